@@ -2,6 +2,7 @@
 #include "apps_container_storage.h"
 #include "global_preferences.h"
 #include "exam_mode_configuration.h"
+#include "shared/curve_view.h"
 #include <ion.h>
 #include <poincare/init.h>
 #include <poincare/exception_checkpoint.h>
@@ -31,7 +32,11 @@ AppsContainer::AppsContainer() :
   m_homeSnapshot(),
   m_onBoardingSnapshot(),
   m_hardwareTestSnapshot(),
-  m_usbConnectedSnapshot()
+  m_usbConnectedSnapshot(),
+  m_isRefiningDrawing(false),
+  m_refinementInterruptedByPoincare(false),
+  m_refinementInterruptingEvent(Ion::Events::None),
+  m_refinementInterruptingKeyboardState(0)
 {
   m_emptyBatteryWindow.setFrame(KDRect(0, 0, Ion::Display::Width, Ion::Display::Height), false);
 #if __EMSCRIPTEN__
@@ -42,17 +47,48 @@ AppsContainer::AppsContainer() :
    * (which makes bigger files to download and slower execution), or
    * whitelisting all the symbols (that's a big amount of symbols to find and
    * quite painy to maintain).
-   * We just remove the circuit breaker for now.
+   * We just remove the circuit breaker for now. The same goes for the curve
+   * views drawing circuit breaker.
    * TODO: Put the Poincare circuit breaker back on epsilon's web emulator */
 #else
   Poincare::Expression::SetCircuitBreaker(AppsContainer::poincareCircuitBreaker);
+  Shared::CurveView::SetDrawingCircuitBreaker(AppsContainer::drawingCircuitBreaker);
 #endif
   Ion::Storage::sharedStorage()->setDelegate(this);
 }
 
 bool AppsContainer::poincareCircuitBreaker() {
   Ion::Keyboard::State state = Ion::Keyboard::scan();
-  return state.keyDown(Ion::Keyboard::Key::Back);
+  bool interrupted = state.keyDown(Ion::Keyboard::Key::Back);
+  if (interrupted) {
+    // The Back key has acted by interrupting the computation
+    sharedAppsContainer()->m_refinementInterruptedByPoincare = true;
+  }
+  return interrupted;
+}
+
+bool AppsContainer::drawingCircuitBreaker() {
+  /* Only the drawings refined while the run loop is idle are interrupted: the
+   * key that triggered the drawing of an event is usually still down. */
+  AppsContainer * container = sharedAppsContainer();
+  if (!container->m_isRefiningDrawing) {
+    return false;
+  }
+  Ion::Keyboard::State state = Ion::Keyboard::scan();
+  if (state == 0) {
+    return false;
+  }
+  /* Ion::Events::getEvent only yields the keys it sees pressed, so the key
+   * that interrupted the refinement is recorded to be dispatched afterwards.
+   * As in getEvent, the key is given by the highest bit of the state. */
+  if (container->m_refinementInterruptingEvent == Ion::Events::None) {
+    Ion::Keyboard::Key key = (Ion::Keyboard::Key)(63-__builtin_clzll(state));
+    bool shift = Ion::Events::isShiftActive() || state.keyDown(Ion::Keyboard::Key::Shift);
+    bool alpha = Ion::Events::isAlphaActive() || state.keyDown(Ion::Keyboard::Key::Alpha);
+    container->m_refinementInterruptingEvent = Ion::Events::Event(key, shift, alpha);
+    container->m_refinementInterruptingKeyboardState = state;
+  }
+  return true;
 }
 
 App::Snapshot * AppsContainer::hardwareTestAppSnapshot() {
@@ -123,6 +159,8 @@ bool AppsContainer::dispatchEvent(Ion::Events::Event event) {
       updateBatteryState();
       if (switchTo(usbConnectedAppSnapshot())) {
         Ion::USB::DFU();
+        // The storage might have been written through DFU
+        Ion::Storage::sharedStorage()->bufferWasModifiedExternally();
         // Update LED when exiting DFU mode
         Ion::LED::updateColorWithPlugAndCharge();
         bool switched = switchTo(activeSnapshot);
@@ -195,6 +233,11 @@ bool AppsContainer::processEvent(Ion::Events::Event event) {
 bool AppsContainer::switchTo(App::Snapshot * snapshot) {
   if (s_activeApp && snapshot != s_activeApp->snapshot()) {
     resetShiftAlphaStatus();
+#if POINCARE_TREE_STATS
+    // The pool statistics are logged for each app when leaving it
+    Poincare::TreePool::sharedPool()->statisticsLog(std::cout, I18n::translate(s_activeApp->snapshot()->descriptor()->name()));
+    Poincare::TreePool::sharedPool()->resetStatistics();
+#endif
   }
   if (snapshot == hardwareTestAppSnapshot() || snapshot == onBoardingAppSnapshot()) {
     m_window.hideTitleBarView(true);
@@ -354,6 +397,24 @@ Window * AppsContainer::window() {
   return &m_window;
 }
 
+bool AppsContainer::refineDrawing() {
+  m_isRefiningDrawing = true;
+  m_refinementInterruptedByPoincare = false;
+  m_refinementInterruptingEvent = Ion::Events::None;
+  bool refined = Container::refineDrawing();
+  m_isRefiningDrawing = false;
+  Ion::Events::Event event = m_refinementInterruptingEvent;
+  m_refinementInterruptingEvent = Ion::Events::None;
+  /* A Back key that interrupted a computation must not act twice, as the
+   * other circuit breakers never replay their key either. */
+  if (event != Ion::Events::None && !m_refinementInterruptedByPoincare) {
+    // Holding the key then repeats the event
+    Ion::Events::didReplayEvent(event, m_refinementInterruptingKeyboardState);
+    dispatchEvent(event);
+  }
+  return refined;
+}
+
 int AppsContainer::numberOfContainerTimers() {
   return 3;
 }
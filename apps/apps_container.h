@@ -25,6 +25,7 @@ public:
   static AppsContainer * sharedAppsContainer();
   AppsContainer();
   static bool poincareCircuitBreaker();
+  static bool drawingCircuitBreaker();
   virtual int numberOfApps() = 0;
   virtual App::Snapshot * appSnapshotAtIndex(int index) = 0;
   App::Snapshot * initialAppSnapshot();
@@ -59,6 +60,7 @@ private:
   Window * window() override;
   int numberOfContainerTimers() override;
   Timer * containerTimerAtIndex(int i) override;
+  bool refineDrawing() override;
   bool processEvent(Ion::Events::Event event);
   void resetShiftAlphaStatus();
   bool updateAlphaLock();
@@ -80,6 +82,10 @@ private:
   OnBoarding::App::Snapshot m_onBoardingSnapshot;
   HardwareTest::App::Snapshot m_hardwareTestSnapshot;
   USB::App::Snapshot m_usbConnectedSnapshot;
+  bool m_isRefiningDrawing;
+  bool m_refinementInterruptedByPoincare;
+  Ion::Events::Event m_refinementInterruptingEvent;
+  Ion::Keyboard::State m_refinementInterruptingKeyboardState;
 };
 
 #endif
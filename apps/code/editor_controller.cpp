@@ -131,13 +131,15 @@ StackViewController * EditorController::stackController() {
 }
 
 void EditorController::cleanStorageEmptySpace() {
-  if (m_script.isNull() || !Ion::Storage::sharedStorage()->hasRecord(m_script)) {
+  if (m_script.isNull() || !Ion::Storage::sharedStorage()->hasRecord(m_script) || m_script.isCompressed()) {
+    // A compressed script has already been cleaned
     return;
   }
   Ion::Storage::Record::Data scriptValue = m_script.value();
   Ion::Storage::sharedStorage()->getAvailableSpaceFromEndOfRecord(
       m_script,
       scriptValue.size - Script::k_importationStatusSize - (strlen(m_script.scriptContent()) + 1)); // TODO optimize number of script fetches
+  m_script.compress();
 }
 
 
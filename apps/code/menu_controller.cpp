@@ -372,6 +372,11 @@ void MenuController::configureScript() {
 void MenuController::editScriptAtIndex(int scriptIndex) {
   assert(scriptIndex >=0 && scriptIndex < m_scriptStore->numberOfScripts());
   Script script = m_scriptStore->scriptAtIndex(scriptIndex);
+  // The editor edits the script in place, which requires it to be uncompressed
+  if (script.decompress() != Script::ErrorStatus::None) {
+    Container::activeApp()->displayWarning(I18n::Message::StorageMemoryFull1, I18n::Message::StorageMemoryFull2);
+    return;
+  }
   m_editorController.setScript(script);
   stackViewController()->push(&m_editorController);
 }
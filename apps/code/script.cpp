@@ -1,5 +1,6 @@
 #include "script.h"
 #include "script_store.h"
+#include <string.h>
 
 namespace Code {
 
@@ -67,20 +68,106 @@ bool Script::nameCompliant(const char * name) {
 
 bool Script::importationStatus() const {
   assert(!isNull());
-  Data d = value();
-  return (((char *)d.buffer)[0] == 1);
+  return (status() & k_importationStatusMask) == 1;
 }
 
 void Script::toggleImportationStatus() {
   Data d = value();
-  ((char *)d.buffer)[0] = (((char *)d.buffer)[0] == 1 ? 0 : 1);
+  ((uint8_t *)d.buffer)[0] ^= k_importationStatusMask;
   setValue(d);
 }
 
+bool Script::BodyIsCompressed(Data d) {
+  const uint8_t * body = (const uint8_t *)d.buffer;
+  return (body[0] & k_compressedFlag) && d.size > k_compressedHeaderSize && body[k_importationStatusSize] == 0;
+}
+
+bool Script::isCompressed() const {
+  assert(!isNull());
+  return BodyIsCompressed(value());
+}
+
+/* The decompression cache holds the body of the last compressed script read,
+ * with its status byte so that it can be written back to the storage as is. It
+ * is keyed by the record and the storage version. */
+static Ion::Storage::Record sCachedRecord;
+static uint32_t sCachedStorageVersion = 0;
+static uint8_t sCachedBody[Script::k_importationStatusSize + Script::k_maxDecompressedContentSize];
+
+static void invalidateCache() {
+  sCachedRecord = Ion::Storage::Record();
+}
+
 const char * Script::scriptContent() const {
   assert(!isNull());
   Data d = value();
-  return (const char *)d.buffer + k_importationStatusSize;
+  const uint8_t * body = (const uint8_t *)d.buffer;
+  if (!BodyIsCompressed(d)) {
+    return (const char *)body + k_importationStatusSize;
+  }
+  uint32_t storageVersion = Ion::Storage::sharedStorage()->version();
+  if (sCachedRecord != *this || sCachedStorageVersion != storageVersion) {
+    uint16_t contentSize;
+    memcpy(&contentSize, body + k_compressedHeaderSize - sizeof(uint16_t), sizeof(uint16_t));
+    sCachedBody[0] = body[0] & ~k_compressedFlag;
+    uint8_t * content = sCachedBody + k_importationStatusSize;
+    // The storage may have been written by other softwares: trust no size
+    if (contentSize == 0 || contentSize > k_maxDecompressedContentSize || Ion::decompress(body + k_compressedHeaderSize, content, d.size - k_compressedHeaderSize, contentSize) != contentSize) {
+      content[0] = 0;
+    } else {
+      content[contentSize - 1] = 0;
+    }
+    sCachedRecord = *this;
+    sCachedStorageVersion = storageVersion;
+  }
+  return (const char *)sCachedBody + k_importationStatusSize;
+}
+
+Script::ErrorStatus Script::decompress() {
+  if (!isCompressed()) {
+    Data d = value();
+    uint8_t * status = (uint8_t *)d.buffer;
+    if (*status & k_compressedFlag) {
+      /* Clear the flag of a script that is not compressed, for it not to be
+       * mistaken for a compressed one once its content is emptied. */
+      *status &= ~k_compressedFlag;
+      return setValue(d);
+    }
+    return ErrorStatus::None;
+  }
+  const char * content = scriptContent();
+  assert(content == (const char *)sCachedBody + k_importationStatusSize);
+  ErrorStatus error = setValue(Data{sCachedBody, k_importationStatusSize + strlen(content) + 1});
+  invalidateCache();
+  return error;
+}
+
+void Script::compress() {
+  if (isCompressed()) {
+    return;
+  }
+  Data d = value();
+  const uint8_t * body = (const uint8_t *)d.buffer;
+  size_t contentSize = strlen((const char *)body + k_importationStatusSize) + 1;
+  if (contentSize < k_compressionThreshold || contentSize > k_maxDecompressedContentSize) {
+    return;
+  }
+  /* Compress in the cache buffer, which is big enough since the compressed
+   * body is required to be smaller than the uncompressed one. */
+  invalidateCache();
+  int compressedSize = Ion::compress(body + k_importationStatusSize, sCachedBody + k_compressedHeaderSize, contentSize, contentSize - (k_compressedHeaderSize - k_importationStatusSize) - 1);
+  if (compressedSize == 0) {
+    // The compression would not save any space
+    return;
+  }
+  sCachedBody[0] = body[0] | k_compressedFlag;
+  sCachedBody[k_importationStatusSize] = 0;
+  uint16_t size = contentSize;
+  memcpy(sCachedBody + k_compressedHeaderSize - sizeof(uint16_t), &size, sizeof(uint16_t));
+  ErrorStatus error = setValue(Data{sCachedBody, k_compressedHeaderSize + compressedSize});
+  // Shrinking a record cannot fail
+  assert(error == ErrorStatus::None);
+  (void)error;
 }
 
 }
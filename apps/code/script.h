@@ -6,7 +6,15 @@
 namespace Code {
 
 /* Record  : | Total Size |  Name |             Body                |
- * Script:                        | AutoImportationStatus | Content |*/
+ * Script:                        | AutoImportationStatus | Content |
+ *
+ * Large scripts are stored compressed with LZ4, which is flagged in the
+ * status byte. A null byte, which cannot start the content of a non-empty
+ * script, and the size of the decompressed content then precede the
+ * compressed content:
+ * Script:                        | Status | 0 | Content size | LZ4 Content |
+ * Scripts written by other softwares may have the flag set without being
+ * compressed: they are told apart by the null byte. */
 
 class Script : public Ion::Storage::Record {
 private:
@@ -15,6 +23,12 @@ private:
   static constexpr int k_defaultScriptNameNumberMaxSize = 2; // Numbers from 1 to 99 have 2 digits max
 public:
   static constexpr size_t k_importationStatusSize = 1;
+  /* Only scripts whose content size (null-terminating char included) lies
+   * between k_compressionThreshold and k_maxDecompressedContentSize are
+   * compressed: smaller ones would not save much space and bigger ones would
+   * not fit in the decompression cache. */
+  static constexpr size_t k_compressionThreshold = 1024;
+  static constexpr size_t k_maxDecompressedContentSize = 4096;
   static constexpr int k_defaultScriptNameMaxSize = 6 + k_defaultScriptNameNumberMaxSize + 1;
   /* 6 = strlen("script")
    * k_defaultScriptNameNumberMaxSize = maxLength of integers between 1 and 99
@@ -26,7 +40,21 @@ public:
   Script(Ion::Storage::Record r) : Record(r) {}
   bool importationStatus() const;
   void toggleImportationStatus();
+  bool isCompressed() const;
+  /* The content of a compressed script is decompressed in a cache, which
+   * remains valid until the storage changes. The content of a corrupted
+   * compressed script is empty. */
   const char * scriptContent() const;
+  /* Compressed scripts have to be decompressed before being edited in place.
+   * compress stores the script compressed if this saves space. */
+  ErrorStatus decompress();
+  void compress();
+private:
+  static constexpr uint8_t k_importationStatusMask = 0x01;
+  static constexpr uint8_t k_compressedFlag = 0x80;
+  static constexpr size_t k_compressedHeaderSize = k_importationStatusSize + 1 + sizeof(uint16_t);
+  static bool BodyIsCompressed(Data d);
+  uint8_t status() const { return *(const uint8_t *)value().buffer; }
 };
 
 }
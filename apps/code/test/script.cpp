@@ -0,0 +1,164 @@
+#include <quiz.h>
+#include <ion.h>
+#include <assert.h>
+#include <string.h>
+#include "../script.h"
+
+using namespace Ion;
+
+namespace Code {
+
+constexpr int k_bodySize = 2001;
+
+/* Fill body with an importation status and a content of k_bodySize-2 chars,
+ * large enough to be compressed. */
+void fill_script_body(char * body, uint8_t status, const char * line) {
+  body[0] = status;
+  int lineLength = strlen(line);
+  for (int i = 1; i < k_bodySize - 1; i++) {
+    body[i] = line[(i - 1) % lineLength];
+  }
+  body[k_bodySize - 1] = 0;
+}
+
+Script create_script(const char * baseName, const char * body, size_t bodySize) {
+  Storage::Record::ErrorStatus error = Storage::sharedStorage()->createRecordWithExtension(baseName, "py", body, bodySize);
+  quiz_assert(error == Storage::Record::ErrorStatus::None);
+  return Script(Storage::sharedStorage()->recordBaseNamedWithExtension(baseName, "py"));
+}
+
+QUIZ_CASE(code_script_compression) {
+  char body[k_bodySize];
+  fill_script_body(body, 1, "def f(x):\n  return x*x\n");
+  Script script = create_script("compressed", body, k_bodySize);
+  quiz_assert(!script.isCompressed());
+
+  script.compress();
+  quiz_assert(script.isCompressed());
+  quiz_assert(script.value().size < k_bodySize/4);
+  quiz_assert(script.importationStatus());
+  quiz_assert(strcmp(script.scriptContent(), body + 1) == 0);
+
+  // The script is edited uncompressed
+  quiz_assert(script.decompress() == Storage::Record::ErrorStatus::None);
+  quiz_assert(!script.isCompressed());
+  quiz_assert(script.value().size == k_bodySize);
+  quiz_assert(memcmp(script.value().buffer, body, k_bodySize) == 0);
+  fill_script_body(body, 1, "def g(x):\n  return x+1\n");
+  quiz_assert(script.setValue(Storage::Record::Data{body, k_bodySize}) == Storage::Record::ErrorStatus::None);
+
+  script.compress();
+  quiz_assert(script.isCompressed());
+  quiz_assert(strcmp(script.scriptContent(), body + 1) == 0);
+  quiz_assert(script.decompress() == Storage::Record::ErrorStatus::None);
+  quiz_assert(memcmp(script.value().buffer, body, k_bodySize) == 0);
+
+  // Small scripts are not compressed
+  const char smallBody[] = "\x01" "from math import *\n";
+  Script smallScript = create_script("small", smallBody, sizeof(smallBody));
+  smallScript.compress();
+  quiz_assert(!smallScript.isCompressed());
+  quiz_assert(strcmp(smallScript.scriptContent(), smallBody + 1) == 0);
+
+  script.destroy();
+  smallScript.destroy();
+}
+
+QUIZ_CASE(code_script_compressed_flag) {
+  // A script written with the compressed flag but an uncompressed content
+  char body[k_bodySize];
+  fill_script_body(body, 0x81, "from math import *\n");
+  Script script = create_script("flagged", body, k_bodySize);
+  quiz_assert(!script.isCompressed());
+  quiz_assert(script.importationStatus());
+  quiz_assert(strcmp(script.scriptContent(), body + 1) == 0);
+
+  // The flag is cleared before the script is edited
+  quiz_assert(script.decompress() == Storage::Record::ErrorStatus::None);
+  quiz_assert(*(const uint8_t *)script.value().buffer == 0x01);
+  quiz_assert(strcmp(script.scriptContent(), body + 1) == 0);
+
+  // The flag of a compressed script does not leak into its status
+  script.compress();
+  quiz_assert(script.isCompressed());
+  quiz_assert(script.decompress() == Storage::Record::ErrorStatus::None);
+  quiz_assert(*(const uint8_t *)script.value().buffer == 0x01);
+
+  // An empty script with the flag set
+  const char emptyBody[] = "\x80";
+  Script emptyScript = create_script("empty", emptyBody, sizeof(emptyBody));
+  quiz_assert(!emptyScript.isCompressed());
+  quiz_assert(strcmp(emptyScript.scriptContent(), "") == 0);
+
+  script.destroy();
+  emptyScript.destroy();
+}
+
+QUIZ_CASE(code_script_corrupted_compressed_content) {
+  char body[k_bodySize];
+  fill_script_body(body, 0, "print('hello')\n");
+  Script script = create_script("corrupted", body, k_bodySize);
+  script.compress();
+  quiz_assert(script.isCompressed());
+  Storage::Record::Data d = script.value();
+  constexpr size_t k_contentSizeOffset = 2;
+  uint8_t compressedBody[k_bodySize];
+  memcpy(compressedBody, d.buffer, d.size);
+
+  // The content size exceeds the decompression cache
+  uint16_t contentSize = Script::k_maxDecompressedContentSize + 1;
+  memcpy(compressedBody + k_contentSizeOffset, &contentSize, sizeof(uint16_t));
+  quiz_assert(script.setValue(Storage::Record::Data{compressedBody, d.size}) == Storage::Record::ErrorStatus::None);
+  quiz_assert(strcmp(script.scriptContent(), "") == 0);
+
+  // The content size does not match the LZ4 content
+  contentSize = k_bodySize;
+  memcpy(compressedBody + k_contentSizeOffset, &contentSize, sizeof(uint16_t));
+  quiz_assert(script.setValue(Storage::Record::Data{compressedBody, d.size}) == Storage::Record::ErrorStatus::None);
+  quiz_assert(strcmp(script.scriptContent(), "") == 0);
+
+  // The LZ4 content is truncated
+  contentSize = k_bodySize - 1;
+  memcpy(compressedBody + k_contentSizeOffset, &contentSize, sizeof(uint16_t));
+  quiz_assert(script.setValue(Storage::Record::Data{compressedBody, d.size - 8}) == Storage::Record::ErrorStatus::None);
+  quiz_assert(strcmp(script.scriptContent(), "") == 0);
+
+  // The LZ4 content is intact
+  quiz_assert(script.setValue(Storage::Record::Data{compressedBody, d.size}) == Storage::Record::ErrorStatus::None);
+  quiz_assert(strcmp(script.scriptContent(), body + 1) == 0);
+
+  script.destroy();
+}
+
+QUIZ_CASE(code_script_decompression_cache) {
+  char body1[k_bodySize];
+  fill_script_body(body1, 0, "from math import *\n");
+  Script script1 = create_script("cached1", body1, k_bodySize);
+  script1.compress();
+  char body2[k_bodySize];
+  fill_script_body(body2, 0, "from turtle import *\n");
+  Script script2 = create_script("cached2", body2, k_bodySize);
+  script2.compress();
+  quiz_assert(script1.isCompressed() && script2.isCompressed());
+
+  // Both scripts share the single entry of the cache
+  const char * content1 = script1.scriptContent();
+  quiz_assert(strcmp(content1, body1 + 1) == 0);
+  quiz_assert(script1.scriptContent() == content1);
+  const char * content2 = script2.scriptContent();
+  quiz_assert(content2 == content1);
+  quiz_assert(strcmp(content2, body2 + 1) == 0);
+  quiz_assert(strcmp(script1.scriptContent(), body1 + 1) == 0);
+
+  // The cache is refreshed when the storage changes
+  fill_script_body(body1, 0, "from random import *\n");
+  quiz_assert(script1.setValue(Storage::Record::Data{body1, k_bodySize}) == Storage::Record::ErrorStatus::None);
+  script1.compress();
+  quiz_assert(script1.isCompressed());
+  quiz_assert(strcmp(script1.scriptContent(), body1 + 1) == 0);
+
+  script1.destroy();
+  script2.destroy();
+}
+
+}
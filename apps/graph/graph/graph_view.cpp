@@ -9,6 +9,7 @@ namespace Graph {
 GraphView::GraphView(InteractiveCurveViewRange * graphRange,
   CurveViewCursor * cursor, Shared::BannerView * bannerView, CursorView * cursorView) :
   FunctionGraphView(graphRange, cursor, bannerView, cursorView),
+  m_nextSampleCache(0),
   m_tangent(false)
 {
 }
@@ -53,11 +54,20 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
 
     // Cartesian
     if (type == Shared::ContinuousFunction::PlotType::Cartesian) {
+      SampleCache * cache = sampleCacheForRecord(record);
+      cache->bind(f.operator->(), pixelWidth(), context());
       drawCartesianCurve(ctx, rect, tmin, tmax, [](float t, void * model, void * context) {
-            ContinuousFunction * f = (ContinuousFunction *)model;
-            Poincare::Context * c = (Poincare::Context *)context;
-            return f->evaluateXYAtParameter(t, c);
-          }, f.operator->(), context(), f->color(), true, record == m_selectedRecord, m_highlightedStart, m_highlightedEnd);
+            SampleCache * cache = (SampleCache *)model;
+            return cache->function()->evaluateXYAtParameter(t, cache->context());
+          }, cache, nullptr, f->color(), true, record == m_selectedRecord, m_highlightedStart, m_highlightedEnd,
+          [](const float * t, int numberOfParameters, Poincare::Coordinate2D<float> * xy, void * model, void * context) {
+            SampleCache * cache = (SampleCache *)model;
+            cache->evaluateXYAtParameters(t, numberOfParameters, xy);
+          },
+          [](float t1, float t2, Poincare::Coordinate2D<float> * xyMin, Poincare::Coordinate2D<float> * xyMax, void * model, void * context) {
+            SampleCache * cache = (SampleCache *)model;
+            return cache->function()->enclosureOnParameterInterval(t1, t2, xyMin, xyMax, cache->context());
+          });
       /* Draw tangent */
       if (m_tangent && record == m_selectedRecord) {
         float tangentParameter[2];
@@ -79,8 +89,29 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
         ContinuousFunction * f = (ContinuousFunction *)model;
         Poincare::Context * c = (Poincare::Context *)context;
         return f->evaluateXYAtParameter(t, c);
-      }, f.operator->(), context(), false, f->color());
+      }, f.operator->(), context(), false, f->color(), true, false, 0.0f, 0.0f,
+      [](const float * t, int numberOfParameters, Poincare::Coordinate2D<float> * xy, void * model, void * context) {
+        ContinuousFunction * f = (ContinuousFunction *)model;
+        Poincare::Context * c = (Poincare::Context *)context;
+        f->evaluateXYAtParameters(t, numberOfParameters, xy, c);
+      },
+      [](float t1, float t2, Poincare::Coordinate2D<float> * xyMin, Poincare::Coordinate2D<float> * xyMax, void * model, void * context) {
+        ContinuousFunction * f = (ContinuousFunction *)model;
+        Poincare::Context * c = (Poincare::Context *)context;
+        return f->enclosureOnParameterInterval(t1, t2, xyMin, xyMax, c);
+      });
+  }
+}
+
+SampleCache * GraphView::sampleCacheForRecord(Ion::Storage::Record record) const {
+  for (int i = 0; i < k_numberOfSampleCaches; i++) {
+    if (m_sampleCaches[i].isBoundTo(record)) {
+      return &m_sampleCaches[i];
+    }
   }
+  SampleCache * cache = &m_sampleCaches[m_nextSampleCache];
+  m_nextSampleCache = (m_nextSampleCache + 1) % k_numberOfSampleCaches;
+  return cache;
 }
 
 }
@@ -2,6 +2,7 @@
 #define GRAPH_GRAPH_VIEW_H
 
 #include "../../shared/function_graph_view.h"
+#include "sample_cache.h"
 
 namespace Graph {
 
@@ -18,6 +19,14 @@ public:
    * of the graph where the area under the curve is colored. */
   void setAreaHighlightColor(bool highlightColor) override {};
 private:
+  bool movesDrawnPixelsOnPan() const override { return true; }
+  bool drawsProgressively() const override { return true; }
+  /* The samples of the last drawn cartesian functions are kept so that
+   * redrawing a part of the view or panning it does not evaluate them again. */
+  constexpr static int k_numberOfSampleCaches = 4;
+  SampleCache * sampleCacheForRecord(Ion::Storage::Record record) const;
+  mutable SampleCache m_sampleCaches[k_numberOfSampleCaches];
+  mutable int m_nextSampleCache;
   bool m_tangent;
 };
 
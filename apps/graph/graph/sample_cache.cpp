@@ -0,0 +1,155 @@
+#include "sample_cache.h"
+#include <assert.h>
+#include <cmath>
+#include <string.h>
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Graph {
+
+SampleCache::SampleCache() :
+  m_record(),
+  m_function(nullptr),
+  m_context(nullptr),
+  m_checksum(0),
+  m_contextVersion(Context::k_noVersion),
+  m_tStep(NAN),
+  m_tMin(NAN),
+  m_tMax(NAN),
+  m_angleUnit(Preferences::AngleUnit::Radian),
+  m_complexFormat(Preferences::ComplexFormat::Real),
+  m_firstIndex(0)
+{
+  reset();
+}
+
+void SampleCache::bind(ContinuousFunction * function, float tStep, Context * context) {
+  assert(function->plotType() == ContinuousFunction::PlotType::Cartesian);
+  m_function = function;
+  m_context = context;
+  Ion::Storage::Record record = *function;
+  uint32_t checksum = record.checksum();
+  uint32_t contextVersion = context->version();
+  float tMin = function->tMin();
+  float tMax = function->tMax();
+  Preferences * preferences = Preferences::sharedPreferences();
+  if (record == m_record
+   && checksum == m_checksum
+   && contextVersion != Context::k_noVersion
+   && contextVersion == m_contextVersion
+   && tStep == m_tStep
+   && tMin == m_tMin
+   && tMax == m_tMax
+   && preferences->angleUnit() == m_angleUnit
+   && preferences->complexFormat() == m_complexFormat) {
+    return;
+  }
+  m_record = record;
+  m_checksum = checksum;
+  m_contextVersion = contextVersion;
+  m_tStep = tStep;
+  m_tMin = tMin;
+  m_tMax = tMax;
+  m_angleUnit = preferences->angleUnit();
+  m_complexFormat = preferences->complexFormat();
+  reset();
+}
+
+void SampleCache::evaluateXYAtParameters(const float * t, int numberOfParameters, Coordinate2D<float> * xy) {
+  assert(m_function != nullptr);
+  int misses[k_maxNumberOfMisses];
+  int numberOfMisses = 0;
+  for (int i = 0; i < numberOfParameters; i++) {
+    int index;
+    if (sampleIndex(t[i], &index) && isValid(index)) {
+      xy[i] = Coordinate2D<float>(t[i], m_samples[slot(index)]);
+      continue;
+    }
+    misses[numberOfMisses++] = i;
+    if (numberOfMisses == k_maxNumberOfMisses) {
+      evaluateMisses(t, misses, numberOfMisses, xy);
+      numberOfMisses = 0;
+    }
+  }
+  evaluateMisses(t, misses, numberOfMisses, xy);
+}
+
+void SampleCache::reset() {
+  m_firstIndex = 0;
+  memset(m_validSlots, 0, sizeof(m_validSlots));
+}
+
+bool SampleCache::sampleIndex(float t, int * index) const {
+  float q = t / m_tStep;
+  if (!(std::fabs(q) < k_maxSampleIndex)) {
+    return false;
+  }
+  float roundedQ = std::round(q);
+  if (std::fabs(q - roundedQ) > k_sampleIndexRelativeTolerance * (std::fabs(roundedQ) + k_capacity)) {
+    return false;
+  }
+  *index = static_cast<int>(roundedQ);
+  return true;
+}
+
+int SampleCache::slot(int index) const {
+  int s = index % k_capacity;
+  return s < 0 ? s + k_capacity : s;
+}
+
+bool SampleCache::isValid(int index) const {
+  if (index < m_firstIndex || index >= m_firstIndex + k_capacity) {
+    return false;
+  }
+  int s = slot(index);
+  return (m_validSlots[s / 8] >> (s % 8)) & 1;
+}
+
+void SampleCache::store(int index, float y) {
+  /* Slide the window of cached indexes to include index, dropping the samples
+   * that leave it. */
+  int shift = 0;
+  int firstDroppedIndex = 0;
+  if (index >= m_firstIndex + k_capacity) {
+    shift = index - (m_firstIndex + k_capacity) + 1;
+    firstDroppedIndex = m_firstIndex;
+    m_firstIndex += shift;
+  } else if (index < m_firstIndex) {
+    shift = m_firstIndex - index;
+    m_firstIndex = index;
+    firstDroppedIndex = m_firstIndex + k_capacity;
+  }
+  if (shift >= k_capacity) {
+    memset(m_validSlots, 0, sizeof(m_validSlots));
+  } else {
+    for (int i = firstDroppedIndex; i < firstDroppedIndex + shift; i++) {
+      int s = slot(i);
+      m_validSlots[s / 8] &= ~(1 << (s % 8));
+    }
+  }
+  int s = slot(index);
+  m_samples[s] = y;
+  m_validSlots[s / 8] |= 1 << (s % 8);
+}
+
+void SampleCache::evaluateMisses(const float * t, const int * parameterIndexes, int numberOfMisses, Coordinate2D<float> * xy) {
+  if (numberOfMisses == 0) {
+    return;
+  }
+  float missingT[k_maxNumberOfMisses];
+  Coordinate2D<float> missingXY[k_maxNumberOfMisses];
+  for (int i = 0; i < numberOfMisses; i++) {
+    missingT[i] = t[parameterIndexes[i]];
+  }
+  m_function->evaluateXYAtParameters(missingT, numberOfMisses, missingXY, m_context);
+  for (int i = 0; i < numberOfMisses; i++) {
+    xy[parameterIndexes[i]] = missingXY[i];
+    int index;
+    if (sampleIndex(missingT[i], &index)) {
+      store(index, missingXY[i].x2());
+    }
+  }
+}
+
+}
@@ -0,0 +1,66 @@
+#ifndef GRAPH_SAMPLE_CACHE_H
+#define GRAPH_SAMPLE_CACHE_H
+
+#include "../../shared/continuous_function.h"
+#include <ion/display.h>
+#include <poincare/preferences.h>
+#include <float.h>
+
+namespace Graph {
+
+/* A SampleCache keeps the samples of a cartesian function that
+ * CurveView::drawCartesianCurve evaluated at the multiples of the pixel width,
+ * for the abscissae of one screen width. Panning the graph, moving the cursor
+ * or toggling the tangent then only evaluates the function on the abscissae
+ * that were not displayed yet.
+ * The samples are dropped when the record checksum, the version of the
+ * context, the pixel width, the function domain or the angle unit and complex
+ * format preferences change. */
+
+class SampleCache {
+public:
+  SampleCache();
+  /* Prepare the cache to provide the samples of function at multiples of
+   * tStep, keeping the previous samples if they still apply. */
+  void bind(Shared::ContinuousFunction * function, float tStep, Poincare::Context * context);
+  bool isBoundTo(Ion::Storage::Record record) const { return !m_record.isNull() && m_record == record; }
+  Shared::ContinuousFunction * function() const { return m_function; }
+  Poincare::Context * context() const { return m_context; }
+  void evaluateXYAtParameters(const float * t, int numberOfParameters, Poincare::Coordinate2D<float> * xy);
+private:
+  constexpr static int k_capacity = Ion::Display::Width + 32;
+  constexpr static int k_maxNumberOfMisses = 16;
+  /* Beyond k_maxSampleIndex, the abscissa computed by the curve view is not
+   * precise enough to tell which multiple of tStep it stands for. */
+  constexpr static float k_maxSampleIndex = 1 << 18;
+  /* The abscissae tStart + i*tStep of the curve view are multiples of tStep
+   * up to the rounding of a few float operations on indexes of the order of
+   * the sample index plus a screen width. Other abscissae, such as the bounds
+   * of the function domain, are evaluated without being cached. */
+  constexpr static float k_sampleIndexRelativeTolerance = 4.0f * FLT_EPSILON;
+  void reset();
+  bool sampleIndex(float t, int * index) const;
+  int slot(int index) const;
+  bool isValid(int index) const;
+  void store(int index, float y);
+  void evaluateMisses(const float * t, const int * parameterIndexes, int numberOfMisses, Poincare::Coordinate2D<float> * xy);
+  Ion::Storage::Record m_record;
+  Shared::ContinuousFunction * m_function;
+  Poincare::Context * m_context;
+  uint32_t m_checksum;
+  uint32_t m_contextVersion;
+  float m_tStep;
+  float m_tMin;
+  float m_tMax;
+  Poincare::Preferences::AngleUnit m_angleUnit;
+  Poincare::Preferences::ComplexFormat m_complexFormat;
+  /* The cached samples have indexes in [m_firstIndex, m_firstIndex+k_capacity[
+   * and the sample of index i is stored in slot i modulo k_capacity. */
+  int m_firstIndex;
+  float m_samples[k_capacity];
+  uint8_t m_validSlots[(k_capacity + 7) / 8];
+};
+
+}
+
+#endif
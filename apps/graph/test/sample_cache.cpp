@@ -0,0 +1,111 @@
+#include <quiz.h>
+#include <apps/shared/global_context.h>
+#include <poincare/rational.h>
+#include <poincare/symbol.h>
+#include <assert.h>
+#include <cmath>
+#include "../graph/sample_cache.h"
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Graph {
+
+void assert_cached_samples_are(SampleCache * cache, const float * t, int numberOfParameters, const float * expectedY) {
+  constexpr int maxNumberOfParameters = 8;
+  assert(numberOfParameters <= maxNumberOfParameters);
+  Coordinate2D<float> xy[maxNumberOfParameters];
+  /* Evaluate twice so that the second evaluation reads the samples stored by
+   * the first one. */
+  for (int j = 0; j < 2; j++) {
+    cache->evaluateXYAtParameters(t, numberOfParameters, xy);
+    for (int i = 0; i < numberOfParameters; i++) {
+      quiz_assert(xy[i].x1() == t[i]);
+      quiz_assert(xy[i].x2() == expectedY[i]);
+    }
+  }
+}
+
+QUIZ_CASE(graph_sample_cache) {
+  GlobalContext context;
+  Ion::Storage::Record::ErrorStatus error;
+  ContinuousFunction f = ContinuousFunction::NewModel(&error);
+  assert(error == Ion::Storage::Record::ErrorStatus::None);
+  f.setContent("x^2", &context);
+  SampleCache cache;
+  cache.bind(&f, 0.5f, &context);
+  quiz_assert(cache.isBoundTo(f));
+
+  const float t1[] = {-1.0f, -0.5f, 0.0f, 0.5f, 1.0f};
+  const float y1[] = {1.0f, 0.25f, 0.0f, 0.25f, 1.0f};
+  assert_cached_samples_are(&cache, t1, 5, y1);
+
+  // Panned view: some samples are cached, the window slides on the others
+  const float t2[] = {0.5f, 1.0f, 150.0f, 200.0f, 200.5f};
+  const float y2[] = {0.25f, 1.0f, 22500.0f, 40000.0f, 40200.25f};
+  assert_cached_samples_are(&cache, t2, 5, y2);
+  const float t3[] = {-200.0f, 0.25f, 1.0f};
+  const float y3[] = {40000.0f, 0.0625f, 1.0f};
+  assert_cached_samples_are(&cache, t3, 3, y3);
+
+  // Abscissae close to a multiple of the step are neither served nor stored
+  const float t4[] = {10.02f, 0.52f};
+  Coordinate2D<float> xy4[2];
+  cache.evaluateXYAtParameters(t4, 2, xy4);
+  quiz_assert(xy4[0].x2() > 100.0f && xy4[1].x2() > 0.25f);
+  const float t5[] = {10.0f, 0.5f};
+  const float y5[] = {100.0f, 0.25f};
+  assert_cached_samples_are(&cache, t5, 2, y5);
+
+  // Multiples of the step computed as the curve view does are cached
+  const float tStart = std::floor(-3.3f / 0.5f) * 0.5f;
+  const float t6[] = {tStart + 3 * 0.5f, tStart + 8 * 0.5f};
+  const float y6[] = {4.0f, 0.25f};
+  assert_cached_samples_are(&cache, t6, 2, y6);
+
+  // Editing the function drops the samples
+  f.setContent("x^3", &context);
+  cache.bind(&f, 0.5f, &context);
+  const float y7[] = {-1.0f, -0.125f, 0.0f, 0.125f, 1.0f};
+  assert_cached_samples_are(&cache, t1, 5, y7);
+
+  // Defining a variable used by the function drops the samples
+  f.setContent("x+a", &context);
+  cache.bind(&f, 0.5f, &context);
+  Coordinate2D<float> xy[1];
+  cache.evaluateXYAtParameters(t1, 1, xy);
+  quiz_assert(std::isnan(xy[0].x2()));
+  context.setExpressionForSymbolAbstract(Rational::Builder(3), Symbol::Builder('a'));
+  f.tidy();
+  cache.bind(&f, 0.5f, &context);
+  const float y8[] = {2.0f, 2.5f, 3.0f, 3.5f, 4.0f};
+  assert_cached_samples_are(&cache, t1, 5, y8);
+
+  /* Multiples of a step that is not a float, computed from two different
+   * starts, are served from the cache: the function is edited without binding
+   * the cache again, so that the served samples are the former ones. */
+  constexpr float step = 0.1f;
+  cache.bind(&f, step, &context);
+  constexpr int numberOfSamples = 4;
+  float t9[numberOfSamples];
+  float t10[numberOfSamples];
+  Coordinate2D<float> xy9[numberOfSamples];
+  Coordinate2D<float> xy10[numberOfSamples];
+  const float tStart9 = std::floor(-0.73f / step) * step;
+  const float tStart10 = std::floor(-0.53f / step) * step;
+  for (int i = 0; i < numberOfSamples; i++) {
+    t9[i] = tStart9 + (2 * i) * step;
+    t10[i] = tStart10 + (2 * i - 2) * step;
+  }
+  cache.evaluateXYAtParameters(t9, numberOfSamples, xy9);
+  f.setContent("x", &context);
+  cache.evaluateXYAtParameters(t10, numberOfSamples, xy10);
+  for (int i = 0; i < numberOfSamples; i++) {
+    quiz_assert(xy10[i].x2() == xy9[i].x2());
+    quiz_assert(std::fabs(xy10[i].x2() - 3.0f - t10[i]) < 1e-5f);
+  }
+
+  Ion::Storage::sharedStorage()->destroyAllRecords();
+}
+
+}
@@ -281,6 +281,32 @@ void ValuesController::fillMemoizedBuffer(int column, int row, int index) {
       evaluationX = eval.x1();
     }
   }
+  printEvaluationInMemoizedBuffer(index, evaluationX, evaluationY, isParametric);
+}
+
+void ValuesController::fillMemoizedBuffers(int column, const int * rows, const int * indexes, int numberOfCells) {
+  bool isDerivative = false;
+  Ion::Storage::Record record = recordAtColumn(column, &isDerivative);
+  if (isDerivative) {
+    Shared::ValuesController::fillMemoizedBuffers(column, rows, indexes, numberOfCells);
+    return;
+  }
+  assert(numberOfCells <= k_maxNumberOfDisplayableRows);
+  Shared::Interval * interval = intervalAtColumn(column);
+  double abscissae[k_maxNumberOfDisplayableRows];
+  for (int i = 0; i < numberOfCells; i++) {
+    abscissae[i] = interval->element(rows[i]-1); // Subtract the title row from row to get the element index
+  }
+  Poincare::Coordinate2D<double> evaluations[k_maxNumberOfDisplayableRows];
+  Shared::ExpiringPointer<ContinuousFunction> function = functionStore()->modelForRecord(record);
+  function->evaluate2DAtParameters(abscissae, numberOfCells, evaluations, textFieldDelegateApp()->localContext());
+  bool isParametric = function->plotType() == ContinuousFunction::PlotType::Parametric;
+  for (int i = 0; i < numberOfCells; i++) {
+    printEvaluationInMemoizedBuffer(indexes[i], isParametric ? evaluations[i].x1() : NAN, evaluations[i].x2(), isParametric);
+  }
+}
+
+void ValuesController::printEvaluationInMemoizedBuffer(int index, double evaluationX, double evaluationY, bool isParametric) {
   char * buffer = memoizedBufferAtIndex(index);
   int numberOfChar = 0;
   if (isParametric) {
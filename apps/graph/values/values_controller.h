@@ -86,6 +86,8 @@ private:
   int valuesColumnForAbsoluteColumn(int column) override;
   int absoluteColumnForValuesColumn(int column) override;
   void fillMemoizedBuffer(int i, int j, int index) override;
+  void fillMemoizedBuffers(int i, const int * rows, const int * indexes, int numberOfCells) override;
+  void printEvaluationInMemoizedBuffer(int index, double evaluationX, double evaluationY, bool isParametric);
 
   // Parameter controllers
   ViewController * functionParameterController() override;
@@ -1,6 +1,8 @@
 #include "apps_container.h"
 #include "global_preferences.h"
 #include <poincare/init.h>
+#include <poincare/tree_pool.h>
+#include <stdlib.h>
 
 #define DUMMY_MAIN 0
 #if DUMMY_MAIN
@@ -41,6 +43,13 @@ void ion_main(int argc, const char * const argv[]) {
       }
       continue;
     }
+    /* Option should be given at run-time:
+     * $ ./epsilon.elf --pool-capacity 32768
+     * The capacity is clamped to the size of the TreePool buffer. */
+    if (strcmp(argv[i], "--pool-capacity") == 0 && argc > i+1) {
+      Poincare::TreePool::sharedPool()->setCapacity(atoi(argv[i+1]));
+      continue;
+    }
     /* Option should be given at run-time:
      * $ ./epsilon.elf --[app_name]-[option] [arguments]
      * For example:
@@ -12,6 +12,7 @@ public:
   GraphView(Store * store, Shared::CurveViewCursor * cursor, Shared::BannerView * bannerView, Shared::CursorView * cursorView);
   void drawRect(KDContext * ctx, KDRect rect) const override;
 private:
+  bool movesDrawnPixelsOnPan() const override { return true; }
   char * label(Axis axis, int index) const override;
   Store * m_store;
   char m_xLabels[k_maxNumberOfXLabels][k_labelBufferMaxSize];
@@ -23,7 +23,9 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
     float rectXMin = pixelToFloat(Axis::Horizontal, rect.left() - k_externRectMargin);
     rectXMin = rectXMin < 0 ? 0 : rectXMin;
     float rectXMax = pixelToFloat(Axis::Horizontal, rect.right() + k_externRectMargin);
-    for (int x = rectXMin; x < rectXMax; x += step) {
+    /* Dots are drawn at multiples of step so that drawing a part of the view
+     * draws the same dots as drawing all of it. */
+    for (int x = std::ceil(rectXMin/step)*step; x < rectXMax; x += step) {
       float y = s->evaluateXYAtParameter((float)x, context()).x2();
       if (std::isnan(y)) {
         continue;
@@ -12,6 +12,7 @@ public:
     Shared::CurveViewCursor * cursor, Shared::BannerView * bannerView, Shared::CursorView * cursorView);
   void drawRect(KDContext * ctx, KDRect rect) const override;
 private:
+  bool movesDrawnPixelsOnPan() const override { return true; }
   SequenceStore * m_sequenceStore;
 };
 
@@ -46,6 +46,7 @@ void Sequence::setType(Type t) {
     setInitialRank(0);
   }
   recordData()->setType(t);
+  valueDidChangeInPlace();
   tidy();
   /* Reset all contents */
   switch (t) {
@@ -75,6 +76,7 @@ void Sequence::setType(Type t) {
 
 void Sequence::setInitialRank(int rank) {
   recordData()->setInitialRank(rank);
+  valueDidChangeInPlace();
   m_firstInitialCondition.tidyName();
   m_secondInitialCondition.tidyName();
 }
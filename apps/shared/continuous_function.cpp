@@ -13,6 +13,7 @@
 #include <ion/unicode/utf8_decoder.h>
 #include <apps/i18n.h>
 #include <float.h>
+#include <algorithm>
 #include <cmath>
 
 using namespace Poincare;
@@ -127,6 +128,7 @@ void ContinuousFunction::setPlotType(PlotType newPlotType, Poincare::Preferences
   }
 
   recordData()->setPlotType(newPlotType);
+  valueDidChangeInPlace();
 
   // Recompute the layouts
   m_model.tidy();
@@ -193,6 +195,20 @@ Poincare::Coordinate2D<T> ContinuousFunction::privateEvaluateXYAtParameter(T t,
     return x1x2;
   }
   assert(type == PlotType::Polar);
+  return PolarToCartesian(x1x2);
+}
+
+void ContinuousFunction::evaluateXYAtParameters(const float * t, int numberOfParameters, Poincare::Coordinate2D<float> * xy, Poincare::Context * context) const {
+  templatedApproximateAtParameters(t, numberOfParameters, xy, context);
+  if (plotType() == PlotType::Polar) {
+    for (int i = 0; i < numberOfParameters; i++) {
+      xy[i] = PolarToCartesian(xy[i]);
+    }
+  }
+}
+
+template <typename T>
+Poincare::Coordinate2D<T> ContinuousFunction::PolarToCartesian(Poincare::Coordinate2D<T> thetaR) {
   T factor = (T)1.0;
   Preferences::AngleUnit angleUnit = Preferences::sharedPreferences()->angleUnit();
   if (angleUnit == Preferences::AngleUnit::Degree) {
@@ -202,8 +218,8 @@ Poincare::Coordinate2D<T> ContinuousFunction::privateEvaluateXYAtParameter(T t,
   } else {
     assert(angleUnit == Preferences::AngleUnit::Radian);
   }
-  const float angle = x1x2.x1()*factor;
-  return Coordinate2D<T>(x1x2.x2() * std::cos(angle), x1x2.x2() * std::sin(angle));
+  const float angle = thetaR.x1()*factor;
+  return Coordinate2D<T>(thetaR.x2() * std::cos(angle), thetaR.x2() * std::sin(angle));
 }
 
 bool ContinuousFunction::displayDerivative() const {
@@ -211,7 +227,8 @@ bool ContinuousFunction::displayDerivative() const {
 }
 
 void ContinuousFunction::setDisplayDerivative(bool display) {
-  return recordData()->setDisplayDerivative(display);
+  recordData()->setDisplayDerivative(display);
+  valueDidChangeInPlace();
 }
 
 int ContinuousFunction::printValue(double cursorT, double cursorX, double cursorY, char * buffer, int bufferSize, int precision, Poincare::Context * context) {
@@ -254,10 +271,12 @@ float ContinuousFunction::tMax() const {
 
 void ContinuousFunction::setTMin(float tMin) {
   recordData()->setTMin(tMin);
+  valueDidChangeInPlace();
 }
 
 void ContinuousFunction::setTMax(float tMax) {
   recordData()->setTMax(tMax);
+  valueDidChangeInPlace();
 }
 
 void * ContinuousFunction::Model::expressionAddress(const Ion::Storage::Record * record) const {
@@ -268,6 +287,37 @@ size_t ContinuousFunction::Model::expressionSize(const Ion::Storage::Record * re
   return record->value().size-sizeof(RecordDataBuffer);
 }
 
+void ContinuousFunction::Model::tidy() const {
+  ExpressionModel::tidy();
+  m_compiledExpression.reset();
+  m_compilationFailed = false;
+}
+
+const CompiledExpression * ContinuousFunction::Model::compiledExpression(const Expression e, Context * context) const {
+  /* Parametric functions are compiled as two expressions sharing the complex
+   * format of the first one. */
+  bool parametric = e.type() == ExpressionNode::Type::Matrix;
+  const Expression expressions[CompiledExpression::k_maxNumberOfOutputs] = {
+    parametric ? e.childAtIndex(0) : e,
+    parametric ? e.childAtIndex(1) : Expression()
+  };
+  Preferences * preferences = Preferences::sharedPreferences();
+  Preferences::ComplexFormat complexFormat = Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), expressions[0], context);
+  Preferences::AngleUnit angleUnit = preferences->angleUnit();
+  if (m_compiledExpression.isCompiledFor(complexFormat, angleUnit)) {
+    return &m_compiledExpression;
+  }
+  if (m_compilationFailed) {
+    return nullptr;
+  }
+  constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
+  char unknown[bufferSize];
+  SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknown);
+  m_compilationFailed = (parametric && Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), expressions[1], context) != complexFormat)
+    || !m_compiledExpression.compile(expressions, parametric ? 2 : 1, unknown, context, complexFormat, angleUnit);
+  return m_compilationFailed ? nullptr : &m_compiledExpression;
+}
+
 ContinuousFunction::RecordDataBuffer * ContinuousFunction::recordData() const {
   assert(!isNull());
   Ion::Storage::Record::Data d = value();
@@ -279,11 +329,77 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Poincar
   if (t < tMin() || t > tMax()) {
     return Coordinate2D<T>(plotType() == PlotType::Cartesian ? t : NAN, NAN);
   }
+  return approximateReducedExpressionAtParameter(t, context);
+}
+
+template<typename T>
+void ContinuousFunction::templatedApproximateAtParameters(const T * t, int numberOfParameters, Coordinate2D<T> * results, Poincare::Context * context) const {
+  const CompiledExpression * compiledExpression = m_model.compiledExpression(expressionReduced(context), context);
+  if (compiledExpression == nullptr) {
+    for (int i = 0; i < numberOfParameters; i++) {
+      results[i] = templatedApproximateAtParameter(t[i], context);
+    }
+    return;
+  }
+  PlotType type = plotType();
+  T min = tMin();
+  T max = tMax();
+  T values[CompiledExpression::k_maxNumberOfOutputs][CompiledExpression::k_batchSize];
+  T * const outputs[CompiledExpression::k_maxNumberOfOutputs] = {values[0], values[1]};
+  for (int batchStart = 0; batchStart < numberOfParameters; batchStart += CompiledExpression::k_batchSize) {
+    const T * batchT = t + batchStart;
+    const int batchSize = std::min(numberOfParameters - batchStart, int(CompiledExpression::k_batchSize));
+    compiledExpression->approximateWithValuesForSymbol(batchT, batchSize, outputs);
+    for (int i = 0; i < batchSize; i++) {
+      Coordinate2D<T> * result = results + batchStart + i;
+      if (batchT[i] < min || batchT[i] > max) {
+        *result = Coordinate2D<T>(type == PlotType::Cartesian ? batchT[i] : NAN, NAN);
+      } else {
+        *result = type == PlotType::Parametric ? Coordinate2D<T>(values[0][i], values[1][i]) : Coordinate2D<T>(batchT[i], values[0][i]);
+      }
+    }
+  }
+}
+
+template<typename T>
+bool ContinuousFunction::templatedEnclosureOnParameterInterval(T t1, T t2, Coordinate2D<T> * xyMin, Coordinate2D<T> * xyMax, Context * context) const {
+  assert(t1 <= t2);
+  PlotType type = plotType();
+  const CompiledExpression * compiledExpression = m_model.compiledExpression(expressionReduced(context), context);
+  if (type == PlotType::Polar || compiledExpression == nullptr) {
+    return false;
+  }
+  // The function is undefined out of [tMin, tMax]
+  T t1InDomain = t1 > tMin() ? t1 : tMin();
+  T t2InDomain = t2 < tMax() ? t2 : tMax();
+  T min[CompiledExpression::k_maxNumberOfOutputs] = {INFINITY, INFINITY};
+  T max[CompiledExpression::k_maxNumberOfOutputs] = {-INFINITY, -INFINITY};
+  if (t1InDomain <= t2InDomain && !compiledExpression->approximateOnInterval(t1InDomain, t2InDomain, min, max)) {
+    return false;
+  }
+  if (type == PlotType::Parametric) {
+    *xyMin = Coordinate2D<T>(min[0], min[1]);
+    *xyMax = Coordinate2D<T>(max[0], max[1]);
+  } else {
+    *xyMin = Coordinate2D<T>(t1, min[0]);
+    *xyMax = Coordinate2D<T>(t2, max[0]);
+  }
+  return true;
+}
+
+template<typename T>
+Coordinate2D<T> ContinuousFunction::approximateReducedExpressionAtParameter(T t, Poincare::Context * context) const {
+  PlotType type = plotType();
+  Expression e = expressionReduced(context);
+  const CompiledExpression * compiledExpression = m_model.compiledExpression(e, context);
+  if (compiledExpression != nullptr) {
+    T values[CompiledExpression::k_maxNumberOfOutputs];
+    compiledExpression->approximateWithValueForSymbol(t, values);
+    return type == PlotType::Parametric ? Coordinate2D<T>(values[0], values[1]) : Coordinate2D<T>(t, values[0]);
+  }
   constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
   char unknown[bufferSize];
   Poincare::SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknown);
-  PlotType type = plotType();
-  Expression e = expressionReduced(context);
   if (type != PlotType::Parametric) {
     assert(type == PlotType::Cartesian || type == PlotType::Polar);
     return Coordinate2D<T>(t, PoincareHelpers::ApproximateWithValueForSymbol(e, unknown, t, context));
@@ -296,16 +412,30 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Poincar
       PoincareHelpers::ApproximateWithValueForSymbol(e.childAtIndex(1), unknown, t, context));
 }
 
+double ContinuousFunction::EvaluateAtAbscissa(double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * function, const void * context2, const void * context3) {
+  return static_cast<const ContinuousFunction *>(function)->approximateReducedExpressionAtParameter(x, context).x2();
+}
+
+bool ContinuousFunction::EvaluateEnclosureOnInterval(double a, double b, double * min, double * max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * function, const void * context2, const void * context3) {
+  Coordinate2D<double> xyMin, xyMax;
+  if (!static_cast<const ContinuousFunction *>(function)->templatedEnclosureOnParameterInterval(a, b, &xyMin, &xyMax, context)) {
+    return false;
+  }
+  *min = xyMin.x2();
+  *max = xyMax.x2();
+  return true;
+}
+
 Coordinate2D<double> ContinuousFunction::nextMinimumFrom(double start, double step, double max, Context * context) const {
-  return nextPointOfInterestFrom(start, step, max, context, [](Expression e, char * symbol, double start, double step, double max, Context * context) { return PoincareHelpers::NextMinimum(e, symbol, start, step, max, context); });
+  return nextPointOfInterestFrom(start, step, max, context, [](double start, double step, double max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * function) { return Solver::NextMinimum(start, step, max, EvaluateAtAbscissa, context, complexFormat, angleUnit, function); });
 }
 
 Coordinate2D<double> ContinuousFunction::nextMaximumFrom(double start, double step, double max, Context * context) const {
-  return nextPointOfInterestFrom(start, step, max, context, [](Expression e, char * symbol, double start, double step, double max, Context * context) { return PoincareHelpers::NextMaximum(e, symbol, start, step, max, context); });
+  return nextPointOfInterestFrom(start, step, max, context, [](double start, double step, double max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * function) { return Solver::NextMaximum(start, step, max, EvaluateAtAbscissa, context, complexFormat, angleUnit, function); });
 }
 
 Coordinate2D<double> ContinuousFunction::nextRootFrom(double start, double step, double max, Context * context) const {
-  return nextPointOfInterestFrom(start, step, max, context, [](Expression e, char * symbol, double start, double step, double max, Context * context) { return Coordinate2D<double>(PoincareHelpers::NextRoot(e, symbol, start, step, max, context), 0.0); });
+  return nextPointOfInterestFrom(start, step, max, context, [](double start, double step, double max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * function) { return Coordinate2D<double>(Solver::NextRoot(start, step, max, EvaluateAtAbscissa, context, complexFormat, angleUnit, function, nullptr, nullptr, EvaluateEnclosureOnInterval), 0.0); });
 }
 
 Coordinate2D<double> ContinuousFunction::nextIntersectionFrom(double start, double step, double max, Poincare::Context * context, Poincare::Expression e, double eDomainMin, double eDomainMax) const {
@@ -322,14 +452,45 @@ Coordinate2D<double> ContinuousFunction::nextIntersectionFrom(double start, doub
     start = minDouble(start, domainMax);
     max = maxDouble(max, domainMin);
   }
-  return PoincareHelpers::NextIntersection(expressionReduced(context), unknownX, start, step, max, context, e);
+  Preferences * preferences = Preferences::sharedPreferences();
+  Preferences::ComplexFormat complexFormat = Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), expressionReduced(context), context);
+  Preferences::AngleUnit angleUnit = preferences->angleUnit();
+  CompiledExpression compiledExpression;
+  bool compiled = compiledExpression.compile(&e, 1, unknownX, context, complexFormat, angleUnit);
+  struct Intersection {
+    const Expression * expression;
+    const char * symbol;
+    const CompiledExpression * compiledExpression;
+  };
+  const Intersection intersection = {&e, unknownX, compiled ? &compiledExpression : nullptr};
+  double resultAbscissa = Solver::NextRoot(start, step, max,
+      [](double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * function, const void * intersection, const void * context3) {
+        const Intersection * i = static_cast<const Intersection *>(intersection);
+        return EvaluateAtAbscissa(x, context, complexFormat, angleUnit, function, nullptr, nullptr) - i->expression->approximateWithValueForSymbol(i->symbol, x, context, complexFormat, angleUnit);
+      }, context, complexFormat, angleUnit, this, &intersection, nullptr,
+      [](double a, double b, double * min, double * max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * function, const void * intersection, const void * context3) {
+        const Intersection * i = static_cast<const Intersection *>(intersection);
+        double functionMin, functionMax, expressionMin, expressionMax;
+        if (i->compiledExpression == nullptr
+            || !EvaluateEnclosureOnInterval(a, b, &functionMin, &functionMax, context, complexFormat, angleUnit, function, nullptr, nullptr)
+            || !i->compiledExpression->approximateOnInterval(a, b, &expressionMin, &expressionMax)) {
+          return false;
+        }
+        // Enclosure of the difference
+        bool isEmpty = functionMin > functionMax || expressionMin > expressionMax;
+        *min = isEmpty ? INFINITY : functionMin - expressionMax;
+        *max = isEmpty ? -INFINITY : functionMax - expressionMin;
+        return true;
+      });
+  Coordinate2D<double> result(resultAbscissa, EvaluateAtAbscissa(resultAbscissa, context, complexFormat, angleUnit, this, nullptr, nullptr));
+  if (std::fabs(result.x2()) < std::fabs(step)*Solver::k_solverPrecision) {
+    result.setX2(0.0);
+  }
+  return result;
 }
 
 Coordinate2D<double> ContinuousFunction::nextPointOfInterestFrom(double start, double step, double max, Context * context, ComputePointOfInterest compute) const {
   assert(plotType() == PlotType::Cartesian);
-  constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
-  char unknownX[bufferSize];
-  SerializationHelper::CodePoint(unknownX, bufferSize, UCodePointUnknown);
   if (step > 0.0f) {
     start = maxDouble(start, tMin());
     max = minDouble(max, tMax());
@@ -337,7 +498,9 @@ Coordinate2D<double> ContinuousFunction::nextPointOfInterestFrom(double start, d
     start = minDouble(start, tMax());
     max = maxDouble(max, tMin());
   }
-  return compute(expressionReduced(context), unknownX, start, step, max, context);
+  Preferences * preferences = Preferences::sharedPreferences();
+  Preferences::ComplexFormat complexFormat = Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), expressionReduced(context), context);
+  return compute(start, step, max, context, complexFormat, preferences->angleUnit(), this);
 }
 
 Poincare::Expression ContinuousFunction::sumBetweenBounds(double start, double end, Poincare::Context * context) const {
@@ -352,5 +515,8 @@ Poincare::Expression ContinuousFunction::sumBetweenBounds(double start, double e
 
 template Coordinate2D<float> ContinuousFunction::templatedApproximateAtParameter<float>(float, Poincare::Context *) const;
 template Coordinate2D<double> ContinuousFunction::templatedApproximateAtParameter<double>(double, Poincare::Context *) const;
+template Coordinate2D<double> ContinuousFunction::approximateReducedExpressionAtParameter<double>(double, Poincare::Context *) const;
+template bool ContinuousFunction::templatedEnclosureOnParameterInterval<float>(float, float, Coordinate2D<float> *, Coordinate2D<float> *, Poincare::Context *) const;
+template void ContinuousFunction::templatedApproximateAtParameters<double>(const double *, int, Coordinate2D<double> *, Poincare::Context *) const;
 
 }
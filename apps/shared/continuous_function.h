@@ -12,8 +12,10 @@
 #include "global_context.h"
 #include "function.h"
 #include "range_1D.h"
-#include <poincare/symbol.h>
+#include <poincare/compiled_expression.h>
 #include <poincare/coordinate_2D.h>
+#include <poincare/solver.h>
+#include <poincare/symbol.h>
 
 namespace Shared {
 
@@ -48,6 +50,17 @@ public:
   Poincare::Coordinate2D<double> evaluateXYAtParameter(double t, Poincare::Context * context) const override {
     return privateEvaluateXYAtParameter<double>(t, context);
   }
+  void evaluate2DAtParameters(const double * t, int numberOfParameters, Poincare::Coordinate2D<double> * results, Poincare::Context * context) const {
+    templatedApproximateAtParameters(t, numberOfParameters, results, context);
+  }
+  void evaluateXYAtParameters(const float * t, int numberOfParameters, Poincare::Coordinate2D<float> * xy, Poincare::Context * context) const override;
+  /* enclosureOnParameterInterval sets [xyMin, xyMax] to a box containing the
+   * points of the curve for t in [t1, t2], and returns false if it cannot be
+   * computed (polar curves, complex values, expressions that cannot be
+   * compiled...). */
+  bool enclosureOnParameterInterval(float t1, float t2, Poincare::Coordinate2D<float> * xyMin, Poincare::Coordinate2D<float> * xyMax, Poincare::Context * context) const {
+    return templatedEnclosureOnParameterInterval(t1, t2, xyMin, xyMax, context);
+  }
 
   // Derivative
   bool displayDerivative() const;
@@ -75,9 +88,14 @@ public:
   Poincare::Expression sumBetweenBounds(double start, double end, Poincare::Context * context) const override;
 private:
   constexpr static float k_polarParamRangeSearchNumberOfPoints = 100.0f; // This is ad hoc, no special justification
-  typedef Poincare::Coordinate2D<double> (*ComputePointOfInterest)(Poincare::Expression e, char * symbol, double start, double step, double max, Poincare::Context * context);
+  typedef Poincare::Coordinate2D<double> (*ComputePointOfInterest)(double start, double step, double max, Poincare::Context * context, Poincare::Preferences::ComplexFormat complexFormat, Poincare::Preferences::AngleUnit angleUnit, const void * function);
   Poincare::Coordinate2D<double> nextPointOfInterestFrom(double start, double step, double max, Poincare::Context * context, ComputePointOfInterest compute) const;
+  // Solver::ValueAtAbscissa evaluating the cartesian function given as context1
+  static double EvaluateAtAbscissa(double x, Poincare::Context * context, Poincare::Preferences::ComplexFormat complexFormat, Poincare::Preferences::AngleUnit angleUnit, const void * function, const void * context2, const void * context3);
+  // Solver::EnclosureOnInterval of the cartesian function given as context1
+  static bool EvaluateEnclosureOnInterval(double a, double b, double * min, double * max, Poincare::Context * context, Poincare::Preferences::ComplexFormat complexFormat, Poincare::Preferences::AngleUnit angleUnit, const void * function, const void * context2, const void * context3);
   template <typename T> Poincare::Coordinate2D<T> privateEvaluateXYAtParameter(T t, Poincare::Context * context) const;
+  template <typename T> static Poincare::Coordinate2D<T> PolarToCartesian(Poincare::Coordinate2D<T> thetaR);
   /* RecordDataBuffer is the layout of the data buffer of Record
    * representing a ContinuousFunction. See comment on
    * Shared::Function::RecordDataBuffer about packing. */
@@ -106,14 +124,28 @@ private:
     //char m_expression[0];
   };
   class Model : public ExpressionModel {
+  public:
+    Model() : ExpressionModel(), m_compilationFailed(false) {}
+    void tidy() const override;
+    /* compiledExpression returns the compiled version of the reduced
+     * expression e, or nullptr if it could not be compiled. */
+    const Poincare::CompiledExpression * compiledExpression(const Poincare::Expression e, Poincare::Context * context) const;
   private:
     void * expressionAddress(const Ion::Storage::Record * record) const override;
     size_t expressionSize(const Ion::Storage::Record * record) const override;
+    /* The compiled expression is derived from m_expression and is dropped
+     * along with it. */
+    mutable Poincare::CompiledExpression m_compiledExpression;
+    mutable bool m_compilationFailed;
   };
   size_t metaDataSize() const override { return sizeof(RecordDataBuffer); }
   const ExpressionModel * model() const override { return &m_model; }
   RecordDataBuffer * recordData() const;
   template<typename T> Poincare::Coordinate2D<T> templatedApproximateAtParameter(T t, Poincare::Context * context) const;
+  template<typename T> bool templatedEnclosureOnParameterInterval(T t1, T t2, Poincare::Coordinate2D<T> * xyMin, Poincare::Coordinate2D<T> * xyMax, Poincare::Context * context) const;
+  template<typename T> void templatedApproximateAtParameters(const T * t, int numberOfParameters, Poincare::Coordinate2D<T> * results, Poincare::Context * context) const;
+  // Approximates the reduced expression, regardless of the t range
+  template<typename T> Poincare::Coordinate2D<T> approximateReducedExpressionAtParameter(T t, Poincare::Context * context) const;
   Model m_model;
 };
 
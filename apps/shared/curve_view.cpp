@@ -16,6 +16,8 @@ static inline int minInt(int x, int y) { return x < y ? x : y; }
 static inline float minFloat(float x, float y) { return x < y ? x : y; }
 static inline float maxFloat(float x, float y) { return x > y ? x : y; }
 
+CurveView::CircuitBreaker CurveView::s_drawingCircuitBreaker = nullptr;
+
 CurveView::CurveView(CurveViewRange * curveViewRange, CurveViewCursor * curveViewCursor, BannerView * bannerView,
     CursorView * cursorView, View * okView, bool displayBanner) :
   View(),
@@ -26,7 +28,10 @@ CurveView::CurveView(CurveViewRange * curveViewRange, CurveViewCursor * curveVie
   m_okView(okView),
   m_forceOkDisplay(false),
   m_mainViewSelected(false),
-  m_drawnRangeVersion(0)
+  m_drawnRangeVersion(0),
+  m_samplingStepFactor(1),
+  m_drawingInterrupted(false),
+  m_coarselyDrawnRect(KDRectZero)
 {
 }
 
@@ -35,18 +40,71 @@ void CurveView::reload() {
   if (m_drawnRangeVersion != rangeVersion) {
     // FIXME: This should also be called if the *curve* changed
     m_drawnRangeVersion = rangeVersion;
-    KDCoordinate bannerHeight = (m_bannerView != nullptr) ? m_bannerView->bounds().height() : 0;
-    markRectAsDirty(KDRect(0, 0, bounds().width(), bounds().height() - bannerHeight));
-    if (label(Axis::Horizontal, 0) != nullptr) {
-      computeLabels(Axis::Horizontal);
+    KDPoint offset = KDPointZero;
+    bool isTranslation = movesDrawnPixelsOnPan() && isTranslationOfDrawnRange(&offset);
+    bool labelsAreTranslated = isTranslation;
+    for (int i = 0; i < 2; i++) {
+      Axis axis = static_cast<Axis>(i);
+      if (label(axis, 0) == nullptr) {
+        continue;
+      }
+      if (labelsAreTranslated) {
+        labelsAreTranslated = computeLabelsOfTranslatedRange(axis);
+      } else {
+        computeLabels(axis);
+      }
     }
-    if (label(Axis::Vertical, 0) != nullptr) {
-      computeLabels(Axis::Vertical);
+    FloatingPosition drawnFloatingLabels[2];
+    for (int i = 0; i < 2; i++) {
+      Axis axis = static_cast<Axis>(i);
+      DrawnAxis * drawnAxis = &m_drawnAxes[i];
+      if (isTranslation) {
+        drawnAxis->shift -= axis == Axis::Horizontal ? offset.x() : offset.y();
+      } else {
+        drawnAxis->origin = axis == Axis::Horizontal ? min(axis) : max(axis);
+        drawnAxis->pixelSize = (max(axis) - min(axis))/(numberOfPixels(axis) - 1);
+        drawnAxis->shift = 0;
+      }
+      drawnAxis->min = min(axis);
+      drawnAxis->max = max(axis);
+      drawnAxis->numberOfPixels = numberOfPixels(axis);
+      drawnAxis->gridUnit = gridUnit(axis);
+      drawnFloatingLabels[i] = drawnAxis->floatingLabels;
+    }
+    // The frames are set, the floating labels can be positioned
+    for (int i = 0; i < 2; i++) {
+      m_drawnAxes[i].floatingLabels = floatingLabelsPosition(static_cast<Axis>(i));
+    }
+    KDCoordinate bannerHeight = (m_bannerView != nullptr) ? m_bannerView->bounds().height() : 0;
+    KDRect drawnRect(0, 0, bounds().width(), bounds().height() - bannerHeight);
+    if (!(labelsAreTranslated
+          && drawnFloatingLabels[0] == m_drawnAxes[0].floatingLabels
+          && drawnFloatingLabels[1] == m_drawnAxes[1].floatingLabels
+          && moveDrawnPixels(drawnRect, offset))) {
+      if (drawsProgressively()) {
+        m_samplingStepFactor = k_coarsestSamplingStepFactor;
+        m_drawingInterrupted = false;
+      }
+      markRectAsDirty(drawnRect);
     }
   }
   layoutSubviews();
 }
 
+bool CurveView::markRectToRefineAsDirty() {
+  if (m_coarselyDrawnRect.isEmpty()) {
+    return false;
+  }
+  // An interrupted drawing is done again with the same sampling step
+  if (!m_drawingInterrupted && m_samplingStepFactor > 1) {
+    m_samplingStepFactor /= 2;
+  }
+  m_drawingInterrupted = false;
+  markRectAsDirty(m_coarselyDrawnRect);
+  m_coarselyDrawnRect = KDRectZero;
+  return true;
+}
+
 bool CurveView::isMainViewSelected() const {
   return m_mainViewSelected;
 }
@@ -107,23 +165,55 @@ void CurveView::setOkView(View * okView) {
  */
 
 float CurveView::pixelWidth() const {
-  return (m_curveViewRange->xMax() - m_curveViewRange->xMin()) / (m_frame.width() - 1);
+  float origin, size;
+  int shift;
+  pixelFrame(Axis::Horizontal, &origin, &size, &shift);
+  return size;
 }
 
 float CurveView::pixelHeight() const {
-  return (m_curveViewRange->yMax() - m_curveViewRange->yMin()) / (m_frame.height() - 1);
+  float origin, size;
+  int shift;
+  pixelFrame(Axis::Vertical, &origin, &size, &shift);
+  return size;
+}
+
+bool CurveView::isDrawnRange(Axis axis) const {
+  const DrawnAxis & drawnAxis = m_drawnAxes[static_cast<int>(axis)];
+  return min(axis) == drawnAxis.min && max(axis) == drawnAxis.max && numberOfPixels(axis) == drawnAxis.numberOfPixels;
+}
+
+void CurveView::pixelFrame(Axis axis, float * origin, float * pixelSize, int * shift) const {
+  /* The range may have changed since it was reloaded: its frame is then
+   * deduced from the range itself. */
+  if (isDrawnRange(axis)) {
+    const DrawnAxis & drawnAxis = m_drawnAxes[static_cast<int>(axis)];
+    *origin = drawnAxis.origin;
+    *pixelSize = drawnAxis.pixelSize;
+    *shift = drawnAxis.shift;
+    return;
+  }
+  *origin = axis == Axis::Horizontal ? min(axis) : max(axis);
+  *pixelSize = (max(axis) - min(axis)) / (numberOfPixels(axis) - 1);
+  *shift = 0;
 }
 
 float CurveView::pixelToFloat(Axis axis, KDCoordinate p) const {
+  float origin, size;
+  int shift;
+  pixelFrame(axis, &origin, &size, &shift);
   return (axis == Axis::Horizontal) ?
-    m_curveViewRange->xMin() + p * pixelWidth() :
-    m_curveViewRange->yMax() - p * pixelHeight();
+    origin + (p + shift) * size :
+    origin - (p + shift) * size;
 }
 
 float CurveView::floatToPixel(Axis axis, float f) const {
-  float result = (axis == Axis::Horizontal) ?
-    (f - m_curveViewRange->xMin()) / pixelWidth() :
-    (m_curveViewRange->yMax() - f) / pixelHeight();
+  float origin, size;
+  int shift;
+  pixelFrame(axis, &origin, &size, &shift);
+  float result = ((axis == Axis::Horizontal) ?
+    (f - origin) / size :
+    (origin - f) / size) - shift;
   /* Make sure that the returned value is between the maximum and minimum
    * possible values of KDCoordinate. */
   if (result == NAN) {
@@ -164,6 +254,10 @@ float CurveView::gridUnit(Axis axis) const {
   return (axis == Axis::Horizontal ? m_curveViewRange->xGridUnit() : m_curveViewRange->yGridUnit());
 }
 
+KDCoordinate CurveView::numberOfPixels(Axis axis) const {
+  return axis == Axis::Horizontal ? m_frame.width() : m_frame.height();
+}
+
 int CurveView::numberOfLabels(Axis axis) const {
   float labelStep = 2.0f * gridUnit(axis);
   float minLabel = std::ceil(min(axis)/labelStep);
@@ -173,6 +267,22 @@ int CurveView::numberOfLabels(Axis axis) const {
   return numberOfLabels;
 }
 
+KDCoordinate CurveView::maxLabelWidth() const {
+  KDCoordinate width = 0;
+  for (int i = 0; i < 2; i++) {
+    Axis axis = static_cast<Axis>(i);
+    if (label(axis, 0) == nullptr) {
+      continue;
+    }
+    int axisLabelsCount = numberOfLabels(axis);
+    for (int j = 0; j < axisLabelsCount; j++) {
+      KDCoordinate labelWidth = k_font->stringSize(label(axis, j)).width();
+      width = labelWidth > width ? labelWidth : width;
+    }
+  }
+  return width;
+}
+
 void CurveView::computeLabels(Axis axis) {
   float step = gridUnit(axis);
   int axisLabelsCount = numberOfLabels(axis);
@@ -260,11 +370,34 @@ void CurveView::drawLabel(KDContext * ctx, KDRect rect, float xPosition, float y
   }
 }
 
-enum class FloatingPosition : uint8_t {
-  None,
-  Min,
-  Max
-};
+KDCoordinate CurveView::labelsViewHeight() const {
+  return bounds().height() - (bannerIsVisible() ? m_bannerView->minimalSizeForOptimalDisplay().height() : 0);
+}
+
+CurveView::FloatingPosition CurveView::floatingLabelsPosition(Axis axis, bool graduationOnly, float horizontalCoordinate, float verticalCoordinate, KDCoordinate viewHeight) const {
+  if (axis == Axis::Horizontal) {
+    KDCoordinate maximalVerticalPosition = graduationOnly ? viewHeight : viewHeight - k_font->glyphSize().height() - k_labelMargin;
+    if (verticalCoordinate > maximalVerticalPosition) {
+      return FloatingPosition::Max;
+    }
+    if (max(Axis::Vertical) < 0.0f) {
+      return FloatingPosition::Min;
+    }
+    return FloatingPosition::None;
+  }
+  KDCoordinate minimalHorizontalPosition = graduationOnly ? 0 : k_labelMargin + k_font->glyphSize().width() * 3; // We want do display at least 3 characters left of the Y axis
+  if (horizontalCoordinate < minimalHorizontalPosition) {
+    return FloatingPosition::Min;
+  }
+  if (max(Axis::Horizontal) < 0.0f) {
+    return FloatingPosition::Max;
+  }
+  return FloatingPosition::None;
+}
+
+CurveView::FloatingPosition CurveView::floatingLabelsPosition(Axis axis) const {
+  return floatingLabelsPosition(axis, false, std::round(floatToPixel(Axis::Horizontal, 0.0f)), std::round(floatToPixel(Axis::Vertical, 0.0f)), labelsViewHeight());
+}
 
 void CurveView::drawLabelsAndGraduations(KDContext * ctx, KDRect rect, Axis axis, bool shiftOrigin, bool graduationOnly, bool fixCoordinate, KDCoordinate fixedCoordinate, KDColor backgroundColor) const {
   int numberLabels = numberOfLabels(axis);
@@ -275,29 +408,12 @@ void CurveView::drawLabelsAndGraduations(KDContext * ctx, KDRect rect, Axis axis
   float verticalCoordinate = fixCoordinate ? fixedCoordinate : std::round(floatToPixel(Axis::Vertical, 0.0f));
   float horizontalCoordinate = fixCoordinate ? fixedCoordinate : std::round(floatToPixel(Axis::Horizontal, 0.0f));
 
-  KDCoordinate viewHeight = bounds().height() - (bannerIsVisible() ? m_bannerView->minimalSizeForOptimalDisplay().height() : 0);
+  KDCoordinate viewHeight = labelsViewHeight();
 
   /* If the axis is not visible, draw floating labels on the edge of the screen.
    * The X axis floating status is needed when drawing both axes labels. */
-  FloatingPosition floatingHorizontalLabels = FloatingPosition::None;
-  KDCoordinate maximalVerticalPosition = graduationOnly ? viewHeight : viewHeight - k_font->glyphSize().height() - k_labelMargin;
-  if (verticalCoordinate > maximalVerticalPosition) {
-    floatingHorizontalLabels = FloatingPosition::Max;
-  } else if (max(Axis::Vertical) < 0.0f) {
-    floatingHorizontalLabels = FloatingPosition::Min;
-  }
-
-  FloatingPosition floatingLabels = FloatingPosition::None;
-  if (axis == Axis::Horizontal) {
-    floatingLabels = floatingHorizontalLabels;
-  } else {
-    KDCoordinate minimalHorizontalPosition = graduationOnly ? 0 : k_labelMargin + k_font->glyphSize().width() * 3; // We want do display at least 3 characters left of the Y axis
-    if (horizontalCoordinate < minimalHorizontalPosition) {
-      floatingLabels = FloatingPosition::Min;
-    } else if (max(Axis::Horizontal) < 0.0f) {
-      floatingLabels = FloatingPosition::Max;
-    }
-  }
+  FloatingPosition floatingHorizontalLabels = floatingLabelsPosition(Axis::Horizontal, graduationOnly, horizontalCoordinate, verticalCoordinate, viewHeight);
+  FloatingPosition floatingLabels = axis == Axis::Horizontal ? floatingHorizontalLabels : floatingLabelsPosition(Axis::Vertical, graduationOnly, horizontalCoordinate, verticalCoordinate, viewHeight);
 
   /* There might be less labels than graduations, if the extrema labels are too
    * close to the screen edge to write them. We must thus draw the graduations
@@ -460,91 +576,123 @@ void CurveView::drawAxis(KDContext * ctx, KDRect rect, Axis axis) const {
   drawLine(ctx, rect, axis, 0.0f, KDColorBlack, 1);
 }
 
-constexpr KDCoordinate thinCircleDiameter = 1;
-constexpr KDCoordinate thinStampSize = thinCircleDiameter+1;
-const uint8_t thinStampMask[(thinStampSize+1)*(thinStampSize+1)] = {
-  0xFF, 0xE1, 0xFF,
-  0xE1, 0x00, 0xE1,
-  0xFF, 0xE1, 0xFF,
-};
-
-#define LINE_THICKNESS 2
-
-#if LINE_THICKNESS == 2
-
-constexpr KDCoordinate thickCircleDiameter = 2;
-constexpr KDCoordinate thickStampSize = thickCircleDiameter+1;
-const uint8_t thickStampMask[(thickStampSize+1)*(thickStampSize+1)] = {
-  0xFF, 0xE6, 0xE6, 0xFF,
-  0xE6, 0x33, 0x33, 0xE6,
-  0xE6, 0x33, 0x33, 0xE6,
-  0xFF, 0xE6, 0xE6, 0xFF,
-};
-
-#elif LINE_THICKNESS == 3
+constexpr float thinLineThickness = 1.0f;
+constexpr float thickLineThickness = 2.0f;
 
-constexpr KDCoordinate thickCircleDiameter = 3;
-constexpr KDCoordinate thickStampSize = thickCircleDiameter+1;
-const uint8_t thickStampMask[(thickStampSize+1)*(thickStampSize+1)] = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x7A, 0x0C, 0x7A, 0xFF,
-  0xFF, 0x0C, 0x00, 0x0C, 0xFF,
-  0xFF, 0x7A, 0x0C, 0x7A, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-};
+CurveView::Polyline::Polyline(KDContext * ctx, KDColor color, bool thick) :
+  m_context(ctx),
+  m_color(color),
+  m_thickness(thick ? thickLineThickness : thinLineThickness),
+  m_numberOfPoints(0)
+{
+}
 
-#elif LINE_THICKNESS == 5
-
-constexpr KDCoordinate thickCircleDiameter = 5;
-constexpr KDCoordinate thickStampSize = thickCircleDiameter+1;
-const uint8_t thickStampMask[(thickStampSize+1)*(thickStampSize+1)] = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xE1, 0x45, 0x0C, 0x45, 0xE1, 0xFF,
-  0xFF, 0x45, 0x00, 0x00, 0x00, 0x45, 0xFF,
-  0xFF, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0xFF,
-  0xFF, 0x45, 0x00, 0x00, 0x00, 0x45, 0xFF,
-  0xFF, 0xE1, 0x45, 0x0C, 0x45, 0xE1, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-};
+void CurveView::Polyline::addSegment(float x1, float y1, float x2, float y2) {
+  if (m_numberOfPoints == 0 || m_x[m_numberOfPoints - 1] != x1 || m_y[m_numberOfPoints - 1] != y1) {
+    flush();
+    m_x[0] = x1;
+    m_y[0] = y1;
+    m_numberOfPoints = 1;
+  }
+  if (x2 == x1 && y2 == y1) {
+    return;
+  }
+  if (m_numberOfPoints == k_maxNumberOfPoints) {
+    // Start a new polyline from the last point
+    flush();
+    m_x[0] = x1;
+    m_y[0] = y1;
+    m_numberOfPoints = 1;
+  }
+  m_x[m_numberOfPoints] = x2;
+  m_y[m_numberOfPoints] = y2;
+  m_numberOfPoints++;
+}
 
-#endif
+void CurveView::Polyline::flush() {
+  m_context->drawAntialiasedPolyline(m_x, m_y, m_numberOfPoints, m_thickness, m_color, m_workingBuffer);
+  m_numberOfPoints = 0;
+}
 
 constexpr static int k_maxNumberOfIterations = 10;
-
-void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound) const {
+/* A jump between two dots is suspected to be a discontinuity when more than
+ * k_discontinuityJumpRatio of it happens in one half of the parameter
+ * interval. Once this happens on k_maxNumberOfDiscontinuityLevels consecutive
+ * recursion levels, the half holding the jump is halved at most
+ * k_maxNumberOfDiscontinuityBisections more times: the jump of a steep
+ * continuous function is shared out between the halves on the way. A pole is
+ * only skipped once both dots are out of the drawn rect. Jumps of less than
+ * k_minDiscontinuityJump pixels are not classified. */
+constexpr static int k_maxNumberOfDiscontinuityLevels = 3;
+constexpr static int k_maxNumberOfDiscontinuityBisections = 32;
+constexpr static float k_discontinuityJumpRatio = 0.9f;
+constexpr static float k_minDiscontinuityJump = 2.0f;
+constexpr static int k_numberOfSamplesPerBatch = 16;
+
+void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EvaluateXYForParameters xyBatchEvaluation, EnclosureForParameters xyEnclosure) const {
   float previousT = NAN;
   float t = NAN;
   float previousX = NAN;
   float x = NAN;
   float previousY = NAN;
   float y = NAN;
+  float batchT[k_numberOfSamplesPerBatch];
+  Coordinate2D<float> batchXY[k_numberOfSamplesPerBatch];
   int i = 0;
+  bool lastBatch = false;
+  Polyline polyline(ctx, color, thick);
+  int stepFactor = samplingStepFactor(rect);
   do {
-    previousT = t;
-    t = tStart + (i++) * tStep;
-    if (t <= tStart) {
-      t = tStart + FLT_EPSILON;
+    if (stepFactor < k_coarsestSamplingStepFactor && shouldInterruptDrawing()) {
+      stepFactor = samplingStepFactor(rect);
     }
-    if (t >= tEnd) {
-      t = tEnd - FLT_EPSILON;
+    // The dichotomy is shortened when the samples are sparser
+    const int maxNumberOfRecursion = k_maxNumberOfIterations / stepFactor;
+    // Compute the parameters of the next batch of samples
+    int batchSize = 0;
+    while (batchSize < k_numberOfSamplesPerBatch) {
+      float nextT = tStart + i * tStep;
+      i += stepFactor;
+      if (nextT <= tStart) {
+        nextT = tStart + FLT_EPSILON;
+      }
+      if (nextT >= tEnd) {
+        nextT = tEnd - FLT_EPSILON;
+      }
+      if (nextT == (batchSize > 0 ? batchT[batchSize - 1] : t)) {
+        lastBatch = true;
+        break;
+      }
+      batchT[batchSize++] = nextT;
     }
-    if (previousT == t) {
-      break;
+    if (xyBatchEvaluation != nullptr) {
+      xyBatchEvaluation(batchT, batchSize, batchXY, model, context);
+    } else {
+      for (int j = 0; j < batchSize; j++) {
+        batchXY[j] = xyEvaluation(batchT[j], model, context);
+      }
     }
-    previousX = x;
-    previousY = y;
-    Coordinate2D<float> xy = xyEvaluation(t, model, context);
-    x = xy.x1();
-    y = xy.x2();
-    if (colorUnderCurve && !std::isnan(x) && colorLowerBound < x && x < colorUpperBound && !(std::isnan(y) || std::isinf(y))) {
-      drawSegment(ctx, rect, Axis::Vertical, x, minFloat(0.0f, y), maxFloat(0.0f, y), color, 1);
+    for (int j = 0; j < batchSize; j++) {
+      previousT = t;
+      t = batchT[j];
+      previousX = x;
+      previousY = y;
+      x = batchXY[j].x1();
+      y = batchXY[j].x2();
+      if (colorUnderCurve && !std::isnan(x) && colorLowerBound < x && x < colorUpperBound && !(std::isnan(y) || std::isinf(y))) {
+        drawSegment(ctx, rect, Axis::Vertical, x, minFloat(0.0f, y), maxFloat(0.0f, y), color, 1);
+      }
+      joinDots(&polyline, rect, xyEvaluation, xyEnclosure, model, context, drawStraightLinesEarly, previousT, previousX, previousY, t, x, y, maxNumberOfRecursion, 0);
     }
-    joinDots(ctx, rect, xyEvaluation, model, context, drawStraightLinesEarly, previousT, previousX, previousY, t, x, y, color, thick, k_maxNumberOfIterations);
-  } while (true);
+  } while (!lastBatch);
+  polyline.flush();
 }
 
-void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForParameter xyEvaluation, void * model, void * context, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound) const {
-  float rectLeft = pixelToFloat(Axis::Horizontal, rect.left() - k_externRectMargin);
+void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForParameter xyEvaluation, void * model, void * context, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EvaluateXYForParameters xyBatchEvaluation, EnclosureForParameters xyEnclosure) const {
+  float tStep = pixelWidth();
+  /* The samples are taken at multiples of tStep, so that the samples of two
+   * overlapping rects, or of a panned view, are the same. */
+  float rectLeft = std::floor(pixelToFloat(Axis::Horizontal, rect.left() - k_externRectMargin) / tStep) * tStep;
   float rectRight = pixelToFloat(Axis::Horizontal, rect.right() + k_externRectMargin);
   float tStart = std::isnan(rectLeft) ? xMin : maxFloat(xMin, rectLeft);
   float tEnd = std::isnan(rectRight) ? xMax : minFloat(xMax, rectRight);
@@ -552,8 +700,7 @@ void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, flo
   if (std::isinf(tStart) || std::isinf(tEnd) || tStart > tEnd) {
     return;
   }
-  float tStep = pixelWidth();
-  drawCurve(ctx, rect, tStart, tEnd, tStep, xyEvaluation, model, context, true, color, thick, colorUnderCurve, colorLowerBound, colorUpperBound);
+  drawCurve(ctx, rect, tStart, tEnd, tStep, xyEvaluation, model, context, true, color, thick, colorUnderCurve, colorLowerBound, colorUpperBound, xyBatchEvaluation, xyEnclosure);
 }
 
 void CurveView::drawHistogram(KDContext * ctx, KDRect rect, EvaluateYForX yEvaluation, void * model, void * context, float firstBarAbscissa, float barWidth,
@@ -594,7 +741,72 @@ void CurveView::drawHistogram(KDContext * ctx, KDRect rect, EvaluateYForX yEvalu
   }
 }
 
-void CurveView::joinDots(KDContext * ctx, KDRect rect, EvaluateXYForParameter xyEvaluation , void * model, void * context, bool drawStraightLinesEarly, float t, float x, float y, float s, float u, float v, KDColor color, bool thick, int maxNumberOfRecursion) const {
+static bool isOutOfRect(KDRect rect, float pxf, float pyf, float margin) {
+  return pxf < rect.left() - margin || pxf > rect.right() + margin
+    || pyf < rect.top() - margin || pyf > rect.bottom() + margin;
+}
+
+static bool isDotValid(float x, float y) {
+  return !(std::isnan(x) || std::isinf(x) || std::isnan(y) || std::isinf(y));
+}
+
+CurveView::Discontinuity CurveView::discontinuityBetweenDots(EvaluateXYForParameter xyEvaluation, EnclosureForParameters xyEnclosure, void * model, void * context, float t, float x, float y, float s, float u, float v) const {
+  if (!isDotValid(x, y) || !isDotValid(u, v)) {
+    return Discontinuity::None;
+  }
+  Coordinate2D<float> xyMin, xyMax;
+  const bool isBounded = xyEnclosure != nullptr
+    && xyEnclosure(minFloat(t, s), maxFloat(t, s), &xyMin, &xyMax, model, context)
+    && isDotValid(xyMin.x1(), xyMin.x2()) && isDotValid(xyMax.x1(), xyMax.x2());
+  float pxf = floatToPixel(Axis::Horizontal, x);
+  float pyf = floatToPixel(Axis::Vertical, y);
+  float puf = floatToPixel(Axis::Horizontal, u);
+  float pvf = floatToPixel(Axis::Vertical, v);
+  float jump = std::sqrt((puf - pxf)*(puf - pxf) + (pvf - pyf)*(pvf - pyf));
+  const float initialJump = jump;
+  for (int i = 0; i < k_maxNumberOfDiscontinuityBisections; i++) {
+    if (jump <= k_minDiscontinuityJump) {
+      return Discontinuity::None;
+    }
+    float ct = (t + s)/2.0f;
+    if (ct == t || ct == s) {
+      // The float resolution is reached
+      break;
+    }
+    Coordinate2D<float> cxy = xyEvaluation(ct, model, context);
+    float cx = cxy.x1();
+    float cy = cxy.x2();
+    if (std::isinf(cx) || std::isinf(cy)) {
+      return isBounded ? Discontinuity::None : Discontinuity::Pole;
+    }
+    if (std::isnan(cx) || std::isnan(cy)) {
+      // The dichotomy of joinDots handles undefined dots
+      return Discontinuity::None;
+    }
+    float pcxf = floatToPixel(Axis::Horizontal, cx);
+    float pcyf = floatToPixel(Axis::Vertical, cy);
+    float leftJump = std::sqrt((pcxf - pxf)*(pcxf - pxf) + (pcyf - pyf)*(pcyf - pyf));
+    float rightJump = std::sqrt((puf - pcxf)*(puf - pcxf) + (pvf - pcyf)*(pvf - pcyf));
+    if (maxFloat(leftJump, rightJump) <= k_discontinuityJumpRatio * jump) {
+      return Discontinuity::None;
+    }
+    if (leftJump >= rightJump) {
+      s = ct;
+      puf = pcxf;
+      pvf = pcyf;
+      jump = leftJump;
+    } else {
+      t = ct;
+      pxf = pcxf;
+      pyf = pcyf;
+      jump = rightJump;
+    }
+  }
+  // Around a pole, the jump keeps growing as the interval shrinks
+  return !isBounded && jump > 2.0f * initialJump ? Discontinuity::Pole : Discontinuity::Jump;
+}
+
+void CurveView::joinDots(Polyline * polyline, KDRect rect, EvaluateXYForParameter xyEvaluation, EnclosureForParameters xyEnclosure, void * model, void * context, bool drawStraightLinesEarly, float t, float x, float y, float s, float u, float v, int maxNumberOfRecursion, int numberOfDiscontinuityLevels) const {
   const bool isFirstDot = std::isnan(t);
   const bool isLeftDotValid = !(
       std::isnan(x) || std::isinf(x) ||
@@ -609,15 +821,18 @@ void CurveView::joinDots(KDContext * ctx, KDRect rect, EvaluateXYForParameter xy
   if (!isRightDotValid && !isLeftDotValid) {
     return;
   }
-  KDCoordinate circleDiameter = thick ? thickCircleDiameter : thinCircleDiameter;
+  const float thickness = polyline->thickness();
   if (isRightDotValid) {
     const float deltaX = pxf - puf;
     const float deltaY = pyf - pvf;
-    if (isFirstDot // First dot has to be stamped
-       || (!isLeftDotValid && maxNumberOfRecursion == 0) // Last step of the recursion with an undefined left dot: we stamp the last right dot
-       || (isLeftDotValid && deltaX*deltaX + deltaY*deltaY < circleDiameter * circleDiameter / 4.0f)) { // the dots are already close enough
-      // the dots are already joined
-      stampAtLocation(ctx, rect, puf, pvf, color, thick);
+    if (isFirstDot // First dot has to be drawn
+       || (!isLeftDotValid && maxNumberOfRecursion == 0)) { // Last step of the recursion with an undefined left dot: we draw the last right dot
+      polyline->addDot(puf, pvf);
+      return;
+    }
+    if (isLeftDotValid && deltaX*deltaX + deltaY*deltaY < thickness * thickness / 4.0f) {
+      // the dots are already close enough
+      polyline->addSegment(pxf, pyf, puf, pvf);
       return;
     }
   }
@@ -626,16 +841,68 @@ void CurveView::joinDots(KDContext * ctx, KDRect rect, EvaluateXYForParameter xy
   Coordinate2D<float> cxy = xyEvaluation(ct, model, context);
   float cx = cxy.x1();
   float cy = cxy.x2();
-  if ((drawStraightLinesEarly || maxNumberOfRecursion == 0) && isRightDotValid && isLeftDotValid &&
+  /* The jump of a continuous function between the dots is shared out between
+   * both halves, whereas at a pole or a jump most of it stays in the half
+   * holding the discontinuity, and may even grow. */
+  bool isJumpLeftSuspect = false;
+  bool isJumpRightSuspect = false;
+  if (isRightDotValid && isLeftDotValid && !std::isnan(cx) && !std::isinf(cx) && !std::isnan(cy) && !std::isinf(cy)) {
+    float pcxf = floatToPixel(Axis::Horizontal, cx);
+    float pcyf = floatToPixel(Axis::Vertical, cy);
+    float jump = std::sqrt((puf - pxf)*(puf - pxf) + (pvf - pyf)*(pvf - pyf));
+    float leftJump = std::sqrt((pcxf - pxf)*(pcxf - pxf) + (pcyf - pyf)*(pcyf - pyf));
+    float rightJump = std::sqrt((puf - pcxf)*(puf - pcxf) + (pvf - pcyf)*(pvf - pcyf));
+    float halfJump = maxFloat(leftJump, rightJump);
+    if (jump > k_minDiscontinuityJump && halfJump > k_discontinuityJumpRatio * jump) {
+      /* Around a pole, the jump grows: the branches are refined until they
+       * leave the rect. */
+      if (numberOfDiscontinuityLevels + 1 >= k_maxNumberOfDiscontinuityLevels
+       && (halfJump <= jump || (isOutOfRect(rect, pxf, pyf, thickness) && isOutOfRect(rect, puf, pvf, thickness)))
+       && discontinuityBetweenDots(xyEvaluation, xyEnclosure, model, context, t, x, y, s, u, v) != Discontinuity::None) {
+        /* The curve is discontinuous between the dots: there is no need to
+         * refine further nor to join them. */
+        return;
+      }
+      isJumpLeftSuspect = leftJump >= rightJump;
+      isJumpRightSuspect = !isJumpLeftSuspect;
+    }
+  }
+  const bool isJumpSuspect = isJumpLeftSuspect || isJumpRightSuspect;
+  if ((drawStraightLinesEarly || maxNumberOfRecursion == 0) && isRightDotValid && isLeftDotValid && !isJumpSuspect &&
       ((x <= cx && cx <= u) || (u <= cx && cx <= x)) && ((y <= cy && cy <= v) || (v <= cy && cy <= y))) {
     /* As the middle dot is between the two dots, we assume that we
      * can draw a 'straight' line between the two */
-    straightJoinDots(ctx, rect, pxf, pyf, puf, pvf, color, thick);
+    straightJoinDots(polyline, rect, pxf, pyf, puf, pvf);
     return;
   }
+  Coordinate2D<float> xyMin, xyMax;
+  if (maxNumberOfRecursion > 0 && !isFirstDot && xyEnclosure != nullptr && xyEnclosure(minFloat(t, s), maxFloat(t, s), &xyMin, &xyMax, model, context)) {
+    if (xyMin.x1() > xyMax.x1() || xyMin.x2() > xyMax.x2()) {
+      // The curve is undefined between the dots
+      return;
+    }
+    // The vertical axis is upside down
+    float pxMin = floatToPixel(Axis::Horizontal, xyMin.x1());
+    float pxMax = floatToPixel(Axis::Horizontal, xyMax.x1());
+    float pyMin = floatToPixel(Axis::Vertical, xyMax.x2());
+    float pyMax = floatToPixel(Axis::Vertical, xyMin.x2());
+    if (pxMax < rect.left() - thickness || pxMin > rect.right() + thickness
+     || pyMax < rect.top() - thickness || pyMin > rect.bottom() + thickness) {
+      // The curve between the dots is out of rect
+      return;
+    }
+    if (drawStraightLinesEarly && isRightDotValid && isLeftDotValid && !isJumpSuspect
+     && minFloat(pxf, puf) - 1.0f <= pxMin && pxMax <= maxFloat(pxf, puf) + 1.0f
+     && minFloat(pyf, pvf) - 1.0f <= pyMin && pyMax <= maxFloat(pyf, pvf) + 1.0f) {
+      /* The curve cannot leave the box of the two dots: a straight line is a
+       * good enough approximation. */
+      straightJoinDots(polyline, rect, pxf, pyf, puf, pvf);
+      return;
+    }
+  }
   if (maxNumberOfRecursion > 0) {
-    joinDots(ctx, rect, xyEvaluation, model, context, drawStraightLinesEarly, t, x, y, ct, cx, cy, color, thick, maxNumberOfRecursion-1);
-    joinDots(ctx, rect, xyEvaluation, model, context, drawStraightLinesEarly, ct, cx, cy, s, u, v, color, thick, maxNumberOfRecursion-1);
+    joinDots(polyline, rect, xyEvaluation, xyEnclosure, model, context, drawStraightLinesEarly, t, x, y, ct, cx, cy, maxNumberOfRecursion-1, isJumpLeftSuspect ? numberOfDiscontinuityLevels + 1 : 0);
+    joinDots(polyline, rect, xyEvaluation, xyEnclosure, model, context, drawStraightLinesEarly, ct, cx, cy, s, u, v, maxNumberOfRecursion-1, isJumpRightSuspect ? numberOfDiscontinuityLevels + 1 : 0);
   }
 }
 
@@ -653,85 +920,34 @@ static void clipBarycentricCoordinatesBetweenBounds(float & start, float & end,
   }
 }
 
-void CurveView::straightJoinDots(KDContext * ctx, KDRect rect, float pxf, float pyf, float puf, float pvf, KDColor color, bool thick) const {
-  {
-    /* Before drawing the line segment, clip it to rect:
-     * start and end are the barycentric coordinates on the line segment (0
-     * corresponding to (u, v) and 1 to (x, y)), of the drawing start and end
-     * points. */
-    float start = 0;
-    float end   = 1;
-    KDCoordinate stampSize = thick ? thickStampSize : thinStampSize;
-    const KDCoordinate xBounds[2] = {
-      static_cast<KDCoordinate>(rect.left() - stampSize),
-      static_cast<KDCoordinate>(rect.right() + stampSize)
-    };
-    const KDCoordinate yBounds[2] = {
-      static_cast<KDCoordinate>(rect.top() - stampSize),
-      static_cast<KDCoordinate>(rect.bottom() + stampSize)
-    };
-    clipBarycentricCoordinatesBetweenBounds(start, end, xBounds, pxf, puf);
-    clipBarycentricCoordinatesBetweenBounds(start, end, yBounds, pyf, pvf);
-    if (start > end) {
-      return;
-    }
-    puf = start * pxf + (1-start) * puf;
-    pvf = start * pyf + (1-start) * pvf;
-    pxf =  end  * pxf + (1- end ) * puf;
-    pyf =  end  * pyf + (1- end ) * pvf;
-  }
-  const float deltaX = pxf - puf;
-  const float deltaY = pyf - pvf;
-  KDCoordinate circleDiameter = thick ? thickCircleDiameter : thinCircleDiameter;
-  const float normsRatio = std::sqrt(deltaX*deltaX + deltaY*deltaY) / (circleDiameter / 2.0f);
-  const float stepX = deltaX / normsRatio ;
-  const float stepY = deltaY / normsRatio;
-  const int numberOfStamps = std::floor(normsRatio);
-  for (int i = 0; i < numberOfStamps; i++) {
-    stampAtLocation(ctx, rect, puf, pvf, color, thick);
-    puf += stepX;
-    pvf += stepY;
-  }
-}
-
-void CurveView::stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color, bool thick) const {
-  /* The (pxf, pyf) coordinates are not generally locating the center of a
-   * pixel. We use stampMask, which is one pixel wider and higher than
-   * stampSize, in order to cover stampRect without aligning the pixels. Then
-   * shiftedMask is computed so that each pixel is the average of the values of
-   * the four pixels of stampMask by which it is covered, proportionally to the
-   * area of the intersection with each of those.
-   *
-   * In order to compute the coordinates (px, py) of the top-left pixel of
-   * stampRect, we consider that stampMask is centered at the provided point
-   * (pxf,pyf) which is then translated to the center of the top-left pixel of
-   * stampMask.
-   */
-  KDCoordinate stampSize = thick ? thickStampSize : thinStampSize;
-  const uint8_t * stampMask = thick ? thickStampMask : thinStampMask;
-  pxf -= (stampSize + 1 - 1)/2.0f;
-  pyf -= (stampSize + 1 - 1)/2.0f;
-  const KDCoordinate px = std::ceil(pxf);
-  const KDCoordinate py = std::ceil(pyf);
-  KDRect stampRect(px, py, stampSize, stampSize);
-  if (!rect.intersects(stampRect)) {
+void CurveView::straightJoinDots(Polyline * polyline, KDRect rect, float pxf, float pyf, float puf, float pvf) const {
+  /* Before drawing the line segment, clip it to rect, widened by the
+   * thickness of the line: start and end are the barycentric coordinates on
+   * the line segment (0 corresponding to (u, v) and 1 to (x, y)), of the
+   * drawing start and end points. */
+  float start = 0;
+  float end   = 1;
+  KDCoordinate margin = std::ceil(polyline->thickness()) + 1;
+  const KDCoordinate xBounds[2] = {
+    static_cast<KDCoordinate>(rect.left() - margin),
+    static_cast<KDCoordinate>(rect.right() + margin)
+  };
+  const KDCoordinate yBounds[2] = {
+    static_cast<KDCoordinate>(rect.top() - margin),
+    static_cast<KDCoordinate>(rect.bottom() + margin)
+  };
+  clipBarycentricCoordinatesBetweenBounds(start, end, xBounds, pxf, puf);
+  clipBarycentricCoordinatesBetweenBounds(start, end, yBounds, pyf, pvf);
+  if (start > end) {
     return;
   }
-  uint8_t shiftedMask[stampSize][stampSize];
-  KDColor workingBuffer[stampSize*stampSize];
-  const float dx = px - pxf;
-  const float dy = py - pyf;
-  /* TODO: this could be optimized by precomputing 10 or 100 shifted masks. The
-   * dx and dy would be rounded to one tenth or one hundredth to choose the
-   * right shifted mask. */
-  const KDCoordinate stampMaskSize = stampSize + 1;
-  for (int i=0; i<stampSize; i++) {
-    for (int j=0; j<stampSize; j++) {
-      shiftedMask[j][i] = (1.0f - dx) * (stampMask[j*stampMaskSize+i]*(1.0-dy)+stampMask[(j+1)*stampMaskSize+i]*dy)
-        + dx * (stampMask[j*stampMaskSize+(i+1)]*(1.0f-dy) + stampMask[(j+1)*stampMaskSize+(i+1)]*dy);
-    }
-  }
-  ctx->blendRectWithMask(stampRect, color, (const uint8_t *)shiftedMask, workingBuffer);
+  /* Keep the ends that are not clipped exact, so that the segment extends the
+   * polyline drawn so far. */
+  float clippedPuf = start == 0 ? puf : start * pxf + (1-start) * puf;
+  float clippedPvf = start == 0 ? pvf : start * pyf + (1-start) * pvf;
+  float clippedPxf = end == 1 ? pxf : end * pxf + (1-end) * puf;
+  float clippedPyf = end == 1 ? pyf : end * pyf + (1-end) * pvf;
+  polyline->addSegment(clippedPxf, clippedPyf, clippedPuf, clippedPvf);
 }
 
 void CurveView::layoutSubviews(bool force) {
@@ -847,6 +1063,129 @@ void CurveView::computeHorizontalExtremaLabels(bool increaseNumberOfSignificantD
   }
 }
 
+bool CurveView::computeLabelsOfTranslatedRange(Axis axis) {
+  constexpr int k_maxNumberOfLabels = k_maxNumberOfXLabels > k_maxNumberOfYLabels ? k_maxNumberOfXLabels : k_maxNumberOfYLabels;
+  char drawnLabels[k_maxNumberOfLabels][k_labelBufferMaxSize];
+  const DrawnAxis & drawnAxis = m_drawnAxes[static_cast<int>(axis)];
+  // The grid unit of the translated range is the drawn one
+  float labelStep = 2.0f * gridUnit(axis);
+  int firstDrawnLabel = std::ceil(drawnAxis.min/labelStep);
+  int numberOfDrawnLabels = std::floor(drawnAxis.max/labelStep) - firstDrawnLabel + 1;
+  assert(numberOfDrawnLabels <= k_maxNumberOfLabels);
+  for (int j = 0; j < numberOfDrawnLabels; j++) {
+    strlcpy(drawnLabels[j], label(axis, j), k_labelBufferMaxSize);
+  }
+  computeLabels(axis);
+  int firstLabel = std::ceil(min(axis)/labelStep);
+  int axisLabelsCount = numberOfLabels(axis);
+  for (int j = 0; j < axisLabelsCount; j++) {
+    int drawnIndex = firstLabel + j - firstDrawnLabel;
+    if (drawnIndex >= 0 && drawnIndex < numberOfDrawnLabels && strcmp(label(axis, j), drawnLabels[drawnIndex]) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CurveView::isTranslationOfDrawnRange(KDPoint * offset) const {
+  KDCoordinate pixelOffset[2];
+  for (int i = 0; i < 2; i++) {
+    Axis axis = static_cast<Axis>(i);
+    const DrawnAxis & drawnAxis = m_drawnAxes[i];
+    KDCoordinate n = numberOfPixels(axis);
+    float pixelSize = (max(axis) - min(axis))/(n - 1);
+    if (n != drawnAxis.numberOfPixels
+        || gridUnit(axis) != drawnAxis.gridUnit
+        || !(std::fabs(pixelSize - drawnAxis.pixelSize) * n < k_maxDrawnPixelsDrift * pixelSize)) {
+      return false;
+    }
+    // Pixel coordinate, in the drawn frame, of the first pixel of the range
+    float firstPixel = (axis == Axis::Horizontal ? min(axis) - drawnAxis.origin : drawnAxis.origin - max(axis))/drawnAxis.pixelSize - drawnAxis.shift;
+    float roundedFirstPixel = std::round(firstPixel);
+    if (!(std::fabs(firstPixel - roundedFirstPixel) < k_maxDrawnPixelsDrift
+          && std::fabs(roundedFirstPixel) < n)) {
+      return false;
+    }
+    pixelOffset[i] = -roundedFirstPixel;
+  }
+  *offset = KDPoint(pixelOffset[0], pixelOffset[1]);
+  return true;
+}
+
+bool CurveView::moveDrawnPixels(KDRect rect, KDPoint offset) {
+  if (!translateDrawnPixels(rect, offset)) {
+    return false;
+  }
+  // The coarsely drawn pixels moved too
+  m_coarselyDrawnRect = m_coarselyDrawnRect.translatedBy(offset).intersectedWith(rect);
+  KDCoordinate width = rect.width();
+  KDCoordinate height = rect.height();
+  /* Draw the strips uncovered by the move. They are widened so that the
+   * labels and dots cut by the former edges of the view are completed. The
+   * opposite edges are drawn too: a label is only drawn if its value is in the
+   * range, but it may overflow the range. */
+  KDCoordinate horizontalMargin = k_labelMargin + maxLabelWidth();
+  horizontalMargin = horizontalMargin > Dots::LargeDotDiameter ? horizontalMargin : Dots::LargeDotDiameter;
+  KDCoordinate verticalMargin = k_labelMargin + k_font->glyphSize().height();
+  if (offset.x() != 0) {
+    KDCoordinate uncoveredWidth = std::abs(offset.x()) + horizontalMargin;
+    drawRectNow(KDRect(offset.x() > 0 ? 0 : width - uncoveredWidth, 0, uncoveredWidth, height).intersectedWith(rect));
+    drawRectNow(KDRect(offset.x() > 0 ? width - horizontalMargin : 0, 0, horizontalMargin, height).intersectedWith(rect));
+  }
+  if (offset.y() != 0) {
+    KDCoordinate uncoveredHeight = std::abs(offset.y()) + verticalMargin;
+    drawRectNow(KDRect(0, offset.y() > 0 ? 0 : height - uncoveredHeight, width, uncoveredHeight).intersectedWith(rect));
+    drawRectNow(KDRect(0, offset.y() > 0 ? height - verticalMargin : 0, width, verticalMargin).intersectedWith(rect));
+  }
+  /* Floating labels stay on an edge of the view, the move shifted them along
+   * the other axis. The band of the horizontal labels also holds the extremal
+   * vertical labels hidden by them. */
+  KDCoordinate bandHeight = k_labelMargin + 2 * k_font->glyphSize().height();
+  KDCoordinate labelsHeight = labelsViewHeight();
+  KDRect horizontalLabelsBand = KDRectZero;
+  if (offset.y() != 0 && m_drawnAxes[static_cast<int>(Axis::Horizontal)].floatingLabels == FloatingPosition::Min) {
+    horizontalLabelsBand = KDRect(0, 0, width, bandHeight);
+  } else if (offset.y() != 0 && m_drawnAxes[static_cast<int>(Axis::Horizontal)].floatingLabels == FloatingPosition::Max) {
+    horizontalLabelsBand = KDRect(0, labelsHeight - bandHeight, width, bandHeight);
+  }
+  KDCoordinate bandWidth = k_labelMargin + maxLabelWidth();
+  KDRect verticalLabelsBand = KDRectZero;
+  if (offset.x() != 0 && m_drawnAxes[static_cast<int>(Axis::Vertical)].floatingLabels == FloatingPosition::Min) {
+    verticalLabelsBand = KDRect(0, 0, bandWidth, height);
+  } else if (offset.x() != 0 && m_drawnAxes[static_cast<int>(Axis::Vertical)].floatingLabels == FloatingPosition::Max) {
+    verticalLabelsBand = KDRect(width - bandWidth, 0, bandWidth, height);
+  }
+  drawRectNow(horizontalLabelsBand.unionedWith(horizontalLabelsBand.translatedBy(offset)).intersectedWith(rect));
+  drawRectNow(verticalLabelsBand.unionedWith(verticalLabelsBand.translatedBy(offset)).intersectedWith(rect));
+  /* The subviews are drawn over the pixels of the view: the move shifted them
+   * out of their frames. */
+  View * subviews[] = {m_cursorView, m_okView};
+  for (View * subview : subviews) {
+    if (subview != nullptr) {
+      KDRect frame(pointFromPointInView(subview, KDPointZero), subview->bounds().size());
+      markRectAsDirty(frame);
+      markRectAsDirty(frame.translatedBy(offset));
+    }
+  }
+  return true;
+}
+
+int CurveView::samplingStepFactor(KDRect rect) const {
+  int factor = m_drawingInterrupted ? k_coarsestSamplingStepFactor : m_samplingStepFactor;
+  if (factor > 1) {
+    m_coarselyDrawnRect = m_coarselyDrawnRect.unionedWith(rect);
+  }
+  return factor;
+}
+
+bool CurveView::shouldInterruptDrawing() const {
+  if (!drawsProgressively() || s_drawingCircuitBreaker == nullptr || !s_drawingCircuitBreaker()) {
+    return false;
+  }
+  m_drawingInterrupted = true;
+  return true;
+}
+
 float CurveView::labelValueAtIndex(Axis axis, int i) const {
   assert(i >= 0 && i < numberOfLabels(axis));
   float labelStep = 2.0f * gridUnit(axis);
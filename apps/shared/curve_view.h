@@ -5,6 +5,7 @@
 #include "curve_view_range.h"
 #include "curve_view_cursor.h"
 #include "cursor_view.h"
+#include <ion/display.h>
 #include <poincare/preferences.h>
 #include <poincare/coordinate_2D.h>
 #include <cmath>
@@ -17,7 +18,15 @@ public:
    * labels appear completely. This gives 3*charWidth/320 = 3*7/320= 0.066 */
   static constexpr float k_labelsHorizontalMarginRatio = 0.066f;
   typedef Poincare::Coordinate2D<float> (*EvaluateXYForParameter)(float t, void * model, void * context);
+  typedef void (*EvaluateXYForParameters)(const float * t, int numberOfParameters, Poincare::Coordinate2D<float> * xy, void * model, void * context);
+  /* EnclosureForParameters sets [xyMin, xyMax] to a box containing the curve
+   * for parameters in [t1, t2]. It returns false if no such box is known. */
+  typedef bool (*EnclosureForParameters)(float t1, float t2, Poincare::Coordinate2D<float> * xyMin, Poincare::Coordinate2D<float> * xyMax, void * model, void * context);
   typedef float (*EvaluateYForX)(float x, void * model, void * context);
+  /* The circuit breaker tells the curve views refining their drawing to stop,
+   * for instance when a key is down. */
+  typedef bool (*CircuitBreaker)();
+  static void SetDrawingCircuitBreaker(CircuitBreaker cb) { s_drawingCircuitBreaker = cb; }
   enum class Axis {
     Horizontal = 0,
     Vertical = 1
@@ -74,8 +83,11 @@ protected:
   void drawGrid(KDContext * ctx, KDRect rect) const;
   void drawAxes(KDContext * ctx, KDRect rect) const;
   void drawAxis(KDContext * ctx, KDRect rect, Axis axis) const;
-  void drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick = true, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f) const;
-  void drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForParameter xyEvaluation, void * model, void * context, KDColor color, bool thick = true, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f) const;
+  /* The curve is sampled every tStep. Samples are evaluated by batches with
+   * xyBatchEvaluation when it is provided, xyEvaluation being used for the
+   * extra dots needed to join the samples. */
+  void drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick = true, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EvaluateXYForParameters xyBatchEvaluation = nullptr, EnclosureForParameters xyEnclosure = nullptr) const;
+  void drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForParameter xyEvaluation, void * model, void * context, KDColor color, bool thick = true, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EvaluateXYForParameters xyBatchEvaluation = nullptr, EnclosureForParameters xyEnclosure = nullptr) const;
   void drawHistogram(KDContext * ctx, KDRect rect, EvaluateYForX yEvaluation, void * model, void * context, float firstBarAbscissa, float barWidth,
     bool fillBar, KDColor defaultColor, KDColor highlightColor,  float highlightLowerBound = INFINITY, float highlightUpperBound = -INFINITY) const;
   void computeLabels(Axis axis);
@@ -88,30 +100,105 @@ protected:
   // Draw the label at the above/below and to the left/right of the given position
   void drawLabel(KDContext * ctx, KDRect rect, float xPosition, float yPosition, const char * label, KDColor color, RelativePosition horizontalPosition, RelativePosition verticalPosition) const;
   void drawLabelsAndGraduations(KDContext * ctx, KDRect rect, Axis axis, bool shiftOrigin, bool graduationOnly = false, bool fixCoordinate = false, KDCoordinate fixedCoordinate = 0, KDColor backgroundColor = KDColorWhite) const;
+  /* A view drawing the same pixels when its range is translated by a whole
+   * number of pixels can be panned by moving its drawn pixels: only the strips
+   * uncovered by the move, the floating labels and the subviews are then
+   * redrawn. */
+  virtual bool movesDrawnPixelsOnPan() const { return false; }
+  // Return whether the range is the drawn range translated by offset pixels
+  bool isTranslationOfDrawnRange(KDPoint * offset) const;
+  /* Compute the labels of the translated range and return whether the values
+   * that were already labelled kept the same labels. */
+  bool computeLabelsOfTranslatedRange(Axis axis);
+  enum class Discontinuity : uint8_t {
+    None,
+    Jump,
+    Pole
+  };
+  /* Classify the jump between the dots (t, x, y) and (s, u, v) by halving the
+   * parameter interval around it down to the float resolution. The jump of a
+   * continuous function, however steep, ends up shared out between the
+   * halves. A pole is told from a jump by the growth of the jump, unless the
+   * enclosure of the curve between the dots is bounded. */
+  Discontinuity discontinuityBetweenDots(EvaluateXYForParameter xyEvaluation, EnclosureForParameters xyEnclosure, void * model, void * context, float t, float x, float y, float s, float u, float v) const;
+  /* A view whose curves are slow to draw can draw them progressively: when
+   * the whole view is redrawn for a new range, the curves are first sampled
+   * every k_coarsestSamplingStepFactor pixels. The sampling step is then
+   * halved each time the run loop is idle, until the curves are sampled every
+   * pixel. A refining drawing interrupted by the circuit breaker completes its
+   * curves coarsely and is done again later. */
+  virtual bool drawsProgressively() const { return false; }
+  bool markRectToRefineAsDirty() override;
   View * m_bannerView;
   CurveViewCursor * m_curveViewCursor;
 private:
+  enum class FloatingPosition : uint8_t {
+    None,
+    Min,
+    Max
+  };
+  /* A Polyline gathers the consecutive segments joining the dots of a curve to
+   * draw them at once with KDContext::drawAntialiasedPolyline. */
+  class Polyline {
+  public:
+    Polyline(KDContext * ctx, KDColor color, bool thick);
+    float thickness() const { return m_thickness; }
+    void addDot(float x, float y) { addSegment(x, y, x, y); }
+    void addSegment(float x1, float y1, float x2, float y2);
+    void flush();
+  private:
+    constexpr static int k_maxNumberOfPoints = 64;
+    KDContext * m_context;
+    KDColor m_color;
+    float m_thickness;
+    int m_numberOfPoints;
+    float m_x[k_maxNumberOfPoints];
+    float m_y[k_maxNumberOfPoints];
+    KDColor m_workingBuffer[Ion::Display::Width];
+  };
   static constexpr const KDFont * k_font = KDFont::SmallFont;
+  /* The range may be translated by a fraction of pixel before the drawn pixels
+   * stop matching the drawing of the new range. */
+  constexpr static float k_maxDrawnPixelsDrift = 0.02f;
+  constexpr static uint8_t k_coarsestSamplingStepFactor = 8;
+  static CircuitBreaker s_drawingCircuitBreaker;
+  /* Return the factor by which to multiply the sampling step of the curves
+   * drawn in rect, keeping track of rect if the drawing is coarse. */
+  int samplingStepFactor(KDRect rect) const;
+  // Return whether a refining drawing should stop
+  bool shouldInterruptDrawing() const;
   // returns the coordinates where should be drawn the label knowing the coordinates of its graduation and its relative position
    KDPoint positionLabel(KDCoordinate xPosition, KDCoordinate yPosition, KDSize labelSize, RelativePosition horizontalPosition, RelativePosition verticalPosition) const;
   void drawGridLines(KDContext * ctx, KDRect rect, Axis axis, float step, KDColor boldColor, KDColor lightColor) const;
+  /* If an axis is not visible, its labels float on an edge of the view.
+   * horizontalCoordinate and verticalCoordinate are the pixel coordinates of
+   * the vertical and horizontal axes. */
+  FloatingPosition floatingLabelsPosition(Axis axis, bool graduationOnly, float horizontalCoordinate, float verticalCoordinate, KDCoordinate viewHeight) const;
+  FloatingPosition floatingLabelsPosition(Axis axis) const;
+  KDCoordinate labelsViewHeight() const;
   /* The window bounds are deduced from the model bounds but also take into
   account a margin (computed with k_marginFactor) */
   float min(Axis axis) const;
   float max(Axis axis) const;
   float gridUnit(Axis axis) const;
+  KDCoordinate numberOfPixels(Axis axis) const;
+  bool isDrawnRange(Axis axis) const;
+  void pixelFrame(Axis axis, float * origin, float * pixelSize, int * shift) const;
   virtual char * label(Axis axis, int index) const = 0;
   virtual size_t labelMaxGlyphLengthSize() const { return k_labelBufferMaxGlyphLength; }
   int numberOfLabels(Axis axis) const;
+  KDCoordinate maxLabelWidth() const;
+  bool moveDrawnPixels(KDRect rect, KDPoint offset);
   /* Recursively join two dots (dichotomy). The method stops when the
-   * maxNumberOfRecursion in reached. */
-  void joinDots(KDContext * ctx, KDRect rect, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, float t, float x, float y, float s, float u, float v, KDColor color, bool thick, int maxNumberOfRecursion) const;
+   * maxNumberOfRecursion in reached. When an enclosure of the curve between
+   * the dots is known, the dichotomy also stops if the curve is out of rect or
+   * stays in the box of the two dots. It also stops without joining the dots
+   * when the jump between them stays concentrated in one half of the interval
+   * on several consecutive levels (numberOfDiscontinuityLevels counts them)
+   * and discontinuityBetweenDots confirms a pole or a jump there. */
+  void joinDots(Polyline * polyline, KDRect rect, EvaluateXYForParameter xyEvaluation, EnclosureForParameters xyEnclosure, void * model, void * context, bool drawStraightLinesEarly, float t, float x, float y, float s, float u, float v, int maxNumberOfRecursion, int numberOfDiscontinuityLevels) const;
   /* Join two dots with a straight line. */
-  void straightJoinDots(KDContext * ctx, KDRect rect, float pxf, float pyf, float puf, float pvf, KDColor color, bool thick) const;
-  /* Stamp centered around (pxf, pyf). If pxf and pyf are not round number, the
-   * function shifts the stamp (by blending adjacent pixel colors) to draw with
-   * anti alising. */
-  void stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color, bool thick) const;
+  void straightJoinDots(Polyline * polyline, KDRect rect, float pxf, float pyf, float puf, float pvf) const;
   void layoutSubviews(bool force = false) override;
   KDRect cursorFrame();
   KDRect bannerFrame();
@@ -129,6 +216,36 @@ private:
   bool m_forceOkDisplay;
   bool m_mainViewSelected;
   uint32_t m_drawnRangeVersion;
+  uint8_t m_samplingStepFactor;
+  mutable bool m_drawingInterrupted;
+  mutable KDRect m_coarselyDrawnRect;
+  /* Along each axis, the pixel coordinate of a value is computed in a frame
+   * set by the range when it is reloaded. When the range is translated by a
+   * whole number of pixels, the frame is only shifted by this number: the
+   * pixels of a value then move by exactly the offset of the drawn pixels. */
+  struct DrawnAxis {
+    DrawnAxis() :
+      min(NAN),
+      max(NAN),
+      numberOfPixels(0),
+      gridUnit(NAN),
+      floatingLabels(FloatingPosition::None),
+      origin(NAN),
+      pixelSize(NAN),
+      shift(0)
+    {}
+    // Range reloaded
+    float min;
+    float max;
+    KDCoordinate numberOfPixels;
+    float gridUnit;
+    FloatingPosition floatingLabels;
+    // Frame: the value origin is at pixel -shift
+    float origin;
+    float pixelSize;
+    int shift;
+  };
+  DrawnAxis m_drawnAxes[2];
 };
 
 }
@@ -44,12 +44,19 @@ KDColor Function::color() const {
 
 void Function::setActive(bool active) {
   recordData()->setActive(active);
+  valueDidChangeInPlace();
 }
 
 int Function::printValue(double cursorT, double cursorX, double cursorY, char * buffer, int bufferSize, int precision, Poincare::Context * context) {
   return PoincareHelpers::ConvertFloatToText<double>(cursorY, buffer, bufferSize, precision);
 }
 
+void Function::evaluateXYAtParameters(const float * t, int numberOfParameters, Poincare::Coordinate2D<float> * xy, Poincare::Context * context) const {
+  for (int i = 0; i < numberOfParameters; i++) {
+    xy[i] = evaluateXYAtParameter(t[i], context);
+  }
+}
+
 int Function::name(char * buffer, size_t bufferSize) {
   return SymbolAbstract::TruncateExtension(buffer, fullName(), bufferSize);
 }
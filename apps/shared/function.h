@@ -52,6 +52,8 @@ public:
   // Evaluation
   virtual Poincare::Coordinate2D<float> evaluateXYAtParameter(float t, Poincare::Context * context) const = 0;
   virtual Poincare::Coordinate2D<double> evaluateXYAtParameter(double t, Poincare::Context * context) const = 0;
+  // Fills xy[i] with the evaluation at t[i]
+  virtual void evaluateXYAtParameters(const float * t, int numberOfParameters, Poincare::Coordinate2D<float> * xy, Poincare::Context * context) const;
   virtual Poincare::Expression sumBetweenBounds(double start, double end, Poincare::Context * context) const = 0;
 protected:
   /* RecordDataBuffer is the layout of the data buffer of Record
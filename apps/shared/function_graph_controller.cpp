@@ -14,6 +14,7 @@ static inline float minFloat(float x, float y) { return x < y ? x : y; }
 static inline float maxFloat(float x, float y) { return x > y ? x : y; }
 static inline double minDouble(double x, double y) { return x < y ? x : y; }
 static inline double maxDouble(double x, double y) { return x > y ? x : y; }
+static inline int minInt(int x, int y) { return x < y ? x : y; }
 
 FunctionGraphController::FunctionGraphController(Responder * parentResponder, InputEventHandlerDelegate * inputEventHandlerDelegate, ButtonRowController * header, InteractiveCurveViewRange * interactiveRange, CurveView * curveView, CurveViewCursor * cursor, int * indexFunctionSelectedByCursor, uint32_t * modelVersion, uint32_t * rangeVersion, Preferences::AngleUnit * angleUnitVersion) :
   InteractiveCurveViewController(parentResponder, inputEventHandlerDelegate, header, interactiveRange, curveView, cursor, modelVersion, rangeVersion),
@@ -106,15 +107,24 @@ InteractiveCurveViewRangeDelegate::Range FunctionGraphController::computeYRange(
     float rangeStep = f->rangeStep();
     const float step = std::isnan(rangeStep) ? curveView()->pixelWidth() / 2.0f : rangeStep;
     const int balancedBound = std::floor((tMax-tMin)/2/step);
-    for (int j = -balancedBound; j <= balancedBound ; j++) {
-      float t = (tMin+tMax)/2 + step * j;
-      Coordinate2D<float> xy = f->evaluateXYAtParameter(t, context);
-      float x = xy.x1();
-      if (!std::isnan(x) && !std::isinf(x) && x >= xMin && x <= xMax) {
-        float y = xy.x2();
-        if (!std::isnan(y) && !std::isinf(y)) {
-          min = minFloat(min, y);
-          max = maxFloat(max, y);
+    // Sample the function by batches
+    constexpr int batchSize = 16;
+    float t[batchSize];
+    Coordinate2D<float> xy[batchSize];
+    for (int j = -balancedBound; j <= balancedBound ; j += batchSize) {
+      const int numberOfSamples = minInt(batchSize, balancedBound - j + 1);
+      for (int k = 0; k < numberOfSamples; k++) {
+        t[k] = (tMin+tMax)/2 + step * (j + k);
+      }
+      f->evaluateXYAtParameters(t, numberOfSamples, xy, context);
+      for (int k = 0; k < numberOfSamples; k++) {
+        float x = xy[k].x1();
+        if (!std::isnan(x) && !std::isinf(x) && x >= xMin && x <= xMax) {
+          float y = xy[k].x2();
+          if (!std::isnan(y) && !std::isinf(y)) {
+            min = minFloat(min, y);
+            max = maxFloat(max, y);
+          }
         }
       }
     }
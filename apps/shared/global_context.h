@@ -30,6 +30,8 @@ public:
   SymbolAbstractType expressionTypeForIdentifier(const char * identifier, int length) override;
   const Poincare::Expression expressionForSymbolAbstract(const Poincare::SymbolAbstract & symbol, bool clone) override;
   void setExpressionForSymbolAbstract(const Poincare::Expression & expression, const Poincare::SymbolAbstract & symbol) override;
+  // All the definitions are records of the shared storage
+  uint32_t version() const override { return Ion::Storage::sharedStorage()->version(); }
 
 private:
   // Expression getters
@@ -86,7 +86,8 @@ bool InteractiveCurveViewController::handleEvent(Ion::Events::Event event) {
     if (moveCursorVertically(direction)) {
       interactiveCurveViewRange()->panToMakePointVisible(
         m_cursor->x(), m_cursor->y(),
-        cursorTopMarginRatio(), k_cursorRightMarginRatio, cursorBottomMarginRatio(), k_cursorLeftMarginRatio
+        cursorTopMarginRatio(), k_cursorRightMarginRatio, cursorBottomMarginRatio(), k_cursorLeftMarginRatio,
+        curveView()->pixelWidth(), curveView()->pixelHeight()
       );
       reloadBannerView();
       curveView()->reload();
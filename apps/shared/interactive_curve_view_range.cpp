@@ -201,29 +201,38 @@ void InteractiveCurveViewRange::centerAxisAround(Axis axis, float position) {
   }
 }
 
-void InteractiveCurveViewRange::panToMakePointVisible(float x, float y, float topMarginRatio, float rightMarginRatio, float bottomMarginRation, float leftMarginRation) {
+static float snappedTranslation(float translation, float pixelSize) {
+  if (std::isnan(pixelSize)) {
+    return translation;
+  }
+  // Round away from zero so that the point stays within the margins
+  float numberOfPixels = translation/pixelSize;
+  return (translation < 0.0f ? std::floor(numberOfPixels) : std::ceil(numberOfPixels)) * pixelSize;
+}
+
+void InteractiveCurveViewRange::panToMakePointVisible(float x, float y, float topMarginRatio, float rightMarginRatio, float bottomMarginRation, float leftMarginRation, float pixelWidth, float pixelHeight) {
   float xRange = xMax() - xMin();
   float yRange = yMax() - yMin();
   if (x < xMin() + leftMarginRation*xRange - FLT_EPSILON && !std::isinf(x) && !std::isnan(x)) {
     m_yAuto = false;
-    float newXMin = x - leftMarginRation*xRange;
+    float newXMin = xMin() + snappedTranslation(x - leftMarginRation*xRange - xMin(), pixelWidth);
     m_xRange.setMax(newXMin + xRange, k_lowerMaxFloat, k_upperMaxFloat);
     MemoizedCurveViewRange::protectedSetXMin(newXMin, k_lowerMaxFloat, k_upperMaxFloat);
   }
   if (x > xMax() - rightMarginRatio*xRange + FLT_EPSILON && !std::isinf(x) && !std::isnan(x)) {
     m_yAuto = false;
-    m_xRange.setMax(x + rightMarginRatio*xRange, k_lowerMaxFloat, k_upperMaxFloat);
+    m_xRange.setMax(xMax() + snappedTranslation(x + rightMarginRatio*xRange - xMax(), pixelWidth), k_lowerMaxFloat, k_upperMaxFloat);
     MemoizedCurveViewRange::protectedSetXMin(xMax() - xRange, k_lowerMaxFloat, k_upperMaxFloat);
   }
   if (y < yMin() + bottomMarginRation*yRange - FLT_EPSILON && !std::isinf(y) && !std::isnan(y)) {
     m_yAuto = false;
-    float newYMin = y - bottomMarginRation*yRange;
+    float newYMin = yMin() + snappedTranslation(y - bottomMarginRation*yRange - yMin(), pixelHeight);
     m_yRange.setMax(newYMin + yRange, k_lowerMaxFloat, k_upperMaxFloat);
     MemoizedCurveViewRange::protectedSetYMin(newYMin, k_lowerMaxFloat, k_upperMaxFloat);
   }
   if (y > yMax() - topMarginRatio*yRange + FLT_EPSILON && !std::isinf(y) && !std::isnan(y)) {
     m_yAuto = false;
-    m_yRange.setMax(y + topMarginRatio*yRange, k_lowerMaxFloat, k_upperMaxFloat);
+    m_yRange.setMax(yMax() + snappedTranslation(y + topMarginRatio*yRange - yMax(), pixelHeight), k_lowerMaxFloat, k_upperMaxFloat);
     MemoizedCurveViewRange::protectedSetYMin(yMax() - yRange, k_lowerMaxFloat, k_upperMaxFloat);
   }
 }
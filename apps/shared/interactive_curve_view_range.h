@@ -6,6 +6,7 @@
 #include "interactive_curve_view_range_delegate.h"
 #include <ion/display.h>
 #include <float.h>
+#include <cmath>
 
 namespace Shared {
 
@@ -37,7 +38,9 @@ public:
   virtual void setTrigonometric();
   virtual void setDefault();
   void centerAxisAround(Axis axis, float position);
-  void panToMakePointVisible(float x, float y, float topMarginRatio, float rightMarginRatio, float bottomMarginRation, float leftMarginRation);
+  /* When the pixel sizes are given, the range is translated by a whole number
+   * of pixels so that the curve view can move its drawn pixels. */
+  void panToMakePointVisible(float x, float y, float topMarginRatio, float rightMarginRatio, float bottomMarginRation, float leftMarginRation, float pixelWidth = NAN, float pixelHeight = NAN);
 protected:
   constexpr static float k_upperMaxFloat = 1E+8f;
   constexpr static float k_lowerMaxFloat = 9E+7f;
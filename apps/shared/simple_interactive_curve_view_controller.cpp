@@ -48,7 +48,8 @@ bool SimpleInteractiveCurveViewController::handleLeftRightEvent(Ion::Events::Eve
   if (moveCursorHorizontally(direction, Ion::Events::isLongRepetition())) {
     interactiveCurveViewRange()->panToMakePointVisible(
       m_cursor->x(), m_cursor->y(),
-      cursorTopMarginRatio(), k_cursorRightMarginRatio, cursorBottomMarginRatio(), k_cursorLeftMarginRatio
+      cursorTopMarginRatio(), k_cursorRightMarginRatio, cursorBottomMarginRatio(), k_cursorLeftMarginRatio,
+      curveView()->pixelWidth(), curveView()->pixelHeight()
     );
     reloadBannerView();
     curveView()->reload();
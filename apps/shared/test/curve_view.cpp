@@ -0,0 +1,162 @@
+#include <quiz.h>
+#include <cmath>
+#include "../curve_view.h"
+
+namespace Shared {
+
+class TranslatedRange : public CurveViewRange {
+public:
+  TranslatedRange() : m_xMin(-30.0f), m_xMax(30.0f), m_yMin(-10.0f), m_yMax(10.0f), m_xGridUnit(NAN) {}
+  float xMin() const override { return m_xMin; }
+  float xMax() const override { return m_xMax; }
+  float yMin() const override { return m_yMin; }
+  float yMax() const override { return m_yMax; }
+  float xGridUnit() const override { return std::isnan(m_xGridUnit) ? CurveViewRange::xGridUnit() : m_xGridUnit; }
+  void translate(float dx, float dy) {
+    m_xMin += dx;
+    m_xMax += dx;
+    m_yMin += dy;
+    m_yMax += dy;
+  }
+  void setXMax(float xMax) { m_xMax = xMax; }
+  void setXGridUnit(float gridUnit) { m_xGridUnit = gridUnit; }
+private:
+  float m_xMin;
+  float m_xMax;
+  float m_yMin;
+  float m_yMax;
+  float m_xGridUnit;
+};
+
+class TranslatedCurveView : public CurveView {
+public:
+  static constexpr KDCoordinate k_width = 320;
+  static constexpr KDCoordinate k_height = 200;
+  TranslatedCurveView(TranslatedRange * range) :
+    CurveView(range),
+    m_labelMaxGlyphLength(k_labelBufferMaxGlyphLength)
+  {
+    setFrame(KDRect(0, 0, k_width, k_height), false);
+  }
+  void drawRect(KDContext * ctx, KDRect rect) const override {}
+  bool isTranslation(KDPoint * offset) const { return isTranslationOfDrawnRange(offset); }
+  bool labelsAreTranslated() { return computeLabelsOfTranslatedRange(Axis::Horizontal); }
+  void setLabelMaxGlyphLength(size_t length) { m_labelMaxGlyphLength = length; }
+  using CurveView::Discontinuity;
+  Discontinuity discontinuity(EvaluateXYForParameter xyEvaluation, EnclosureForParameters xyEnclosure, float t, float s) const {
+    Poincare::Coordinate2D<float> xy = xyEvaluation(t, nullptr, nullptr);
+    Poincare::Coordinate2D<float> uv = xyEvaluation(s, nullptr, nullptr);
+    return discontinuityBetweenDots(xyEvaluation, xyEnclosure, nullptr, nullptr, t, xy.x1(), xy.x2(), s, uv.x1(), uv.x2());
+  }
+private:
+  constexpr static int k_maxNumberOfLabels = k_maxNumberOfXLabels > k_maxNumberOfYLabels ? k_maxNumberOfXLabels : k_maxNumberOfYLabels;
+  bool movesDrawnPixelsOnPan() const override { return true; }
+  char * label(Axis axis, int index) const override { return const_cast<char *>(m_labels[static_cast<int>(axis)][index]); }
+  size_t labelMaxGlyphLengthSize() const override { return m_labelMaxGlyphLength; }
+  char m_labels[2][k_maxNumberOfLabels][k_labelBufferMaxSize];
+  size_t m_labelMaxGlyphLength;
+};
+
+QUIZ_CASE(shared_curve_view_translation_of_drawn_range) {
+  TranslatedRange range;
+  TranslatedCurveView view(&range);
+  view.reload();
+  const float pixelWidth = (range.xMax() - range.xMin())/(TranslatedCurveView::k_width - 1);
+  const float pixelHeight = (range.yMax() - range.yMin())/(TranslatedCurveView::k_height - 1);
+  KDPoint offset = KDPointZero;
+
+  // Whole numbers of pixels, the drawn pixels move the other way round
+  range.translate(3 * pixelWidth, 0.0f);
+  quiz_assert(view.isTranslation(&offset) && offset == KDPoint(-3, 0));
+  range.translate(-5 * pixelWidth, -2 * pixelHeight);
+  quiz_assert(view.isTranslation(&offset) && offset == KDPoint(2, -2));
+  view.reload();
+  range.translate(0.0f, 7 * pixelHeight);
+  quiz_assert(view.isTranslation(&offset) && offset == KDPoint(0, 7));
+  view.reload();
+
+  // Fractions of pixel
+  range.translate(0.5f * pixelWidth, 0.0f);
+  quiz_assert(!view.isTranslation(&offset));
+  range.translate(-0.5f * pixelWidth, 0.1f * pixelHeight);
+  quiz_assert(!view.isTranslation(&offset));
+  range.translate(0.0f, -0.1f * pixelHeight);
+  quiz_assert(view.isTranslation(&offset) && offset == KDPointZero);
+
+  // Translations beyond the view
+  range.translate(TranslatedCurveView::k_width * pixelWidth, 0.0f);
+  quiz_assert(!view.isTranslation(&offset));
+  range.translate(-TranslatedCurveView::k_width * pixelWidth, 0.0f);
+
+  // The pixel size drifts from the drawn one
+  const float xMax = range.xMax();
+  range.setXMax(xMax + 0.05f * pixelWidth);
+  quiz_assert(!view.isTranslation(&offset));
+  range.setXMax(xMax);
+  quiz_assert(view.isTranslation(&offset));
+
+  // The grid unit changes
+  range.setXGridUnit(2.0f * range.xGridUnit());
+  quiz_assert(!view.isTranslation(&offset));
+  range.setXGridUnit(NAN);
+  quiz_assert(view.isTranslation(&offset));
+}
+
+Poincare::Coordinate2D<float> tangent(float t, void * model, void * context) { return Poincare::Coordinate2D<float>(t, std::tan(t)); }
+Poincare::Coordinate2D<float> inverse(float t, void * model, void * context) { return Poincare::Coordinate2D<float>(t, 1.0f/(t - 1.0f)); }
+Poincare::Coordinate2D<float> floorOf(float t, void * model, void * context) { return Poincare::Coordinate2D<float>(t, std::floor(t)); }
+Poincare::Coordinate2D<float> steepTanh(float t, void * model, void * context) { return Poincare::Coordinate2D<float>(t, std::tanh(1000.0f*(t - 0.5f))); }
+Poincare::Coordinate2D<float> steepLogistic(float t, void * model, void * context) { return Poincare::Coordinate2D<float>(t, 5.0f/(1.0f + std::exp(-10000.0f*t))); }
+
+bool boundedEnclosure(float t1, float t2, Poincare::Coordinate2D<float> * xyMin, Poincare::Coordinate2D<float> * xyMax, void * model, void * context) {
+  *xyMin = Poincare::Coordinate2D<float>(t1, -5.0f);
+  *xyMax = Poincare::Coordinate2D<float>(t2, 5.0f);
+  return true;
+}
+
+bool unboundedEnclosure(float t1, float t2, Poincare::Coordinate2D<float> * xyMin, Poincare::Coordinate2D<float> * xyMax, void * model, void * context) {
+  *xyMin = Poincare::Coordinate2D<float>(t1, -INFINITY);
+  *xyMax = Poincare::Coordinate2D<float>(t2, INFINITY);
+  return true;
+}
+
+QUIZ_CASE(shared_curve_view_discontinuity_between_dots) {
+  typedef TranslatedCurveView::Discontinuity Discontinuity;
+  TranslatedRange range;
+  TranslatedCurveView view(&range);
+  // Poles
+  quiz_assert(view.discontinuity(tangent, nullptr, 1.5f, 1.65f) == Discontinuity::Pole);
+  quiz_assert(view.discontinuity(tangent, unboundedEnclosure, 1.5f, 1.65f) == Discontinuity::Pole);
+  quiz_assert(view.discontinuity(inverse, nullptr, 0.95f, 1.05f) == Discontinuity::Pole);
+  quiz_assert(view.discontinuity(inverse, nullptr, 0.9f, 1.3f) == Discontinuity::Pole);
+  // Jumps
+  quiz_assert(view.discontinuity(floorOf, nullptr, 1.9f, 2.1f) == Discontinuity::Jump);
+  quiz_assert(view.discontinuity(floorOf, boundedEnclosure, -3.05f, -2.95f) == Discontinuity::Jump);
+  // Continuous curves, however steep
+  quiz_assert(view.discontinuity(floorOf, nullptr, 1.2f, 1.4f) == Discontinuity::None);
+  quiz_assert(view.discontinuity(steepTanh, nullptr, 0.4f, 0.6f) == Discontinuity::None);
+  quiz_assert(view.discontinuity(steepTanh, boundedEnclosure, 0.45f, 0.55f) == Discontinuity::None);
+  quiz_assert(view.discontinuity(steepLogistic, nullptr, -0.1f, 0.1f) == Discontinuity::None);
+}
+
+QUIZ_CASE(shared_curve_view_labels_of_translated_range) {
+  TranslatedRange range;
+  TranslatedCurveView view(&range);
+  view.reload();
+  const float pixelWidth = (range.xMax() - range.xMin())/(TranslatedCurveView::k_width - 1);
+
+  // The labels of the values still shown are kept
+  range.translate(40 * pixelWidth, 0.0f);
+  quiz_assert(view.labelsAreTranslated());
+  view.reload();
+  range.translate(-90 * pixelWidth, 0.0f);
+  quiz_assert(view.labelsAreTranslated());
+  view.reload();
+
+  // Shorter labels do not fit anymore
+  view.setLabelMaxGlyphLength(2);
+  range.translate(40 * pixelWidth, 0.0f);
+  quiz_assert(!view.labelsAreTranslated());
+}
+
+}
@@ -0,0 +1,50 @@
+#include <quiz.h>
+#include <cmath>
+#include "../interactive_curve_view_range.h"
+
+namespace Shared {
+
+void assert_translation_is(float translation, float expectedTranslation, float pixelSize) {
+  if (std::isnan(pixelSize)) {
+    quiz_assert(std::fabs(translation - expectedTranslation) < 1e-5f);
+    return;
+  }
+  // The translation is the smallest whole number of pixels beyond the expected one
+  float numberOfPixels = translation/pixelSize;
+  quiz_assert(std::fabs(numberOfPixels - std::round(numberOfPixels)) < 1e-3f);
+  quiz_assert(std::fabs(translation) >= std::fabs(expectedTranslation) - 1e-5f);
+  quiz_assert(std::fabs(translation) < std::fabs(expectedTranslation) + pixelSize);
+}
+
+void assert_pan_to_point_is(float x, float y, float expectedXTranslation, float expectedYTranslation, float pixelWidth, float pixelHeight) {
+  InteractiveCurveViewRange range;
+  range.setYAuto(false);
+  range.setXMin(-10.0f);
+  range.setXMax(10.0f);
+  range.setYMin(-5.0f);
+  range.setYMax(5.0f);
+  constexpr float margin = 0.1f;
+  range.panToMakePointVisible(x, y, margin, margin, margin, margin, pixelWidth, pixelHeight);
+  assert_translation_is(range.xMin() + 10.0f, expectedXTranslation, pixelWidth);
+  assert_translation_is(range.xMax() - 10.0f, expectedXTranslation, pixelWidth);
+  assert_translation_is(range.yMin() + 5.0f, expectedYTranslation, pixelHeight);
+  assert_translation_is(range.yMax() - 5.0f, expectedYTranslation, pixelHeight);
+}
+
+QUIZ_CASE(shared_interactive_curve_view_range_pan_to_point) {
+  constexpr float pixelWidth = 20.0f/319.0f;
+  constexpr float pixelHeight = 10.0f/199.0f;
+  // The point is kept at the margin, 2 units from the horizontal edges
+  assert_pan_to_point_is(10.3f, 0.0f, 2.3f, 0.0f, NAN, NAN);
+  assert_pan_to_point_is(-13.0f, 0.0f, -5.0f, 0.0f, NAN, NAN);
+  assert_pan_to_point_is(0.0f, 4.7f, 0.0f, 0.7f, NAN, NAN);
+  // Given the pixel sizes, the translations are snapped to whole pixels
+  assert_pan_to_point_is(10.3f, 0.0f, 2.3f, 0.0f, pixelWidth, pixelHeight);
+  assert_pan_to_point_is(-13.0f, 0.0f, -5.0f, 0.0f, pixelWidth, pixelHeight);
+  assert_pan_to_point_is(0.0f, 4.7f, 0.0f, 0.7f, pixelWidth, pixelHeight);
+  assert_pan_to_point_is(-8.3f, -4.3f, -0.3f, -0.3f, pixelWidth, pixelHeight);
+  // Points within the margins do not move the range
+  assert_pan_to_point_is(7.9f, -3.9f, 0.0f, 0.0f, pixelWidth, pixelHeight);
+}
+
+}
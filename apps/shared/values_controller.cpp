@@ -265,6 +265,12 @@ void ValuesController::didChangeCell(int column, int row) {
   }
 }
 
+void ValuesController::fillMemoizedBuffers(int i, const int * rows, const int * indexes, int numberOfCells) {
+  for (int k = 0; k < numberOfCells; k++) {
+    fillMemoizedBuffer(i, rows[k], indexes[k]);
+  }
+}
+
 int ValuesController::numberOfElementsInColumn(int columnIndex) const {
   return const_cast<ValuesController *>(this)->intervalAtColumn(columnIndex)->numberOfElements();
 }
@@ -340,14 +346,20 @@ char * ValuesController::memoizedBufferForCell(int i, int j) {
     int maxI = numberOfValuesColumns() - m_firstMemoizedColumn;
     for (int ii = 0; ii < minInt(nbOfMemoizedColumns, maxI); ii++) {
       int maxJ = numberOfElementsInColumn(absoluteColumnForValuesColumn(ii+m_firstMemoizedColumn)) - m_firstMemoizedRow;
+      int rows[k_maxNumberOfDisplayableRows];
+      int indexes[k_maxNumberOfDisplayableRows];
+      int numberOfCells = 0;
       for (int jj = 0; jj < minInt(k_maxNumberOfDisplayableRows, maxJ); jj++) {
         // Escape if already filled
         if (ii >= -offsetI && ii < -offsetI + nbOfMemoizedColumns && jj >= -offsetJ && jj < -offsetJ + k_maxNumberOfDisplayableRows) {
           continue;
         }
-        fillMemoizedBuffer(absoluteColumnForValuesColumn(m_firstMemoizedColumn + ii),
-            absoluteRowForValuesRow(m_firstMemoizedRow + jj),
-            jj * nbOfMemoizedColumns + ii);
+        rows[numberOfCells] = absoluteRowForValuesRow(m_firstMemoizedRow + jj);
+        indexes[numberOfCells] = jj * nbOfMemoizedColumns + ii;
+        numberOfCells++;
+      }
+      if (numberOfCells > 0) {
+        fillMemoizedBuffers(absoluteColumnForValuesColumn(m_firstMemoizedColumn + ii), rows, indexes, numberOfCells);
       }
     }
   }
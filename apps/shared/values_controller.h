@@ -86,6 +86,9 @@ protected:
   void resetMemoization();
   virtual char * memoizedBufferAtIndex(int i) = 0;
   virtual int numberOfMemoizedColumn() = 0;
+  /* fillMemoizedBuffers fills the buffers of several cells of the column i,
+   * which subclasses can evaluate at once. */
+  virtual void fillMemoizedBuffers(int i, const int * rows, const int * indexes, int numberOfCells);
 private:
   // Specialization depending on the abscissa names (x, n, t...)
   virtual void setStartEndMessages(Shared::IntervalParameterController * controller, int column) = 0;
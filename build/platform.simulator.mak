@@ -1,6 +1,8 @@
 USE_LIBA = 0
 ION_KEYBOARD_LAYOUT = layout_B2
 EPSILON_GETOPT = 1
+# The TreePool has the size of the device one, 32 KB, unless a larger one is
+# requested, e.g. make PLATFORM=simulator POINCARE_TREE_POOL_SIZE=196608
 
 SFLAGS += -fPIE
 
@@ -33,6 +33,7 @@ public:
   virtual bool switchTo(App::Snapshot * snapshot);
 protected:
   virtual Window * window() = 0;
+  bool refineDrawing() override;
   static App * s_activeApp;
 private:
   void step();
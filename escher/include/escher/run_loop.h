@@ -13,7 +13,12 @@ protected:
   virtual bool dispatchEvent(Ion::Events::Event e) = 0;
   virtual int numberOfTimers();
   virtual Timer * timerAtIndex(int i);
+  /* Carry on with the drawings left coarse, and return false when they are
+   * all final. */
+  virtual bool refineDrawing() { return false; }
 private:
+  // Let duration milliseconds elapse for the timers
+  void fireTimers(int duration);
   bool step();
   int m_time;
 };
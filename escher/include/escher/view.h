@@ -76,6 +76,19 @@ protected:
    *  - ... and that's all I can think of.
    */
   virtual void markRectAsDirty(KDRect rect);
+  /* When the view is on screen and has nothing left to redraw, scrolling its
+   * content can move the drawn pixels instead of redrawing them:
+   * translateDrawnPixels moves the pixels of rect by offset and returns true.
+   * The parts of rect uncovered by the move can then be drawn right away with
+   * drawRectNow. Subviews are neither moved nor redrawn: their former and new
+   * frames have to be marked as dirty. */
+  bool translateDrawnPixels(KDRect rect, KDPoint offset);
+  void drawRectNow(KDRect rect);
+  /* A view can draw a coarse version of its content first, for it to appear
+   * quickly, and refine it when the run loop is idle. Until its drawing is
+   * final, markRectToRefineAsDirty marks as dirty the part to draw again and
+   * returns true. */
+  virtual bool markRectToRefineAsDirty() { return false; }
 #if ESCHER_VIEW_LOGGING
   virtual const char * className() const;
   virtual void logAttributes(std::ostream &os) const;
@@ -87,6 +100,7 @@ private:
   virtual void layoutSubviews(bool force = false) {}
   virtual const Window * window() const;
   KDRect redraw(KDRect rect, KDRect forceRedrawRect = KDRectZero);
+  bool markRectsToRefineAsDirty();
   KDPoint absoluteOrigin() const;
   KDRect absoluteVisibleFrame() const;
 
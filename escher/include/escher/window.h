@@ -7,6 +7,8 @@ class Window : public View {
 public:
   Window() : m_contentView(nullptr) {}
   void redraw(bool force = false);
+  // Redraw the views refining their drawing, return false if there are none
+  bool refineDrawing();
   void setContentView(View * contentView);
 protected:
 #if ESCHER_VIEW_LOGGING
@@ -67,6 +67,10 @@ Timer * Container::timerAtIndex(int i) {
   return containerTimerAtIndex(i-s_activeApp->numberOfTimers());
 }
 
+bool Container::refineDrawing() {
+  return window()->refineDrawing();
+}
+
 int Container::numberOfContainerTimers() {
   return 0;
 }
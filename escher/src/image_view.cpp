@@ -26,12 +26,14 @@ void ImageView::drawRect(KDContext * ctx, KDRect rect) const {
   assert(pixelBufferSize <= maxPixelBufferSize);
   assert(Ion::stackSafe()); // That's a VERY big buffer we're allocating on the stack
 
-  Ion::decompress(
+  int decompressedSize = Ion::decompress(
     m_image->compressedPixelData(),
     reinterpret_cast<uint8_t *>(pixelBuffer),
     m_image->compressedPixelDataSize(),
     pixelBufferSize * sizeof(KDColor)
   );
+  (void)decompressedSize; // Make the compiler happy if assertions are disabled
+  assert(decompressedSize == pixelBufferSize * (int)sizeof(KDColor));
 
   ctx->fillRectWithPixels(bounds(), pixelBuffer, nullptr);
 }
@@ -26,7 +26,30 @@ void RunLoop::runWhile(bool (*callback)(void * ctx), void * ctx) {
   }
 }
 
+void RunLoop::fireTimers(int duration) {
+  m_time += duration;
+  // A refinement may have lasted several ticks
+  while (m_time >= Timer::TickDuration) {
+    m_time -= Timer::TickDuration;
+    for (int i=0; i<numberOfTimers(); i++) {
+      Timer * timer = timerAtIndex(i);
+      if (timer->tick()) {
+        dispatchEvent(Ion::Events::TimerFire);
+      }
+    }
+  }
+}
+
 bool RunLoop::step() {
+  /* While no key is down, the drawings left coarse are refined instead of
+   * waiting for an event. A refining drawing stops as soon as a key is down.
+   * The time spent refining still counts for the timers. */
+  uint64_t refinementStart = Ion::Timing::millis();
+  if (Ion::Keyboard::scan() == 0 && refineDrawing()) {
+    fireTimers(Ion::Timing::millis() - refinementStart);
+    return true;
+  }
+
   // Fetch the event, if any
   int eventDuration = Timer::TickDuration;
   int timeout = eventDuration;
@@ -43,17 +66,7 @@ bool RunLoop::step() {
    * TickDuration.  The event returned can be None if nothing worth taking care
    * of happened. In other words, getEvent is a blocking call with a timeout. */
 
-  m_time += eventDuration;
-
-  if (m_time >= Timer::TickDuration) {
-    m_time -= Timer::TickDuration;
-    for (int i=0; i<numberOfTimers(); i++) {
-      Timer * timer = timerAtIndex(i);
-      if (timer->tick()) {
-        dispatchEvent(Ion::Events::TimerFire);
-      }
-    }
-  }
+  fireTimers(eventDuration);
 
 #if ESCHER_LOG_EVENTS_BINARY
   Ion::Console::writeChar((char)event.id());
@@ -2,6 +2,7 @@ extern "C" {
 #include <assert.h>
 }
 #include <escher/view.h>
+#include <ion/display.h>
 
 const Window * View::window() const {
   if (m_superview == nullptr) {
@@ -83,6 +84,50 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
   return redrawnArea;
 }
 
+bool View::markRectsToRefineAsDirty() {
+  bool markedRect = markRectToRefineAsDirty();
+  for (uint8_t i=0; i<numberOfSubviews(); i++) {
+    View * subview = this->subview(i);
+    if (subview != nullptr && subview->markRectsToRefineAsDirty()) {
+      markedRect = true;
+    }
+  }
+  return markedRect;
+}
+
+bool View::translateDrawnPixels(KDRect rect, KDPoint offset) {
+  if (window() == nullptr || !m_dirtyRect.isEmpty()) {
+    return false;
+  }
+  KDPoint absOrigin = absoluteOrigin();
+  KDRect absRect = rect.translatedBy(absOrigin);
+  if (!absoluteVisibleFrame().containsRect(absRect)) {
+    // Some pixels of rect are hidden and cannot be moved into view
+    return false;
+  }
+  assert(rect.width() <= Ion::Display::Width);
+  KDColor workingBuffer[Ion::Display::Width];
+  KDContext * ctx = KDIonContext::sharedContext();
+  ctx->setOrigin(absOrigin);
+  ctx->setClippingRect(absRect);
+  ctx->translateRect(rect, offset, workingBuffer);
+  return true;
+}
+
+void View::drawRectNow(KDRect rect) {
+  assert(window() != nullptr);
+  rect = rect.intersectedWith(bounds());
+  KDPoint absOrigin = absoluteOrigin();
+  KDRect absClippingRect = absoluteVisibleFrame().intersectedWith(rect.translatedBy(absOrigin));
+  if (absClippingRect.isEmpty()) {
+    return;
+  }
+  KDContext * ctx = KDIonContext::sharedContext();
+  ctx->setOrigin(absOrigin);
+  ctx->setClippingRect(absClippingRect);
+  drawRect(ctx, rect);
+}
+
 View * View::subview(int index) {
   assert(index >= 0 && index < numberOfSubviews());
   View * subview = subviewAtIndex(index);
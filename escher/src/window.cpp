@@ -12,6 +12,14 @@ void Window::redraw(bool force) {
   View::redraw(bounds());
 }
 
+bool Window::refineDrawing() {
+  if (!markRectsToRefineAsDirty()) {
+    return false;
+  }
+  redraw();
+  return true;
+}
+
 void Window::setContentView(View * contentView) {
   m_contentView = contentView;
   markRectAsDirty(bounds());
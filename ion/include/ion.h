@@ -42,8 +42,14 @@ uint32_t crc32EatByte(uint32_t previousCRC, uint8_t data);
 // Provides a true random number
 uint32_t random();
 
-// Decompress data
-void decompress(const uint8_t * src, uint8_t * dst, int srcSize, int dstSize);
+/* Compress data. Returns the size of the compressed data, or 0 if it does not
+ * fit in dstCapacity bytes. */
+int compress(const uint8_t * src, uint8_t * dst, int srcSize, int dstCapacity);
+
+/* Decompress data. Returns the size of the decompressed data, which is
+ * negative if the compressed data is corrupted or does not fit in dstSize
+ * bytes. */
+int decompress(const uint8_t * src, uint8_t * dst, int srcSize, int dstSize);
 
 // Tells whether the stack pointer is within acceptable bounds
 bool stackSafe();
@@ -50,6 +50,9 @@ enum class ShiftAlphaStatus {
 
 // Timeout is decremented
 Event getEvent(int * timeout);
+/* Record e, dispatched out of getEvent for the keyboard state, as the last
+ * event: holding its key then repeats it as if getEvent had returned it. */
+void didReplayEvent(Event e, Keyboard::State state);
 
 ShiftAlphaStatus shiftAlphaStatus();
 void setShiftAlphaStatus(ShiftAlphaStatus s);
@@ -81,6 +81,12 @@ public:
     void destroy() {
       return Storage::sharedStorage()->destroyRecord(*this);
     }
+    /* The value of a record can be modified in place, through the buffer
+     * returned by value(). The storage must then be told so, to update its
+     * checksum and its version. */
+    void valueDidChangeInPlace() {
+      return Storage::sharedStorage()->valueOfRecordDidChangeInPlace(*this);
+    }
   private:
     Record(const char * basename, int basenameLength, const char * extension, int extensionLength);
     uint32_t m_fullNameCRC32;
@@ -95,12 +101,22 @@ public:
   size_t availableSize();
   size_t putAvailableSpaceAtEndOfRecord(Record r);
   void getAvailableSpaceFromEndOfRecord(Record r, size_t recordAvailableSpace);
+  /* The checksum is the sum of the checksums of the records, which are
+   * updated by the mutators. It only has to be computed again when the records
+   * could not be followed, for instance while one of them has the available
+   * space at its end. */
   uint32_t checksum();
+  // Forget everything deduced from the buffer after it was written directly
+  void bufferWasModifiedExternally();
 
   // Delegate
   void setDelegate(StorageDelegate * delegate) { m_delegate = delegate; }
   void notifyChangeToDelegate(const Record r = Record()) const;
   Record::ErrorStatus notifyFullnessToDelegate() const;
+  /* The version changes whenever a record is created, modified or destroyed,
+   * including when its value is modified in place.
+   * It is never 0. */
+  uint32_t version() const { return m_version; }
 
   int numberOfRecordsWithExtension(const char * extension);
   static bool FullNameHasExtension(const char * fullName, const char * extension, size_t extensionLength);
@@ -133,6 +149,7 @@ private:
   Record::Data valueOfRecord(const Record record);
   Record::ErrorStatus setValueOfRecord(const Record record, Record::Data data);
   void destroyRecord(const Record record);
+  void valueOfRecordDidChangeInPlace(const Record record);
 
   /* Getters on address in buffer */
   char * pointerOfRecord(const Record record) const;
@@ -174,12 +191,70 @@ private:
 
   Record privateRecordAndExtensionOfRecordBaseNamedWithExtensions(const char * baseName, const char * const extensions[], size_t numberOfExtensions, const char * * extensionResult = nullptr, int baseNameLength = -1);
 
+  /* Record index
+   * The index maps the CRC32 of the records' fullNames to their offsets in the
+   * buffer and to the checksums of the records. It is an open-addressing hash table with linear probing, kept up to
+   * date by the mutators. When there are too many records for the table, the
+   * lookups it misses fall back on scanning the buffer. */
+  constexpr static int k_recordIndexCapacity = 256;
+  constexpr static int k_maxNumberOfIndexedRecords = 3*k_recordIndexCapacity/4;
+  static_assert((k_recordIndexCapacity & (k_recordIndexCapacity - 1)) == 0, "The record index capacity should be a power of 2");
+  static_assert(UINT16_MAX >= k_storageSize, "The record index offsets are not big enough");
+  int indexSlotOfRecord(const Record record) const;
+  char * indexedPointerOfRecord(const Record record) const;
+  void indexRecord(const Record record, char * position, uint32_t checksum) const;
+  void unindexRecord(const Record record) const;
+  void shiftIndexedRecords(char * position, int delta) const;
+  void resetIndex() const;
+  void rebuildIndex() const;
+
+  /* Extension lists
+   * For a few recently listed extensions, the offsets of the records with that
+   * extension are kept in buffer order, so that counting them and accessing
+   * them by index do not scan the buffer. The lists share a single table of
+   * offsets where they are stored one after the other. They are updated by
+   * the mutators, and dropped when the table is full. The last extension that
+   * had too many records to be listed is remembered until a record is
+   * removed, so that its lookups scan the buffer without retrying first. */
+  constexpr static int k_numberOfExtensionLists = 4;
+  constexpr static size_t k_maxExtensionListExtensionLength = 7;
+  constexpr static int k_extensionListsCapacity = 256;
+  struct ExtensionList {
+    char extension[k_maxExtensionListExtensionLength+1];
+    uint16_t numberOfRecords;
+  };
+  int extensionListIndex(const char * extension) const;
+  int firstOffsetOfExtensionList(int listIndex) const;
+  void removeExtensionList(int listIndex) const;
+  void addRecordToExtensionLists(const char * fullName, char * position) const;
+  void removeRecordFromExtensionLists(char * position) const;
+
+  // Checksum
+  uint32_t checksumOfRecordStarting(char * start) const;
+  bool cachedChecksumOfRecord(const Record record, uint32_t * checksum) const;
+  void setCachedChecksumOfRecord(const Record record, uint32_t checksum) const;
+  void updateChecksum(bool previousChecksumIsCached, uint32_t previousChecksum, uint32_t newChecksum);
+  void incrementVersion() const { m_version = m_version == UINT32_MAX ? 1 : m_version + 1; }
+
   uint32_t m_magicHeader;
   char m_buffer[k_storageSize];
   uint32_t m_magicFooter;
   StorageDelegate * m_delegate;
+  mutable uint32_t m_version;
   mutable Record m_lastRecordRetrieved;
   mutable char * m_lastRecordRetrievedPointer;
+  mutable uint32_t m_indexedFullNameCRC32s[k_recordIndexCapacity];
+  mutable uint16_t m_indexedOffsets[k_recordIndexCapacity];
+  mutable uint32_t m_indexedChecksums[k_recordIndexCapacity];
+  mutable int m_numberOfIndexedRecords;
+  mutable bool m_indexIsValid;
+  mutable bool m_indexIsComplete;
+  mutable ExtensionList m_extensionLists[k_numberOfExtensionLists];
+  mutable uint16_t m_extensionListsOffsets[k_extensionListsCapacity];
+  mutable int m_numberOfExtensionLists;
+  mutable char m_unlistedExtension[k_maxExtensionListExtensionLength+1];
+  mutable uint32_t m_checksum;
+  mutable bool m_checksumIsValid;
 };
 
 /* Some apps memoize records and need to be notified when a record might have
@@ -10,6 +10,9 @@ namespace Events {
 static int sLogAfterNumberOfEvents = -1;
 static int sEventCount = 0;
 
+void didReplayEvent(Event e, Keyboard::State state) {
+}
+
 Event getEvent(int * timeout) {
   Ion::Events::Event event = Ion::Events::None;
   while (!(event.isDefined() && event.isKeyboardEvent())) {
@@ -0,0 +1,6 @@
+#include <ion.h>
+#include "../external/lz4/lz4.h"
+
+int Ion::compress(const uint8_t * src, uint8_t * dst, int srcSize, int dstCapacity) {
+  return LZ4_compress_default(reinterpret_cast<const char *>(src), reinterpret_cast<char *>(dst), srcSize, dstCapacity);
+}
@@ -58,6 +58,9 @@ static constexpr Scenario scenari[] = {
 
 constexpr static int numberOfScenari = sizeof(scenari)/sizeof(Scenario);
 
+void didReplayEvent(Event e, Keyboard::State state) {
+}
+
 Event getEvent(int * timeout) {
   static int scenariIndex = 0;
   static int eventIndex = 0;
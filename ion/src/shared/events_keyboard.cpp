@@ -46,6 +46,16 @@ void resetLongRepetition() {
   setLongRepetition(false);
 }
 
+void didReplayEvent(Event e, Keyboard::State state) {
+  sEventIsRepeating = false;
+  resetLongRepetition();
+  sLastEventShift = isShiftActive() || state.keyDown(Keyboard::Key::Shift);
+  sLastEventAlpha = isAlphaActive() || state.keyDown(Keyboard::Key::Alpha);
+  updateModifiersFromEvent(e);
+  sLastEvent = e;
+  sLastKeyboardState = state;
+}
+
 Event getEvent(int * timeout) {
   assert(*timeout > delayBeforeRepeat);
   assert(*timeout > delayBetweenRepeat);
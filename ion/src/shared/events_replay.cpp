@@ -17,6 +17,9 @@ const Event sequence[] = {
   Up, Up, Up, Up, Up, Up
 };
 
+void Ion::Events::didReplayEvent(Event e, Ion::Keyboard::State state) {
+}
+
 Event Ion::Events::getEvent(int * timeout) {
   static int i = 0;
   int sequenceLength = sizeof(sequence)/sizeof(sequence[0]);
@@ -95,13 +95,19 @@ Storage::Storage() :
   m_buffer(),
   m_magicFooter(Magic),
   m_delegate(nullptr),
+  m_version(1),
   m_lastRecordRetrieved(nullptr),
-  m_lastRecordRetrievedPointer(nullptr)
+  m_lastRecordRetrievedPointer(nullptr),
+  m_checksum(0),
+  m_checksumIsValid(true)
 {
   assert(m_magicHeader == Magic);
   assert(m_magicFooter == Magic);
   // Set the size of the first record to 0
   overrideSizeAtPosition(m_buffer, 0);
+  resetIndex();
+  m_numberOfExtensionLists = 0;
+  m_unlistedExtension[0] = 0;
 }
 
 #if ION_STORAGE_LOG
@@ -127,8 +133,12 @@ size_t Storage::putAvailableSpaceAtEndOfRecord(Storage::Record r) {
   memmove(nextRecord + availableStorageSize,
       nextRecord,
       (m_buffer + k_storageSize - availableStorageSize) - nextRecord);
+  shiftIndexedRecords(nextRecord, availableStorageSize);
   size_t newRecordSize = previousRecordSize + availableStorageSize;
   overrideSizeAtPosition(p, (record_size_t)newRecordSize);
+  // The record is going to be edited without the storage knowing
+  m_checksumIsValid = false;
+  incrementVersion();
   return newRecordSize;
 }
 
@@ -139,16 +149,38 @@ void Storage::getAvailableSpaceFromEndOfRecord(Record r, size_t recordAvailableS
   memmove(nextRecord - recordAvailableSpace,
       nextRecord,
       m_buffer + k_storageSize - nextRecord);
+  shiftIndexedRecords(nextRecord, -recordAvailableSpace);
   overrideSizeAtPosition(p, (record_size_t)(previousRecordSize - recordAvailableSpace));
+  setCachedChecksumOfRecord(r, checksumOfRecordStarting(p));
+  incrementVersion();
 }
 
 uint32_t Storage::checksum() {
-  return Ion::crc32Byte((const uint8_t *) m_buffer, endBuffer()-m_buffer);
+  if (!m_checksumIsValid) {
+    // Also update the cached checksums, which must be consistent with the sum
+    m_checksum = 0;
+    for (char * p : *this) {
+      uint32_t recordChecksum = checksumOfRecordStarting(p);
+      m_checksum += recordChecksum;
+      setCachedChecksumOfRecord(Record(fullNameOfRecordStarting(p)), recordChecksum);
+    }
+    m_checksumIsValid = true;
+  }
+  return m_checksum;
+}
+
+void Storage::bufferWasModifiedExternally() {
+  m_indexIsValid = false;
+  m_numberOfExtensionLists = 0;
+  m_unlistedExtension[0] = 0;
+  m_checksumIsValid = false;
+  notifyChangeToDelegate();
 }
 
 void Storage::notifyChangeToDelegate(const Record record) const {
   m_lastRecordRetrieved = Record(nullptr);
   m_lastRecordRetrievedPointer = nullptr;
+  incrementVersion();
   if (m_delegate != nullptr) {
     m_delegate->storageDidChangeForRecord(record);
   }
@@ -181,6 +213,10 @@ Storage::Record::ErrorStatus Storage::createRecordWithFullName(const char * full
   // Next Record is null-sized
   overrideSizeAtPosition(newRecord, 0);
   Record r = Record(fullName);
+  uint32_t recordChecksum = checksumOfRecordStarting(newRecordAddress);
+  indexRecord(r, newRecordAddress, recordChecksum);
+  m_checksum += recordChecksum;
+  addRecordToExtensionLists(fullNameOfRecordStarting(newRecordAddress), newRecordAddress);
   notifyChangeToDelegate(r);
   m_lastRecordRetrieved = r;
   m_lastRecordRetrievedPointer = newRecordAddress;
@@ -207,6 +243,10 @@ Storage::Record::ErrorStatus Storage::createRecordWithExtension(const char * bas
   // Next Record is null-sized
   overrideSizeAtPosition(newRecord, 0);
   Record r = Record(fullNameOfRecordStarting(newRecordAddress));
+  uint32_t recordChecksum = checksumOfRecordStarting(newRecordAddress);
+  indexRecord(r, newRecordAddress, recordChecksum);
+  m_checksum += recordChecksum;
+  addRecordToExtensionLists(fullNameOfRecordStarting(newRecordAddress), newRecordAddress);
   notifyChangeToDelegate(r);
   m_lastRecordRetrieved = r;
   m_lastRecordRetrievedPointer = newRecordAddress;
@@ -214,6 +254,10 @@ Storage::Record::ErrorStatus Storage::createRecordWithExtension(const char * bas
 }
 
 int Storage::numberOfRecordsWithExtension(const char * extension) {
+  int listIndex = extensionListIndex(extension);
+  if (listIndex >= 0) {
+    return m_extensionLists[listIndex].numberOfRecords;
+  }
   int count = 0;
   size_t extensionLength = strlen(extension);
   for (char * p : *this) {
@@ -230,15 +274,23 @@ Storage::Record Storage::recordWithExtensionAtIndex(const char * extension, int
   const char * name = nullptr;
   size_t extensionLength = strlen(extension);
   char * recordAddress = nullptr;
-  for (char * p : *this) {
-    const char * currentName = fullNameOfRecordStarting(p);
-    if (FullNameHasExtension(currentName, extension, extensionLength)) {
-      currentIndex++;
+  int listIndex = extensionListIndex(extension);
+  if (listIndex >= 0) {
+    if (index >= 0 && index < m_extensionLists[listIndex].numberOfRecords) {
+      recordAddress = m_buffer + m_extensionListsOffsets[firstOffsetOfExtensionList(listIndex) + index];
+      name = fullNameOfRecordStarting(recordAddress);
     }
-    if (currentIndex == index) {
-      recordAddress = p;
-      name = currentName;
-      break;
+  } else {
+    for (char * p : *this) {
+      const char * currentName = fullNameOfRecordStarting(p);
+      if (FullNameHasExtension(currentName, extension, extensionLength)) {
+        currentIndex++;
+      }
+      if (currentIndex == index) {
+        recordAddress = p;
+        name = currentName;
+        break;
+      }
     }
   }
   if (name == nullptr) {
@@ -279,6 +331,11 @@ const char * Storage::extensionOfRecordBaseNamedWithExtensions(const char * base
 
 void Storage::destroyAllRecords() {
   overrideSizeAtPosition(m_buffer, 0);
+  resetIndex();
+  m_numberOfExtensionLists = 0;
+  m_unlistedExtension[0] = 0;
+  m_checksum = 0;
+  m_checksumIsValid = true;
   notifyChangeToDelegate();
 }
 
@@ -331,8 +388,16 @@ Storage::Record::ErrorStatus Storage::setFullNameOfRecord(const Record record, c
     }
     overrideSizeAtPosition(p, newRecordSize);
     overrideFullNameAtPosition(p+sizeof(record_size_t), fullName);
+    uint32_t previousChecksum;
+    bool previousChecksumIsCached = cachedChecksumOfRecord(record, &previousChecksum);
+    uint32_t newChecksum = checksumOfRecordStarting(p);
+    unindexRecord(record);
+    indexRecord(Record(fullName), p, newChecksum);
+    updateChecksum(previousChecksumIsCached, previousChecksum, newChecksum);
+    removeRecordFromExtensionLists(p);
+    addRecordToExtensionLists(fullName, p);
     notifyChangeToDelegate(record);
-    m_lastRecordRetrieved = record;
+    m_lastRecordRetrieved = Record(fullName);
     m_lastRecordRetrievedPointer = p;
     return Record::ErrorStatus::None;
   }
@@ -355,8 +420,16 @@ Storage::Record::ErrorStatus Storage::setBaseNameWithExtensionOfRecord(Record re
     overrideSizeAtPosition(p, newRecordSize);
     char * fullNamePosition = p + sizeof(record_size_t);
     overrideBaseNameWithExtensionAtPosition(fullNamePosition, baseName, extension);
+    uint32_t previousChecksum;
+    bool previousChecksumIsCached = cachedChecksumOfRecord(record, &previousChecksum);
+    uint32_t newChecksum = checksumOfRecordStarting(p);
+    unindexRecord(record);
     // Recompute the CRC32
     record = Record(fullNamePosition);
+    indexRecord(record, p, newChecksum);
+    updateChecksum(previousChecksumIsCached, previousChecksum, newChecksum);
+    removeRecordFromExtensionLists(p);
+    addRecordToExtensionLists(fullNamePosition, p);
     notifyChangeToDelegate(record);
     m_lastRecordRetrieved = record;
     m_lastRecordRetrievedPointer = p;
@@ -388,6 +461,13 @@ Storage::Record::ErrorStatus Storage::setValueOfRecord(Record record, Record::Da
     record_size_t fullNameSize = strlen(fullName)+1;
     overrideSizeAtPosition(p, newRecordSize);
     overrideValueAtPosition(p+sizeof(record_size_t)+fullNameSize, data.buffer, data.size);
+    /* The previous checksum is read from the index, as data might be the value
+     * of the record, modified in place. */
+    uint32_t previousChecksum;
+    bool previousChecksumIsCached = cachedChecksumOfRecord(record, &previousChecksum);
+    uint32_t newChecksum = checksumOfRecordStarting(p);
+    setCachedChecksumOfRecord(record, newChecksum);
+    updateChecksum(previousChecksumIsCached, previousChecksum, newChecksum);
     notifyChangeToDelegate(record);
     m_lastRecordRetrieved = record;
     m_lastRecordRetrievedPointer = p;
@@ -403,11 +483,28 @@ void Storage::destroyRecord(Record record) {
   char * p = pointerOfRecord(record);
   if (p != nullptr) {
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
+    uint32_t previousChecksum;
+    bool previousChecksumIsCached = cachedChecksumOfRecord(record, &previousChecksum);
+    updateChecksum(previousChecksumIsCached, previousChecksum, 0);
+    unindexRecord(record);
+    removeRecordFromExtensionLists(p);
     slideBuffer(p+previousRecordSize, -previousRecordSize);
     notifyChangeToDelegate();
   }
 }
 
+void Storage::valueOfRecordDidChangeInPlace(const Record record) {
+  char * p = pointerOfRecord(record);
+  if (p != nullptr) {
+    uint32_t previousChecksum;
+    bool previousChecksumIsCached = cachedChecksumOfRecord(record, &previousChecksum);
+    uint32_t newChecksum = checksumOfRecordStarting(p);
+    setCachedChecksumOfRecord(record, newChecksum);
+    updateChecksum(previousChecksumIsCached, previousChecksum, newChecksum);
+    incrementVersion();
+  }
+}
+
 char * Storage::pointerOfRecord(const Record record) const {
   if (record.isNull()) {
     return nullptr;
@@ -416,15 +513,21 @@ char * Storage::pointerOfRecord(const Record record) const {
     assert(m_lastRecordRetrievedPointer != nullptr);
     return m_lastRecordRetrievedPointer;
   }
-  for (char * p : *this) {
-    Record currentRecord(fullNameOfRecordStarting(p));
-    if (record == currentRecord) {
-      m_lastRecordRetrieved = record;
-      m_lastRecordRetrievedPointer = p;
-      return p;
+  char * p = indexedPointerOfRecord(record);
+  if (p == nullptr && !m_indexIsComplete) {
+    for (char * q : *this) {
+      Record currentRecord(fullNameOfRecordStarting(q));
+      if (record == currentRecord) {
+        p = q;
+        break;
+      }
     }
   }
-  return nullptr;
+  if (p != nullptr) {
+    m_lastRecordRetrieved = record;
+    m_lastRecordRetrievedPointer = p;
+  }
+  return p;
 }
 
 Storage::record_size_t Storage::sizeOfRecordStarting(char * start) const {
@@ -481,16 +584,7 @@ bool Storage::isNameOfRecordTaken(Record r, const Record * recordToExclude) {
      * name is nullptr. */
     return true;
   }
-  for (char * p : *this) {
-    Record s(fullNameOfRecordStarting(p));
-    if (recordToExclude && s == *recordToExclude) {
-      continue;
-    }
-    if (s == r) {
-      return true;
-    }
-  }
-  return false;
+  return (recordToExclude == nullptr || r != *recordToExclude) && pointerOfRecord(r) != nullptr;
 }
 
 bool Storage::FullNameCompliant(const char * fullName) {
@@ -546,6 +640,7 @@ bool Storage::slideBuffer(char * position, int delta) {
     return false;
   }
   memmove(position+delta, position, endBuffer()+sizeof(record_size_t)-position);
+  shiftIndexedRecords(position, delta);
   return true;
 }
 
@@ -565,24 +660,246 @@ Storage::Record Storage::privateRecordAndExtensionOfRecordBaseNamedWithExtension
       }
     }
   }
+  Record result;
+  char * resultPointer = nullptr;
+  const char * resultExtension = nullptr;
+  for (size_t i = 0; i < numberOfExtensions; i++) {
+    Record r(baseName, nameLength, extensions[i], strlen(extensions[i]));
+    char * p = pointerOfRecord(r);
+    // Return the first matching record of the buffer whatever its extension
+    if (p != nullptr && (resultPointer == nullptr || p < resultPointer)) {
+      result = r;
+      resultPointer = p;
+      resultExtension = extensions[i];
+    }
+  }
+  if (extensionResult != nullptr) {
+    *extensionResult = resultExtension;
+  }
+  return result;
+}
+
+void Storage::resetIndex() const {
+  for (int i = 0; i < k_recordIndexCapacity; i++) {
+    m_indexedFullNameCRC32s[i] = 0;
+  }
+  m_numberOfIndexedRecords = 0;
+  m_indexIsValid = true;
+  m_indexIsComplete = true;
+}
+
+void Storage::rebuildIndex() const {
+  resetIndex();
+  // The cached checksums of the records are computed anew
+  m_checksumIsValid = false;
   for (char * p : *this) {
-    const char * currentName = fullNameOfRecordStarting(p);
-    if (strncmp(baseName, currentName, nameLength) == 0) {
-      for (size_t i = 0; i < numberOfExtensions; i++) {
-        if (strcmp(currentName+nameLength+1 /*+1 to pass the dot*/, extensions[i]) == 0) {
-          assert(UTF8Helper::CodePointIs(currentName + nameLength, '.'));
-          if (extensionResult != nullptr) {
-            *extensionResult = extensions[i];
-          }
-          return Record(currentName);
+    indexRecord(Record(fullNameOfRecordStarting(p)), p, checksumOfRecordStarting(p));
+  }
+}
+
+int Storage::indexSlotOfRecord(const Record record) const {
+  assert(!record.isNull());
+  if (!m_indexIsValid) {
+    rebuildIndex();
+  }
+  constexpr int mask = k_recordIndexCapacity - 1;
+  for (int i = record.m_fullNameCRC32 & mask; m_indexedFullNameCRC32s[i] != 0; i = (i + 1) & mask) {
+    if (m_indexedFullNameCRC32s[i] == record.m_fullNameCRC32) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+char * Storage::indexedPointerOfRecord(const Record record) const {
+  int slot = indexSlotOfRecord(record);
+  return slot < 0 ? nullptr : const_cast<char *>(m_buffer) + m_indexedOffsets[slot];
+}
+
+void Storage::indexRecord(const Record record, char * position, uint32_t checksum) const {
+  if (!m_indexIsValid) {
+    return;
+  }
+  if (record.isNull() || m_numberOfIndexedRecords >= k_maxNumberOfIndexedRecords) {
+    // The record cannot be found through the index
+    m_indexIsComplete = false;
+    return;
+  }
+  constexpr int mask = k_recordIndexCapacity - 1;
+  int i = record.m_fullNameCRC32 & mask;
+  while (m_indexedFullNameCRC32s[i] != 0) {
+    if (m_indexedFullNameCRC32s[i] == record.m_fullNameCRC32) {
+      // Keep the first record of the buffer, as a scan would
+      return;
+    }
+    i = (i + 1) & mask;
+  }
+  m_indexedFullNameCRC32s[i] = record.m_fullNameCRC32;
+  m_indexedOffsets[i] = position - m_buffer;
+  m_indexedChecksums[i] = checksum;
+  m_numberOfIndexedRecords++;
+}
+
+void Storage::unindexRecord(const Record record) const {
+  if (!m_indexIsValid || record.isNull()) {
+    return;
+  }
+  if (!m_indexIsComplete) {
+    // Removing a record might leave enough room for the unindexed ones
+    m_indexIsValid = false;
+    return;
+  }
+  constexpr int mask = k_recordIndexCapacity - 1;
+  int i = record.m_fullNameCRC32 & mask;
+  while (m_indexedFullNameCRC32s[i] != record.m_fullNameCRC32) {
+    if (m_indexedFullNameCRC32s[i] == 0) {
+      return;
+    }
+    i = (i + 1) & mask;
+  }
+  m_numberOfIndexedRecords--;
+  /* Shift back the following entries of the probing sequence which would not
+   * be reachable anymore once the slot i is emptied. */
+  int j = i;
+  while (true) {
+    j = (j + 1) & mask;
+    if (m_indexedFullNameCRC32s[j] == 0) {
+      break;
+    }
+    int home = m_indexedFullNameCRC32s[j] & mask;
+    bool homeIsBetweenIAndJ = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+    if (!homeIsBetweenIAndJ) {
+      m_indexedFullNameCRC32s[i] = m_indexedFullNameCRC32s[j];
+      m_indexedOffsets[i] = m_indexedOffsets[j];
+      m_indexedChecksums[i] = m_indexedChecksums[j];
+      i = j;
+    }
+  }
+  m_indexedFullNameCRC32s[i] = 0;
+}
+
+void Storage::shiftIndexedRecords(char * position, int delta) const {
+  uint16_t offset = position - m_buffer;
+  if (m_indexIsValid) {
+    for (int i = 0; i < k_recordIndexCapacity; i++) {
+      if (m_indexedFullNameCRC32s[i] != 0 && m_indexedOffsets[i] >= offset) {
+        m_indexedOffsets[i] += delta;
+      }
+    }
+  }
+  int numberOfListedRecords = firstOffsetOfExtensionList(m_numberOfExtensionLists);
+  for (int i = 0; i < numberOfListedRecords; i++) {
+    if (m_extensionListsOffsets[i] >= offset) {
+      m_extensionListsOffsets[i] += delta;
+    }
+  }
+}
+
+int Storage::firstOffsetOfExtensionList(int listIndex) const {
+  assert(listIndex <= m_numberOfExtensionLists);
+  int result = 0;
+  for (int i = 0; i < listIndex; i++) {
+    result += m_extensionLists[i].numberOfRecords;
+  }
+  return result;
+}
+
+void Storage::removeExtensionList(int listIndex) const {
+  assert(listIndex < m_numberOfExtensionLists);
+  int first = firstOffsetOfExtensionList(listIndex);
+  int numberOfRecords = m_extensionLists[listIndex].numberOfRecords;
+  int numberOfListedRecords = firstOffsetOfExtensionList(m_numberOfExtensionLists);
+  memmove(m_extensionListsOffsets + first, m_extensionListsOffsets + first + numberOfRecords, (numberOfListedRecords - first - numberOfRecords)*sizeof(uint16_t));
+  memmove(m_extensionLists + listIndex, m_extensionLists + listIndex + 1, (m_numberOfExtensionLists - listIndex - 1)*sizeof(ExtensionList));
+  m_numberOfExtensionLists--;
+}
+
+int Storage::extensionListIndex(const char * extension) const {
+  for (int i = 0; i < m_numberOfExtensionLists; i++) {
+    if (strcmp(m_extensionLists[i].extension, extension) == 0) {
+      return i;
+    }
+  }
+  size_t extensionLength = strlen(extension);
+  if (extensionLength > k_maxExtensionListExtensionLength || strcmp(m_unlistedExtension, extension) == 0) {
+    return -1;
+  }
+  if (m_numberOfExtensionLists == k_numberOfExtensionLists) {
+    // Drop the oldest list
+    removeExtensionList(0);
+  }
+  while (true) {
+    int first = firstOffsetOfExtensionList(m_numberOfExtensionLists);
+    int numberOfRecords = 0;
+    bool fits = true;
+    for (char * p : *this) {
+      if (FullNameHasExtension(fullNameOfRecordStarting(p), extension, extensionLength)) {
+        if (first + numberOfRecords == k_extensionListsCapacity) {
+          fits = false;
+          break;
         }
+        m_extensionListsOffsets[first + numberOfRecords++] = p - m_buffer;
       }
     }
+    if (fits) {
+      ExtensionList * list = m_extensionLists + m_numberOfExtensionLists;
+      strlcpy(list->extension, extension, sizeof(list->extension));
+      list->numberOfRecords = numberOfRecords;
+      return m_numberOfExtensionLists++;
+    }
+    if (m_numberOfExtensionLists == 0) {
+      // Too many records to be listed: the callers scan the buffer
+      strlcpy(m_unlistedExtension, extension, sizeof(m_unlistedExtension));
+      return -1;
+    }
+    // Drop the other lists to make room for this one
+    m_numberOfExtensionLists = 0;
   }
-  if (extensionResult != nullptr) {
-    *extensionResult = nullptr;
+}
+
+void Storage::addRecordToExtensionLists(const char * fullName, char * position) const {
+  uint16_t offset = position - m_buffer;
+  int i = 0;
+  while (i < m_numberOfExtensionLists) {
+    ExtensionList * list = m_extensionLists + i;
+    if (!FullNameHasExtension(fullName, list->extension, strlen(list->extension))) {
+      i++;
+      continue;
+    }
+    int numberOfListedRecords = firstOffsetOfExtensionList(m_numberOfExtensionLists);
+    if (numberOfListedRecords == k_extensionListsCapacity) {
+      removeExtensionList(i);
+      continue;
+    }
+    // Keep the list in buffer order
+    int first = firstOffsetOfExtensionList(i);
+    int j = first + list->numberOfRecords;
+    while (j > first && m_extensionListsOffsets[j-1] > offset) {
+      j--;
+    }
+    memmove(m_extensionListsOffsets + j + 1, m_extensionListsOffsets + j, (numberOfListedRecords - j)*sizeof(uint16_t));
+    m_extensionListsOffsets[j] = offset;
+    list->numberOfRecords++;
+    i++;
+  }
+}
+
+void Storage::removeRecordFromExtensionLists(char * position) const {
+  m_unlistedExtension[0] = 0;
+  uint16_t offset = position - m_buffer;
+  int first = 0;
+  for (int i = 0; i < m_numberOfExtensionLists; i++) {
+    ExtensionList * list = m_extensionLists + i;
+    for (int j = first; j < first + list->numberOfRecords; j++) {
+      if (m_extensionListsOffsets[j] == offset) {
+        int numberOfListedRecords = firstOffsetOfExtensionList(m_numberOfExtensionLists);
+        memmove(m_extensionListsOffsets + j, m_extensionListsOffsets + j + 1, (numberOfListedRecords - j - 1)*sizeof(uint16_t));
+        list->numberOfRecords--;
+        break;
+      }
+    }
+    first += list->numberOfRecords;
   }
-  return Record();
 }
 
 Storage::RecordIterator & Storage::RecordIterator::operator++() {
@@ -594,4 +911,38 @@ Storage::RecordIterator & Storage::RecordIterator::operator++() {
   return *this;
 }
 
+uint32_t Storage::checksumOfRecordStarting(char * start) const {
+  const char * fullName = fullNameOfRecordStarting(start);
+  size_t valueSize = sizeOfRecordStarting(start) - strlen(fullName) - 1 - sizeof(record_size_t);
+  uint32_t crc32Results[2];
+  crc32Results[0] = Record(fullName).m_fullNameCRC32;
+  crc32Results[1] = Ion::crc32Byte((const uint8_t *)valueOfRecordStarting(start), valueSize);
+  return Ion::crc32Word(crc32Results, 2);
+}
+
+bool Storage::cachedChecksumOfRecord(const Record record, uint32_t * checksum) const {
+  int slot = record.isNull() ? -1 : indexSlotOfRecord(record);
+  if (slot < 0) {
+    return false;
+  }
+  *checksum = m_indexedChecksums[slot];
+  return true;
+}
+
+void Storage::setCachedChecksumOfRecord(const Record record, uint32_t checksum) const {
+  int slot = record.isNull() ? -1 : indexSlotOfRecord(record);
+  if (slot >= 0) {
+    m_indexedChecksums[slot] = checksum;
+  }
+}
+
+void Storage::updateChecksum(bool previousChecksumIsCached, uint32_t previousChecksum, uint32_t newChecksum) {
+  if (!previousChecksumIsCached) {
+    // The previous checksum of the record cannot be removed from the sum
+    m_checksumIsValid = false;
+    return;
+  }
+  m_checksum += newChecksum - previousChecksum;
+}
+
 }
@@ -0,0 +1,27 @@
+#include <quiz.h>
+#include <ion.h>
+#include <string.h>
+
+QUIZ_CASE(ion_compress) {
+  constexpr int bufferSize = 512;
+  char text[bufferSize];
+  for (int i = 0; i < bufferSize - 1; i++) {
+    text[i] = "def f(x):\n  return x*x\n"[i%24];
+  }
+  text[bufferSize - 1] = 0;
+  uint8_t compressed[bufferSize];
+  int compressedSize = Ion::compress(reinterpret_cast<const uint8_t *>(text), compressed, bufferSize, bufferSize);
+  quiz_assert(compressedSize > 0 && compressedSize < bufferSize/4);
+  char decompressed[bufferSize];
+  quiz_assert(Ion::decompress(compressed, reinterpret_cast<uint8_t *>(decompressed), compressedSize, bufferSize) == bufferSize);
+  quiz_assert(memcmp(text, decompressed, bufferSize) == 0);
+
+  // Incompressible data does not fit in a smaller buffer
+  uint8_t noise[64];
+  uint32_t seed = 1;
+  for (int i = 0; i < 64; i++) {
+    seed = seed * 1103515245 + 12345;
+    noise[i] = seed >> 24;
+  }
+  quiz_assert(Ion::compress(noise, compressed, 64, 63) == 0);
+}
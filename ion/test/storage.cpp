@@ -500,3 +500,170 @@ aaaaaa)";
   retreivedRecord3.destroy();
   retreivedRecord4.destroy();
 }
+
+static void nameOfIndexedRecord(int i, char * buffer, size_t bufferSize) {
+  assert(bufferSize >= 4);
+  buffer[0] = 'r';
+  buffer[1] = 'a' + i / 26;
+  buffer[2] = 'a' + i % 26;
+  buffer[3] = 0;
+}
+
+static bool indexedRecordHasValue(int i, const char * data) {
+  char baseName[4];
+  nameOfIndexedRecord(i, baseName, sizeof(baseName));
+  Storage::Record r = Storage::sharedStorage()->recordBaseNamedWithExtension(baseName, "idx");
+  if (data == nullptr) {
+    return r.isNull();
+  }
+  Storage::Record::Data value = r.value();
+  return value.size == strlen(data) && strncmp(data, static_cast<const char *>(value.buffer), value.size) == 0;
+}
+
+QUIZ_CASE(ion_storage_record_index) {
+  /* Create more records than the index can hold, and move and destroy some of
+   * them so that the lookups go through the index, through its fallback scan
+   * and through its rebuilds. */
+  size_t initialStorageAvailableStage = Storage::sharedStorage()->availableSize();
+  constexpr int numberOfRecords = 300;
+  char baseName[4];
+  for (int i = 0; i < numberOfRecords; i++) {
+    nameOfIndexedRecord(i, baseName, sizeof(baseName));
+    quiz_assert(putRecordInSharedStorage(baseName, "idx", baseName) == Storage::Record::ErrorStatus::None);
+  }
+  for (int i = 0; i < numberOfRecords; i++) {
+    nameOfIndexedRecord(i, baseName, sizeof(baseName));
+    quiz_assert(indexedRecordHasValue(i, baseName));
+  }
+  quiz_assert(Storage::sharedStorage()->numberOfRecordsWithExtension("idx") == numberOfRecords);
+  quiz_assert(strcmp(Storage::sharedStorage()->recordWithExtensionAtIndex("idx", numberOfRecords - 1).fullName(), "rln.idx") == 0);
+  // Destroy two thirds of the records and lengthen the others
+  const char * longData = "A longer value that moves the following records";
+  for (int i = 0; i < numberOfRecords; i++) {
+    nameOfIndexedRecord(i, baseName, sizeof(baseName));
+    Storage::Record r = Storage::sharedStorage()->recordBaseNamedWithExtension(baseName, "idx");
+    if (i % 3 == 0) {
+      quiz_assert(r.setValue({.buffer = longData, .size = strlen(longData)}) == Storage::Record::ErrorStatus::None);
+    } else {
+      r.destroy();
+    }
+  }
+  for (int i = 0; i < numberOfRecords; i++) {
+    quiz_assert(indexedRecordHasValue(i, i % 3 == 0 ? longData : nullptr));
+  }
+  quiz_assert(Storage::sharedStorage()->numberOfRecordsWithExtension("idx") == numberOfRecords / 3);
+  quiz_assert(strcmp(Storage::sharedStorage()->recordWithExtensionAtIndex("idx", 1).fullName(), "rad.idx") == 0);
+  // Rename the first remaining record
+  nameOfIndexedRecord(0, baseName, sizeof(baseName));
+  Storage::Record r = Storage::sharedStorage()->recordBaseNamedWithExtension(baseName, "idx");
+  quiz_assert(r.setName("renamed.idx") == Storage::Record::ErrorStatus::None);
+  quiz_assert(indexedRecordHasValue(0, nullptr));
+  quiz_assert(!Storage::sharedStorage()->recordNamed("renamed.idx").isNull());
+  for (int i = 3; i < numberOfRecords; i += 3) {
+    quiz_assert(indexedRecordHasValue(i, longData));
+  }
+  // The index is rebuilt after the buffer was written behind the storage
+  Storage::sharedStorage()->bufferWasModifiedExternally();
+  for (int i = 3; i < numberOfRecords; i += 3) {
+    quiz_assert(indexedRecordHasValue(i, longData));
+  }
+  Storage::sharedStorage()->destroyRecordsWithExtension("idx");
+  quiz_assert(Storage::sharedStorage()->recordNamed("renamed.idx").isNull());
+  quiz_assert(Storage::sharedStorage()->availableSize() == initialStorageAvailableStage);
+}
+
+QUIZ_CASE(ion_storage_records_with_extension) {
+  size_t initialStorageAvailableStage = Storage::sharedStorage()->availableSize();
+  char baseName[4];
+  for (int i = 0; i < 10; i++) {
+    nameOfIndexedRecord(i, baseName, sizeof(baseName));
+    quiz_assert(putRecordInSharedStorage(baseName, i % 2 == 0 ? "even" : "odd", baseName) == Storage::Record::ErrorStatus::None);
+  }
+  quiz_assert(Storage::sharedStorage()->numberOfRecordsWithExtension("even") == 5);
+  quiz_assert(Storage::sharedStorage()->numberOfRecordsWithExtension("odd") == 5);
+  // Destroy the record rac, and move the record rae to the odd records
+  Storage::sharedStorage()->recordNamed("rac.even").destroy();
+  quiz_assert(Storage::sharedStorage()->recordNamed("rae.even").setName("rae.odd") == Storage::Record::ErrorStatus::None);
+  quiz_assert(putRecordInSharedStorage("rba", "even", "rba") == Storage::Record::ErrorStatus::None);
+  const char * evenNames[] = {"raa.even", "rag.even", "rai.even", "rba.even"};
+  const char * oddNames[] = {"rab.odd", "rad.odd", "rae.odd", "raf.odd", "rah.odd", "raj.odd"};
+  quiz_assert(Storage::sharedStorage()->numberOfRecordsWithExtension("even") == 4);
+  for (int i = 0; i < 4; i++) {
+    quiz_assert(strcmp(Storage::sharedStorage()->recordWithExtensionAtIndex("even", i).fullName(), evenNames[i]) == 0);
+  }
+  quiz_assert(Storage::sharedStorage()->recordWithExtensionAtIndex("even", 4).isNull());
+  quiz_assert(Storage::sharedStorage()->numberOfRecordsWithExtension("odd") == 6);
+  for (int i = 0; i < 6; i++) {
+    quiz_assert(strcmp(Storage::sharedStorage()->recordWithExtensionAtIndex("odd", i).fullName(), oddNames[i]) == 0);
+  }
+  Storage::sharedStorage()->destroyRecordsWithExtension("even");
+  quiz_assert(Storage::sharedStorage()->numberOfRecordsWithExtension("even") == 0);
+  Storage::sharedStorage()->destroyRecordsWithExtension("odd");
+  quiz_assert(Storage::sharedStorage()->numberOfRecordsWithExtension("odd") == 0);
+  quiz_assert(Storage::sharedStorage()->availableSize() == initialStorageAvailableStage);
+}
+
+QUIZ_CASE(ion_storage_many_records_with_extension) {
+  // List 200 small records the way the stores and the variable box do
+  constexpr int numberOfRecords = 200;
+  char baseName[4];
+  for (int i = 0; i < numberOfRecords; i++) {
+    nameOfIndexedRecord(i, baseName, sizeof(baseName));
+    quiz_assert(putRecordInSharedStorage(baseName, "many", baseName) == Storage::Record::ErrorStatus::None);
+  }
+  quiz_assert(Storage::sharedStorage()->numberOfRecordsWithExtension("many") == numberOfRecords);
+  for (int i = 0; i < numberOfRecords; i++) {
+    Storage::Record r = Storage::sharedStorage()->recordWithExtensionAtIndex("many", i);
+    nameOfIndexedRecord(i, baseName, sizeof(baseName));
+    Storage::Record::Data data = r.value();
+    quiz_assert(data.size == strlen(baseName) && memcmp(data.buffer, baseName, data.size) == 0);
+  }
+  Storage::sharedStorage()->destroyRecordsWithExtension("many");
+}
+
+static void assert_checksum_is_up_to_date() {
+  // Computing the checksum anew from the buffer should not change it
+  uint32_t checksum = Storage::sharedStorage()->checksum();
+  Storage::sharedStorage()->bufferWasModifiedExternally();
+  quiz_assert(Storage::sharedStorage()->checksum() == checksum);
+}
+
+QUIZ_CASE(ion_storage_checksum) {
+  quiz_assert(putRecordInSharedStorage("ionTestStorage1", "chk", "first") == Storage::Record::ErrorStatus::None);
+  quiz_assert(putRecordInSharedStorage("ionTestStorage2", "chk", "second") == Storage::Record::ErrorStatus::None);
+  Storage::Record r = Storage::sharedStorage()->recordNamed("ionTestStorage1.chk");
+  uint32_t initialChecksum = Storage::sharedStorage()->checksum();
+  uint32_t initialVersion = Storage::sharedStorage()->version();
+  assert_checksum_is_up_to_date();
+
+  // Modify the value of a record, then restore it
+  const char * longerValue = "first, but longer";
+  quiz_assert(r.setValue({.buffer = longerValue, .size = strlen(longerValue)}) == Storage::Record::ErrorStatus::None);
+  quiz_assert(Storage::sharedStorage()->checksum() != initialChecksum);
+  assert_checksum_is_up_to_date();
+  quiz_assert(r.setValue({.buffer = "first", .size = strlen("first")}) == Storage::Record::ErrorStatus::None);
+  quiz_assert(Storage::sharedStorage()->checksum() == initialChecksum);
+
+  // Modify the value of a record in place
+  char * value = static_cast<char *>(const_cast<void *>(r.value().buffer));
+  value[0] = 'F';
+  r.valueDidChangeInPlace();
+  quiz_assert(Storage::sharedStorage()->checksum() != initialChecksum);
+  assert_checksum_is_up_to_date();
+  value = static_cast<char *>(const_cast<void *>(r.value().buffer));
+  value[0] = 'f';
+  r.valueDidChangeInPlace();
+  quiz_assert(Storage::sharedStorage()->checksum() == initialChecksum);
+
+  // Rename a record, then restore its name
+  quiz_assert(r.setName("ionTestStorage3.chk") == Storage::Record::ErrorStatus::None);
+  quiz_assert(Storage::sharedStorage()->checksum() != initialChecksum);
+  assert_checksum_is_up_to_date();
+  r = Storage::sharedStorage()->recordNamed("ionTestStorage3.chk");
+  quiz_assert(r.setName("ionTestStorage1.chk") == Storage::Record::ErrorStatus::None);
+  quiz_assert(Storage::sharedStorage()->checksum() == initialChecksum);
+  quiz_assert(Storage::sharedStorage()->version() != initialVersion);
+
+  Storage::sharedStorage()->destroyRecordsWithExtension("chk");
+  assert_checksum_is_up_to_date();
+}
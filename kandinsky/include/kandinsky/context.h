@@ -22,12 +22,22 @@ public:
 
   // Line. Not anti-aliased.
   void drawLine(KDPoint p1, KDPoint p2, KDColor c);
+  /* Anti-aliased polyline of given thickness, joining the points of
+   * coordinates (x[i], y[i]), pixel (i, j) being centered on the point (i, j).
+   * Each row of pixels is blended and pushed at once: the working buffer must
+   * hold a row of the clipping rect. A pixel covered by several segments is
+   * only blended once. */
+  void drawAntialiasedPolyline(const float * x, const float * y, int numberOfPoints, float thickness, KDColor color, KDColor * workingBuffer);
 
   // Rect
   void fillRect(KDRect rect, KDColor color);
   void fillRectWithPixels(KDRect rect, const KDColor * pixels, KDColor * workingBuffer);
   void blendRectWithMask(KDRect rect, KDColor color, const uint8_t * mask, KDColor * workingBuffer);
   void strokeRect(KDRect rect, KDColor color);
+  /* Move the pixels of rect by offset. The pixels moved out of rect are
+   * dropped and the uncovered part of rect is left unaltered. The working
+   * buffer must hold a row of rect. */
+  void translateRect(KDRect rect, KDPoint offset, KDColor * workingBuffer);
 protected:
   KDContext(KDPoint origin, KDRect clippingRect) :
     m_origin(origin),
@@ -0,0 +1,145 @@
+#include <kandinsky/context.h>
+#include <assert.h>
+#include <cmath>
+
+static inline float minFloat(float x, float y) { return x < y ? x : y; }
+static inline float maxFloat(float x, float y) { return x > y ? x : y; }
+
+/* Compute the abscissae covered by the part of segment [p1, p2] that lies in
+ * the horizontal band [y-halfHeight, y+halfHeight]. Return false if the
+ * segment does not cross the band. */
+static bool segmentAbscissaeInBand(float x1, float y1, float x2, float y2, float y, float halfHeight, float * xMin, float * xMax) {
+  if (maxFloat(y1, y2) < y - halfHeight || minFloat(y1, y2) > y + halfHeight) {
+    return false;
+  }
+  float start = 0.0f;
+  float end = 1.0f;
+  if (y1 != y2) {
+    float t1 = (y - halfHeight - y1) / (y2 - y1);
+    float t2 = (y + halfHeight - y1) / (y2 - y1);
+    start = maxFloat(start, minFloat(t1, t2));
+    end = minFloat(end, maxFloat(t1, t2));
+  }
+  float xStart = x1 + start * (x2 - x1);
+  float xEnd = x1 + end * (x2 - x1);
+  *xMin = minFloat(xStart, xEnd);
+  *xMax = maxFloat(xStart, xEnd);
+  return true;
+}
+
+/* Compute the pixels of a row that may be covered by segment [p1, p2], between
+ * the clipping bounds left and right. The row is at relative ordinate y and
+ * the pixels are given in absolute abscissae. */
+static bool segmentPixelsInRow(float x1, float y1, float x2, float y2, float y, float reach, float originX, float clipLeft, float clipRight, float * left, float * right) {
+  float xMin, xMax;
+  if (!segmentAbscissaeInBand(x1, y1, x2, y2, y, reach, &xMin, &xMax)) {
+    return false;
+  }
+  *left = maxFloat(std::ceil(originX + xMin - reach), clipLeft);
+  *right = minFloat(std::floor(originX + xMax + reach), clipRight);
+  return *left <= *right;
+}
+
+static float distanceToSegment(float x, float y, float x1, float y1, float x2, float y2) {
+  float dx = x2 - x1;
+  float dy = y2 - y1;
+  float squaredLength = dx*dx + dy*dy;
+  float t = 0.0f;
+  if (squaredLength > 0.0f) {
+    t = maxFloat(0.0f, minFloat(1.0f, ((x - x1)*dx + (y - y1)*dy) / squaredLength));
+  }
+  float ex = x - (x1 + t*dx);
+  float ey = y - (y1 + t*dy);
+  return std::sqrt(ex*ex + ey*ey);
+}
+
+void KDContext::drawAntialiasedPolyline(const float * x, const float * y, int numberOfPoints, float thickness, KDColor color, KDColor * workingBuffer) {
+  if (numberOfPoints <= 0) {
+    return;
+  }
+  /* The pixel of coordinates (i, j) is centered on the point (i, j). Its
+   * coverage by the line decreases linearly from 1, when its center is within
+   * thickness/2 - 1/2 of the polyline, to 0, when it is beyond reach. */
+  const float reach = thickness/2.0f + 0.5f;
+  const float originX = m_origin.x();
+  const float originY = m_origin.y();
+  float xMin = x[0], xMax = x[0], yMin = y[0], yMax = y[0];
+  for (int k = 1; k < numberOfPoints; k++) {
+    xMin = minFloat(xMin, x[k]);
+    xMax = maxFloat(xMax, x[k]);
+    yMin = minFloat(yMin, y[k]);
+    yMax = maxFloat(yMax, y[k]);
+  }
+  /* Clip in floats before converting to coordinates, as the points may be
+   * far out of the clipping rect. */
+  const float clipLeft = m_clippingRect.left();
+  const float clipRight = m_clippingRect.right();
+  const float top = maxFloat(std::ceil(originY + yMin - reach), m_clippingRect.top());
+  const float bottom = minFloat(std::floor(originY + yMax + reach), m_clippingRect.bottom());
+  if (m_clippingRect.isEmpty() || top > bottom
+   || originX + xMax + reach < clipLeft || originX + xMin - reach > clipRight) {
+    return;
+  }
+  // A single point is drawn as a segment of length 0
+  const int numberOfSegments = numberOfPoints > 1 ? numberOfPoints - 1 : 1;
+  for (KDCoordinate j = top; j <= bottom; j++) {
+    // Relative ordinate of the center of the row
+    const float rowY = j - originY;
+    /* The pixels of the row that the segments may cover are gathered into
+     * disjoint spans, taken from left to right: a non-monotonic polyline
+     * leaves the pixels between its crossings of the row untouched. */
+    float spanLeft = clipLeft;
+    while (true) {
+      // The next span starts at the leftmost pixel not drawn yet
+      float nextLeft = INFINITY;
+      float spanRight = -INFINITY;
+      for (int k = 0; k < numberOfSegments; k++) {
+        const int l = numberOfPoints > 1 ? k + 1 : k;
+        float segmentLeft, segmentRight;
+        if (segmentPixelsInRow(x[k], y[k], x[l], y[l], rowY, reach, originX, clipLeft, clipRight, &segmentLeft, &segmentRight)
+         && segmentRight >= spanLeft && maxFloat(segmentLeft, spanLeft) < nextLeft) {
+          nextLeft = maxFloat(segmentLeft, spanLeft);
+          spanRight = segmentRight;
+        }
+      }
+      if (nextLeft == INFINITY) {
+        break;
+      }
+      spanLeft = nextLeft;
+      // Merge the spans of the segments overlapping or touching this one
+      bool spanGrew = true;
+      while (spanGrew) {
+        spanGrew = false;
+        for (int k = 0; k < numberOfSegments; k++) {
+          const int l = numberOfPoints > 1 ? k + 1 : k;
+          float segmentLeft, segmentRight;
+          if (segmentPixelsInRow(x[k], y[k], x[l], y[l], rowY, reach, originX, clipLeft, clipRight, &segmentLeft, &segmentRight)
+           && segmentLeft <= spanRight + 1.0f && segmentRight > spanRight) {
+            spanRight = segmentRight;
+            spanGrew = true;
+          }
+        }
+      }
+      // Blend the whole span at once
+      KDRect span(spanLeft, j, spanRight - spanLeft + 1, 1);
+      pullRect(span, workingBuffer);
+      for (KDCoordinate i = 0; i < span.width(); i++) {
+        const float pixelX = span.x() + i - originX;
+        float coverage = 0.0f;
+        for (int k = 0; k < numberOfSegments && coverage < 1.0f; k++) {
+          const int l = numberOfPoints > 1 ? k + 1 : k;
+          if (maxFloat(x[k], x[l]) < pixelX - reach || minFloat(x[k], x[l]) > pixelX + reach
+           || maxFloat(y[k], y[l]) < rowY - reach || minFloat(y[k], y[l]) > rowY + reach) {
+            continue;
+          }
+          coverage = maxFloat(coverage, reach - distanceToSegment(pixelX, rowY, x[k], y[k], x[l], y[l]));
+        }
+        if (coverage > 0.0f) {
+          workingBuffer[i] = KDColor::blend(color, workingBuffer[i], minFloat(coverage, 1.0f) * 0xFF);
+        }
+      }
+      pushRect(span, workingBuffer);
+      spanLeft = spanRight + 1.0f;
+    }
+  }
+}
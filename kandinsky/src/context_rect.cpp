@@ -93,3 +93,20 @@ void KDContext::strokeRect(KDRect rect, KDColor color) {
   fillRect(KDRect(KDPoint(rect.right(), rect.y()), 1, rect.height()), color);
 }
 
+
+void KDContext::translateRect(KDRect rect, KDPoint offset, KDColor * workingBuffer) {
+  KDRect absoluteRect = absoluteFillRect(rect);
+  KDRect destination = absoluteRect.intersectedWith(absoluteRect.translatedBy(offset));
+  if (destination.isEmpty()) {
+    return;
+  }
+  KDRect source = destination.translatedBy(offset.opposite());
+  /* Rows are moved one by one. When moving down, the bottom rows are moved
+   * first so that no row is overwritten before being pulled. */
+  KDCoordinate height = destination.height();
+  for (KDCoordinate j = 0; j < height; j++) {
+    KDCoordinate row = offset.y() > 0 ? height - 1 - j : j;
+    pullRect(KDRect(source.x(), source.y() + row, source.width(), 1), workingBuffer);
+    pushRect(KDRect(destination.x(), destination.y() + row, destination.width(), 1), workingBuffer);
+  }
+}
@@ -47,12 +47,15 @@ void KDFont::accumulateGlyphGreyscalesForCodePoint(CodePoint codePoint, GlyphBuf
 }
 
 void KDFont::fetchGreyscaleGlyphAtIndex(KDFont::GlyphIndex index, uint8_t * greyscaleBuffer) const {
-  Ion::decompress(
+  int glyphDataSize = m_glyphSize.width() * m_glyphSize.height() * k_bitsPerPixel/8;
+  int decompressedSize = Ion::decompress(
     compressedGlyphData(index),
     greyscaleBuffer,
     compressedGlyphDataSize(index),
-    m_glyphSize.width() * m_glyphSize.height() * k_bitsPerPixel/8
+    glyphDataSize
   );
+  (void)decompressedSize; // Make the compiler happy if assertions are disabled
+  assert(decompressedSize == glyphDataSize);
 }
 
 void KDFont::colorizeGlyphBuffer(const RenderPalette * renderPalette, GlyphBuffer * glyphBuffer) const {
@@ -0,0 +1,179 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <assert.h>
+
+constexpr KDCoordinate k_width = 6;
+constexpr KDCoordinate k_height = 5;
+
+void assert_rect_translates_to(KDRect rect, KDPoint offset, KDRect clippingRect, const uint16_t expectedPixels[k_height][k_width]) {
+  KDColor pixels[k_width*k_height];
+  for (int i = 0; i < k_width*k_height; i++) {
+    pixels[i] = KDColor::RGB16(i);
+  }
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  KDFrameBufferContext context(&frameBuffer);
+  context.setClippingRect(clippingRect);
+  KDColor workingBuffer[k_width];
+  context.translateRect(rect, offset, workingBuffer);
+  for (int j = 0; j < k_height; j++) {
+    for (int i = 0; i < k_width; i++) {
+      quiz_assert(pixels[i + k_width*j] == expectedPixels[j][i]);
+    }
+  }
+}
+
+QUIZ_CASE(kandinsky_context_translate_rect) {
+  KDRect frame(0, 0, k_width, k_height);
+  const uint16_t downRight[k_height][k_width] = {
+    { 0,  1,  2,  3,  4,  5},
+    { 6,  7,  8,  9, 10, 11},
+    {12, 13,  7,  8,  9, 17},
+    {18, 19, 13, 14, 15, 23},
+    {24, 25, 26, 27, 28, 29}
+  };
+  assert_rect_translates_to(KDRect(1, 1, 4, 3), KDPoint(1, 1), frame, downRight);
+  const uint16_t upLeft[k_height][k_width] = {
+    { 7,  8,  9, 10, 11,  5},
+    {13, 14, 15, 16, 17, 11},
+    {19, 20, 21, 22, 23, 17},
+    {25, 26, 27, 28, 29, 23},
+    {24, 25, 26, 27, 28, 29}
+  };
+  assert_rect_translates_to(frame, KDPoint(-1, -1), frame, upLeft);
+  // Only the pixels of the clipped rect move
+  const uint16_t clippedLeft[k_height][k_width] = {
+    { 0,  1,  2,  3,  4,  5},
+    { 6,  7,  8,  9, 10, 11},
+    {12, 15, 16, 15, 16, 17},
+    {18, 21, 22, 21, 22, 23},
+    {24, 25, 26, 27, 28, 29}
+  };
+  assert_rect_translates_to(frame, KDPoint(-2, 0), KDRect(1, 2, 4, 2), clippedLeft);
+  // Moving the pixels out of the rect leaves it unaltered
+  const uint16_t unaltered[k_height][k_width] = {
+    { 0,  1,  2,  3,  4,  5},
+    { 6,  7,  8,  9, 10, 11},
+    {12, 13, 14, 15, 16, 17},
+    {18, 19, 20, 21, 22, 23},
+    {24, 25, 26, 27, 28, 29}
+  };
+  assert_rect_translates_to(frame, KDPoint(0, k_height), frame, unaltered);
+}
+
+void assert_polyline_draws(const float * x, const float * y, int numberOfPoints, float thickness, KDRect clippingRect, const char * expectedPixels[k_height]) {
+  /* '#' stands for a fully covered pixel, '+' for a pixel half covered and ' '
+   * for an uncovered one. */
+  KDColor pixels[k_width*k_height];
+  for (int i = 0; i < k_width*k_height; i++) {
+    pixels[i] = KDColorWhite;
+  }
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  KDFrameBufferContext context(&frameBuffer);
+  context.setClippingRect(clippingRect);
+  KDColor workingBuffer[k_width];
+  context.drawAntialiasedPolyline(x, y, numberOfPoints, thickness, KDColorBlack, workingBuffer);
+  const KDColor halfCovered = KDColor::blend(KDColorBlack, KDColorWhite, 0x7F);
+  for (int j = 0; j < k_height; j++) {
+    for (int i = 0; i < k_width; i++) {
+      char c = expectedPixels[j][i];
+      KDColor expected = c == '#' ? KDColorBlack : (c == '+' ? halfCovered : KDColorWhite);
+      quiz_assert(pixels[i + k_width*j] == expected);
+    }
+  }
+}
+
+QUIZ_CASE(kandinsky_context_draw_antialiased_polyline) {
+  KDRect frame(0, 0, k_width, k_height);
+  const float x1[] = {1.0f, 4.0f};
+  const float y1[] = {2.0f, 2.0f};
+  const char * line[k_height] = {
+    "      ",
+    "      ",
+    " #### ",
+    "      ",
+    "      "
+  };
+  assert_polyline_draws(x1, y1, 2, 1.0f, frame, line);
+  const float x2[] = {1.0f, 1.0f};
+  const float y2[] = {0.0f, 4.0f};
+  const char * thickLine[k_height] = {
+    "###   ",
+    "###   ",
+    "###   ",
+    "###   ",
+    "###   "
+  };
+  assert_polyline_draws(x2, y2, 2, 3.0f, frame, thickLine);
+  // A single point is drawn as a dot
+  const float x3[] = {2.5f};
+  const float y3[] = {2.0f};
+  const char * dot[k_height] = {
+    "      ",
+    "      ",
+    "  ++  ",
+    "      ",
+    "      "
+  };
+  assert_polyline_draws(x3, y3, 1, 1.0f, frame, dot);
+  // Pixels covered by several segments are blended once
+  const float x4[] = {1.0f, 4.0f, 1.0f};
+  const float y4[] = {2.5f, 2.5f, 2.5f};
+  const char * halfLine[k_height] = {
+    "      ",
+    "      ",
+    " ++++ ",
+    " ++++ ",
+    "      "
+  };
+  assert_polyline_draws(x4, y4, 3, 1.0f, frame, halfLine);
+  const char * clippedHalfLine[k_height] = {
+    "      ",
+    "      ",
+    " ++++ ",
+    "      ",
+    "      "
+  };
+  assert_polyline_draws(x4, y4, 3, 1.0f, KDRect(0, 0, k_width, 3), clippedHalfLine);
+}
+
+class PushCountingContext : public KDFrameBufferContext {
+public:
+  PushCountingContext(KDFrameBuffer * frameBuffer) : KDFrameBufferContext(frameBuffer), m_numberOfPushedPixels(0) {}
+  int numberOfPushedPixels() const { return m_numberOfPushedPixels; }
+protected:
+  void pushRect(KDRect rect, const KDColor * pixels) override {
+    m_numberOfPushedPixels += rect.width() * rect.height();
+    KDFrameBufferContext::pushRect(rect, pixels);
+  }
+private:
+  int m_numberOfPushedPixels;
+};
+
+QUIZ_CASE(kandinsky_context_draw_antialiased_polyline_spans) {
+  // The pixels between two crossings of a row are neither pulled nor pushed
+  KDColor pixels[k_width*k_height];
+  for (int i = 0; i < k_width*k_height; i++) {
+    pixels[i] = KDColorWhite;
+  }
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  PushCountingContext context(&frameBuffer);
+  context.setClippingRect(KDRect(0, 0, k_width, k_height));
+  KDColor workingBuffer[k_width];
+  const float x[] = {0.0f, 0.0f, 5.0f, 5.0f};
+  const float y[] = {0.0f, 4.0f, 4.0f, 0.0f};
+  context.drawAntialiasedPolyline(x, y, 4, 1.0f, KDColorBlack, workingBuffer);
+  const char * u[k_height] = {
+    "#    #",
+    "#    #",
+    "#    #",
+    "#    #",
+    "######"
+  };
+  for (int j = 0; j < k_height; j++) {
+    for (int i = 0; i < k_width; i++) {
+      quiz_assert(pixels[i + k_width*j] == (u[j][i] == '#' ? KDColorBlack : KDColorWhite));
+    }
+  }
+  // Two spans of 2 pixels on the first three rows, the last two rows are full
+  quiz_assert(context.numberOfPushedPixels() == 3*4 + 2*k_width);
+}
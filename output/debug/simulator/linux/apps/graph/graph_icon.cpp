@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "graph_icon.h"
+
+// Compressed 3080 pixels into 621 bytes (10.08% compression ratio)/
+const uint8_t compressedPixelData[621] = {0x0019, 0x00ff, 0x0001, 0x0000, 0x004f, 0x00df, 0x00ff, 0x00be, 0x00f7, 0x0002, 0x0000, 0x0039, 0x002f, 0x00df, 0x00ff, 0x0001, 0x0000, 0x0005, 0x002f, 0x00be, 0x00f7, 0x0002, 0x0000, 0x0045, 0x002f, 0x00ff, 0x00ff, 0x00d4, 0x0000, 0x004b, 0x000e, 0x00e4, 0x0000, 0x000f, 0x006c, 0x0000, 0x0057, 0x000a, 0x0070, 0x0000, 0x002f, 0x00be, 0x00f7, 0x0002, 0x0000, 0x0051, 0x000f, 0x006c, 0x0000, 0x0059, 0x0002, 0x0070, 0x0000, 0x001f, 0x00df, 0x006e, 0x0000, 0x006a, 0x002f, 0x00ab, 0x0052, 0x00bc, 0x0001, 0x0049, 0x000c, 0x0012, 0x0000, 0x002f, 0x0008, 0x0042, 0x00ec, 0x0000, 0x0057, 0x000f, 0x006e, 0x0000, 0x00ff, 0x007c, 0x009f, 0x009d, 0x00f7, 0x009c, 0x00f7, 0x009c, 0x00f7, 0x009d, 0x00f7, 0x009e, 0x006e, 0x0000, 0x0046, 0x0099, 0x009c, 0x00f7, 0x0038, 0x00ff, 0x00d4, 0x00fe, 0x0091, 0x00fe, 0x006f, 0x0002, 0x0000, 0x000f, 0x006e, 0x0000, 0x003f, 0x005b, 0x005a, 0x00ff, 0x00d4, 0x00fe, 0x0070, 0x0066, 0x0000, 0x000f, 0x006e, 0x0000, 0x0041, 0x003e, 0x009d, 0x00f7, 0x00f6, 0x0068, 0x0000, 0x000f, 0x006e, 0x0000, 0x0042, 0x003e, 0x009d, 0x00f7, 0x00d4, 0x0068, 0x0000, 0x000f, 0x006e, 0x0000, 0x0044, 0x001e, 0x00f6, 0x006a, 0x0000, 0x000f, 0x006e, 0x0000, 0x0014, 0x002a, 0x007d, 0x00ef, 0x0002, 0x0000, 0x002c, 0x0008, 0x0042, 0x0012, 0x0000, 0x000a, 0x0002, 0x0000, 0x002f, 0x003a, 0x00f7, 0x003e, 0x0001, 0x000b, 0x0008, 0x0002, 0x0000, 0x000e, 0x004a, 0x0000, 0x000f, 0x006e, 0x0000, 0x001b, 0x002f, 0x00d6, 0x00f6, 0x005a, 0x0000, 0x0005, 0x00f1, 0x0000, 0x004e, 0x00fe, 0x002c, 0x00fe, 0x000b, 0x00fe, 0x00e9, 0x00fd, 0x00e8, 0x00fd, 0x00c7, 0x00fd, 0x00c6, 0x00fd, 0x00a6, 0x0002, 0x0000, 0x000f, 0x006e, 0x0000, 0x0029, 0x003f, 0x005c, 0x00ef, 0x0092, 0x0068, 0x0000, 0x0002, 0x007e, 0x004d, 0x00fe, 0x000a, 0x00fe, 0x00c8, 0x00fd, 0x00a6, 0x0002, 0x0000, 0x000f, 0x006e, 0x0000, 0x0028, 0x002e, 0x005b, 0x00ef, 0x0042, 0x0001, 0x003e, 0x004f, 0x00fe, 0x000b, 0x0068, 0x0000, 0x000f, 0x006e, 0x0000, 0x0030, 0x000e, 0x006c, 0x0000, 0x0000, 0x006a, 0x0000, 0x001e, 0x00c7, 0x006a, 0x0000, 0x000f, 0x006e, 0x0000, 0x0030, 0x001d, 0x005c, 0x006c, 0x0000, 0x001e, 0x002c, 0x006a, 0x0000, 0x000f, 0x006e, 0x0000, 0x0034, 0x000c, 0x006c, 0x0000, 0x003e, 0x004e, 0x00fe, 0x00e9, 0x006a, 0x0000, 0x000f, 0x006e, 0x0000, 0x0036, 0x000a, 0x001c, 0x0002, 0x001e, 0x002d, 0x00d6, 0x0000, 0x000f, 0x006e, 0x0000, 0x0038, 0x0019, 0x00d5, 0x00f4, 0x0002, 0x002e, 0x000b, 0x00fe, 0x006a, 0x0000, 0x000f, 0x006e, 0x0000, 0x0037, 0x0028, 0x0039, 0x00f7, 0x006c, 0x0000, 0x000e, 0x0042, 0x0001, 0x000f, 0x006e, 0x0000, 0x0039, 0x002e, 0x005d, 0x00ef, 0x006c, 0x0000, 0x000f, 0x006e, 0x0000, 0x0047, 0x001e, 0x00b3, 0x006c, 0x0000, 0x000f, 0x006e, 0x0000, 0x0046, 0x002e, 0x003b, 0x00ef, 0x006c, 0x0000, 0x000f, 0x006e, 0x0000, 0x0047, 0x0006, 0x00f8, 0x0002, 0x003f, 0x000a, 0x00fe, 0x00a6, 0x006e, 0x0000, 0x004c, 0x0026, 0x0018, 0x00f7, 0x00ca, 0x0003, 0x002f, 0x00a6, 0x00fd, 0x006e, 0x0000, 0x004d, 0x0006, 0x0074, 0x0005, 0x002f, 0x00c6, 0x00fd, 0x006e, 0x0000, 0x004d, 0x0024, 0x0019, 0x00f7, 0x000e, 0x0005, 0x000e, 0x00cc, 0x0003, 0x000f, 0x006e, 0x0000, 0x003f, 0x001e, 0x0070, 0x001e, 0x0002, 0x000f, 0x006e, 0x0000, 0x0032, 0x002a, 0x00db, 0x00de, 0x0002, 0x0000, 0x007f, 0x0008, 0x0042, 0x00db, 0x00de, 0x00b9, 0x00de, 0x004f, 0x00b2, 0x0001, 0x002c, 0x0002, 0x0002, 0x0000, 0x002e, 0x00db, 0x00de, 0x0002, 0x0000, 0x000e, 0x006e, 0x0000, 0x0022, 0x0051, 0x00f6, 0x007e, 0x0005, 0x002f, 0x00c7, 0x00fd, 0x006e, 0x0000, 0x0051, 0x001e, 0x004e, 0x0046, 0x0001, 0x000f, 0x006e, 0x0000, 0x0046, 0x0022, 0x0095, 0x00e6, 0x00ec, 0x0005, 0x001f, 0x00a6, 0x006e, 0x0000, 0x0052, 0x0011, 0x004f, 0x0048, 0x0001, 0x002f, 0x00c8, 0x00fd, 0x006e, 0x0000, 0x0053, 0x001e, 0x004e, 0x005a, 0x0006, 0x000f, 0x006e, 0x0000, 0x0048, 0x000e, 0x0020, 0x0002, 0x000f, 0x006e, 0x0000, 0x004b, 0x000e, 0x0018, 0x0005, 0x000f, 0x006e, 0x0000, 0x0047, 0x001e, 0x004d, 0x006c, 0x0000, 0x000f, 0x006e, 0x0000, 0x0048, 0x002f, 0x00e8, 0x00fd, 0x006e, 0x0000, 0x0057, 0x003f, 0x0009, 0x0042, 0x0008, 0x0002, 0x0000, 0x0038, 0x004f, 0x008b, 0x0052, 0x00db, 0x00de, 0x0002, 0x0000, 0x0067, 0x002f, 0x00ba, 0x00d6, 0x006c, 0x0000, 0x0057, 0x002f, 0x009a, 0x00d6, 0x00dc, 0x0000, 0x005b, 0x004f, 0x00ff, 0x00ff, 0x0059, 0x00ce, 0x006a, 0x0000, 0x0053, 0x0020, 0x0038, 0x00c6, 0x00c4, 0x0013, 0x001f, 0x00fb, 0x004e, 0x0001, 0x0052, 0x0042, 0x009a, 0x00d6, 0x00fb, 0x00de, 0x0034, 0x0014, 0x004f, 0x0059, 0x00ce, 0x00ba, 0x00d6, 0x006c, 0x0000, 0x004d, 0x0026, 0x0059, 0x00ce, 0x007e, 0x0015, 0x004f, 0x0038, 0x00c6, 0x0038, 0x00c6, 0x006c, 0x0000, 0x0047, 0x004a, 0x0018, 0x00c6, 0x0038, 0x00c6, 0x005a, 0x0016, 0x006f, 0x00fb, 0x00de, 0x0055, 0x00ad, 0x0038, 0x00c6, 0x00ae, 0x0001, 0x0041, 0x0024, 0x0055, 0x00ad, 0x0044, 0x0001, 0x000a, 0x0001, 0x0000, 0x009f, 0x00db, 0x00de, 0x00d7, 0x00bd, 0x0034, 0x00a5, 0x00f3, 0x009c, 0x00d3, 0x0002, 0x0000, 0x0032, 0x0074, 0x00f3, 0x009c, 0x0034, 0x00a5, 0x00d7, 0x00bd, 0x00db, 0x006a, 0x0000, 0x0050, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(55, 56, compressedPixelData, 621);
+
+const Image * ImageStore::GraphIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "stat_icon.h"
+
+// Compressed 3080 pixels into 804 bytes (13.05% compression ratio)/
+const uint8_t compressedPixelData[804] = {0x0015, 0x00ff, 0x0001, 0x0000, 0x00cf, 0x00df, 0x00ff, 0x007a, 0x00ce, 0x00f4, 0x009c, 0x0011, 0x007c, 0x006f, 0x006b, 0x004e, 0x0063, 0x0002, 0x0000, 0x0031, 0x00ae, 0x006f, 0x006b, 0x00f0, 0x007b, 0x00f4, 0x009c, 0x007a, 0x00ce, 0x00df, 0x00ff, 0x0001, 0x0000, 0x006f, 0x007a, 0x00ce, 0x00f1, 0x007b, 0x004e, 0x0063, 0x0002, 0x0000, 0x0041, 0x004a, 0x00f1, 0x007b, 0x009a, 0x00d6, 0x006c, 0x0000, 0x004f, 0x0076, 0x00ad, 0x004e, 0x0063, 0x0002, 0x0000, 0x0049, 0x0026, 0x0076, 0x00ad, 0x006c, 0x0000, 0x004f, 0x0035, 0x00a5, 0x004e, 0x0063, 0x0002, 0x0000, 0x004d, 0x0024, 0x0096, 0x00ad, 0x0044, 0x0001, 0x002f, 0x004e, 0x0063, 0x0002, 0x0000, 0x0051, 0x0020, 0x009a, 0x00ce, 0x001c, 0x0002, 0x002f, 0x00d0, 0x0073, 0x006e, 0x0000, 0x0053, 0x008f, 0x00d0, 0x0073, 0x00df, 0x00ff, 0x0059, 0x00c6, 0x004e, 0x0063, 0x0002, 0x0000, 0x0055, 0x004f, 0x0059, 0x00ce, 0x00d4, 0x0094, 0x006e, 0x0000, 0x0057, 0x004f, 0x00f4, 0x009c, 0x00d0, 0x0073, 0x006e, 0x0000, 0x0057, 0x001e, 0x00f0, 0x0064, 0x0003, 0x000f, 0x0002, 0x0000, 0x0048, 0x000f, 0x0038, 0x0004, 0x0035, 0x000f, 0x0002, 0x0000, 0x00ff, 0x00f6, 0x006c, 0x006e, 0x006b, 0x00f8, 0x00bd, 0x00be, 0x00f7, 0x003a, 0x0006, 0x005f, 0x00be, 0x00f7, 0x00f8, 0x00bd, 0x006e, 0x006a, 0x0002, 0x0040, 0x003f, 0x00f8, 0x00bd, 0x00ff, 0x0001, 0x0000, 0x0004, 0x002f, 0x00d7, 0x00b5, 0x006c, 0x0000, 0x003d, 0x002e, 0x002e, 0x0063, 0x0014, 0x0007, 0x0006, 0x0086, 0x0007, 0x001f, 0x002e, 0x006c, 0x0000, 0x003c, 0x003f, 0x000d, 0x005b, 0x00ff, 0x0001, 0x0000, 0x0006, 0x005f, 0x005d, 0x00ef, 0x000d, 0x005b, 0x002e, 0x006e, 0x0000, 0x0054, 0x004f, 0x005d, 0x00ef, 0x001c, 0x00e7, 0x006e, 0x0000, 0x003d, 0x002f, 0x00ed, 0x005a, 0x006c, 0x0000, 0x0003, 0x008f, 0x003d, 0x00ef, 0x001c, 0x00e7, 0x001c, 0x00e7, 0x00ed, 0x005a, 0x006e, 0x0000, 0x004f, 0x0013, 0x00df, 0x006c, 0x0000, 0x0002, 0x006e, 0x0000, 0x000f, 0x00b4, 0x0002, 0x0037, 0x000f, 0x006e, 0x0000, 0x0001, 0x0031, 0x00bf, 0x00f7, 0x001d, 0x006a, 0x0000, 0x0004, 0x006e, 0x0000, 0x000f, 0x00b4, 0x0002, 0x0037, 0x000e, 0x006e, 0x0000, 0x0024, 0x009e, 0x00f7, 0x006a, 0x0000, 0x0002, 0x006e, 0x0000, 0x002f, 0x000d, 0x005b, 0x00b4, 0x0002, 0x0037, 0x000c, 0x006e, 0x0000, 0x0019, 0x007e, 0x006c, 0x0000, 0x0002, 0x006e, 0x0000, 0x002f, 0x009e, 0x00f7, 0x00b6, 0x0002, 0x0007, 0x000f, 0x0046, 0x0002, 0x001b, 0x000a, 0x006e, 0x0000, 0x0000, 0x0086, 0x0002, 0x000b, 0x006e, 0x0000, 0x006f, 0x0052, 0x00ed, 0x005a, 0x001d, 0x00e7, 0x00df, 0x006e, 0x0000, 0x0040, 0x0004, 0x001a, 0x0002, 0x000c, 0x006e, 0x0000, 0x004f, 0x001c, 0x00e7, 0x003d, 0x00ef, 0x006e, 0x0000, 0x0005, 0x002f, 0x00ed, 0x005a, 0x006e, 0x0000, 0x0021, 0x0006, 0x0086, 0x0002, 0x000e, 0x006e, 0x0000, 0x0000, 0x0008, 0x0000, 0x002f, 0x005d, 0x00ef, 0x006e, 0x0000, 0x0017, 0x006a, 0x00d7, 0x00b5, 0x005d, 0x00ef, 0x00be, 0x00f7, 0x0002, 0x0000, 0x0044, 0x005d, 0x00ef, 0x00d7, 0x00b5, 0x006e, 0x0000, 0x0008, 0x0086, 0x0002, 0x000e, 0x006e, 0x0000, 0x0002, 0x000a, 0x0000, 0x002f, 0x009e, 0x00f7, 0x006e, 0x0000, 0x0013, 0x002c, 0x00d7, 0x00b5, 0x006a, 0x0000, 0x0004, 0x0002, 0x0000, 0x0020, 0x00b7, 0x00b5, 0x006e, 0x0000, 0x000a, 0x0086, 0x0002, 0x000e, 0x006e, 0x0000, 0x0004, 0x000c, 0x0000, 0x001f, 0x00bf, 0x006e, 0x0000, 0x0010, 0x004f, 0x002e, 0x0063, 0x009e, 0x00f7, 0x006e, 0x0000, 0x0005, 0x0046, 0x007e, 0x00ef, 0x000d, 0x005b, 0x004e, 0x0000, 0x000f, 0x006e, 0x0000, 0x000d, 0x001e, 0x003d, 0x002e, 0x0002, 0x000b, 0x006e, 0x0000, 0x0000, 0x0008, 0x0005, 0x001f, 0x00be, 0x006e, 0x0000, 0x0006, 0x002f, 0x001c, 0x00e7, 0x006e, 0x0000, 0x0019, 0x000e, 0x00be, 0x0001, 0x000f, 0x006e, 0x0000, 0x0017, 0x0040, 0x009e, 0x00f7, 0x003d, 0x00ef, 0x0050, 0x0003, 0x000f, 0x006e, 0x0000, 0x0019, 0x004e, 0x001c, 0x00e7, 0x007e, 0x00ef, 0x006e, 0x0000, 0x000a, 0x0074, 0x0002, 0x000f, 0x006c, 0x0000, 0x0004, 0x0003, 0x00be, 0x0003, 0x000f, 0x006e, 0x0000, 0x001b, 0x004f, 0x001c, 0x00e7, 0x00be, 0x00f7, 0x006e, 0x0000, 0x001d, 0x002e, 0x007d, 0x00ef, 0x004e, 0x0000, 0x000f, 0x006e, 0x0000, 0x0015, 0x000a, 0x00ec, 0x0003, 0x000f, 0x006e, 0x0000, 0x000f, 0x0008, 0x0032, 0x0004, 0x000f, 0x006e, 0x0000, 0x001f, 0x000a, 0x00ec, 0x0003, 0x000e, 0x006e, 0x0000, 0x000e, 0x00ae, 0x0001, 0x000f, 0x006e, 0x0000, 0x002b, 0x0008, 0x002e, 0x0002, 0x000f, 0x006e, 0x0000, 0x0009, 0x001d, 0x007e, 0x00c6, 0x0003, 0x000f, 0x006e, 0x0000, 0x0023, 0x0006, 0x00ec, 0x0003, 0x000e, 0x006e, 0x0000, 0x000e, 0x0042, 0x0001, 0x000f, 0x006e, 0x0000, 0x002f, 0x0004, 0x00ec, 0x0003, 0x000e, 0x006e, 0x0000, 0x000e, 0x0042, 0x0001, 0x000f, 0x006e, 0x0000, 0x0031, 0x0002, 0x00ec, 0x0003, 0x000e, 0x006e, 0x0000, 0x0006, 0x00f0, 0x0002, 0x000f, 0x006e, 0x0000, 0x0039, 0x0002, 0x00be, 0x0001, 0x000e, 0x006e, 0x0000, 0x001e, 0x007e, 0x00d6, 0x0000, 0x000f, 0x006e, 0x0000, 0x0032, 0x0000, 0x00ec, 0x0003, 0x000e, 0x004c, 0x0004, 0x000f, 0x004e, 0x0000, 0x000a, 0x000e, 0x00de, 0x0003, 0x000f, 0x0020, 0x0000, 0x001a, 0x002c, 0x000d, 0x005b, 0x006e, 0x0000, 0x003f, 0x00cc, 0x0052, 0x00ac, 0x0002, 0x0000, 0x0004, 0x004f, 0x00cc, 0x0052, 0x000d, 0x005b, 0x0020, 0x0000, 0x002d, 0x001d, 0x002e, 0x00a0, 0x000a, 0x0000, 0x007c, 0x0005, 0x000e, 0x0002, 0x0000, 0x0000, 0x0018, 0x0000, 0x001f, 0x002e, 0x0020, 0x0000, 0x002e, 0x000e, 0x00a0, 0x0007, 0x000f, 0x0002, 0x0000, 0x0007, 0x000f, 0x0020, 0x0000, 0x0031, 0x0004, 0x0024, 0x0000, 0x000f, 0x0096, 0x000d, 0x0057, 0x003f, 0x002d, 0x0063, 0x000d, 0x006e, 0x0000, 0x005a, 0x001f, 0x00af, 0x0030, 0x0011, 0x0058, 0x004f, 0x00cf, 0x0073, 0x00b7, 0x00b5, 0x004c, 0x0001, 0x0055, 0x008f, 0x002e, 0x0063, 0x00d7, 0x00bd, 0x00df, 0x00ff, 0x00cc, 0x005a, 0x006e, 0x0000, 0x0053, 0x0020, 0x00ec, 0x005a, 0x00c6, 0x0004, 0x004f, 0x00f7, 0x00bd, 0x00cc, 0x0052, 0x006c, 0x0000, 0x004f, 0x0042, 0x00ac, 0x0052, 0x0018, 0x00c6, 0x0012, 0x0006, 0x004f, 0x0093, 0x0094, 0x00cc, 0x0052, 0x006c, 0x0000, 0x004d, 0x0026, 0x00b3, 0x0094, 0x005e, 0x0007, 0x005f, 0x0072, 0x008c, 0x006a, 0x004a, 0x002d, 0x006a, 0x0000, 0x0044, 0x006a, 0x000d, 0x0063, 0x006a, 0x004a, 0x0072, 0x008c, 0x0018, 0x0009, 0x009f, 0x00f8, 0x00bd, 0x00cb, 0x005a, 0x006a, 0x004a, 0x00ec, 0x005a, 0x002d, 0x00f2, 0x0002, 0x003a, 0x006e, 0x00ec, 0x005a, 0x006a, 0x004a, 0x00cc, 0x005a, 0x00dc, 0x000d, 0x0000, 0x00e6, 0x000b, 0x00af, 0x00b7, 0x00b5, 0x00f0, 0x007b, 0x00cc, 0x005a, 0x0049, 0x004a, 0x0008, 0x0042, 0x0002, 0x0000, 0x0031, 0x0083, 0x0009, 0x0042, 0x00ab, 0x0052, 0x0010, 0x0084, 0x00f8, 0x00bd, 0x0010, 0x0009, 0x0050, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(55, 56, compressedPixelData, 804);
+
+const Image * ImageStore::StatIcon = &image;
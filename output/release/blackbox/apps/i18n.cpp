@@ -0,0 +1,5044 @@
+#include "i18n.h"
+#include <apps/global_preferences.h>
+#include <assert.h>
+
+namespace I18n {
+
+constexpr static char universalDefault[] = {0};
+constexpr static char universalA[] = "a";
+constexpr static char universalAbsCommandWithArg[] = "abs(x)";
+constexpr static char universalAcoshCommandWithArg[] = "acosh(x)";
+constexpr static char universalAlmostEqual[] = "≈";
+constexpr static char universalAlpha[] = "alpha";
+constexpr static char universalArgCommandWithArg[] = "arg(z)";
+constexpr static char universalAsinhCommandWithArg[] = "asinh(x)";
+constexpr static char universalAtanhCommandWithArg[] = "atanh(x)";
+constexpr static char universalB[] = "b";
+constexpr static char universalBinomialCDFCommandWithArg[] = "binomcdf(m,n,p)";
+constexpr static char universalBinomialCommandWithArg[] = "binomial(n,k)";
+constexpr static char universalBinomialPDFCommandWithArg[] = "binompdf(m,n,p)";
+constexpr static char universalBlankMessage[] = " ";
+constexpr static char universalC[] = "c";
+constexpr static char universalCapitalAlpha[] = "ALPHA";
+constexpr static char universalCeilCommandWithArg[] = "ceil(x)";
+constexpr static char universalCmathModule[] = "cmath";
+constexpr static char universalCodeApp[] = "Python";
+constexpr static char universalCodeAppCapital[] = "PYTHON";
+constexpr static char universalConditionAnd[] = "and ";
+constexpr static char universalConditionNot[] = "not ";
+constexpr static char universalConditionOr[] = "or ";
+constexpr static char universalConditionsMenu[] = "Conditions";
+constexpr static char universalConfidenceCommandWithArg[] = "confidence(f,n)";
+constexpr static char universalConjCommandWithArg[] = "conj(z)";
+constexpr static char universalConsolePrompt[] = ">>> ";
+constexpr static char universalCoshCommandWithArg[] = "cosh(x)";
+constexpr static char universalCubicRegressionFormula[] = " y=a·x^3+b·x^2+c·x+d ";
+constexpr static char universalD[] = "d";
+constexpr static char universalD1[] = "d1";
+constexpr static char universalD2[] = "d2";
+constexpr static char universalDash[] = "-";
+constexpr static char universalDeterminantCommandWithArg[] = "det(M)";
+constexpr static char universalDiffCommand[] = "diff(\x11,x,\x11)";
+constexpr static char universalDiffCommandWithArg[] = "diff(f(x),x,a)";
+constexpr static char universalDimensionCommandWithArg[] = "dim(M)";
+constexpr static char universalDiscreteLegend[] = "P(X=";
+constexpr static char universalDiscriminantFormulaDegree2[] = "Δ=b^2-4ac";
+constexpr static char universalE[] = "e";
+constexpr static char universalEqual[] = "=";
+constexpr static char universalEqualityCondition[] = "==";
+constexpr static char universalEqualityConditionWithArg[] = "x==y";
+constexpr static char universalExponentialRegressionFormula[] = " y=a·exp(b·x) ";
+constexpr static char universalFactorCommandWithArg[] = "factor(n)";
+constexpr static char universalFccId[] = "FCC ID";
+constexpr static char universalFiniteIntegralFirstLegend[] = "P(";
+constexpr static char universalFiniteIntegralLegend[] = "≤X≤";
+constexpr static char universalFisher[] = "Fisher";
+constexpr static char universalFloorCommandWithArg[] = "floor(x)";
+constexpr static char universalForInListLoop[] = "for i in \x11:\n  ";
+constexpr static char universalForInListLoopWithArg[] = "for i in list:\n  instruction";
+constexpr static char universalForInRange1ArgLoop[] = "for i in range(\x11):\n  ";
+constexpr static char universalForInRange1ArgLoopWithArg[] = "for i in range(size):\n  instruction";
+constexpr static char universalForInRange2ArgsLoop[] = "for i in range(\x11,):\n  ";
+constexpr static char universalForInRange2ArgsLoopWithArg[] = "for i in range(start, stop):\n  instruction";
+constexpr static char universalForInRange3ArgsLoop[] = "for i in range(\x11,,):\n  ";
+constexpr static char universalForInRange3ArgsLoopWithArg[] = "for i in range(start, stop, step):\n  instruction";
+constexpr static char universalForLoopMenu[] = "For";
+constexpr static char universalFracCommandWithArg[] = "frac(x)";
+constexpr static char universalGcdCommandWithArg[] = "gcd(p,q)";
+constexpr static char universalGon[] = "gon";
+constexpr static char universalIfAndIfElseStatement[] = "if \x11 and :\n  \nelse:\n  ";
+constexpr static char universalIfAndIfElseStatementWithArg[] = "if condition1 and condition2:\n  instruction1\nelse:\n  instruction2";
+constexpr static char universalIfElifElseStatement[] = "if \x11:\n  \nelif :\n  \nelse:\n  ";
+constexpr static char universalIfElifElseStatementWithArg[] = "if condition1:\n  instruction1\nelif condition2:\n  instruction2\nelse:\n  instruction3";
+constexpr static char universalIfElseStatement[] = "if \x11:\n  \nelse:\n  ";
+constexpr static char universalIfElseStatementWithArg[] = "if condition:\n  instruction1\nelse:\n  instruction2";
+constexpr static char universalIfOrIfElseStatement[] = "if \x11 or :\n  \nelse:\n  ";
+constexpr static char universalIfOrIfElseStatementWithArg[] = "if condition1 or condition2:\n  instruction1\nelse:\n  instruction2";
+constexpr static char universalIfStatementMenu[] = "If";
+constexpr static char universalIfThenStatement[] = "if \x11:\n  ";
+constexpr static char universalIfThenStatementWithArg[] = "if condition:\n  instruction";
+constexpr static char universalImCommandWithArg[] = "im(z)";
+constexpr static char universalIndentityCommandWithArg[] = "identity(n)";
+constexpr static char universalInferiorCondition[] = "<=";
+constexpr static char universalInferiorConditionWithArg[] = "x<=y";
+constexpr static char universalInferiorStrictCondition[] = "<";
+constexpr static char universalInferiorStrictConditionWithArg[] = "x<y";
+constexpr static char universalIntCommand[] = "int(\x11,x,\x11,\x11)";
+constexpr static char universalIntCommandWithArg[] = "int(f(x),x,a,b)";
+constexpr static char universalInvBinomialCommandWithArg[] = "invbinom(a,n,p)";
+constexpr static char universalInvNormCommandWithArg[] = "invnorm(a,μ,σ2)";
+constexpr static char universalInvSortCommandWithArg[] = "sort>(L)";
+constexpr static char universalInverseCommandWithArg[] = "inverse(M)";
+constexpr static char universalIonModule[] = "ion";
+constexpr static char universalK[] = "k";
+constexpr static char universalKandinskyModule[] = "kandinsky";
+constexpr static char universalLambda[] = "λ";
+constexpr static char universalLanguageDE[] = "Deutsch ";
+constexpr static char universalLanguageEN[] = "English ";
+constexpr static char universalLanguageES[] = "Español ";
+constexpr static char universalLanguageFR[] = "Français ";
+constexpr static char universalLanguagePT[] = "Português ";
+constexpr static char universalLcmCommandWithArg[] = "lcm(p,q)";
+constexpr static char universalLeftIntegralFirstLegend[] = "P(X≤";
+constexpr static char universalLeftIntegralSecondLegend[] = ")=";
+constexpr static char universalLinearRegressionFormula[] = " y=a·x+b ";
+constexpr static char universalLogCommandWithArg[] = "log(x,a)";
+constexpr static char universalLogarithmicRegressionFormula[] = " y=a·ln(x)+b ";
+constexpr static char universalLogisticRegressionFormula[] = " y=c/(1+a·exp(-b·x)) ";
+constexpr static char universalMathModule[] = "math";
+constexpr static char universalMatrixCommand[] = "[[\x11]]";
+constexpr static char universalMatrixCommandWithArg[] = "[[1,2][3,4]]";
+constexpr static char universalMaxCommandWithArg[] = "max(L)";
+constexpr static char universalMinCommandWithArg[] = "min(L)";
+constexpr static char universalMu[] = "μ";
+constexpr static char universalN[] = "n";
+constexpr static char universalNonEqualityCondition[] = "!=";
+constexpr static char universalNonEqualityConditionWithArg[] = "x!=y";
+constexpr static char universalNormCDF2CommandWithArg[] = "normcdf2(a,b,μ,σ2)";
+constexpr static char universalNormCDFCommandWithArg[] = "normcdf(a,μ,σ2)";
+constexpr static char universalNormPDFCommandWithArg[] = "normpdf(x,μ,σ2)";
+constexpr static char universalP[] = "p";
+constexpr static char universalPermuteCommandWithArg[] = "permute(n,r)";
+constexpr static char universalPoisson[] = "Poisson";
+constexpr static char universalPowerRegressionFormula[] = " y=a·x^b ";
+constexpr static char universalPrediction95CommandWithArg[] = "prediction95(p,n)";
+constexpr static char universalPredictionCommandWithArg[] = "prediction(p,n)";
+constexpr static char universalProductCommand[] = "product(\x11,n,\x11,\x11)";
+constexpr static char universalProductCommandWithArg[] = "product(f(n),n,nmin,nmax)";
+constexpr static char universalPythonCommand1J[] = "1j";
+constexpr static char universalPythonCommandAbs[] = "abs(x)";
+constexpr static char universalPythonCommandAcos[] = "acos(x)";
+constexpr static char universalPythonCommandAcosh[] = "acosh(x)";
+constexpr static char universalPythonCommandAmpersand[] = "&";
+constexpr static char universalPythonCommandAppend[] = "list.append(x)";
+constexpr static char universalPythonCommandAppendWithoutArg[] = ".append(\x11)";
+constexpr static char universalPythonCommandAsin[] = "asin(x)";
+constexpr static char universalPythonCommandAsinh[] = "asinh(x)";
+constexpr static char universalPythonCommandAtan[] = "atan(x)";
+constexpr static char universalPythonCommandAtan2[] = "atan2(y,x)";
+constexpr static char universalPythonCommandAtanh[] = "atanh(x)";
+constexpr static char universalPythonCommandBin[] = "bin(x)";
+constexpr static char universalPythonCommandCeil[] = "ceil(x)";
+constexpr static char universalPythonCommandChoice[] = "choice(list)";
+constexpr static char universalPythonCommandClear[] = "list.clear()";
+constexpr static char universalPythonCommandClearWithoutArg[] = ".clear()";
+constexpr static char universalPythonCommandCmathFunction[] = "cmath.function";
+constexpr static char universalPythonCommandCmathFunctionWithoutArg[] = "cmath.\x11";
+constexpr static char universalPythonCommandColor[] = "color(r,g,b)";
+constexpr static char universalPythonCommandComplex[] = "complex(a,b)";
+constexpr static char universalPythonCommandConstantE[] = "e";
+constexpr static char universalPythonCommandConstantPi[] = "pi";
+constexpr static char universalPythonCommandCopySign[] = "copysign(x,y)";
+constexpr static char universalPythonCommandCos[] = "cos(x)";
+constexpr static char universalPythonCommandCosComplex[] = "cos(z)";
+constexpr static char universalPythonCommandCosh[] = "cosh(x)";
+constexpr static char universalPythonCommandCount[] = "list.count(x)";
+constexpr static char universalPythonCommandCountWithoutArg[] = ".count(\x11)";
+constexpr static char universalPythonCommandDef[] = "def \x11():\n  ";
+constexpr static char universalPythonCommandDefWithArg[] = "def function(x):";
+constexpr static char universalPythonCommandDegrees[] = "degrees(x)";
+constexpr static char universalPythonCommandDivMod[] = "divmod(a,b)";
+constexpr static char universalPythonCommandDrawString[] = "draw_string(\"text\",x,y)";
+constexpr static char universalPythonCommandErf[] = "erf(x)";
+constexpr static char universalPythonCommandErfc[] = "erfc(x)";
+constexpr static char universalPythonCommandEval[] = "eval(\"expression\")";
+constexpr static char universalPythonCommandExp[] = "exp(x)";
+constexpr static char universalPythonCommandExpComplex[] = "exp(z)";
+constexpr static char universalPythonCommandExpm1[] = "expm1(x)";
+constexpr static char universalPythonCommandFabs[] = "fabs(x)";
+constexpr static char universalPythonCommandFillRect[] = "fill_rect(x,y,width,height,color)";
+constexpr static char universalPythonCommandFloat[] = "float(x)";
+constexpr static char universalPythonCommandFloor[] = "floor(x)";
+constexpr static char universalPythonCommandFmod[] = "fmod(a,b)";
+constexpr static char universalPythonCommandFrExp[] = "frexp(x)";
+constexpr static char universalPythonCommandGamma[] = "gamma(x)";
+constexpr static char universalPythonCommandGetPixel[] = "get_pixel(x,y)";
+constexpr static char universalPythonCommandGetrandbits[] = "getrandbits(k)";
+constexpr static char universalPythonCommandHex[] = "hex(x)";
+constexpr static char universalPythonCommandImag[] = "z.imag";
+constexpr static char universalPythonCommandImagWithoutArg[] = ".imag";
+constexpr static char universalPythonCommandImportCmath[] = "import cmath";
+constexpr static char universalPythonCommandImportFromCmath[] = "from cmath import *";
+constexpr static char universalPythonCommandImportFromIon[] = "from ion import *";
+constexpr static char universalPythonCommandImportFromKandinsky[] = "from kandinsky import *";
+constexpr static char universalPythonCommandImportFromMath[] = "from math import *";
+constexpr static char universalPythonCommandImportFromRandom[] = "from random import *";
+constexpr static char universalPythonCommandImportFromTime[] = "from time import *";
+constexpr static char universalPythonCommandImportFromTurtle[] = "from turtle import *";
+constexpr static char universalPythonCommandImportIon[] = "import ion";
+constexpr static char universalPythonCommandImportKandinsky[] = "import kandinsky";
+constexpr static char universalPythonCommandImportMath[] = "import math";
+constexpr static char universalPythonCommandImportRandom[] = "import random";
+constexpr static char universalPythonCommandImportTime[] = "import time";
+constexpr static char universalPythonCommandImportTurtle[] = "import turtle";
+constexpr static char universalPythonCommandIndex[] = "list.index(x)";
+constexpr static char universalPythonCommandIndexWithoutArg[] = ".index(\x11)";
+constexpr static char universalPythonCommandInput[] = "input(\"text\")";
+constexpr static char universalPythonCommandInsert[] = "list.insert(i,x)";
+constexpr static char universalPythonCommandInsertWithoutArg[] = ".insert(\x11,)";
+constexpr static char universalPythonCommandInt[] = "int(x)";
+constexpr static char universalPythonCommandIonFunction[] = "ion.function";
+constexpr static char universalPythonCommandIonFunctionWithoutArg[] = "ion.\x11";
+constexpr static char universalPythonCommandIsFinite[] = "isfinite(x)";
+constexpr static char universalPythonCommandIsInfinite[] = "isinf(x)";
+constexpr static char universalPythonCommandIsKeyDown[] = "keydown(k)";
+constexpr static char universalPythonCommandIsNaN[] = "isnan(x)";
+constexpr static char universalPythonCommandKandinskyFunction[] = "kandinsky.function";
+constexpr static char universalPythonCommandKandinskyFunctionWithoutArg[] = "kandinsky.\x11";
+constexpr static char universalPythonCommandKeyAlpha[] = "KEY_ALPHA";
+constexpr static char universalPythonCommandKeyAns[] = "KEY_ANS";
+constexpr static char universalPythonCommandKeyBack[] = "KEY_BACK";
+constexpr static char universalPythonCommandKeyBackspace[] = "KEY_BACKSPACE";
+constexpr static char universalPythonCommandKeyComma[] = "KEY_COMMA";
+constexpr static char universalPythonCommandKeyCosine[] = "KEY_COSINE";
+constexpr static char universalPythonCommandKeyDivision[] = "KEY_DIVISION";
+constexpr static char universalPythonCommandKeyDot[] = "KEY_DOT";
+constexpr static char universalPythonCommandKeyDown[] = "KEY_DOWN";
+constexpr static char universalPythonCommandKeyEe[] = "KEY_EE";
+constexpr static char universalPythonCommandKeyEight[] = "KEY_EIGHT";
+constexpr static char universalPythonCommandKeyExe[] = "KEY_EXE";
+constexpr static char universalPythonCommandKeyExp[] = "KEY_EXP";
+constexpr static char universalPythonCommandKeyFive[] = "KEY_FIVE";
+constexpr static char universalPythonCommandKeyFour[] = "KEY_FOUR";
+constexpr static char universalPythonCommandKeyHome[] = "KEY_HOME";
+constexpr static char universalPythonCommandKeyImaginary[] = "KEY_IMAGINARY";
+constexpr static char universalPythonCommandKeyLeft[] = "KEY_LEFT";
+constexpr static char universalPythonCommandKeyLeftParenthesis[] = "KEY_LEFTPARENTHESIS";
+constexpr static char universalPythonCommandKeyLn[] = "KEY_LN";
+constexpr static char universalPythonCommandKeyLog[] = "KEY_LOG";
+constexpr static char universalPythonCommandKeyMinus[] = "KEY_MINUS";
+constexpr static char universalPythonCommandKeyMultiplication[] = "KEY_MULTIPLICATION";
+constexpr static char universalPythonCommandKeyNine[] = "KEY_NINE";
+constexpr static char universalPythonCommandKeyOk[] = "KEY_OK";
+constexpr static char universalPythonCommandKeyOnOff[] = "KEY_ONOFF";
+constexpr static char universalPythonCommandKeyOne[] = "KEY_ONE";
+constexpr static char universalPythonCommandKeyPi[] = "KEY_PI";
+constexpr static char universalPythonCommandKeyPlus[] = "KEY_PLUS";
+constexpr static char universalPythonCommandKeyPower[] = "KEY_POWER";
+constexpr static char universalPythonCommandKeyRight[] = "KEY_RIGHT";
+constexpr static char universalPythonCommandKeyRightParenthesis[] = "KEY_RIGHTPARENTHESIS";
+constexpr static char universalPythonCommandKeySeven[] = "KEY_SEVEN";
+constexpr static char universalPythonCommandKeyShift[] = "KEY_SHIFT";
+constexpr static char universalPythonCommandKeySine[] = "KEY_SINE";
+constexpr static char universalPythonCommandKeySix[] = "KEY_SIX";
+constexpr static char universalPythonCommandKeySqrt[] = "KEY_SQRT";
+constexpr static char universalPythonCommandKeySquare[] = "KEY_SQUARE";
+constexpr static char universalPythonCommandKeyTangent[] = "KEY_TANGENT";
+constexpr static char universalPythonCommandKeyThree[] = "KEY_THREE";
+constexpr static char universalPythonCommandKeyToolbox[] = "KEY_TOOLBOX";
+constexpr static char universalPythonCommandKeyTwo[] = "KEY_TWO";
+constexpr static char universalPythonCommandKeyUp[] = "KEY_UP";
+constexpr static char universalPythonCommandKeyVar[] = "KEY_VAR";
+constexpr static char universalPythonCommandKeyXnt[] = "KEY_XNT";
+constexpr static char universalPythonCommandKeyZero[] = "KEY_ZERO";
+constexpr static char universalPythonCommandLF[] = "\\n";
+constexpr static char universalPythonCommandLdexp[] = "ldexp(x,i)";
+constexpr static char universalPythonCommandLength[] = "len(object)";
+constexpr static char universalPythonCommandLgamma[] = "lgamma(x)";
+constexpr static char universalPythonCommandLog[] = "log(x,a)";
+constexpr static char universalPythonCommandLog10[] = "log10(x)";
+constexpr static char universalPythonCommandLog2[] = "log2(x)";
+constexpr static char universalPythonCommandLogComplex[] = "log(z,a)";
+constexpr static char universalPythonCommandMathFunction[] = "math.function";
+constexpr static char universalPythonCommandMathFunctionWithoutArg[] = "math.\x11";
+constexpr static char universalPythonCommandMax[] = "max(list)";
+constexpr static char universalPythonCommandMin[] = "min(list)";
+constexpr static char universalPythonCommandModf[] = "modf(x)";
+constexpr static char universalPythonCommandMonotonic[] = "monotonic()";
+constexpr static char universalPythonCommandOct[] = "oct(x)";
+constexpr static char universalPythonCommandPercent[] = "%";
+constexpr static char universalPythonCommandPhase[] = "phase(z)";
+constexpr static char universalPythonCommandPolar[] = "polar(z)";
+constexpr static char universalPythonCommandPop[] = "list.pop()";
+constexpr static char universalPythonCommandPopWithoutArg[] = ".pop()";
+constexpr static char universalPythonCommandPound[] = "#";
+constexpr static char universalPythonCommandPower[] = "pow(x,y)";
+constexpr static char universalPythonCommandPrint[] = "print(object)";
+constexpr static char universalPythonCommandRadians[] = "radians(x)";
+constexpr static char universalPythonCommandRandint[] = "randint(a,b)";
+constexpr static char universalPythonCommandRandom[] = "random()";
+constexpr static char universalPythonCommandRandomFunction[] = "random.function";
+constexpr static char universalPythonCommandRandomFunctionWithoutArg[] = "random.\x11";
+constexpr static char universalPythonCommandRandrange[] = "randrange(start, stop)";
+constexpr static char universalPythonCommandRangeStartStop[] = "range(start, stop)";
+constexpr static char universalPythonCommandRangeStop[] = "range(stop)";
+constexpr static char universalPythonCommandReal[] = "z.real";
+constexpr static char universalPythonCommandRealWithoutArg[] = ".real";
+constexpr static char universalPythonCommandRect[] = "rect(r, arg)";
+constexpr static char universalPythonCommandRemove[] = "list.remove(x)";
+constexpr static char universalPythonCommandRemoveWithoutArg[] = ".remove(\x11)";
+constexpr static char universalPythonCommandReturn[] = "return ";
+constexpr static char universalPythonCommandReverse[] = "list.reverse()";
+constexpr static char universalPythonCommandReverseWithoutArg[] = ".reverse()";
+constexpr static char universalPythonCommandRound[] = "round(x, n)";
+constexpr static char universalPythonCommandSeed[] = "seed(x)";
+constexpr static char universalPythonCommandSetPixel[] = "set_pixel(x,y,color)";
+constexpr static char universalPythonCommandSin[] = "sin(x)";
+constexpr static char universalPythonCommandSinComplex[] = "sin(z)";
+constexpr static char universalPythonCommandSingleQuote[] = "'x'";
+constexpr static char universalPythonCommandSinh[] = "sinh(x)";
+constexpr static char universalPythonCommandSleep[] = "sleep(t)";
+constexpr static char universalPythonCommandSort[] = "list.sort()";
+constexpr static char universalPythonCommandSortWithoutArg[] = ".sort()";
+constexpr static char universalPythonCommandSorted[] = "sorted(list)";
+constexpr static char universalPythonCommandSqrt[] = "sqrt(x)";
+constexpr static char universalPythonCommandSqrtComplex[] = "sqrt(z)";
+constexpr static char universalPythonCommandSum[] = "sum(list)";
+constexpr static char universalPythonCommandSymbolExp[] = "^";
+constexpr static char universalPythonCommandTab[] = "\\t";
+constexpr static char universalPythonCommandTan[] = "tan(x)";
+constexpr static char universalPythonCommandTanh[] = "tanh(x)";
+constexpr static char universalPythonCommandTimeFunction[] = "time.function";
+constexpr static char universalPythonCommandTimeFunctionWithoutArg[] = "time.\x11";
+constexpr static char universalPythonCommandTrunc[] = "trunc(x)";
+constexpr static char universalPythonCommandTurtleFunction[] = "turtle.function";
+constexpr static char universalPythonCommandTurtleFunctionWithoutArg[] = "turtle.\x11";
+constexpr static char universalPythonCommandUniform[] = "uniform(a,b)";
+constexpr static char universalPythonCommandVerticalBar[] = "|";
+constexpr static char universalPythonConstantE[] = "2.718281828459045";
+constexpr static char universalPythonConstantPi[] = "3.141592653589793";
+constexpr static char universalPythonTurtleCommandBackward[] = "backward(x)";
+constexpr static char universalPythonTurtleCommandBlack[] = "'black'";
+constexpr static char universalPythonTurtleCommandBlue[] = "'blue'";
+constexpr static char universalPythonTurtleCommandBrown[] = "'brown'";
+constexpr static char universalPythonTurtleCommandCircle[] = "circle(r)";
+constexpr static char universalPythonTurtleCommandColor[] = "color('c')/color(r,g,b)";
+constexpr static char universalPythonTurtleCommandColorWithoutArg[] = "color(\x11)";
+constexpr static char universalPythonTurtleCommandForward[] = "forward(x)";
+constexpr static char universalPythonTurtleCommandGoto[] = "goto(x,y)";
+constexpr static char universalPythonTurtleCommandGreen[] = "'green'";
+constexpr static char universalPythonTurtleCommandGrey[] = "'grey'";
+constexpr static char universalPythonTurtleCommandHeading[] = "heading()";
+constexpr static char universalPythonTurtleCommandHideturtle[] = "hideturtle()";
+constexpr static char universalPythonTurtleCommandIsdown[] = "isdown()";
+constexpr static char universalPythonTurtleCommandLeft[] = "left(a)";
+constexpr static char universalPythonTurtleCommandOrange[] = "'orange'";
+constexpr static char universalPythonTurtleCommandPendown[] = "pendown()";
+constexpr static char universalPythonTurtleCommandPensize[] = "pensize(x)";
+constexpr static char universalPythonTurtleCommandPenup[] = "penup()";
+constexpr static char universalPythonTurtleCommandPink[] = "'pink'";
+constexpr static char universalPythonTurtleCommandPosition[] = "position()";
+constexpr static char universalPythonTurtleCommandPurple[] = "'purple'";
+constexpr static char universalPythonTurtleCommandRed[] = "'red'";
+constexpr static char universalPythonTurtleCommandReset[] = "reset()";
+constexpr static char universalPythonTurtleCommandRight[] = "right(a)";
+constexpr static char universalPythonTurtleCommandSetheading[] = "setheading(a)";
+constexpr static char universalPythonTurtleCommandSetposition[] = "setposition(x, [y])";
+constexpr static char universalPythonTurtleCommandShowturtle[] = "showturtle()";
+constexpr static char universalPythonTurtleCommandSpeed[] = "speed(x)";
+constexpr static char universalPythonTurtleCommandWhite[] = "'white'";
+constexpr static char universalPythonTurtleCommandYellow[] = "'yellow'";
+constexpr static char universalQuadraticRegressionFormula[] = " y=a·x^2+b·x+c ";
+constexpr static char universalQuarticRegressionFormula[] = " y=a·x^4+b·x^3+c·x^2+d·x+e ";
+constexpr static char universalQuoCommandWithArg[] = "quo(p,q)";
+constexpr static char universalR[] = "r";
+constexpr static char universalRandintCommandWithArg[] = "randint(a,b)";
+constexpr static char universalRandomCommandWithArg[] = "random()";
+constexpr static char universalRandomModule[] = "random";
+constexpr static char universalReCommandWithArg[] = "re(z)";
+constexpr static char universalRemCommandWithArg[] = "rem(p,q)";
+constexpr static char universalRightIntegralFirstLegend[] = "P(X≥";
+constexpr static char universalRightIntegralSecondLegend[] = ")=";
+constexpr static char universalRootCommandWithArg[] = "root(x,n)";
+constexpr static char universalRoundCommandWithArg[] = "round(x,n)";
+constexpr static char universalScriptParameters[] = "...";
+constexpr static char universalShift[] = "shift";
+constexpr static char universalSigma[] = "σ";
+constexpr static char universalSinhCommandWithArg[] = "sinh(x)";
+constexpr static char universalSortCommandWithArg[] = "sort<(L)";
+constexpr static char universalStudent[] = "Student";
+constexpr static char universalSumCommand[] = "sum(\x11,n,\x11,\x11)";
+constexpr static char universalSumCommandWithArg[] = "sum(f(n),n,nmin,nmax)";
+constexpr static char universalSuperiorCondition[] = ">=";
+constexpr static char universalSuperiorConditionWithArg[] = "x>=y";
+constexpr static char universalSuperiorStrictCondition[] = ">";
+constexpr static char universalSuperiorStrictConditionWithArg[] = "x>y";
+constexpr static char universalSxy[] = "∑xy";
+constexpr static char universalT[] = "t";
+constexpr static char universalTMax[] = "Tmax";
+constexpr static char universalTMin[] = "Tmin";
+constexpr static char universalTanhCommandWithArg[] = "tanh(x)";
+constexpr static char universalTheta[] = "θ";
+constexpr static char universalThetaMax[] = "θmax";
+constexpr static char universalThetaMin[] = "θmin";
+constexpr static char universalTimeModule[] = "time";
+constexpr static char universalTraceCommandWithArg[] = "trace(M)";
+constexpr static char universalTransposeCommandWithArg[] = "transpose(M)";
+constexpr static char universalTrigonometricRegressionFormula[] = " y=a·sin(b·x+c)+d ";
+constexpr static char universalTurtleModule[] = "turtle";
+constexpr static char universalUSBAppCapital[] = "USB";
+constexpr static char universalUnitAmountMoleMicroSymbol[] = "_μmol";
+constexpr static char universalUnitAmountMoleMilliSymbol[] = "_mmol";
+constexpr static char universalUnitAmountMoleSymbol[] = "_mol";
+constexpr static char universalUnitCapacitanceFaradMicroSymbol[] = "_μF";
+constexpr static char universalUnitCapacitanceFaradMilliSymbol[] = "_mF";
+constexpr static char universalUnitCapacitanceFaradSymbol[] = "_F";
+constexpr static char universalUnitChargeCoulombSymbol[] = "_C";
+constexpr static char universalUnitConductanceSiemensMilliSymbol[] = "_mS";
+constexpr static char universalUnitConductanceSiemensSymbol[] = "_S";
+constexpr static char universalUnitCurrentAmpereMicroSymbol[] = "_μA";
+constexpr static char universalUnitCurrentAmpereMilliSymbol[] = "_mA";
+constexpr static char universalUnitCurrentAmpereSymbol[] = "_A";
+constexpr static char universalUnitDistanceAstronomicalUnitSymbol[] = "_au";
+constexpr static char universalUnitDistanceLightYearSymbol[] = "_ly";
+constexpr static char universalUnitDistanceMeterKiloSymbol[] = "_km";
+constexpr static char universalUnitDistanceMeterMicroSymbol[] = "_μm";
+constexpr static char universalUnitDistanceMeterMilliSymbol[] = "_mm";
+constexpr static char universalUnitDistanceMeterNanoSymbol[] = "_nm";
+constexpr static char universalUnitDistanceMeterPicoSymbol[] = "_pm";
+constexpr static char universalUnitDistanceMeterSymbol[] = "_m";
+constexpr static char universalUnitDistanceParsecSymbol[] = "_pc";
+constexpr static char universalUnitEnergyElectronVoltKiloSymbol[] = "_keV";
+constexpr static char universalUnitEnergyElectronVoltMegaSymbol[] = "_MeV";
+constexpr static char universalUnitEnergyElectronVoltMilliSymbol[] = "_meV";
+constexpr static char universalUnitEnergyElectronVoltSymbol[] = "_eV";
+constexpr static char universalUnitEnergyJouleKiloSymbol[] = "_kJ";
+constexpr static char universalUnitEnergyJouleMilliSymbol[] = "_mJ";
+constexpr static char universalUnitEnergyJouleSymbol[] = "_J";
+constexpr static char universalUnitForceNewtonKiloSymbol[] = "_kN";
+constexpr static char universalUnitForceNewtonMilliSymbol[] = "_mN";
+constexpr static char universalUnitForceNewtonSymbol[] = "_N";
+constexpr static char universalUnitFrequencyHertzGigaSymbol[] = "_GHz";
+constexpr static char universalUnitFrequencyHertzKiloSymbol[] = "_kHz";
+constexpr static char universalUnitFrequencyHertzMegaSymbol[] = "_MHz";
+constexpr static char universalUnitFrequencyHertzSymbol[] = "_Hz";
+constexpr static char universalUnitInductanceHenrySymbol[] = "_H";
+constexpr static char universalUnitLuminousIntensityCandelaSymbol[] = "_cd";
+constexpr static char universalUnitMagneticFieldTeslaSymbol[] = "_T";
+constexpr static char universalUnitMassGramKiloSymbol[] = "_kg";
+constexpr static char universalUnitMassGramMicroSymbol[] = "_μg";
+constexpr static char universalUnitMassGramMilliSymbol[] = "_mg";
+constexpr static char universalUnitMassGramNanoSymbol[] = "_ng";
+constexpr static char universalUnitMassGramSymbol[] = "_g";
+constexpr static char universalUnitMassTonneSymbol[] = "_t";
+constexpr static char universalUnitPotentialVoltKiloSymbol[] = "_kV";
+constexpr static char universalUnitPotentialVoltMicroSymbol[] = "_μV";
+constexpr static char universalUnitPotentialVoltMilliSymbol[] = "_mV";
+constexpr static char universalUnitPotentialVoltSymbol[] = "_V";
+constexpr static char universalUnitPowerWattGigaSymbol[] = "_GW";
+constexpr static char universalUnitPowerWattKiloSymbol[] = "_kW";
+constexpr static char universalUnitPowerWattMegaSymbol[] = "_MW";
+constexpr static char universalUnitPowerWattMicroSymbol[] = "_μW";
+constexpr static char universalUnitPowerWattMilliSymbol[] = "_mW";
+constexpr static char universalUnitPowerWattSymbol[] = "_W";
+constexpr static char universalUnitPressureAtmSymbol[] = "_atm";
+constexpr static char universalUnitPressureBarSymbol[] = "_bar";
+constexpr static char universalUnitPressurePascalHectoSymbol[] = "_hPa";
+constexpr static char universalUnitPressurePascalSymbol[] = "_Pa";
+constexpr static char universalUnitResistanceOhmKiloSymbol[] = "_kΩ";
+constexpr static char universalUnitResistanceOhmSymbol[] = "_Ω";
+constexpr static char universalUnitSurfaceHectarSymbol[] = "_ha";
+constexpr static char universalUnitTemperatureKelvinSymbol[] = "_K";
+constexpr static char universalUnitTimeDaySymbol[] = "_day";
+constexpr static char universalUnitTimeHourSymbol[] = "_h";
+constexpr static char universalUnitTimeMinuteSymbol[] = "_min";
+constexpr static char universalUnitTimeMonthSymbol[] = "_month";
+constexpr static char universalUnitTimeSecondMicroSymbol[] = "_μs";
+constexpr static char universalUnitTimeSecondMilliSymbol[] = "_ms";
+constexpr static char universalUnitTimeSecondNanoSymbol[] = "_ns";
+constexpr static char universalUnitTimeSecondSymbol[] = "_s";
+constexpr static char universalUnitTimeWeekSymbol[] = "_week";
+constexpr static char universalUnitTimeYearSymbol[] = "_year";
+constexpr static char universalUnitVolumeLiterCentiSymbol[] = "_cL";
+constexpr static char universalUnitVolumeLiterDeciSymbol[] = "_dL";
+constexpr static char universalUnitVolumeLiterMilliSymbol[] = "_mL";
+constexpr static char universalUnitVolumeLiterSymbol[] = "_L";
+constexpr static char universalWhileLoop[] = "while \x11:\n  ";
+constexpr static char universalWhileLoopMenu[] = "While";
+constexpr static char universalWhileLoopWithArg[] = "while condition:\n  instruction";
+constexpr static char universalX[] = "x";
+constexpr static char universalXMax[] = "Xmax";
+constexpr static char universalXMin[] = "Xmin";
+constexpr static char universalY[] = "y";
+constexpr static char universalYAuto[] = "Y auto";
+constexpr static char universalYMax[] = "Ymax";
+constexpr static char universalYMin[] = "Ymin";
+
+constexpr static const char * universalMessages[469] = {
+  universalDefault,
+  universalA,
+  universalAbsCommandWithArg,
+  universalAcoshCommandWithArg,
+  universalAlmostEqual,
+  universalAlpha,
+  universalArgCommandWithArg,
+  universalAsinhCommandWithArg,
+  universalAtanhCommandWithArg,
+  universalB,
+  universalBinomialCDFCommandWithArg,
+  universalBinomialCommandWithArg,
+  universalBinomialPDFCommandWithArg,
+  universalBlankMessage,
+  universalC,
+  universalCapitalAlpha,
+  universalCeilCommandWithArg,
+  universalCmathModule,
+  universalCodeApp,
+  universalCodeAppCapital,
+  universalConditionAnd,
+  universalConditionNot,
+  universalConditionOr,
+  universalConditionsMenu,
+  universalConfidenceCommandWithArg,
+  universalConjCommandWithArg,
+  universalConsolePrompt,
+  universalCoshCommandWithArg,
+  universalCubicRegressionFormula,
+  universalD,
+  universalD1,
+  universalD2,
+  universalDash,
+  universalDeterminantCommandWithArg,
+  universalDiffCommand,
+  universalDiffCommandWithArg,
+  universalDimensionCommandWithArg,
+  universalDiscreteLegend,
+  universalDiscriminantFormulaDegree2,
+  universalE,
+  universalEqual,
+  universalEqualityCondition,
+  universalEqualityConditionWithArg,
+  universalExponentialRegressionFormula,
+  universalFactorCommandWithArg,
+  universalFccId,
+  universalFiniteIntegralFirstLegend,
+  universalFiniteIntegralLegend,
+  universalFisher,
+  universalFloorCommandWithArg,
+  universalForInListLoop,
+  universalForInListLoopWithArg,
+  universalForInRange1ArgLoop,
+  universalForInRange1ArgLoopWithArg,
+  universalForInRange2ArgsLoop,
+  universalForInRange2ArgsLoopWithArg,
+  universalForInRange3ArgsLoop,
+  universalForInRange3ArgsLoopWithArg,
+  universalForLoopMenu,
+  universalFracCommandWithArg,
+  universalGcdCommandWithArg,
+  universalGon,
+  universalIfAndIfElseStatement,
+  universalIfAndIfElseStatementWithArg,
+  universalIfElifElseStatement,
+  universalIfElifElseStatementWithArg,
+  universalIfElseStatement,
+  universalIfElseStatementWithArg,
+  universalIfOrIfElseStatement,
+  universalIfOrIfElseStatementWithArg,
+  universalIfStatementMenu,
+  universalIfThenStatement,
+  universalIfThenStatementWithArg,
+  universalImCommandWithArg,
+  universalIndentityCommandWithArg,
+  universalInferiorCondition,
+  universalInferiorConditionWithArg,
+  universalInferiorStrictCondition,
+  universalInferiorStrictConditionWithArg,
+  universalIntCommand,
+  universalIntCommandWithArg,
+  universalInvBinomialCommandWithArg,
+  universalInvNormCommandWithArg,
+  universalInvSortCommandWithArg,
+  universalInverseCommandWithArg,
+  universalIonModule,
+  universalK,
+  universalKandinskyModule,
+  universalLambda,
+  universalLanguageDE,
+  universalLanguageEN,
+  universalLanguageES,
+  universalLanguageFR,
+  universalLanguagePT,
+  universalLcmCommandWithArg,
+  universalLeftIntegralFirstLegend,
+  universalLeftIntegralSecondLegend,
+  universalLinearRegressionFormula,
+  universalLogCommandWithArg,
+  universalLogarithmicRegressionFormula,
+  universalLogisticRegressionFormula,
+  universalMathModule,
+  universalMatrixCommand,
+  universalMatrixCommandWithArg,
+  universalMaxCommandWithArg,
+  universalMinCommandWithArg,
+  universalMu,
+  universalN,
+  universalNonEqualityCondition,
+  universalNonEqualityConditionWithArg,
+  universalNormCDF2CommandWithArg,
+  universalNormCDFCommandWithArg,
+  universalNormPDFCommandWithArg,
+  universalP,
+  universalPermuteCommandWithArg,
+  universalPoisson,
+  universalPowerRegressionFormula,
+  universalPrediction95CommandWithArg,
+  universalPredictionCommandWithArg,
+  universalProductCommand,
+  universalProductCommandWithArg,
+  universalPythonCommand1J,
+  universalPythonCommandAbs,
+  universalPythonCommandAcos,
+  universalPythonCommandAcosh,
+  universalPythonCommandAmpersand,
+  universalPythonCommandAppend,
+  universalPythonCommandAppendWithoutArg,
+  universalPythonCommandAsin,
+  universalPythonCommandAsinh,
+  universalPythonCommandAtan,
+  universalPythonCommandAtan2,
+  universalPythonCommandAtanh,
+  universalPythonCommandBin,
+  universalPythonCommandCeil,
+  universalPythonCommandChoice,
+  universalPythonCommandClear,
+  universalPythonCommandClearWithoutArg,
+  universalPythonCommandCmathFunction,
+  universalPythonCommandCmathFunctionWithoutArg,
+  universalPythonCommandColor,
+  universalPythonCommandComplex,
+  universalPythonCommandConstantE,
+  universalPythonCommandConstantPi,
+  universalPythonCommandCopySign,
+  universalPythonCommandCos,
+  universalPythonCommandCosComplex,
+  universalPythonCommandCosh,
+  universalPythonCommandCount,
+  universalPythonCommandCountWithoutArg,
+  universalPythonCommandDef,
+  universalPythonCommandDefWithArg,
+  universalPythonCommandDegrees,
+  universalPythonCommandDivMod,
+  universalPythonCommandDrawString,
+  universalPythonCommandErf,
+  universalPythonCommandErfc,
+  universalPythonCommandEval,
+  universalPythonCommandExp,
+  universalPythonCommandExpComplex,
+  universalPythonCommandExpm1,
+  universalPythonCommandFabs,
+  universalPythonCommandFillRect,
+  universalPythonCommandFloat,
+  universalPythonCommandFloor,
+  universalPythonCommandFmod,
+  universalPythonCommandFrExp,
+  universalPythonCommandGamma,
+  universalPythonCommandGetPixel,
+  universalPythonCommandGetrandbits,
+  universalPythonCommandHex,
+  universalPythonCommandImag,
+  universalPythonCommandImagWithoutArg,
+  universalPythonCommandImportCmath,
+  universalPythonCommandImportFromCmath,
+  universalPythonCommandImportFromIon,
+  universalPythonCommandImportFromKandinsky,
+  universalPythonCommandImportFromMath,
+  universalPythonCommandImportFromRandom,
+  universalPythonCommandImportFromTime,
+  universalPythonCommandImportFromTurtle,
+  universalPythonCommandImportIon,
+  universalPythonCommandImportKandinsky,
+  universalPythonCommandImportMath,
+  universalPythonCommandImportRandom,
+  universalPythonCommandImportTime,
+  universalPythonCommandImportTurtle,
+  universalPythonCommandIndex,
+  universalPythonCommandIndexWithoutArg,
+  universalPythonCommandInput,
+  universalPythonCommandInsert,
+  universalPythonCommandInsertWithoutArg,
+  universalPythonCommandInt,
+  universalPythonCommandIonFunction,
+  universalPythonCommandIonFunctionWithoutArg,
+  universalPythonCommandIsFinite,
+  universalPythonCommandIsInfinite,
+  universalPythonCommandIsKeyDown,
+  universalPythonCommandIsNaN,
+  universalPythonCommandKandinskyFunction,
+  universalPythonCommandKandinskyFunctionWithoutArg,
+  universalPythonCommandKeyAlpha,
+  universalPythonCommandKeyAns,
+  universalPythonCommandKeyBack,
+  universalPythonCommandKeyBackspace,
+  universalPythonCommandKeyComma,
+  universalPythonCommandKeyCosine,
+  universalPythonCommandKeyDivision,
+  universalPythonCommandKeyDot,
+  universalPythonCommandKeyDown,
+  universalPythonCommandKeyEe,
+  universalPythonCommandKeyEight,
+  universalPythonCommandKeyExe,
+  universalPythonCommandKeyExp,
+  universalPythonCommandKeyFive,
+  universalPythonCommandKeyFour,
+  universalPythonCommandKeyHome,
+  universalPythonCommandKeyImaginary,
+  universalPythonCommandKeyLeft,
+  universalPythonCommandKeyLeftParenthesis,
+  universalPythonCommandKeyLn,
+  universalPythonCommandKeyLog,
+  universalPythonCommandKeyMinus,
+  universalPythonCommandKeyMultiplication,
+  universalPythonCommandKeyNine,
+  universalPythonCommandKeyOk,
+  universalPythonCommandKeyOnOff,
+  universalPythonCommandKeyOne,
+  universalPythonCommandKeyPi,
+  universalPythonCommandKeyPlus,
+  universalPythonCommandKeyPower,
+  universalPythonCommandKeyRight,
+  universalPythonCommandKeyRightParenthesis,
+  universalPythonCommandKeySeven,
+  universalPythonCommandKeyShift,
+  universalPythonCommandKeySine,
+  universalPythonCommandKeySix,
+  universalPythonCommandKeySqrt,
+  universalPythonCommandKeySquare,
+  universalPythonCommandKeyTangent,
+  universalPythonCommandKeyThree,
+  universalPythonCommandKeyToolbox,
+  universalPythonCommandKeyTwo,
+  universalPythonCommandKeyUp,
+  universalPythonCommandKeyVar,
+  universalPythonCommandKeyXnt,
+  universalPythonCommandKeyZero,
+  universalPythonCommandLF,
+  universalPythonCommandLdexp,
+  universalPythonCommandLength,
+  universalPythonCommandLgamma,
+  universalPythonCommandLog,
+  universalPythonCommandLog10,
+  universalPythonCommandLog2,
+  universalPythonCommandLogComplex,
+  universalPythonCommandMathFunction,
+  universalPythonCommandMathFunctionWithoutArg,
+  universalPythonCommandMax,
+  universalPythonCommandMin,
+  universalPythonCommandModf,
+  universalPythonCommandMonotonic,
+  universalPythonCommandOct,
+  universalPythonCommandPercent,
+  universalPythonCommandPhase,
+  universalPythonCommandPolar,
+  universalPythonCommandPop,
+  universalPythonCommandPopWithoutArg,
+  universalPythonCommandPound,
+  universalPythonCommandPower,
+  universalPythonCommandPrint,
+  universalPythonCommandRadians,
+  universalPythonCommandRandint,
+  universalPythonCommandRandom,
+  universalPythonCommandRandomFunction,
+  universalPythonCommandRandomFunctionWithoutArg,
+  universalPythonCommandRandrange,
+  universalPythonCommandRangeStartStop,
+  universalPythonCommandRangeStop,
+  universalPythonCommandReal,
+  universalPythonCommandRealWithoutArg,
+  universalPythonCommandRect,
+  universalPythonCommandRemove,
+  universalPythonCommandRemoveWithoutArg,
+  universalPythonCommandReturn,
+  universalPythonCommandReverse,
+  universalPythonCommandReverseWithoutArg,
+  universalPythonCommandRound,
+  universalPythonCommandSeed,
+  universalPythonCommandSetPixel,
+  universalPythonCommandSin,
+  universalPythonCommandSinComplex,
+  universalPythonCommandSingleQuote,
+  universalPythonCommandSinh,
+  universalPythonCommandSleep,
+  universalPythonCommandSort,
+  universalPythonCommandSortWithoutArg,
+  universalPythonCommandSorted,
+  universalPythonCommandSqrt,
+  universalPythonCommandSqrtComplex,
+  universalPythonCommandSum,
+  universalPythonCommandSymbolExp,
+  universalPythonCommandTab,
+  universalPythonCommandTan,
+  universalPythonCommandTanh,
+  universalPythonCommandTimeFunction,
+  universalPythonCommandTimeFunctionWithoutArg,
+  universalPythonCommandTrunc,
+  universalPythonCommandTurtleFunction,
+  universalPythonCommandTurtleFunctionWithoutArg,
+  universalPythonCommandUniform,
+  universalPythonCommandVerticalBar,
+  universalPythonConstantE,
+  universalPythonConstantPi,
+  universalPythonTurtleCommandBackward,
+  universalPythonTurtleCommandBlack,
+  universalPythonTurtleCommandBlue,
+  universalPythonTurtleCommandBrown,
+  universalPythonTurtleCommandCircle,
+  universalPythonTurtleCommandColor,
+  universalPythonTurtleCommandColorWithoutArg,
+  universalPythonTurtleCommandForward,
+  universalPythonTurtleCommandGoto,
+  universalPythonTurtleCommandGreen,
+  universalPythonTurtleCommandGrey,
+  universalPythonTurtleCommandHeading,
+  universalPythonTurtleCommandHideturtle,
+  universalPythonTurtleCommandIsdown,
+  universalPythonTurtleCommandLeft,
+  universalPythonTurtleCommandOrange,
+  universalPythonTurtleCommandPendown,
+  universalPythonTurtleCommandPensize,
+  universalPythonTurtleCommandPenup,
+  universalPythonTurtleCommandPink,
+  universalPythonTurtleCommandPosition,
+  universalPythonTurtleCommandPurple,
+  universalPythonTurtleCommandRed,
+  universalPythonTurtleCommandReset,
+  universalPythonTurtleCommandRight,
+  universalPythonTurtleCommandSetheading,
+  universalPythonTurtleCommandSetposition,
+  universalPythonTurtleCommandShowturtle,
+  universalPythonTurtleCommandSpeed,
+  universalPythonTurtleCommandWhite,
+  universalPythonTurtleCommandYellow,
+  universalQuadraticRegressionFormula,
+  universalQuarticRegressionFormula,
+  universalQuoCommandWithArg,
+  universalR,
+  universalRandintCommandWithArg,
+  universalRandomCommandWithArg,
+  universalRandomModule,
+  universalReCommandWithArg,
+  universalRemCommandWithArg,
+  universalRightIntegralFirstLegend,
+  universalRightIntegralSecondLegend,
+  universalRootCommandWithArg,
+  universalRoundCommandWithArg,
+  universalScriptParameters,
+  universalShift,
+  universalSigma,
+  universalSinhCommandWithArg,
+  universalSortCommandWithArg,
+  universalStudent,
+  universalSumCommand,
+  universalSumCommandWithArg,
+  universalSuperiorCondition,
+  universalSuperiorConditionWithArg,
+  universalSuperiorStrictCondition,
+  universalSuperiorStrictConditionWithArg,
+  universalSxy,
+  universalT,
+  universalTMax,
+  universalTMin,
+  universalTanhCommandWithArg,
+  universalTheta,
+  universalThetaMax,
+  universalThetaMin,
+  universalTimeModule,
+  universalTraceCommandWithArg,
+  universalTransposeCommandWithArg,
+  universalTrigonometricRegressionFormula,
+  universalTurtleModule,
+  universalUSBAppCapital,
+  universalUnitAmountMoleMicroSymbol,
+  universalUnitAmountMoleMilliSymbol,
+  universalUnitAmountMoleSymbol,
+  universalUnitCapacitanceFaradMicroSymbol,
+  universalUnitCapacitanceFaradMilliSymbol,
+  universalUnitCapacitanceFaradSymbol,
+  universalUnitChargeCoulombSymbol,
+  universalUnitConductanceSiemensMilliSymbol,
+  universalUnitConductanceSiemensSymbol,
+  universalUnitCurrentAmpereMicroSymbol,
+  universalUnitCurrentAmpereMilliSymbol,
+  universalUnitCurrentAmpereSymbol,
+  universalUnitDistanceAstronomicalUnitSymbol,
+  universalUnitDistanceLightYearSymbol,
+  universalUnitDistanceMeterKiloSymbol,
+  universalUnitDistanceMeterMicroSymbol,
+  universalUnitDistanceMeterMilliSymbol,
+  universalUnitDistanceMeterNanoSymbol,
+  universalUnitDistanceMeterPicoSymbol,
+  universalUnitDistanceMeterSymbol,
+  universalUnitDistanceParsecSymbol,
+  universalUnitEnergyElectronVoltKiloSymbol,
+  universalUnitEnergyElectronVoltMegaSymbol,
+  universalUnitEnergyElectronVoltMilliSymbol,
+  universalUnitEnergyElectronVoltSymbol,
+  universalUnitEnergyJouleKiloSymbol,
+  universalUnitEnergyJouleMilliSymbol,
+  universalUnitEnergyJouleSymbol,
+  universalUnitForceNewtonKiloSymbol,
+  universalUnitForceNewtonMilliSymbol,
+  universalUnitForceNewtonSymbol,
+  universalUnitFrequencyHertzGigaSymbol,
+  universalUnitFrequencyHertzKiloSymbol,
+  universalUnitFrequencyHertzMegaSymbol,
+  universalUnitFrequencyHertzSymbol,
+  universalUnitInductanceHenrySymbol,
+  universalUnitLuminousIntensityCandelaSymbol,
+  universalUnitMagneticFieldTeslaSymbol,
+  universalUnitMassGramKiloSymbol,
+  universalUnitMassGramMicroSymbol,
+  universalUnitMassGramMilliSymbol,
+  universalUnitMassGramNanoSymbol,
+  universalUnitMassGramSymbol,
+  universalUnitMassTonneSymbol,
+  universalUnitPotentialVoltKiloSymbol,
+  universalUnitPotentialVoltMicroSymbol,
+  universalUnitPotentialVoltMilliSymbol,
+  universalUnitPotentialVoltSymbol,
+  universalUnitPowerWattGigaSymbol,
+  universalUnitPowerWattKiloSymbol,
+  universalUnitPowerWattMegaSymbol,
+  universalUnitPowerWattMicroSymbol,
+  universalUnitPowerWattMilliSymbol,
+  universalUnitPowerWattSymbol,
+  universalUnitPressureAtmSymbol,
+  universalUnitPressureBarSymbol,
+  universalUnitPressurePascalHectoSymbol,
+  universalUnitPressurePascalSymbol,
+  universalUnitResistanceOhmKiloSymbol,
+  universalUnitResistanceOhmSymbol,
+  universalUnitSurfaceHectarSymbol,
+  universalUnitTemperatureKelvinSymbol,
+  universalUnitTimeDaySymbol,
+  universalUnitTimeHourSymbol,
+  universalUnitTimeMinuteSymbol,
+  universalUnitTimeMonthSymbol,
+  universalUnitTimeSecondMicroSymbol,
+  universalUnitTimeSecondMilliSymbol,
+  universalUnitTimeSecondNanoSymbol,
+  universalUnitTimeSecondSymbol,
+  universalUnitTimeWeekSymbol,
+  universalUnitTimeYearSymbol,
+  universalUnitVolumeLiterCentiSymbol,
+  universalUnitVolumeLiterDeciSymbol,
+  universalUnitVolumeLiterMilliSymbol,
+  universalUnitVolumeLiterSymbol,
+  universalWhileLoop,
+  universalWhileLoopMenu,
+  universalWhileLoopWithArg,
+  universalX,
+  universalXMax,
+  universalXMin,
+  universalY,
+  universalYAuto,
+  universalYMax,
+  universalYMin,
+};
+
+constexpr static char enAbout[] = "About";
+constexpr static char frAbout[] = "A propos";
+constexpr static char esAbout[] = "Acerca";
+constexpr static char deAbout[] = "Uber";
+constexpr static char ptAbout[] = "Acerca";
+constexpr static char enAboutWarning1[] = "Caution: you're using an";
+constexpr static char frAboutWarning1[] = "Attention, vous utilisez une version";
+constexpr static char esAboutWarning1[] = "Caution: you're using an";
+constexpr static char deAboutWarning1[] = "Caution: you're using an";
+constexpr static char ptAboutWarning1[] = "Caution: you're using an";
+constexpr static char enAboutWarning2[] = "unofficial software version.";
+constexpr static char frAboutWarning2[] = "non officielle du logiciel. NumWorks";
+constexpr static char esAboutWarning2[] = "unofficial software version.";
+constexpr static char deAboutWarning2[] = "unofficial software version.";
+constexpr static char ptAboutWarning2[] = "unofficial software version.";
+constexpr static char enAboutWarning3[] = "NumWorks can't be held responsible";
+constexpr static char frAboutWarning3[] = "ne saurait être tenu responsable des";
+constexpr static char esAboutWarning3[] = "NumWorks can't be held responsible";
+constexpr static char deAboutWarning3[] = "NumWorks can't be held responsible";
+constexpr static char ptAboutWarning3[] = "NumWorks can't be held responsible";
+constexpr static char enAboutWarning4[] = "for any resulting damage.";
+constexpr static char frAboutWarning4[] = "problèmes que cela pourrait entraîner.";
+constexpr static char esAboutWarning4[] = "for any resulting damage.";
+constexpr static char deAboutWarning4[] = "for any resulting damage.";
+constexpr static char ptAboutWarning4[] = "for any resulting damage.";
+constexpr static char enAbsoluteValue[] = "Absolute value";
+constexpr static char frAbsoluteValue[] = "Valeur absolue";
+constexpr static char esAbsoluteValue[] = "Valor absoluto";
+constexpr static char deAbsoluteValue[] = "Betragsfunktion";
+constexpr static char ptAbsoluteValue[] = "Valor absoluto";
+constexpr static char enActivateDeactivate[] = "Turn on/off";
+constexpr static char frActivateDeactivate[] = "Activer/Désactiver";
+constexpr static char esActivateDeactivate[] = "Activar/Desactivar";
+constexpr static char deActivateDeactivate[] = "Aktivieren/Deaktivieren";
+constexpr static char ptActivateDeactivate[] = "Activar/Desactivar";
+constexpr static char enActivateDutchExamMode[] = "Activate Dutch exam mode";
+constexpr static char frActivateDutchExamMode[] = "Activate Dutch exam mode";
+constexpr static char esActivateDutchExamMode[] = "Activate Dutch exam mode";
+constexpr static char deActivateDutchExamMode[] = "Activate Dutch exam mode";
+constexpr static char ptActivateDutchExamMode[] = "Activate Dutch exam mode";
+constexpr static char enActivateExamMode[] = "Activate exam mode";
+constexpr static char frActivateExamMode[] = "Activer le mode examen";
+constexpr static char esActivateExamMode[] = "Activar el modo examen";
+constexpr static char deActivateExamMode[] = "Starten Testmodus";
+constexpr static char ptActivateExamMode[] = "Activar o modo de exame";
+constexpr static char enActiveDutchExamModeMessage1[] = "All your data will be deleted when";
+constexpr static char frActiveDutchExamModeMessage1[] = "All your data will be deleted when";
+constexpr static char esActiveDutchExamModeMessage1[] = "All your data will be deleted when";
+constexpr static char deActiveDutchExamModeMessage1[] = "All your data will be deleted when";
+constexpr static char ptActiveDutchExamModeMessage1[] = "All your data will be deleted when";
+constexpr static char enActiveDutchExamModeMessage2[] = "you activate the exam mode. Python";
+constexpr static char frActiveDutchExamModeMessage2[] = "you activate the exam mode. Python";
+constexpr static char esActiveDutchExamModeMessage2[] = "you activate the exam mode. Python";
+constexpr static char deActiveDutchExamModeMessage2[] = "you activate the exam mode. Python";
+constexpr static char ptActiveDutchExamModeMessage2[] = "you activate the exam mode. Python";
+constexpr static char enActiveDutchExamModeMessage3[] = "application will be unavailable.";
+constexpr static char frActiveDutchExamModeMessage3[] = "application will be unavailable.";
+constexpr static char esActiveDutchExamModeMessage3[] = "application will be unavailable.";
+constexpr static char deActiveDutchExamModeMessage3[] = "application will be unavailable.";
+constexpr static char ptActiveDutchExamModeMessage3[] = "application will be unavailable.";
+constexpr static char enActiveExamModeMessage1[] = "All your data will be ";
+constexpr static char frActiveExamModeMessage1[] = "Toutes vos données seront ";
+constexpr static char esActiveExamModeMessage1[] = "Todos sus datos se ";
+constexpr static char deActiveExamModeMessage1[] = "Alle Ihre Daten werden ";
+constexpr static char ptActiveExamModeMessage1[] = "Todos os seus dados serão ";
+constexpr static char enActiveExamModeMessage2[] = "deleted when you activate ";
+constexpr static char frActiveExamModeMessage2[] = "supprimées si vous activez ";
+constexpr static char esActiveExamModeMessage2[] = "eliminaran al activar ";
+constexpr static char deActiveExamModeMessage2[] = "gelöscht, wenn Sie den ";
+constexpr static char ptActiveExamModeMessage2[] = "apagados se você ligar ";
+constexpr static char enActiveExamModeMessage3[] = "the exam mode.";
+constexpr static char frActiveExamModeMessage3[] = "le mode examen.";
+constexpr static char esActiveExamModeMessage3[] = "el modo examen.";
+constexpr static char deActiveExamModeMessage3[] = "Testmodus einschalten.";
+constexpr static char ptActiveExamModeMessage3[] = "o modo de exame.";
+constexpr static char enAddEquation[] = "Add equation";
+constexpr static char frAddEquation[] = "Ajouter une équation";
+constexpr static char esAddEquation[] = "Agregar una ecuación";
+constexpr static char deAddEquation[] = "Gleichung hinzufügen";
+constexpr static char ptAddEquation[] = "Adicione uma equação";
+constexpr static char enAddFunction[] = "Add function";
+constexpr static char frAddFunction[] = "Ajouter une fonction";
+constexpr static char esAddFunction[] = "Agregar una función";
+constexpr static char deAddFunction[] = "Funktion hinzufügen";
+constexpr static char ptAddFunction[] = "Adicionar uma função";
+constexpr static char enAddScript[] = "Add a script";
+constexpr static char frAddScript[] = "Ajouter un script";
+constexpr static char esAddScript[] = "Agregar un archivo";
+constexpr static char deAddScript[] = "Skript hinzufügen";
+constexpr static char ptAddScript[] = "Adicionar um script";
+constexpr static char enAddSequence[] = "Add sequence";
+constexpr static char frAddSequence[] = "Ajouter une suite";
+constexpr static char esAddSequence[] = "Agregar una sucesión";
+constexpr static char deAddSequence[] = "Folge hinzufügen";
+constexpr static char ptAddSequence[] = "Adicionar uma sequência";
+constexpr static char enAdditionalResults[] = "Additional results";
+constexpr static char frAdditionalResults[] = "Résultats complémentaires";
+constexpr static char esAdditionalResults[] = "????";
+constexpr static char deAdditionalResults[] = "????";
+constexpr static char ptAdditionalResults[] = "????";
+constexpr static char enAgument[] = "Argument";
+constexpr static char frAgument[] = "Argument";
+constexpr static char esAgument[] = "Argumento";
+constexpr static char deAgument[] = "Argument";
+constexpr static char ptAgument[] = "Argumento";
+constexpr static char enAllowedCharactersAZaz09[] = "Allowed characters: A-Z, a-z, 0-9, _";
+constexpr static char frAllowedCharactersAZaz09[] = "Caractères autorisés : A-Z, a-z, 0-9, _";
+constexpr static char esAllowedCharactersAZaz09[] = "Caracteres permitidos : A-Z, a-z, 0-9, _";
+constexpr static char deAllowedCharactersAZaz09[] = "Erlaubte Zeichen: A-Z, a-z, 0-9, _";
+constexpr static char ptAllowedCharactersAZaz09[] = "Caracteres permitidos : A-Z, a-z, 0-9, _";
+constexpr static char enAllowedCharactersaz09[] = "Allowed characters: a-z, 0-9, _";
+constexpr static char frAllowedCharactersaz09[] = "Caractères autorisés : a-z, 0-9, _";
+constexpr static char esAllowedCharactersaz09[] = "Caracteres permitidos : a-z, 0-9, _";
+constexpr static char deAllowedCharactersaz09[] = "Erlaubte Zeichen: a-z, 0-9, _";
+constexpr static char ptAllowedCharactersaz09[] = "Caracteres permitidos : a-z, 0-9, _";
+constexpr static char enAngleUnit[] = "Angle measure";
+constexpr static char frAngleUnit[] = "Unité d'angle";
+constexpr static char esAngleUnit[] = "Medida del ángulo";
+constexpr static char deAngleUnit[] = "Winkeleinheit";
+constexpr static char ptAngleUnit[] = "Valor do angulo";
+constexpr static char enApproximateSolution[] = "Approximate solution";
+constexpr static char frApproximateSolution[] = "Solution approchée";
+constexpr static char esApproximateSolution[] = "Solución aproximada";
+constexpr static char deApproximateSolution[] = "Ungefähre Lösung";
+constexpr static char ptApproximateSolution[] = "Solução aproximada";
+constexpr static char enApproximateSolutionIntervalInstruction0[] = "Enter the interval to search";
+constexpr static char frApproximateSolutionIntervalInstruction0[] = "Entrez l'intervalle dans lequel";
+constexpr static char esApproximateSolutionIntervalInstruction0[] = "Introduzca el intervalo para";
+constexpr static char deApproximateSolutionIntervalInstruction0[] = "Geben Sie das Intervall für die Suche";
+constexpr static char ptApproximateSolutionIntervalInstruction0[] = "Digite o intervalo para procurar";
+constexpr static char enApproximateSolutionIntervalInstruction1[] = "for an approximate solution";
+constexpr static char frApproximateSolutionIntervalInstruction1[] = "rechercher une solution approchée";
+constexpr static char esApproximateSolutionIntervalInstruction1[] = "buscar una solución aproximada";
+constexpr static char deApproximateSolutionIntervalInstruction1[] = "nach einer ungefähren Lösung ein";
+constexpr static char ptApproximateSolutionIntervalInstruction1[] = "uma solução aproximada";
+constexpr static char enApps[] = "Applications";
+constexpr static char frApps[] = "Applications";
+constexpr static char esApps[] = "Aplicaciones";
+constexpr static char deApps[] = "Anwendungen";
+constexpr static char ptApps[] = "Aplicações";
+constexpr static char enAppsCapital[] = "APPLICATIONS";
+constexpr static char frAppsCapital[] = "APPLICATIONS";
+constexpr static char esAppsCapital[] = "APLICACIONES";
+constexpr static char deAppsCapital[] = "ANWENDUNGEN";
+constexpr static char ptAppsCapital[] = "APLICACOES";
+constexpr static char enArithmetic[] = "Arithmetic";
+constexpr static char frArithmetic[] = "Arithmétique";
+constexpr static char esArithmetic[] = "Aritmética";
+constexpr static char deArithmetic[] = "Arithmetik";
+constexpr static char ptArithmetic[] = "Aritmética";
+constexpr static char enAutoImportScript[] = "Auto import in shell";
+constexpr static char frAutoImportScript[] = "Importation auto dans la console";
+constexpr static char esAutoImportScript[] = "Importación auto en intérprete";
+constexpr static char deAutoImportScript[] = "Automatischer Import in Konsole";
+constexpr static char ptAutoImportScript[] = "Importação auto no interpretador";
+constexpr static char enAxis[] = "Axes";
+constexpr static char frAxis[] = "Axes";
+constexpr static char esAxis[] = "Ejes";
+constexpr static char deAxis[] = "Achsen";
+constexpr static char ptAxis[] = "Eixos";
+constexpr static char enBarStart[] = "X start";
+constexpr static char frBarStart[] = "Début de la série";
+constexpr static char esBarStart[] = "Principio de la serie";
+constexpr static char deBarStart[] = "Beginn der Serie";
+constexpr static char ptBarStart[] = "Início da série";
+constexpr static char enBasedLogarithm[] = "Logarithm to base a";
+constexpr static char frBasedLogarithm[] = "Logarithme base a";
+constexpr static char esBasedLogarithm[] = "Logaritmo en base a";
+constexpr static char deBasedLogarithm[] = "Logarithmus zur Basis a";
+constexpr static char ptBasedLogarithm[] = "Logaritmo na base a";
+constexpr static char enBetaPopUp[] = "Beta pop-up";
+constexpr static char frBetaPopUp[] = "Rappel version bêta";
+constexpr static char esBetaPopUp[] = "Beta pop-up";
+constexpr static char deBetaPopUp[] = "Beta pop-up";
+constexpr static char ptBetaPopUp[] = "Beta pop-up";
+constexpr static char enBetaVersion[] = "BETA VERSION";
+constexpr static char frBetaVersion[] = "VERSION BETA";
+constexpr static char esBetaVersion[] = "BETA VERSION";
+constexpr static char deBetaVersion[] = "BETA VERSION";
+constexpr static char ptBetaVersion[] = "BETA VERSION";
+constexpr static char enBetaVersionMessage1[] = "";
+constexpr static char frBetaVersionMessage1[] = "Votre appareil dispose d'une version bêta";
+constexpr static char esBetaVersionMessage1[] = "";
+constexpr static char deBetaVersionMessage1[] = "";
+constexpr static char ptBetaVersionMessage1[] = "";
+constexpr static char enBetaVersionMessage2[] = "Your device runs a beta software.";
+constexpr static char frBetaVersionMessage2[] = "du logiciel. Il est possible que certains";
+constexpr static char esBetaVersionMessage2[] = "Your device runs a beta software.";
+constexpr static char deBetaVersionMessage2[] = "Your device runs a beta software.";
+constexpr static char ptBetaVersionMessage2[] = "Your device runs a beta software.";
+constexpr static char enBetaVersionMessage3[] = "You might run into bugs or glitches.";
+constexpr static char frBetaVersionMessage3[] = "bugs apparaissent.";
+constexpr static char esBetaVersionMessage3[] = "You might run into bugs or glitches.";
+constexpr static char deBetaVersionMessage3[] = "You might run into bugs or glitches.";
+constexpr static char ptBetaVersionMessage3[] = "You might run into bugs or glitches.";
+constexpr static char enBetaVersionMessage4[] = "";
+constexpr static char frBetaVersionMessage4[] = "Vous pouvez nous écrire pour nous";
+constexpr static char esBetaVersionMessage4[] = "";
+constexpr static char deBetaVersionMessage4[] = "";
+constexpr static char ptBetaVersionMessage4[] = "";
+constexpr static char enBetaVersionMessage5[] = "Please send any feedback to";
+constexpr static char frBetaVersionMessage5[] = "faire part de vos retours à";
+constexpr static char esBetaVersionMessage5[] = "Please send any feedback to";
+constexpr static char deBetaVersionMessage5[] = "Please send any feedback to";
+constexpr static char ptBetaVersionMessage5[] = "Please send any feedback to";
+constexpr static char enBetaVersionMessage6[] = "contact@numworks.com";
+constexpr static char frBetaVersionMessage6[] = "contact@numworks.com";
+constexpr static char esBetaVersionMessage6[] = "contact@numworks.com";
+constexpr static char deBetaVersionMessage6[] = "contact@numworks.com";
+constexpr static char ptBetaVersionMessage6[] = "contact@numworks.com";
+constexpr static char enBinaryBase[] = "Binary";
+constexpr static char frBinaryBase[] = "Binaire";
+constexpr static char esBinaryBase[] = "????";
+constexpr static char deBinaryBase[] = "????";
+constexpr static char ptBinaryBase[] = "????";
+constexpr static char enBinomial[] = "Binomial";
+constexpr static char frBinomial[] = "Binomiale";
+constexpr static char esBinomial[] = "Binomial";
+constexpr static char deBinomial[] = "Binomial";
+constexpr static char ptBinomial[] = "Binomial";
+constexpr static char enBinomialCDF[] = "P(X<=m) where X follows B(n,p)";
+constexpr static char frBinomialCDF[] = "P(X<=m) où X suit B(n,p)";
+constexpr static char esBinomialCDF[] = "P(X<=m) donde X sigue B(n,p)";
+constexpr static char deBinomialCDF[] = "P(X<=m) wo X folgt B(n,p)";
+constexpr static char ptBinomialCDF[] = "P(X<=m) onde X segue B(n,p)";
+constexpr static char enBinomialDistribution[] = "Binomial distribution";
+constexpr static char frBinomialDistribution[] = "Loi binomiale";
+constexpr static char esBinomialDistribution[] = "Distribución binomial";
+constexpr static char deBinomialDistribution[] = "Binomialverteilung";
+constexpr static char ptBinomialDistribution[] = "Distribuição binomial";
+constexpr static char enBinomialPDF[] = "P(X=m) where X follows B(n,p)";
+constexpr static char frBinomialPDF[] = "P(X=m) où X suit B(n,p)";
+constexpr static char esBinomialPDF[] = "P(X=m) donde X sigue B(n,p)";
+constexpr static char deBinomialPDF[] = "P(X=m) wo X folgt B(n,p)";
+constexpr static char ptBinomialPDF[] = "P(X=m) onde X segue B(n,p)";
+constexpr static char enBoxTab[] = "Box";
+constexpr static char frBoxTab[] = "Boîte";
+constexpr static char esBoxTab[] = "Caja";
+constexpr static char deBoxTab[] = "Boxplot";
+constexpr static char ptBoxTab[] = "Caixa";
+constexpr static char enBrightness[] = "Brightness";
+constexpr static char frBrightness[] = "Luminosité";
+constexpr static char esBrightness[] = "Brillo";
+constexpr static char deBrightness[] = "Helligkeit";
+constexpr static char ptBrightness[] = "Brilho";
+constexpr static char enCalculApp[] = "Calculation";
+constexpr static char frCalculApp[] = "Calculs";
+constexpr static char esCalculApp[] = "Cálculo";
+constexpr static char deCalculApp[] = "Berechnung";
+constexpr static char ptCalculApp[] = "Cálculo";
+constexpr static char enCalculAppCapital[] = "CALCULATION";
+constexpr static char frCalculAppCapital[] = "CALCULS";
+constexpr static char esCalculAppCapital[] = "CALCULO";
+constexpr static char deCalculAppCapital[] = "BERECHNUNG";
+constexpr static char ptCalculAppCapital[] = "CALCULO";
+constexpr static char enCalculation[] = "Calculation";
+constexpr static char frCalculation[] = "Calcul";
+constexpr static char esCalculation[] = "Cálculos";
+constexpr static char deCalculation[] = "Berechnung";
+constexpr static char ptCalculation[] = "Cálculo";
+constexpr static char enCancel[] = "Cancel";
+constexpr static char frCancel[] = "Annuler";
+constexpr static char esCancel[] = "Cancelar";
+constexpr static char deCancel[] = "Abbrechen";
+constexpr static char ptCancel[] = "Cancelar";
+constexpr static char enCartesian[] = "Cartesian ";
+constexpr static char frCartesian[] = "Algébrique ";
+constexpr static char esCartesian[] = "Binómica ";
+constexpr static char deCartesian[] = "Algebraische ";
+constexpr static char ptCartesian[] = "Cartesiana ";
+constexpr static char enCartesianType[] = "Cartesian ";
+constexpr static char frCartesianType[] = "Cartésien ";
+constexpr static char esCartesianType[] = "Cartesiano ";
+constexpr static char deCartesianType[] = "Kartesisch ";
+constexpr static char ptCartesianType[] = "Cartesiano ";
+constexpr static char enCatalog[] = "Catalog";
+constexpr static char frCatalog[] = "Catalogue";
+constexpr static char esCatalog[] = "Catalog";
+constexpr static char deCatalog[] = "Katalog";
+constexpr static char ptCatalog[] = "Catalog";
+constexpr static char enCeiling[] = "Ceiling";
+constexpr static char frCeiling[] = "Plafond";
+constexpr static char esCeiling[] = "Techo";
+constexpr static char deCeiling[] = "Obergrenze";
+constexpr static char ptCeiling[] = "Tecto";
+constexpr static char enChiSquared[] = "Chi-squared";
+constexpr static char frChiSquared[] = "Chi2";
+constexpr static char esChiSquared[] = "Chi-cuadrado";
+constexpr static char deChiSquared[] = "Chi-Quadrat";
+constexpr static char ptChiSquared[] = "Qui-quadrado";
+constexpr static char enChiSquaredDistribution[] = "Chi-squared distribution";
+constexpr static char frChiSquaredDistribution[] = "Loi du chi2";
+constexpr static char esChiSquaredDistribution[] = "Distribución chi-cuadrado";
+constexpr static char deChiSquaredDistribution[] = "Chi-Quadrat-Verteilung";
+constexpr static char ptChiSquaredDistribution[] = "Distribuição qui-quadrado";
+constexpr static char enChooseDistribution[] = "Choose the distribution";
+constexpr static char frChooseDistribution[] = "Choisir le type de loi";
+constexpr static char esChooseDistribution[] = "Seleccionar la distribución";
+constexpr static char deChooseDistribution[] = "Wählen Sie eine Verteilung";
+constexpr static char ptChooseDistribution[] = "Selecionar a distribuição";
+constexpr static char enChooseParameters[] = "Choose parameters";
+constexpr static char frChooseParameters[] = "Choisir les paramètres";
+constexpr static char esChooseParameters[] = "Seleccionar parámetros";
+constexpr static char deChooseParameters[] = "Parameter auswählen";
+constexpr static char ptChooseParameters[] = "Selecionar os parâmetros";
+constexpr static char enChooseSequenceType[] = "Choose sequence type";
+constexpr static char frChooseSequenceType[] = "Choisir le type de suite";
+constexpr static char esChooseSequenceType[] = "Seleccionar el tipo de sucesión";
+constexpr static char deChooseSequenceType[] = "Das Bildungsgesetz der Folge auswählen";
+constexpr static char ptChooseSequenceType[] = "Escolha o tipo de sequência";
+constexpr static char enClearColumn[] = "Clear column";
+constexpr static char frClearColumn[] = "Effacer la colonne";
+constexpr static char esClearColumn[] = "Borrar la columna";
+constexpr static char deClearColumn[] = "Spalte löschen";
+constexpr static char ptClearColumn[] = "Excluir coluna";
+constexpr static char enColumnOptions[] = "Column options";
+constexpr static char frColumnOptions[] = "Options de la colonne";
+constexpr static char esColumnOptions[] = "Opciones de la columna";
+constexpr static char deColumnOptions[] = "Optionen der Spalte";
+constexpr static char ptColumnOptions[] = "Opções de coluna";
+constexpr static char enCombination[] = "Combination";
+constexpr static char frCombination[] = "k parmi n";
+constexpr static char esCombination[] = "Combinación";
+constexpr static char deCombination[] = "Kombination";
+constexpr static char ptCombination[] = "Combinação";
+constexpr static char enCombinatorics[] = "Combinatorics";
+constexpr static char frCombinatorics[] = "Dénombrement";
+constexpr static char esCombinatorics[] = "Combinatoria";
+constexpr static char deCombinatorics[] = "Kombinatorik";
+constexpr static char ptCombinatorics[] = "Combinatoria";
+constexpr static char enComplexAbsoluteValue[] = "Absolute value";
+constexpr static char frComplexAbsoluteValue[] = "Module";
+constexpr static char esComplexAbsoluteValue[] = "Modulo";
+constexpr static char deComplexAbsoluteValue[] = "Betrag";
+constexpr static char ptComplexAbsoluteValue[] = "Módulo";
+constexpr static char enComplexFormat[] = "Complex format";
+constexpr static char frComplexFormat[] = "Forme complexe";
+constexpr static char esComplexFormat[] = "Forma compleja";
+constexpr static char deComplexFormat[] = "Komplex";
+constexpr static char ptComplexFormat[] = "Complexos";
+constexpr static char enComplexNumber[] = "Complex numbers";
+constexpr static char frComplexNumber[] = "Nombres complexes";
+constexpr static char esComplexNumber[] = "Números complejos";
+constexpr static char deComplexNumber[] = "Komplexe Zahlen";
+constexpr static char ptComplexNumber[] = "Números complexos";
+constexpr static char enCompute[] = "Calculate";
+constexpr static char frCompute[] = "Calculer";
+constexpr static char esCompute[] = "Calcular";
+constexpr static char deCompute[] = "Berechnen";
+constexpr static char ptCompute[] = "Calcular";
+constexpr static char enComputeProbability[] = "Calculate probabilities";
+constexpr static char frComputeProbability[] = "Calculer les probabilités";
+constexpr static char esComputeProbability[] = "Calcular las probabilidades";
+constexpr static char deComputeProbability[] = "Wahrscheinlichkeit berechnen";
+constexpr static char ptComputeProbability[] = "Calcular probabilidades";
+constexpr static char enConfidence[] = "Confidence interval";
+constexpr static char frConfidence[] = "Intervalle de confiance";
+constexpr static char esConfidence[] = "Intervalo de confianza";
+constexpr static char deConfidence[] = "Konfidenzintervall";
+constexpr static char ptConfidence[] = "Intervalo de confiança";
+constexpr static char enConjugate[] = "Conjugate";
+constexpr static char frConjugate[] = "Conjugué";
+constexpr static char esConjugate[] = "Conjugado";
+constexpr static char deConjugate[] = "Konjugiert";
+constexpr static char ptConjugate[] = "Conjugado";
+constexpr static char enConnectedMessage1[] = "To transfer data, browse";
+constexpr static char frConnectedMessage1[] = "Pour transférer des données, connectez-";
+constexpr static char esConnectedMessage1[] = "Para transferir datos, visite";
+constexpr static char deConnectedMessage1[] = "Um Daten zu übertragen, verbinden";
+constexpr static char ptConnectedMessage1[] = "Para transferir dados, navegue";
+constexpr static char enConnectedMessage2[] = "our page from your computer";
+constexpr static char frConnectedMessage2[] = "vous depuis votre ordinateur sur le site";
+constexpr static char esConnectedMessage2[] = "nuestra página desde su ordenador";
+constexpr static char deConnectedMessage2[] = "Sie Sich von Ihrem Computer aus mit";
+constexpr static char ptConnectedMessage2[] = "na nossa pagina no seu computador";
+constexpr static char enConnectedMessage3[] = "workshop.numworks.com";
+constexpr static char frConnectedMessage3[] = "workshop.numworks.com";
+constexpr static char esConnectedMessage3[] = "workshop.numworks.com";
+constexpr static char deConnectedMessage3[] = "workshop.numworks.com.";
+constexpr static char ptConnectedMessage3[] = "workshop.numworks.com";
+constexpr static char enConnectedMessage4[] = "Press the BACK key of your";
+constexpr static char frConnectedMessage4[] = "Appuyez sur la touche RETOUR de la";
+constexpr static char esConnectedMessage4[] = "Pulse el botón RETURN de la";
+constexpr static char deConnectedMessage4[] = "Drücken Sie die RETURN-Taste am";
+constexpr static char ptConnectedMessage4[] = "Pressione o botão RETURN na";
+constexpr static char enConnectedMessage5[] = "calculator or unplug it to";
+constexpr static char frConnectedMessage5[] = "calculatrice ou débranchez-la pour la";
+constexpr static char esConnectedMessage5[] = "calculadora o desenchúfela para";
+constexpr static char deConnectedMessage5[] = "Taschenrechner oder ziehen Sie das Kabel,";
+constexpr static char ptConnectedMessage5[] = "calculadora ou desligue-la para";
+constexpr static char enConnectedMessage6[] = "disconnect it.";
+constexpr static char frConnectedMessage6[] = "déconnecter.";
+constexpr static char esConnectedMessage6[] = "desconectarla.";
+constexpr static char deConnectedMessage6[] = "um die Verbindung zu trennen.";
+constexpr static char ptConnectedMessage6[] = "desconectar-la.";
+constexpr static char enConsole[] = "Python shell";
+constexpr static char frConsole[] = "Console d'exécution";
+constexpr static char esConsole[] = "Interprete de comandos";
+constexpr static char deConsole[] = "Interaktive Konsole";
+constexpr static char ptConsole[] = "Interpretador interativo";
+constexpr static char enCopyColumnInList[] = "Export the column to a list";
+constexpr static char frCopyColumnInList[] = "Copier la colonne dans une liste";
+constexpr static char esCopyColumnInList[] = "Copiar la columna en una lista";
+constexpr static char deCopyColumnInList[] = "Die Spalte in einer Liste kopieren";
+constexpr static char ptCopyColumnInList[] = "Copie a coluna em uma lista";
+constexpr static char enCovariance[] = "Covariance";
+constexpr static char frCovariance[] = "Covariance";
+constexpr static char esCovariance[] = "Covarianza";
+constexpr static char deCovariance[] = "Kovarianz";
+constexpr static char ptCovariance[] = "Covariancia";
+constexpr static char enCubic[] = "Cubic";
+constexpr static char frCubic[] = "Cubique";
+constexpr static char esCubic[] = "Cúbica";
+constexpr static char deCubic[] = "Kubische";
+constexpr static char ptCubic[] = "Cúbica";
+constexpr static char enCurveType[] = "Curve type";
+constexpr static char frCurveType[] = "Type de courbe";
+constexpr static char esCurveType[] = "Tipo de curva";
+constexpr static char deCurveType[] = "Bildungsgesetz der Kurve";
+constexpr static char ptCurveType[] = "Tipo de curva";
+constexpr static char enD1FisherDefinition[] = "d1: Degrees of freedom of the numerator";
+constexpr static char frD1FisherDefinition[] = "d1 : Degrés de liberté du numérateur";
+constexpr static char esD1FisherDefinition[] = "d1 : Grados de libertad del numerador";
+constexpr static char deD1FisherDefinition[] = "d1: Freiheitsgrade des Zählers";
+constexpr static char ptD1FisherDefinition[] = "d1 : Graus de liberdade do numerador";
+constexpr static char enD2FisherDefinition[] = "d2: Degrees of freedom of the denominator";
+constexpr static char frD2FisherDefinition[] = "d2 : Degrés de liberté du dénominateur";
+constexpr static char esD2FisherDefinition[] = "d2 : Grados de libertad del denominador";
+constexpr static char deD2FisherDefinition[] = "d2: Freiheitsgrade des Nenners";
+constexpr static char ptD2FisherDefinition[] = "d2 : Graus de liberdade do denominador";
+constexpr static char enDataNotSuitable[] = "Data not suitable";
+constexpr static char frDataNotSuitable[] = "Les données ne conviennent pas";
+constexpr static char esDataNotSuitable[] = "Datos no adecuados";
+constexpr static char deDataNotSuitable[] = "Daten nicht geeignet";
+constexpr static char ptDataNotSuitable[] = "Dados não adequados";
+constexpr static char enDataNotSuitableForRegression[] = " Data not suitable for this regression model";
+constexpr static char frDataNotSuitableForRegression[] = "Les données ne conviennent pas";
+constexpr static char esDataNotSuitableForRegression[] = "Datos no adecuados";
+constexpr static char deDataNotSuitableForRegression[] = "Daten sind nicht geeignet";
+constexpr static char ptDataNotSuitableForRegression[] = "Dados não adequados";
+constexpr static char enDataTab[] = "Data";
+constexpr static char frDataTab[] = "Données";
+constexpr static char esDataTab[] = "Datos";
+constexpr static char deDataTab[] = "Daten";
+constexpr static char ptDataTab[] = "Dados";
+constexpr static char enDecimal[] = "Decimal ";
+constexpr static char frDecimal[] = "Décimal ";
+constexpr static char esDecimal[] = "Decimal ";
+constexpr static char deDecimal[] = "Dezimal ";
+constexpr static char ptDecimal[] = "Decimal ";
+constexpr static char enDecimalBase[] = "Decimal";
+constexpr static char frDecimalBase[] = "Décimal";
+constexpr static char esDecimalBase[] = "????";
+constexpr static char deDecimalBase[] = "????";
+constexpr static char ptDecimalBase[] = "????";
+constexpr static char enDefaultSetting[] = "Basic settings";
+constexpr static char frDefaultSetting[] = "Réglages de base";
+constexpr static char esDefaultSetting[] = "Ajustes básicos";
+constexpr static char deDefaultSetting[] = "Grundeinstellung";
+constexpr static char ptDefaultSetting[] = "Configurações basicas";
+constexpr static char enDeg[] = "deg";
+constexpr static char frDeg[] = "deg";
+constexpr static char esDeg[] = "gra";
+constexpr static char deDeg[] = "gra";
+constexpr static char ptDeg[] = "gra";
+constexpr static char enDegrees[] = "Degrees ";
+constexpr static char frDegrees[] = "Degrés ";
+constexpr static char esDegrees[] = "Grados ";
+constexpr static char deDegrees[] = "Grad ";
+constexpr static char ptDegrees[] = "Graus ";
+constexpr static char enDegreesOfFreedomDefinition[] = "k: Degrees of freedom";
+constexpr static char frDegreesOfFreedomDefinition[] = "k : Degrés de liberté";
+constexpr static char esDegreesOfFreedomDefinition[] = "k : Grados de libertad";
+constexpr static char deDegreesOfFreedomDefinition[] = "k: Anzahl der Freiheitsgrade";
+constexpr static char ptDegreesOfFreedomDefinition[] = "k : Graus de liberdade";
+constexpr static char enDeleteFunction[] = "Delete function";
+constexpr static char frDeleteFunction[] = "Supprimer la fonction";
+constexpr static char esDeleteFunction[] = "Eliminar la función";
+constexpr static char deDeleteFunction[] = "Funktion löschen";
+constexpr static char ptDeleteFunction[] = "Eliminar a função";
+constexpr static char enDeleteScript[] = "Delete script";
+constexpr static char frDeleteScript[] = "Supprimer le script";
+constexpr static char esDeleteScript[] = "Eliminar el archivo";
+constexpr static char deDeleteScript[] = "Skript löschen";
+constexpr static char ptDeleteScript[] = "Eliminar o script";
+constexpr static char enDeleteSequence[] = "Delete sequence";
+constexpr static char frDeleteSequence[] = "Supprimer la suite";
+constexpr static char esDeleteSequence[] = "Eliminar la sucesión";
+constexpr static char deDeleteSequence[] = "Folge löschen";
+constexpr static char ptDeleteSequence[] = "Eliminar a sequência";
+constexpr static char enDerivateNumber[] = "Derivative";
+constexpr static char frDerivateNumber[] = "Nombre derivé";
+constexpr static char esDerivateNumber[] = "Derivada";
+constexpr static char deDerivateNumber[] = "Ableitung";
+constexpr static char ptDerivateNumber[] = "Derivada";
+constexpr static char enDerivativeFunctionColumn[] = "Derivative function column";
+constexpr static char frDerivativeFunctionColumn[] = "Colonne de la fonction dérivée";
+constexpr static char esDerivativeFunctionColumn[] = "Columna de la derivada";
+constexpr static char deDerivativeFunctionColumn[] = "Spalte der Ableitungsfunktion";
+constexpr static char ptDerivativeFunctionColumn[] = "Coluna da função derivada";
+constexpr static char enDeterminant[] = "Determinant";
+constexpr static char frDeterminant[] = "Déterminant";
+constexpr static char esDeterminant[] = "Determinante";
+constexpr static char deDeterminant[] = "Determinante";
+constexpr static char ptDeterminant[] = "Determinante";
+constexpr static char enDeviation[] = "Variance";
+constexpr static char frDeviation[] = "Variance";
+constexpr static char esDeviation[] = "Varianza";
+constexpr static char deDeviation[] = "Varianz";
+constexpr static char ptDeviation[] = "Variancia";
+constexpr static char enDeviationDefinition[] = "σ: Standard deviation";
+constexpr static char frDeviationDefinition[] = "σ : Ecart type";
+constexpr static char esDeviationDefinition[] = "σ : Desviación típica";
+constexpr static char deDeviationDefinition[] = "σ: Standardabweichung";
+constexpr static char ptDeviationDefinition[] = "σ : Desvio padrão";
+constexpr static char enDimension[] = "Size";
+constexpr static char frDimension[] = "Taille";
+constexpr static char esDimension[] = "Tamaño";
+constexpr static char deDimension[] = "Größe";
+constexpr static char ptDimension[] = "Tamanho";
+constexpr static char enDisplayMode[] = "Result format";
+constexpr static char frDisplayMode[] = "Format résultat";
+constexpr static char esDisplayMode[] = "Formato resultado";
+constexpr static char deDisplayMode[] = "Zahlenformat";
+constexpr static char ptDisplayMode[] = "Formato numérico";
+constexpr static char enDisplayValues[] = "Display values";
+constexpr static char frDisplayValues[] = "Afficher les valeurs";
+constexpr static char esDisplayValues[] = "Visualizar los valores";
+constexpr static char deDisplayValues[] = "Werte anzeigen";
+constexpr static char ptDisplayValues[] = "Exibir os valores";
+constexpr static char enDoubleRecurrence[] = "Recursive second order";
+constexpr static char frDoubleRecurrence[] = "Récurrente d'ordre 2";
+constexpr static char esDoubleRecurrence[] = "Recurrencia de orden dos";
+constexpr static char deDoubleRecurrence[] = "Rekursion 2. Ordnung";
+constexpr static char ptDoubleRecurrence[] = "Recorrência de Segunda Ordem";
+constexpr static char enEdition2D[] = "Natural ";
+constexpr static char frEdition2D[] = "Naturelle ";
+constexpr static char esEdition2D[] = "Natural ";
+constexpr static char deEdition2D[] = "Natürlich ";
+constexpr static char ptEdition2D[] = "Natural ";
+constexpr static char enEditionLinear[] = "Linear ";
+constexpr static char frEditionLinear[] = "En ligne ";
+constexpr static char esEditionLinear[] = "En línea ";
+constexpr static char deEditionLinear[] = "Linear ";
+constexpr static char ptEditionLinear[] = "Em linha ";
+constexpr static char enEditionMode[] = "Writing format";
+constexpr static char frEditionMode[] = "Format écriture";
+constexpr static char esEditionMode[] = "Formato escritura";
+constexpr static char deEditionMode[] = "Eingabe";
+constexpr static char ptEditionMode[] = "Formato escrita ";
+constexpr static char enEmpty[] = "Empty";
+constexpr static char frEmpty[] = "Vide";
+constexpr static char esEmpty[] = "Vacio";
+constexpr static char deEmpty[] = "Leer";
+constexpr static char ptEmpty[] = "Vácuo";
+constexpr static char enEmptyExpressionBox0[] = "You have not defined any variables.";
+constexpr static char frEmptyExpressionBox0[] = "Vous n'avez défini aucune variable.";
+constexpr static char esEmptyExpressionBox0[] = "Ninguna variable definida.";
+constexpr static char deEmptyExpressionBox0[] = "Sie haben keine Variable definiert.";
+constexpr static char ptEmptyExpressionBox0[] = "Nenhuma variável definida.";
+constexpr static char enEmptyExpressionBox1[] = "To define a variable, type:";
+constexpr static char frEmptyExpressionBox1[] = "Pour définir une variable, tapez :";
+constexpr static char esEmptyExpressionBox1[] = "Para definir una, teclear :";
+constexpr static char deEmptyExpressionBox1[] = "Um eine Variable zu definieren:";
+constexpr static char ptEmptyExpressionBox1[] = "Para definir uma, digite :";
+constexpr static char enEmptyExpressionBox2[] = "The variable name can contain:";
+constexpr static char frEmptyExpressionBox2[] = "Le nom de la variable peut";
+constexpr static char esEmptyExpressionBox2[] = "El nombre de variable debe";
+constexpr static char deEmptyExpressionBox2[] = "Erlaubte Zeichen im Namen:";
+constexpr static char ptEmptyExpressionBox2[] = "O nome da variável pode conter:";
+constexpr static char enEmptyFunctionBox0[] = "You have not defined any functions.";
+constexpr static char frEmptyFunctionBox0[] = "Vous n'avez défini aucune fonction.";
+constexpr static char esEmptyFunctionBox0[] = "Ninguna función definida.";
+constexpr static char deEmptyFunctionBox0[] = "Sie haben keine Funktion definiert.";
+constexpr static char ptEmptyFunctionBox0[] = "Nenhuma função definida.";
+constexpr static char enEmptyFunctionBox1[] = "To define a function, type:";
+constexpr static char frEmptyFunctionBox1[] = "Pour définir une fonction, tapez :";
+constexpr static char esEmptyFunctionBox1[] = "Para definir una, teclear :";
+constexpr static char deEmptyFunctionBox1[] = "Um eine Funktion zu definieren:";
+constexpr static char ptEmptyFunctionBox1[] = "Para definir uma, digite :";
+constexpr static char enEmptyFunctionBox2[] = "The function name can contain:";
+constexpr static char frEmptyFunctionBox2[] = "Le nom de la fonction peut";
+constexpr static char esEmptyFunctionBox2[] = "El nombre de función debe";
+constexpr static char deEmptyFunctionBox2[] = "Erlaubte Zeichen im Namen:";
+constexpr static char ptEmptyFunctionBox2[] = "O nome da função pode conter:";
+constexpr static char enEnableCharacters[] = "A..Z, a..z, 0..9 and _";
+constexpr static char frEnableCharacters[] = "contenir : A..Z, a..z, 0..9 et _";
+constexpr static char esEnableCharacters[] = "contener : A..Z, a..z, 0..9 y _";
+constexpr static char deEnableCharacters[] = "A..Z, a..z, 0..9 und _";
+constexpr static char ptEnableCharacters[] = "A..Z, a..z, 0..9 y _";
+constexpr static char enEng[] = "eng";
+constexpr static char frEng[] = "ing";
+constexpr static char esEng[] = "ing";
+constexpr static char deEng[] = "tech";
+constexpr static char ptEng[] = "eng";
+constexpr static char enEngineering[] = "Engineering ";
+constexpr static char frEngineering[] = "Ingénieur ";
+constexpr static char esEngineering[] = "Ingeniería ";
+constexpr static char deEngineering[] = "Technisch ";
+constexpr static char ptEngineering[] = "Engenharia ";
+constexpr static char enEnterEquation[] = "Enter an equation";
+constexpr static char frEnterEquation[] = "Entrez une équation";
+constexpr static char esEnterEquation[] = "Escribe una ecuación";
+constexpr static char deEnterEquation[] = "Geben Sie eine Gleichung ein";
+constexpr static char ptEnterEquation[] = "Digite uma equação";
+constexpr static char enEuclideanDivision[] = "Euclidean division";
+constexpr static char frEuclideanDivision[] = "Division euclidienne";
+constexpr static char esEuclideanDivision[] = "????";
+constexpr static char deEuclideanDivision[] = "????";
+constexpr static char ptEuclideanDivision[] = "????";
+constexpr static char enExamMode[] = "Exam mode";
+constexpr static char frExamMode[] = "Mode examen";
+constexpr static char esExamMode[] = "Modo examen";
+constexpr static char deExamMode[] = "Testmodus";
+constexpr static char ptExamMode[] = "Modo de exame";
+constexpr static char enExamModeActive[] = "Reactivate exam mode";
+constexpr static char frExamModeActive[] = "Réactiver le mode examen";
+constexpr static char esExamModeActive[] = "Reactivar el modo examen";
+constexpr static char deExamModeActive[] = "Wieder starten Testmodus";
+constexpr static char ptExamModeActive[] = "Reactivar o modo de exame";
+constexpr static char enExamModeWarning1[] = "Caution: compliance of this";
+constexpr static char frExamModeWarning1[] = "Attention, la conformité du mode";
+constexpr static char esExamModeWarning1[] = "Caution: compliance of this";
+constexpr static char deExamModeWarning1[] = "Caution: compliance of this";
+constexpr static char ptExamModeWarning1[] = "Caution: compliance of this";
+constexpr static char enExamModeWarning2[] = "unofficial software's exam mode";
+constexpr static char frExamModeWarning2[] = "examen de ce logiciel non officiel";
+constexpr static char esExamModeWarning2[] = "unofficial software's exam mode";
+constexpr static char deExamModeWarning2[] = "unofficial software's exam mode";
+constexpr static char ptExamModeWarning2[] = "unofficial software's exam mode";
+constexpr static char enExamModeWarning3[] = "is not guaranteed by NumWorks.";
+constexpr static char frExamModeWarning3[] = "n'est pas garantie par NumWorks.";
+constexpr static char esExamModeWarning3[] = "is not guaranteed by NumWorks.";
+constexpr static char deExamModeWarning3[] = "is not guaranteed by NumWorks.";
+constexpr static char ptExamModeWarning3[] = "is not guaranteed by NumWorks.";
+constexpr static char enExecuteScript[] = "Execute script";
+constexpr static char frExecuteScript[] = "Exécuter le script";
+constexpr static char esExecuteScript[] = "Ejecutar el archivo";
+constexpr static char deExecuteScript[] = "Skript ausführen";
+constexpr static char ptExecuteScript[] = "Executar o script";
+constexpr static char enExitExamMode1[] = "Exit the exam ";
+constexpr static char frExitExamMode1[] = "Voulez-vous sortir ";
+constexpr static char esExitExamMode1[] = "Salir del modo ";
+constexpr static char deExitExamMode1[] = "Möchten Sie den Testmodus ";
+constexpr static char ptExitExamMode1[] = "Você quer sair do modo de ";
+constexpr static char enExitExamMode2[] = "mode?";
+constexpr static char frExitExamMode2[] = "du mode examen ?";
+constexpr static char esExitExamMode2[] = "examen ?";
+constexpr static char deExitExamMode2[] = "verlassen?";
+constexpr static char ptExitExamMode2[] = "exame ?";
+constexpr static char enExplicit[] = "Explicit expression";
+constexpr static char frExplicit[] = "Explicite";
+constexpr static char esExplicit[] = "Fórmula explícita";
+constexpr static char deExplicit[] = "Explizit";
+constexpr static char ptExplicit[] = "Explícita";
+constexpr static char enExponential[] = "Exponential";
+constexpr static char frExponential[] = "Exponentielle";
+constexpr static char esExponential[] = "Exponencial";
+constexpr static char deExponential[] = "Exponentielle";
+constexpr static char ptExponential[] = "Exponencial";
+constexpr static char enExponentialDistribution[] = "Exponential distribution";
+constexpr static char frExponentialDistribution[] = "Loi exponentielle";
+constexpr static char esExponentialDistribution[] = "Distribución exponencial";
+constexpr static char deExponentialDistribution[] = "Exponentialverteilung";
+constexpr static char ptExponentialDistribution[] = "Distribuição exponencial";
+constexpr static char enExpressions[] = "Expressions";
+constexpr static char frExpressions[] = "Expressions";
+constexpr static char esExpressions[] = "Expresiones";
+constexpr static char deExpressions[] = "Ausdrücke";
+constexpr static char ptExpressions[] = "Expressões";
+constexpr static char enFillWithFormula[] = "Fill with a formula";
+constexpr static char frFillWithFormula[] = "Remplir avec une formule";
+constexpr static char esFillWithFormula[] = "Rellenar con una fórmula";
+constexpr static char deFillWithFormula[] = "Mit einer Formel füllen";
+constexpr static char ptFillWithFormula[] = "Preencher com uma fórmula";
+constexpr static char enFirstQuartile[] = "First quartile";
+constexpr static char frFirstQuartile[] = "Premier quartile";
+constexpr static char esFirstQuartile[] = "Primer cuartil";
+constexpr static char deFirstQuartile[] = "Unteres Quartil";
+constexpr static char ptFirstQuartile[] = "Quartil inferior";
+constexpr static char enFirstTermIndex[] = "First term index";
+constexpr static char frFirstTermIndex[] = "Indice premier terme";
+constexpr static char esFirstTermIndex[] = "Indice del primer término";
+constexpr static char deFirstTermIndex[] = "Anfangsindex";
+constexpr static char ptFirstTermIndex[] = "Indice do primeiro termo";
+constexpr static char enFisherDistribution[] = "F distribution";
+constexpr static char frFisherDistribution[] = "Loi de Fisher";
+constexpr static char esFisherDistribution[] = "Distribución F";
+constexpr static char deFisherDistribution[] = "F-Verteilung";
+constexpr static char ptFisherDistribution[] = "Distribuição F";
+constexpr static char enFloor[] = "Floor";
+constexpr static char frFloor[] = "Partie entière";
+constexpr static char esFloor[] = "Parte entera";
+constexpr static char deFloor[] = "Untergrenze";
+constexpr static char ptFloor[] = "Parte inteira";
+constexpr static char enFluctuation[] = "Prediction Interval";
+constexpr static char frFluctuation[] = "Intervalle de fluctuation";
+constexpr static char esFluctuation[] = "Interval de predicción";
+constexpr static char deFluctuation[] = "Konfidenzintervall";
+constexpr static char ptFluctuation[] = "Intervalo de confiança";
+constexpr static char enFontSizes[] = "Python font size";
+constexpr static char frFontSizes[] = "Police Python";
+constexpr static char esFontSizes[] = "Tipografía Python";
+constexpr static char deFontSizes[] = "Python Schriftgröße";
+constexpr static char ptFontSizes[] = "Tipografia Python";
+constexpr static char enForbiddenValue[] = "Forbidden value";
+constexpr static char frForbiddenValue[] = "Valeur interdite";
+constexpr static char esForbiddenValue[] = "Valor prohibido";
+constexpr static char deForbiddenValue[] = "Verbotener Wert";
+constexpr static char ptForbiddenValue[] = "Valor proibido";
+constexpr static char enForbidenAppInExamMode1[] = "This application is";
+constexpr static char frForbidenAppInExamMode1[] = "This application is";
+constexpr static char esForbidenAppInExamMode1[] = "This application is";
+constexpr static char deForbidenAppInExamMode1[] = "This application is";
+constexpr static char ptForbidenAppInExamMode1[] = "This application is";
+constexpr static char enForbidenAppInExamMode2[] = "forbidden in exam mode";
+constexpr static char frForbidenAppInExamMode2[] = "forbidden in exam mode";
+constexpr static char esForbidenAppInExamMode2[] = "forbidden in exam mode";
+constexpr static char deForbidenAppInExamMode2[] = "forbidden in exam mode";
+constexpr static char ptForbidenAppInExamMode2[] = "forbidden in exam mode";
+constexpr static char enFracPart[] = "Fractional part";
+constexpr static char frFracPart[] = "Partie fractionnaire";
+constexpr static char esFracPart[] = "Parte fraccionaria";
+constexpr static char deFracPart[] = "Bruchteil";
+constexpr static char ptFracPart[] = "Parte fraccionaria";
+constexpr static char enFrequency[] = "Frequency";
+constexpr static char frFrequency[] = "Fréquence";
+constexpr static char esFrequency[] = "Relativa";
+constexpr static char deFrequency[] = "Relative";
+constexpr static char ptFrequency[] = "Relativa";
+constexpr static char enFunctionApp[] = "Functions";
+constexpr static char frFunctionApp[] = "Fonctions";
+constexpr static char esFunctionApp[] = "Función";
+constexpr static char deFunctionApp[] = "Funktionen";
+constexpr static char ptFunctionApp[] = "Função";
+constexpr static char enFunctionAppCapital[] = "FUNCTIONS";
+constexpr static char frFunctionAppCapital[] = "FONCTIONS";
+constexpr static char esFunctionAppCapital[] = "FUNCION";
+constexpr static char deFunctionAppCapital[] = "FUNKTIONEN";
+constexpr static char ptFunctionAppCapital[] = "FUNCAO";
+constexpr static char enFunctionColor[] = "Function color";
+constexpr static char frFunctionColor[] = "Couleur de la fonction";
+constexpr static char esFunctionColor[] = "Color de la funcion";
+constexpr static char deFunctionColor[] = "Farbe der Funktion";
+constexpr static char ptFunctionColor[] = "Cor da função";
+constexpr static char enFunctionColumn[] = "0(0) column";
+constexpr static char frFunctionColumn[] = "Colonne 0(0)";
+constexpr static char esFunctionColumn[] = "Columna 0(0)";
+constexpr static char deFunctionColumn[] = "0(0) Spalte";
+constexpr static char ptFunctionColumn[] = "Coluna 0(0)";
+constexpr static char enFunctionDomain[] = "Plot range";
+constexpr static char frFunctionDomain[] = "Domaine de tracé";
+constexpr static char esFunctionDomain[] = "Rango del gráfico";
+constexpr static char deFunctionDomain[] = "Plot-Bereich";
+constexpr static char ptFunctionDomain[] = "Intervalo do gráfico";
+constexpr static char enFunctionOptions[] = "Function options";
+constexpr static char frFunctionOptions[] = "Options de la fonction";
+constexpr static char esFunctionOptions[] = "Opciones de la función";
+constexpr static char deFunctionOptions[] = "Funktionsoptionen";
+constexpr static char ptFunctionOptions[] = "Opções de função";
+constexpr static char enFunctionTab[] = "Functions";
+constexpr static char frFunctionTab[] = "Fonctions";
+constexpr static char esFunctionTab[] = "Funciones";
+constexpr static char deFunctionTab[] = "Funktionen";
+constexpr static char ptFunctionTab[] = "Funções";
+constexpr static char enFunctions[] = "Functions";
+constexpr static char frFunctions[] = "Fonctions";
+constexpr static char esFunctions[] = "Funciones";
+constexpr static char deFunctions[] = "Funktionen";
+constexpr static char ptFunctions[] = "Funções";
+constexpr static char enFunctionsAndVariables[] = "Functions and variables";
+constexpr static char frFunctionsAndVariables[] = "Fonctions et variables";
+constexpr static char esFunctionsAndVariables[] = "Funciones y variables";
+constexpr static char deFunctionsAndVariables[] = "Funktionen und Variablen";
+constexpr static char ptFunctionsAndVariables[] = "Funções e variáveis";
+constexpr static char enGeometric[] = "Geometric";
+constexpr static char frGeometric[] = "Géométrique";
+constexpr static char esGeometric[] = "Geométrica";
+constexpr static char deGeometric[] = "Geometrische";
+constexpr static char ptGeometric[] = "Geométrica";
+constexpr static char enGeometricDistribution[] = "Geometric distribution";
+constexpr static char frGeometricDistribution[] = "Loi géométrique";
+constexpr static char esGeometricDistribution[] = "Distribución geométrica";
+constexpr static char deGeometricDistribution[] = "Geometrischeverteilung";
+constexpr static char ptGeometricDistribution[] = "Distribuição geométrica";
+constexpr static char enGoto[] = "Go to";
+constexpr static char frGoto[] = "Aller à";
+constexpr static char esGoto[] = "Ir a";
+constexpr static char deGoto[] = "Gehe zu";
+constexpr static char ptGoto[] = "Ir a";
+constexpr static char enGradians[] = "Gradians ";
+constexpr static char frGradians[] = "Grades ";
+constexpr static char esGradians[] = "Gradianes ";
+constexpr static char deGradians[] = "Gone ";
+constexpr static char ptGradians[] = "Grados ";
+constexpr static char enGraphTab[] = "Graph";
+constexpr static char frGraphTab[] = "Graphique";
+constexpr static char esGraphTab[] = "Gráfico";
+constexpr static char deGraphTab[] = "Graph";
+constexpr static char ptGraphTab[] = "Gráfico";
+constexpr static char enGreatCommonDivisor[] = "GCD";
+constexpr static char frGreatCommonDivisor[] = "PGCD";
+constexpr static char esGreatCommonDivisor[] = "MCD";
+constexpr static char deGreatCommonDivisor[] = "ggT";
+constexpr static char ptGreatCommonDivisor[] = "MDC";
+constexpr static char enHardwareTestLaunch1[] = "You are starting the hardware";
+constexpr static char frHardwareTestLaunch1[] = "Vous allez lancer le test usine.";
+constexpr static char esHardwareTestLaunch1[] = "Esta iniciando la prueba de";
+constexpr static char deHardwareTestLaunch1[] = "Sie sind dabei den Hardwaretest zu";
+constexpr static char ptHardwareTestLaunch1[] = "Você vai executar o teste da planta.";
+constexpr static char enHardwareTestLaunch2[] = " test. At the end of the test, you";
+constexpr static char frHardwareTestLaunch2[] = "Pour en sortir vous devrez";
+constexpr static char esHardwareTestLaunch2[] = "fabrica. Para quitar la prueba,";
+constexpr static char deHardwareTestLaunch2[] = "starten. Um ihn wieder zu verlassen,";
+constexpr static char ptHardwareTestLaunch2[] = "Para sair você tem que executar";
+constexpr static char enHardwareTestLaunch3[] = "will have to reset the device and";
+constexpr static char frHardwareTestLaunch3[] = "appuyer sur le bouton reset";
+constexpr static char esHardwareTestLaunch3[] = "debera resetear su equipo.";
+constexpr static char deHardwareTestLaunch3[] = "müssen Sie einen Reset durchfuhren,";
+constexpr static char ptHardwareTestLaunch3[] = "uma redefinição, que ira apagar";
+constexpr static char enHardwareTestLaunch4[] = "all your data will be deleted.";
+constexpr static char frHardwareTestLaunch4[] = "ce qui supprimera vos données.";
+constexpr static char esHardwareTestLaunch4[] = "";
+constexpr static char deHardwareTestLaunch4[] = "der Ihre Daten löschen wird.";
+constexpr static char ptHardwareTestLaunch4[] = "seus dados.";
+constexpr static char enHexadecimalBase[] = "Hexadecimal";
+constexpr static char frHexadecimalBase[] = "Hexadécimal";
+constexpr static char esHexadecimalBase[] = "????";
+constexpr static char deHexadecimalBase[] = "????";
+constexpr static char ptHexadecimalBase[] = "????";
+constexpr static char enHideDerivativeColumn[] = "Hide the derivative function";
+constexpr static char frHideDerivativeColumn[] = "Masquer la fonction dérivée";
+constexpr static char esHideDerivativeColumn[] = "Ocultar la derivada";
+constexpr static char deHideDerivativeColumn[] = "Ableitungsfunktion ausblenden";
+constexpr static char ptHideDerivativeColumn[] = "Esconder função derivada";
+constexpr static char enHistogramSet[] = "Histogram settings";
+constexpr static char frHistogramSet[] = "Réglage de l'histogramme";
+constexpr static char esHistogramSet[] = "Parámetros del histograma";
+constexpr static char deHistogramSet[] = "Einstellung des Histogramms";
+constexpr static char ptHistogramSet[] = "Configurando o histograma";
+constexpr static char enHistogramTab[] = "Histogram";
+constexpr static char frHistogramTab[] = "Histogramme";
+constexpr static char esHistogramTab[] = "Histograma";
+constexpr static char deHistogramTab[] = "Histogramm";
+constexpr static char ptHistogramTab[] = "Histograma";
+constexpr static char enHyperbolicCosine[] = "Hyperbolic cosine";
+constexpr static char frHyperbolicCosine[] = "Cosinus hyperbolique";
+constexpr static char esHyperbolicCosine[] = "Coseno hiperbólico";
+constexpr static char deHyperbolicCosine[] = "Kosinus hyperbolicus";
+constexpr static char ptHyperbolicCosine[] = "Cosseno hiperbólico";
+constexpr static char enHyperbolicSine[] = "Hyperbolic sine";
+constexpr static char frHyperbolicSine[] = "Sinus hyperbolique";
+constexpr static char esHyperbolicSine[] = "Seno hiperbólico";
+constexpr static char deHyperbolicSine[] = "Sinus hyperbolicus";
+constexpr static char ptHyperbolicSine[] = "Seno hiperbólico";
+constexpr static char enHyperbolicTangent[] = "Hyperbolic tangent";
+constexpr static char frHyperbolicTangent[] = "Tangente hyperbolique";
+constexpr static char esHyperbolicTangent[] = "Tangente hiperbòlica";
+constexpr static char deHyperbolicTangent[] = "Tangens hyperbolicus";
+constexpr static char ptHyperbolicTangent[] = "Tangente hiperbólica";
+constexpr static char enHyperbolicTrigonometry[] = "Hyperbolic trigonometry";
+constexpr static char frHyperbolicTrigonometry[] = "Trigonométrie hyperbolique";
+constexpr static char esHyperbolicTrigonometry[] = "Trigonometría hiperbólica";
+constexpr static char deHyperbolicTrigonometry[] = "Hyperbelfunktionen";
+constexpr static char ptHyperbolicTrigonometry[] = "Funções hiperbólicas";
+constexpr static char enIdentity[] = "Identity matrix of size n";
+constexpr static char frIdentity[] = "Matrice identité de taille n";
+constexpr static char esIdentity[] = "Matriz identidad de tamaño n";
+constexpr static char deIdentity[] = "Einheitsmatrix der Größe n";
+constexpr static char ptIdentity[] = "Matriz identidade de ordem n";
+constexpr static char enImaginaryPart[] = "Imaginary part";
+constexpr static char frImaginaryPart[] = "Partie imaginaire";
+constexpr static char esImaginaryPart[] = "Parte imaginaria";
+constexpr static char deImaginaryPart[] = "Imaginärteil";
+constexpr static char ptImaginaryPart[] = "Parte imaginária";
+constexpr static char enImportList[] = "Import from a list";
+constexpr static char frImportList[] = "Importer une liste";
+constexpr static char esImportList[] = "Importar una lista";
+constexpr static char deImportList[] = "Laden einer Liste";
+constexpr static char ptImportList[] = "Importar de uma lista";
+constexpr static char enInductanceMenu[] = "Electrical inductance";
+constexpr static char frInductanceMenu[] = "Inductance";
+constexpr static char esInductanceMenu[] = "Electrical inductance";
+constexpr static char deInductanceMenu[] = "Electrical inductance";
+constexpr static char ptInductanceMenu[] = "Electrical inductance";
+constexpr static char enInfiniteNumberOfSolutions[] = "There are an infinite number of solutions";
+constexpr static char frInfiniteNumberOfSolutions[] = "Le système admet une infinité de solutions";
+constexpr static char esInfiniteNumberOfSolutions[] = "Hay un número infinito de soluciones";
+constexpr static char deInfiniteNumberOfSolutions[] = "Es gibt unendlich viele Lösungen";
+constexpr static char ptInfiniteNumberOfSolutions[] = "Existe uma infinidade de soluções";
+constexpr static char enInitialization[] = "Preadjustment";
+constexpr static char frInitialization[] = "Initialisation";
+constexpr static char esInitialization[] = "Inicialización";
+constexpr static char deInitialization[] = "Initialisierung";
+constexpr static char ptInitialization[] = "Inicialização";
+constexpr static char enIntegral[] = "Integral";
+constexpr static char frIntegral[] = "Intégrale";
+constexpr static char esIntegral[] = "Integral";
+constexpr static char deIntegral[] = "Integral";
+constexpr static char ptIntegral[] = "Integral";
+constexpr static char enInterquartileRange[] = "Interquartile range";
+constexpr static char frInterquartileRange[] = "Ecart interquartile";
+constexpr static char esInterquartileRange[] = "Rango intercuartilo";
+constexpr static char deInterquartileRange[] = "Interquartilsabstand";
+constexpr static char ptInterquartileRange[] = "Interquartil";
+constexpr static char enIntersection[] = "Intersection";
+constexpr static char frIntersection[] = "Intersection";
+constexpr static char esIntersection[] = "Intersección";
+constexpr static char deIntersection[] = "Schnittmenge";
+constexpr static char ptIntersection[] = "Intersecção";
+constexpr static char enInterval[] = " Interval ";
+constexpr static char frInterval[] = " Intervalle ";
+constexpr static char esInterval[] = " Intervalo";
+constexpr static char deInterval[] = " Intervall";
+constexpr static char ptInterval[] = " Intervalo";
+constexpr static char enIntervalDefinition[] = "[a,b]: Interval";
+constexpr static char frIntervalDefinition[] = "[a,b] : Intervalle";
+constexpr static char esIntervalDefinition[] = "[a,b] : Intervalo";
+constexpr static char deIntervalDefinition[] = "[a,b]: Intervall";
+constexpr static char ptIntervalDefinition[] = "[a,b] : Intervalo";
+constexpr static char enIntervalSet[] = "Set the interval";
+constexpr static char frIntervalSet[] = "Régler l'intervalle";
+constexpr static char esIntervalSet[] = "Ajustar el intervalo";
+constexpr static char deIntervalSet[] = "Intervall einstellen";
+constexpr static char ptIntervalSet[] = "Ajustar o intervalo";
+constexpr static char enIntervalT[] = "t interval";
+constexpr static char frIntervalT[] = "Intervalle t";
+constexpr static char esIntervalT[] = "Intervalo t";
+constexpr static char deIntervalT[] = "t-te Intervall";
+constexpr static char ptIntervalT[] = "Intervalo t";
+constexpr static char enIntervalTheta[] = "θ interval";
+constexpr static char frIntervalTheta[] = "Intervalle θ";
+constexpr static char esIntervalTheta[] = "Intervalo θ";
+constexpr static char deIntervalTheta[] = "θ-te Intervall";
+constexpr static char ptIntervalTheta[] = "Intervalo θ";
+constexpr static char enIntervalX[] = "x interval";
+constexpr static char frIntervalX[] = "Intervalle x";
+constexpr static char esIntervalX[] = "Intervalo x";
+constexpr static char deIntervalX[] = "x-te Intervall";
+constexpr static char ptIntervalX[] = "Intervalo x";
+constexpr static char enInvBinomial[] = "m where P(X<=m)=a, X follows B(n,p)";
+constexpr static char frInvBinomial[] = "m où P(X<=m)=a et X suit B(n,p)";
+constexpr static char esInvBinomial[] = "m donde P(X<=m)=a y X sigue B(n,p)";
+constexpr static char deInvBinomial[] = "m wo P(X<=m)=a und X folgt B(n,p)";
+constexpr static char ptInvBinomial[] = "m onde P(X<=m)=a e X segue B(n,p)";
+constexpr static char enInvNorm[] = "m where P(X<m)=a, X follows N(μ,σ2)";
+constexpr static char frInvNorm[] = "m où P(X<m)=a et X suit N(μ,σ2)";
+constexpr static char esInvNorm[] = "m donde P(X<m)=a y X sigue N(μ,σ2)";
+constexpr static char deInvNorm[] = "m wo P(X<m)=a und X folgt N(μ,σ2)";
+constexpr static char ptInvNorm[] = "m onde P(X<m)=a e X segue N(μ,σ2)";
+constexpr static char enInvSort[] = "Sort descending";
+constexpr static char frInvSort[] = "Tri décroissant";
+constexpr static char esInvSort[] = "Clasificación descendente";
+constexpr static char deInvSort[] = "Sortieren absteigend";
+constexpr static char ptInvSort[] = "Ordem decrescente";
+constexpr static char enInverse[] = "Inverse";
+constexpr static char frInverse[] = "Inverse";
+constexpr static char esInverse[] = "Inversa";
+constexpr static char deInverse[] = "Inverse";
+constexpr static char ptInverse[] = "Matriz inversa";
+constexpr static char enInverseHyperbolicCosine[] = "Inverse hyperbolic cosine";
+constexpr static char frInverseHyperbolicCosine[] = "Argument cosinus hyperbolique";
+constexpr static char esInverseHyperbolicCosine[] = "Argumento coseno hiperbólico";
+constexpr static char deInverseHyperbolicCosine[] = "Areakosinus hyperbolicus";
+constexpr static char ptInverseHyperbolicCosine[] = "Arco cosseno hiperbólico";
+constexpr static char enInverseHyperbolicSine[] = "Inverse hyperbolic sine";
+constexpr static char frInverseHyperbolicSine[] = "Argument sinus hyperbolique";
+constexpr static char esInverseHyperbolicSine[] = "Argumento seno hiperbólico";
+constexpr static char deInverseHyperbolicSine[] = "Areasinus hyperbolicus";
+constexpr static char ptInverseHyperbolicSine[] = "Arco seno hiperbólico";
+constexpr static char enInverseHyperbolicTangent[] = "Inverse hyperbolic tangent";
+constexpr static char frInverseHyperbolicTangent[] = "Argument tangente hyperbolique";
+constexpr static char esInverseHyperbolicTangent[] = "Argumento tangente hiperbólica";
+constexpr static char deInverseHyperbolicTangent[] = "Areatangens hyperbolicus";
+constexpr static char ptInverseHyperbolicTangent[] = "Arco tangente hiperbólica";
+constexpr static char enLambdaExponentialDefinition[] = "λ: Rate parameter";
+constexpr static char frLambdaExponentialDefinition[] = "λ : Paramètre";
+constexpr static char esLambdaExponentialDefinition[] = "λ : Parámetro";
+constexpr static char deLambdaExponentialDefinition[] = "λ: Parameter";
+constexpr static char ptLambdaExponentialDefinition[] = "λ : Parâmetro";
+constexpr static char enLambdaPoissonDefinition[] = "λ: Parameter";
+constexpr static char frLambdaPoissonDefinition[] = "λ : Paramètre";
+constexpr static char esLambdaPoissonDefinition[] = "λ : Parámetro";
+constexpr static char deLambdaPoissonDefinition[] = "λ: Parameter";
+constexpr static char ptLambdaPoissonDefinition[] = "λ : Parâmetro";
+constexpr static char enLanguage[] = "Language";
+constexpr static char frLanguage[] = "Langue";
+constexpr static char esLanguage[] = "Idioma";
+constexpr static char deLanguage[] = "Sprache";
+constexpr static char ptLanguage[] = "Idioma";
+constexpr static char enLargeFont[] = "Large ";
+constexpr static char frLargeFont[] = "Grand ";
+constexpr static char esLargeFont[] = "Grande ";
+constexpr static char deLargeFont[] = "Große ";
+constexpr static char ptLargeFont[] = "Grande ";
+constexpr static char enLeastCommonMultiple[] = "LCM";
+constexpr static char frLeastCommonMultiple[] = "PPCM";
+constexpr static char esLeastCommonMultiple[] = "MCM";
+constexpr static char deLeastCommonMultiple[] = "kgV";
+constexpr static char ptLeastCommonMultiple[] = "MMC";
+constexpr static char enLinear[] = "Linear";
+constexpr static char frLinear[] = "Linéaire";
+constexpr static char esLinear[] = "Lineal";
+constexpr static char deLinear[] = "Lineare";
+constexpr static char ptLinear[] = "Linear";
+constexpr static char enLists[] = "List";
+constexpr static char frLists[] = "Listes";
+constexpr static char esLists[] = "Listas";
+constexpr static char deLists[] = "Listen";
+constexpr static char ptLists[] = "Listas";
+constexpr static char enLogarithmic[] = "Logarithmic";
+constexpr static char frLogarithmic[] = "Logarithmique";
+constexpr static char esLogarithmic[] = "Logarítmica";
+constexpr static char deLogarithmic[] = "Logarithmische";
+constexpr static char ptLogarithmic[] = "Logarítmica";
+constexpr static char enLogistic[] = "Logistic";
+constexpr static char frLogistic[] = "Logistique";
+constexpr static char esLogistic[] = "Logística";
+constexpr static char deLogistic[] = "Logistische";
+constexpr static char ptLogistic[] = "Logística";
+constexpr static char enLoopsAndTests[] = "Loops and tests";
+constexpr static char frLoopsAndTests[] = "Boucles et tests";
+constexpr static char esLoopsAndTests[] = "Loops and tests";
+constexpr static char deLoopsAndTests[] = "Schleifen und Tests";
+constexpr static char ptLoopsAndTests[] = "Loops and tests";
+constexpr static char enLowBattery[] = "Low battery";
+constexpr static char frLowBattery[] = "Batterie faible";
+constexpr static char esLowBattery[] = "Batería baja";
+constexpr static char deLowBattery[] = "Batterie erschöpft";
+constexpr static char ptLowBattery[] = "Bateria fraca";
+constexpr static char enMatrices[] = "Matrix";
+constexpr static char frMatrices[] = "Matrices";
+constexpr static char esMatrices[] = "Matriz";
+constexpr static char deMatrices[] = "Matrizen";
+constexpr static char ptMatrices[] = "Matrizes";
+constexpr static char enMaximum[] = "Maximum";
+constexpr static char frMaximum[] = "Maximum";
+constexpr static char esMaximum[] = "Máximo";
+constexpr static char deMaximum[] = "Maximalwert";
+constexpr static char ptMaximum[] = "Máximo";
+constexpr static char enMean[] = "Mean";
+constexpr static char frMean[] = "Moyenne";
+constexpr static char esMean[] = "Media";
+constexpr static char deMean[] = "Mittelwert";
+constexpr static char ptMean[] = "Média";
+constexpr static char enMeanDefinition[] = "μ: Mean";
+constexpr static char frMeanDefinition[] = "μ : Espérance ou moyenne";
+constexpr static char esMeanDefinition[] = "μ : Media";
+constexpr static char deMeanDefinition[] = "μ: Erwartungswert";
+constexpr static char ptMeanDefinition[] = "μ : Média";
+constexpr static char enMeanDot[] = "mean";
+constexpr static char frMeanDot[] = "moyen";
+constexpr static char esMeanDot[] = "media";
+constexpr static char deMeanDot[] = "mittel";
+constexpr static char ptMeanDot[] = "media";
+constexpr static char enMedian[] = "Median";
+constexpr static char frMedian[] = "Médiane";
+constexpr static char esMedian[] = "Mediana";
+constexpr static char deMedian[] = "Median";
+constexpr static char ptMedian[] = "Mediana";
+constexpr static char enMinimum[] = "Minimum";
+constexpr static char frMinimum[] = "Minimum";
+constexpr static char esMinimum[] = "Mínimo";
+constexpr static char deMinimum[] = "Mindestwert";
+constexpr static char ptMinimum[] = "Mínimo";
+constexpr static char enMixedFraction[] = "Mixed fraction";
+constexpr static char frMixedFraction[] = "Fraction mixte";
+constexpr static char esMixedFraction[] = "????";
+constexpr static char deMixedFraction[] = "????";
+constexpr static char ptMixedFraction[] = "????";
+constexpr static char enModules[] = "Modules";
+constexpr static char frModules[] = "Modules";
+constexpr static char esModules[] = "Modules";
+constexpr static char deModules[] = "Module";
+constexpr static char ptModules[] = "Modules";
+constexpr static char enMove[] = " Move: ";
+constexpr static char frMove[] = " Déplacer : ";
+constexpr static char esMove[] = " Mover : ";
+constexpr static char deMove[] = " Verschieben: ";
+constexpr static char ptMove[] = " Mover : ";
+constexpr static char enNColumn[] = "n column";
+constexpr static char frNColumn[] = "Colonne n";
+constexpr static char esNColumn[] = "Columna n";
+constexpr static char deNColumn[] = "n-te Spalte";
+constexpr static char ptNColumn[] = "Coluna n";
+constexpr static char enNEnd[] = "N end";
+constexpr static char frNEnd[] = "N fin";
+constexpr static char esNEnd[] = "N fin";
+constexpr static char deNEnd[] = "N Endwert";
+constexpr static char ptNEnd[] = "N fim";
+constexpr static char enNStart[] = "N start";
+constexpr static char frNStart[] = "N début";
+constexpr static char esNStart[] = "N inicio";
+constexpr static char deNStart[] = "N Startwert";
+constexpr static char ptNStart[] = "N inicio";
+constexpr static char enNameCannotStartWithNumber[] = "A name cannot start with a number";
+constexpr static char frNameCannotStartWithNumber[] = "Un nom ne peut pas commencer par un chiffre";
+constexpr static char esNameCannotStartWithNumber[] = "Un nombre no puede empezar con un número";
+constexpr static char deNameCannotStartWithNumber[] = "Ein Name darf nicht mit einer Zahl beginnen";
+constexpr static char ptNameCannotStartWithNumber[] = "Um nome não pode começar com um número";
+constexpr static char enNameTaken[] = "This name has already been taken";
+constexpr static char frNameTaken[] = "Ce nom est déjà utilisé";
+constexpr static char esNameTaken[] = "Este nombre ya está en uso";
+constexpr static char deNameTaken[] = "Dieser Name ist bereits vergeben";
+constexpr static char ptNameTaken[] = "Este nome é já usado";
+constexpr static char enNameTooLong[] = "This name is too long";
+constexpr static char frNameTooLong[] = "Ce nom est trop long";
+constexpr static char esNameTooLong[] = "Este nombre es demasiado largo";
+constexpr static char deNameTooLong[] = "Der Name ist zu lang";
+constexpr static char ptNameTooLong[] = "Este nome é muito longo";
+constexpr static char enNewMatrix[] = "New matrix";
+constexpr static char frNewMatrix[] = "Nouvelle matrice";
+constexpr static char esNewMatrix[] = "Nueva matriz";
+constexpr static char deNewMatrix[] = "Neue Matrix";
+constexpr static char ptNewMatrix[] = "Nova matriz";
+constexpr static char enNext[] = "Next";
+constexpr static char frNext[] = "Suivant";
+constexpr static char esNext[] = "Siguiente";
+constexpr static char deNext[] = "Nächste";
+constexpr static char ptNext[] = "Seguinte";
+constexpr static char enNoActivatedFunction[] = "No function is turned on";
+constexpr static char frNoActivatedFunction[] = "Aucune fonction activée";
+constexpr static char esNoActivatedFunction[] = "Ninguna función activada";
+constexpr static char deNoActivatedFunction[] = "Keine aktive Funktion";
+constexpr static char ptNoActivatedFunction[] = "Sem função activada";
+constexpr static char enNoActivatedSequence[] = "No sequence is turned on";
+constexpr static char frNoActivatedSequence[] = "Aucune suite activée";
+constexpr static char esNoActivatedSequence[] = "Ninguna sucesión activada";
+constexpr static char deNoActivatedSequence[] = "Keine aktive Folge";
+constexpr static char ptNoActivatedSequence[] = "Sem sequência activada";
+constexpr static char enNoDataToPlot[] = "No data to draw";
+constexpr static char frNoDataToPlot[] = "Aucune donnée à tracer";
+constexpr static char esNoDataToPlot[] = "Ningunos datos que dibujar";
+constexpr static char deNoDataToPlot[] = "Keine Daten zum Zeichnen";
+constexpr static char ptNoDataToPlot[] = "Não ha dados para desenhar";
+constexpr static char enNoFunction[] = "No function";
+constexpr static char frNoFunction[] = "Aucune fonction";
+constexpr static char esNoFunction[] = "Ninguna función";
+constexpr static char deNoFunction[] = "Keine Funktion";
+constexpr static char ptNoFunction[] = "Nenhuma função";
+constexpr static char enNoFunctionToDelete[] = "No function to delete";
+constexpr static char frNoFunctionToDelete[] = "Pas de fonction à supprimer";
+constexpr static char esNoFunctionToDelete[] = "Ninguna función que eliminar";
+constexpr static char deNoFunctionToDelete[] = "Keine Funktion zum Löschen";
+constexpr static char ptNoFunctionToDelete[] = "Sem função para eliminar";
+constexpr static char enNoIntersectionFound[] = "No intersection found";
+constexpr static char frNoIntersectionFound[] = "Aucune intersection trouvée";
+constexpr static char esNoIntersectionFound[] = "Ninguna intersección encontrada";
+constexpr static char deNoIntersectionFound[] = "Kein Schnittpunkt gefunden";
+constexpr static char ptNoIntersectionFound[] = "Nenhuma intersecção encontrada";
+constexpr static char enNoMaximumFound[] = "No maximum found";
+constexpr static char frNoMaximumFound[] = "Aucun maximum trouvé";
+constexpr static char esNoMaximumFound[] = "Níngun máximo encontrado";
+constexpr static char deNoMaximumFound[] = "Kein Maximalwert gefunden";
+constexpr static char ptNoMaximumFound[] = "Nenhum máximo encontrado";
+constexpr static char enNoMinimumFound[] = "No minimum found";
+constexpr static char frNoMinimumFound[] = "Aucun minimum trouvé";
+constexpr static char esNoMinimumFound[] = "Níngun mínimo encontrado";
+constexpr static char deNoMinimumFound[] = "Kein Mindestwert gefunden";
+constexpr static char ptNoMinimumFound[] = "Nenhum mínimo encontrado";
+constexpr static char enNoPreimageFound[] = "No inverse image found";
+constexpr static char frNoPreimageFound[] = "Aucun antécédent trouvé";
+constexpr static char esNoPreimageFound[] = "Ninguna imagen inversa encontrada";
+constexpr static char deNoPreimageFound[] = "Kein Urbild gefunden";
+constexpr static char ptNoPreimageFound[] = "Nenhuma imagem inversa encontrada";
+constexpr static char enNoSequence[] = "No sequence";
+constexpr static char frNoSequence[] = "Aucune suite";
+constexpr static char esNoSequence[] = "Ninguna sucesión";
+constexpr static char deNoSequence[] = "Keine Folge";
+constexpr static char ptNoSequence[] = "Sem sequência";
+constexpr static char enNoSolutionEquation[] = "The equation has no solution";
+constexpr static char frNoSolutionEquation[] = "L'équation n'admet aucune solution";
+constexpr static char esNoSolutionEquation[] = "La ecuación no tiene solución";
+constexpr static char deNoSolutionEquation[] = "Die Gleichung hat keine Lösung";
+constexpr static char ptNoSolutionEquation[] = "A equação não tem solução";
+constexpr static char enNoSolutionInterval[] = "No solution found in the interval";
+constexpr static char frNoSolutionInterval[] = "Aucune solution trouvée dans cet intervalle";
+constexpr static char esNoSolutionInterval[] = "Ninguna solución encontrada en el intervalo";
+constexpr static char deNoSolutionInterval[] = "Keine Lösung im Intervall gefunden";
+constexpr static char ptNoSolutionInterval[] = "Nenhuma solução encontrada em el intervalo";
+constexpr static char enNoSolutionSystem[] = "The system has no solution";
+constexpr static char frNoSolutionSystem[] = "Le système n'admet aucune solution";
+constexpr static char esNoSolutionSystem[] = "El sistema no tiene solución";
+constexpr static char deNoSolutionSystem[] = "Das System hat keine Lösung";
+constexpr static char ptNoSolutionSystem[] = "O sistema não tem solução";
+constexpr static char enNoValueToCompute[] = "No values to calculate";
+constexpr static char frNoValueToCompute[] = "Aucune grandeur à calculer";
+constexpr static char esNoValueToCompute[] = "Ninguna medida que calcular";
+constexpr static char deNoValueToCompute[] = "Keine Größe zum Berechnen";
+constexpr static char ptNoValueToCompute[] = "Nenhuma quantidade para calcular";
+constexpr static char enNoZeroFound[] = "No zero found";
+constexpr static char frNoZeroFound[] = "Aucun zéro trouvé";
+constexpr static char esNoZeroFound[] = "Ninguna raíz encontrada";
+constexpr static char deNoZeroFound[] = "Keine Nullstelle gefunden";
+constexpr static char ptNoZeroFound[] = "Nenhuma raiz encontrada";
+constexpr static char enNonLinearSystem[] = "The system is not linear";
+constexpr static char frNonLinearSystem[] = "Le système n'est pas linéaire";
+constexpr static char esNonLinearSystem[] = "El sistema no es lineal";
+constexpr static char deNonLinearSystem[] = "Das System ist nicht linear";
+constexpr static char ptNonLinearSystem[] = "O sistema não é linear";
+constexpr static char enNormCDF[] = "P(X<a) where X follows N(μ,σ2)";
+constexpr static char frNormCDF[] = "P(X<a) où X suit N(μ,σ2)";
+constexpr static char esNormCDF[] = "P(X<a) donde X sigue N(μ,σ2)";
+constexpr static char deNormCDF[] = "P(X<a) wo X folgt N(μ,σ2)";
+constexpr static char ptNormCDF[] = "P(X<a) onde X segue N(μ,σ2)";
+constexpr static char enNormCDF2[] = "P(a<X<b) where X follows N(μ,σ2)";
+constexpr static char frNormCDF2[] = "P(a<X<b) où X suit N(μ,σ2)";
+constexpr static char esNormCDF2[] = "P(a<X<b) donde X sigue N(μ,σ2)";
+constexpr static char deNormCDF2[] = "P(a<X<b) wo X folgt N(μ,σ2)";
+constexpr static char ptNormCDF2[] = "P(a<X<b) onde X segue N(μ,σ2)";
+constexpr static char enNormPDF[] = "Probability density of N(μ,σ2)";
+constexpr static char frNormPDF[] = "Fonction densité N(μ,σ2)";
+constexpr static char esNormPDF[] = "Densidad de probabilidad de N(μ,σ2)";
+constexpr static char deNormPDF[] = "Wahrscheinlichkeitsdichte N(μ,σ2)";
+constexpr static char ptNormPDF[] = "Densidade de probabilidade de N(μ,σ2)";
+constexpr static char enNormal[] = "Normal";
+constexpr static char frNormal[] = "Normale";
+constexpr static char esNormal[] = "Normal";
+constexpr static char deNormal[] = "Normal";
+constexpr static char ptNormal[] = "Normal";
+constexpr static char enNormalDistribution[] = "Normal distribution";
+constexpr static char frNormalDistribution[] = "Loi normale";
+constexpr static char esNormalDistribution[] = "Distribución normal";
+constexpr static char deNormalDistribution[] = "Normalverteilung";
+constexpr static char ptNormalDistribution[] = "Distribuição normal";
+constexpr static char enNthRoot[] = "nth-root";
+constexpr static char frNthRoot[] = "Racine n-ième";
+constexpr static char esNthRoot[] = "Raíz enesima";
+constexpr static char deNthRoot[] = "n-te Wurzel";
+constexpr static char ptNthRoot[] = "Radiciacao";
+constexpr static char enNumberOfDots[] = "Number of points";
+constexpr static char frNumberOfDots[] = "Nombre de points";
+constexpr static char esNumberOfDots[] = "Número de puntos";
+constexpr static char deNumberOfDots[] = "Punktanzahl";
+constexpr static char ptNumberOfDots[] = "Número de pontos";
+constexpr static char enOk[] = "Confirm";
+constexpr static char frOk[] = "Valider";
+constexpr static char esOk[] = "Confirmar";
+constexpr static char deOk[] = "Bestätigen";
+constexpr static char ptOk[] = "Confirmar";
+constexpr static char enOnlyFirstSolutionsDisplayed0[] = "Only the first 10 solutions";
+constexpr static char frOnlyFirstSolutionsDisplayed0[] = "Seulement les 10 premières";
+constexpr static char esOnlyFirstSolutionsDisplayed0[] = "Sólo se muestran las";
+constexpr static char deOnlyFirstSolutionsDisplayed0[] = "Es werden nur die ersten";
+constexpr static char ptOnlyFirstSolutionsDisplayed0[] = "Somente as 10 primeiras";
+constexpr static char enOnlyFirstSolutionsDisplayed1[] = "are displayed";
+constexpr static char frOnlyFirstSolutionsDisplayed1[] = "solutions sont affichées";
+constexpr static char esOnlyFirstSolutionsDisplayed1[] = "10 primeras soluciones";
+constexpr static char deOnlyFirstSolutionsDisplayed1[] = "zehn Lösungen angezeigt.";
+constexpr static char ptOnlyFirstSolutionsDisplayed1[] = "soluções são exibidas";
+constexpr static char enOr[] = " or ";
+constexpr static char frOr[] = " ou ";
+constexpr static char esOr[] = " o ";
+constexpr static char deOr[] = " oder ";
+constexpr static char ptOr[] = " ou ";
+constexpr static char enOrthonormal[] = "Orthonormal";
+constexpr static char frOrthonormal[] = "Orthonormé";
+constexpr static char esOrthonormal[] = "Ortonormal";
+constexpr static char deOrthonormal[] = "Orthonormal";
+constexpr static char ptOrthonormal[] = "Ortonormado";
+constexpr static char enParametricType[] = "Parametric ";
+constexpr static char frParametricType[] = "Paramétrique ";
+constexpr static char esParametricType[] = "Paramétrico ";
+constexpr static char deParametricType[] = "Parameter ";
+constexpr static char ptParametricType[] = "Paramétrico ";
+constexpr static char enPermutation[] = "Permutation";
+constexpr static char frPermutation[] = "Arrangement";
+constexpr static char esPermutation[] = "Variación";
+constexpr static char dePermutation[] = "Permutation";
+constexpr static char ptPermutation[] = "Permutação";
+constexpr static char enPlot[] = "Plot graph";
+constexpr static char frPlot[] = "Tracer le graphique";
+constexpr static char esPlot[] = "Dibujar el gráfico";
+constexpr static char dePlot[] = "Graphen zeichnen";
+constexpr static char ptPlot[] = "Traçar o gráfico";
+constexpr static char enPlotOptions[] = "Plot options";
+constexpr static char frPlotOptions[] = "Options de la courbe";
+constexpr static char esPlotOptions[] = "Opciones de la curva";
+constexpr static char dePlotOptions[] = "Plotoptionen";
+constexpr static char ptPlotOptions[] = "Opções da curva";
+constexpr static char enPoissonDistribution[] = "Poisson distribution";
+constexpr static char frPoissonDistribution[] = "Loi de Poisson";
+constexpr static char esPoissonDistribution[] = "Distribución de Poisson";
+constexpr static char dePoissonDistribution[] = "Poisson-Verteilung";
+constexpr static char ptPoissonDistribution[] = "Distribuição de Poisson";
+constexpr static char enPolar[] = "Polar ";
+constexpr static char frPolar[] = "Exponentielle ";
+constexpr static char esPolar[] = "Polar ";
+constexpr static char dePolar[] = "Polar ";
+constexpr static char ptPolar[] = "Polar ";
+constexpr static char enPolarType[] = "Polar ";
+constexpr static char frPolarType[] = "Polaire ";
+constexpr static char esPolarType[] = "Polar ";
+constexpr static char dePolarType[] = "Polar ";
+constexpr static char ptPolarType[] = "Polar ";
+constexpr static char enPolynomeHasNoRealSolution0[] = "The polynomial has no";
+constexpr static char frPolynomeHasNoRealSolution0[] = "Le polynôme n'admet pas";
+constexpr static char esPolynomeHasNoRealSolution0[] = "El polinomio no tiene";
+constexpr static char dePolynomeHasNoRealSolution0[] = "Das Polynom hat";
+constexpr static char ptPolynomeHasNoRealSolution0[] = "O polinômio não tem";
+constexpr static char enPolynomeHasNoRealSolution1[] = "real root";
+constexpr static char frPolynomeHasNoRealSolution1[] = "de racine réelle";
+constexpr static char esPolynomeHasNoRealSolution1[] = "ninguna raíz real";
+constexpr static char dePolynomeHasNoRealSolution1[] = "keine reelle Nullstelle";
+constexpr static char ptPolynomeHasNoRealSolution1[] = "nenhuma raiz real";
+constexpr static char enPoolMemoryFull1[] = "The working memory is full.";
+constexpr static char frPoolMemoryFull1[] = "La mémoire de travail est pleine.";
+constexpr static char esPoolMemoryFull1[] = "La memoria de trabajo está llena.";
+constexpr static char dePoolMemoryFull1[] = "Der Arbeitsspeicher ist voll.";
+constexpr static char ptPoolMemoryFull1[] = "A memória de trabalho está cheia.";
+constexpr static char enPoolMemoryFull2[] = "Try again.";
+constexpr static char frPoolMemoryFull2[] = "Réessayez.";
+constexpr static char esPoolMemoryFull2[] = "Intente de nuevo.";
+constexpr static char dePoolMemoryFull2[] = "Versuchen Sie es erneut.";
+constexpr static char ptPoolMemoryFull2[] = "Tente novamente.";
+constexpr static char enPower[] = "Power";
+constexpr static char frPower[] = "Puissance";
+constexpr static char esPower[] = "Potencial";
+constexpr static char dePower[] = "Potenz";
+constexpr static char ptPower[] = "Potência";
+constexpr static char enPredefinedVariablesIgnoredLeft[] = "Ignored";
+constexpr static char frPredefinedVariablesIgnoredLeft[] = "Variable";
+constexpr static char esPredefinedVariablesIgnoredLeft[] = "Variables";
+constexpr static char dePredefinedVariablesIgnoredLeft[] = "Ignoriert";
+constexpr static char ptPredefinedVariablesIgnoredLeft[] = "Variáveis";
+constexpr static char enPredefinedVariablesIgnoredRight[] = " predefined variables";
+constexpr static char frPredefinedVariablesIgnoredRight[] = "s prédéfinies ignorées";
+constexpr static char esPredefinedVariablesIgnoredRight[] = " predefinidas ignoradas";
+constexpr static char dePredefinedVariablesIgnoredRight[] = " vordefinierte Variablen";
+constexpr static char ptPredefinedVariablesIgnoredRight[] = " pré-definidas ignoradas";
+constexpr static char enPredefinedVariablesUsedLeft[] = "Used ";
+constexpr static char frPredefinedVariablesUsedLeft[] = "Variable";
+constexpr static char esPredefinedVariablesUsedLeft[] = "Variables";
+constexpr static char dePredefinedVariablesUsedLeft[] = "Verwendete";
+constexpr static char ptPredefinedVariablesUsedLeft[] = "Variáveis ";
+constexpr static char enPredefinedVariablesUsedRight[] = "predefined variables";
+constexpr static char frPredefinedVariablesUsedRight[] = "s prédéfinies utilisées";
+constexpr static char esPredefinedVariablesUsedRight[] = " predefinidas utilizadas";
+constexpr static char dePredefinedVariablesUsedRight[] = " vordefinierte Variablen";
+constexpr static char ptPredefinedVariablesUsedRight[] = "pré-definidas utilizadas";
+constexpr static char enPrediction[] = "Simple prediction interval";
+constexpr static char frPrediction[] = "Intervalle fluctuation simple (2de)";
+constexpr static char esPrediction[] = "Intervalo de predicción simple";
+constexpr static char dePrediction[] = "Einfacher Schwankungsbereich";
+constexpr static char ptPrediction[] = "Intervalo de previsão simples";
+constexpr static char enPrediction95[] = "Prediction interval 95%";
+constexpr static char frPrediction95[] = "Intervalle fluctuation 95% (Term)";
+constexpr static char esPrediction95[] = "Intervalo de predicción 95%";
+constexpr static char dePrediction95[] = "Schwankungsbereich 95%";
+constexpr static char ptPrediction95[] = "Intervalo de previsão 95%";
+constexpr static char enPreimage[] = "Inverse image";
+constexpr static char frPreimage[] = "Antécédent";
+constexpr static char esPreimage[] = "Imagen inversa";
+constexpr static char dePreimage[] = "Urbild";
+constexpr static char ptPreimage[] = "Imagem inversa";
+constexpr static char enPrimeFactorDecomposition[] = "Integer factorization";
+constexpr static char frPrimeFactorDecomposition[] = "Décomposition en facteurs premiers";
+constexpr static char esPrimeFactorDecomposition[] = "Factorización de enteros";
+constexpr static char dePrimeFactorDecomposition[] = "Primfaktorzerlegung";
+constexpr static char ptPrimeFactorDecomposition[] = "Fatorização de inteiros";
+constexpr static char enPrimeFactors[] = "Prime factors";
+constexpr static char frPrimeFactors[] = "Facteurs premiers";
+constexpr static char esPrimeFactors[] = "????";
+constexpr static char dePrimeFactors[] = "????";
+constexpr static char ptPrimeFactors[] = "????";
+constexpr static char enProbaApp[] = "Probability";
+constexpr static char frProbaApp[] = "Probabilités";
+constexpr static char esProbaApp[] = "Probabilidad";
+constexpr static char deProbaApp[] = "Wahrsch.";
+constexpr static char ptProbaApp[] = "Probabilidade";
+constexpr static char enProbaAppCapital[] = "PROBABILITY";
+constexpr static char frProbaAppCapital[] = "PROBABILITES";
+constexpr static char esProbaAppCapital[] = "PROBABILIDAD";
+constexpr static char deProbaAppCapital[] = "WAHRSCHEINLICHKEIT";
+constexpr static char ptProbaAppCapital[] = "PROBABILIDADE";
+constexpr static char enProbability[] = "Probability";
+constexpr static char frProbability[] = "Probabilités";
+constexpr static char esProbability[] = "Probabilidad";
+constexpr static char deProbability[] = "Wahrscheinlichkeit";
+constexpr static char ptProbability[] = "Probabilidade";
+constexpr static char enProduct[] = "Product";
+constexpr static char frProduct[] = "Produit";
+constexpr static char esProduct[] = "Productorio";
+constexpr static char deProduct[] = "Produkt";
+constexpr static char ptProduct[] = "Produto";
+constexpr static char enPython1J[] = "Imaginary i";
+constexpr static char frPython1J[] = "i complexe";
+constexpr static char esPython1J[] = "Imaginary i";
+constexpr static char dePython1J[] = "Imaginäres i";
+constexpr static char ptPython1J[] = "Imaginary i";
+constexpr static char enPythonAbs[] = "Absolute value/Magnitude";
+constexpr static char frPythonAbs[] = "Valeur absolue/Module";
+constexpr static char esPythonAbs[] = "Absolute value/Magnitude";
+constexpr static char dePythonAbs[] = "Absolute/r Wert/Größe";
+constexpr static char ptPythonAbs[] = "Absolute value/Magnitude";
+constexpr static char enPythonAcos[] = "Arc cosine";
+constexpr static char frPythonAcos[] = "Arc cosinus";
+constexpr static char esPythonAcos[] = "Arc cosine";
+constexpr static char dePythonAcos[] = "Arkuskosinus";
+constexpr static char ptPythonAcos[] = "Arc cosine";
+constexpr static char enPythonAcosh[] = "Arc hyperbolic cosine";
+constexpr static char frPythonAcosh[] = "Arc cosinus hyperbolique";
+constexpr static char esPythonAcosh[] = "Arc hyperbolic cosine";
+constexpr static char dePythonAcosh[] = "Hyperbelkosinus";
+constexpr static char ptPythonAcosh[] = "Arc hyperbolic cosine";
+constexpr static char enPythonAmpersand[] = "Bitwise and";
+constexpr static char frPythonAmpersand[] = "Et logique";
+constexpr static char esPythonAmpersand[] = "Bitwise and";
+constexpr static char dePythonAmpersand[] = "Bitweise und";
+constexpr static char ptPythonAmpersand[] = "Bitwise and";
+constexpr static char enPythonAppend[] = "Add x to the end of the list";
+constexpr static char frPythonAppend[] = "Insère x à la fin de la liste";
+constexpr static char esPythonAppend[] = "Add x to the end of the list";
+constexpr static char dePythonAppend[] = "Add x to the end of the list";
+constexpr static char ptPythonAppend[] = "Add x to the end of the list";
+constexpr static char enPythonAsin[] = "Arc sine";
+constexpr static char frPythonAsin[] = "Arc sinus";
+constexpr static char esPythonAsin[] = "Arc sine";
+constexpr static char dePythonAsin[] = "Arkussinus";
+constexpr static char ptPythonAsin[] = "Arc sine";
+constexpr static char enPythonAsinh[] = "Arc hyperbolic sine";
+constexpr static char frPythonAsinh[] = "Arc sinus hyperbolique";
+constexpr static char esPythonAsinh[] = "Arc hyperbolic sine";
+constexpr static char dePythonAsinh[] = "Hyperbelsinus";
+constexpr static char ptPythonAsinh[] = "Arc hyperbolic sine";
+constexpr static char enPythonAtan[] = "Arc tangent";
+constexpr static char frPythonAtan[] = "Arc tangente";
+constexpr static char esPythonAtan[] = "Arc tangent";
+constexpr static char dePythonAtan[] = "Arkustangens";
+constexpr static char ptPythonAtan[] = "Arc tangent";
+constexpr static char enPythonAtan2[] = "Return atan(y/x)";
+constexpr static char frPythonAtan2[] = "Calcul de atan(y/x)";
+constexpr static char esPythonAtan2[] = "Return atan(y/x)";
+constexpr static char dePythonAtan2[] = "Gib atan(y/x)";
+constexpr static char ptPythonAtan2[] = "Return atan(y/x)";
+constexpr static char enPythonAtanh[] = "Arc hyperbolic tangent";
+constexpr static char frPythonAtanh[] = "Arc tangente hyperbolique";
+constexpr static char esPythonAtanh[] = "Arc hyperbolic tangent";
+constexpr static char dePythonAtanh[] = "Hyperbeltangens";
+constexpr static char ptPythonAtanh[] = "Arc hyperbolic tangent";
+constexpr static char enPythonBin[] = "Convert integer to binary";
+constexpr static char frPythonBin[] = "Conversion d'un entier en binaire";
+constexpr static char esPythonBin[] = "Convert integer to binary";
+constexpr static char dePythonBin[] = "Ganzzahl nach binär konvertieren";
+constexpr static char ptPythonBin[] = "Convert integer to binary";
+constexpr static char enPythonCeil[] = "Ceiling";
+constexpr static char frPythonCeil[] = "Plafond";
+constexpr static char esPythonCeil[] = "Ceiling";
+constexpr static char dePythonCeil[] = "Aufrundung";
+constexpr static char ptPythonCeil[] = "Ceiling";
+constexpr static char enPythonChoice[] = "Random number in the list";
+constexpr static char frPythonChoice[] = "Nombre aléatoire dans la liste";
+constexpr static char esPythonChoice[] = "Random number in the list";
+constexpr static char dePythonChoice[] = "Zufallszahl aus der Liste";
+constexpr static char ptPythonChoice[] = "Random number in the list";
+constexpr static char enPythonClear[] = "Empty the list";
+constexpr static char frPythonClear[] = "Vide la liste";
+constexpr static char esPythonClear[] = "Empty the list";
+constexpr static char dePythonClear[] = "Empty the list";
+constexpr static char ptPythonClear[] = "Empty the list";
+constexpr static char enPythonCmathFunction[] = "cmath module function prefix";
+constexpr static char frPythonCmathFunction[] = "Préfixe fonction du module cmath";
+constexpr static char esPythonCmathFunction[] = "cmath module function prefix";
+constexpr static char dePythonCmathFunction[] = "cmath-Modul-Funktionspräfix";
+constexpr static char ptPythonCmathFunction[] = "cmath module function prefix";
+constexpr static char enPythonColor[] = "Define a rgb color";
+constexpr static char frPythonColor[] = "Définit une couleur rvb";
+constexpr static char esPythonColor[] = "Define a rgb color";
+constexpr static char dePythonColor[] = "Definiere eine RGB-Farbe";
+constexpr static char ptPythonColor[] = "Define a rgb color";
+constexpr static char enPythonComplex[] = "Return a+ib";
+constexpr static char frPythonComplex[] = "Renvoie a+ib";
+constexpr static char esPythonComplex[] = "Return a+ib";
+constexpr static char dePythonComplex[] = "a+ib zurückgeben";
+constexpr static char ptPythonComplex[] = "Return a+ib";
+constexpr static char enPythonCopySign[] = "Return x with the sign of y";
+constexpr static char frPythonCopySign[] = "Renvoie x avec le signe de y";
+constexpr static char esPythonCopySign[] = "Return x with the sign of y";
+constexpr static char dePythonCopySign[] = "Return x with the sign of y";
+constexpr static char ptPythonCopySign[] = "Return x with the sign of y";
+constexpr static char enPythonCos[] = "Cosine";
+constexpr static char frPythonCos[] = "Cosinus";
+constexpr static char esPythonCos[] = "Cosine";
+constexpr static char dePythonCos[] = "Kosinus";
+constexpr static char ptPythonCos[] = "Cosine";
+constexpr static char enPythonCosh[] = "Hyperbolic cosine";
+constexpr static char frPythonCosh[] = "Cosinus hyperbolique";
+constexpr static char esPythonCosh[] = "Hyperbolic cosine";
+constexpr static char dePythonCosh[] = "Hyperbolic cosine";
+constexpr static char ptPythonCosh[] = "Hyperbolic cosine";
+constexpr static char enPythonCount[] = "Count the occurrences of x";
+constexpr static char frPythonCount[] = "Compte les occurrences de x";
+constexpr static char esPythonCount[] = "Count the occurrences of x";
+constexpr static char dePythonCount[] = "Count the occurrences of x";
+constexpr static char ptPythonCount[] = "Count the occurrences of x";
+constexpr static char enPythonDegrees[] = "Convert x from radians to degrees";
+constexpr static char frPythonDegrees[] = "Conversion de radians en degrés";
+constexpr static char esPythonDegrees[] = "Convert x from radians to degrees";
+constexpr static char dePythonDegrees[] = "Convert x from radians to degrees";
+constexpr static char ptPythonDegrees[] = "Convert x from radians to degrees";
+constexpr static char enPythonDivMod[] = "Quotient and remainder";
+constexpr static char frPythonDivMod[] = "Quotient et reste";
+constexpr static char esPythonDivMod[] = "Quotient and remainder";
+constexpr static char dePythonDivMod[] = "Quotient and remainder";
+constexpr static char ptPythonDivMod[] = "Quotient and remainder";
+constexpr static char enPythonDrawString[] = "Display a text from pixel (x,y)";
+constexpr static char frPythonDrawString[] = "Affiche un texte au pixel (x,y)";
+constexpr static char esPythonDrawString[] = "Display a text from pixel (x,y)";
+constexpr static char dePythonDrawString[] = "Display a text from pixel (x,y)";
+constexpr static char ptPythonDrawString[] = "Display a text from pixel (x,y)";
+constexpr static char enPythonErf[] = "Error function";
+constexpr static char frPythonErf[] = "Fonction d'erreur";
+constexpr static char esPythonErf[] = "Error function";
+constexpr static char dePythonErf[] = "Error function";
+constexpr static char ptPythonErf[] = "Error function";
+constexpr static char enPythonErfc[] = "Complementary error function";
+constexpr static char frPythonErfc[] = "Fonction d'erreur complémentaire";
+constexpr static char esPythonErfc[] = "Complementary error function";
+constexpr static char dePythonErfc[] = "Complementary error function";
+constexpr static char ptPythonErfc[] = "Complementary error function";
+constexpr static char enPythonEval[] = "Return the evaluated expression";
+constexpr static char frPythonEval[] = "Evalue l'expression en argument ";
+constexpr static char esPythonEval[] = "Return the evaluated expression";
+constexpr static char dePythonEval[] = "Return the evaluated expression";
+constexpr static char ptPythonEval[] = "Return the evaluated expression";
+constexpr static char enPythonExp[] = "Exponential function";
+constexpr static char frPythonExp[] = "Fonction exponentielle";
+constexpr static char esPythonExp[] = "Exponential function";
+constexpr static char dePythonExp[] = "Exponential function";
+constexpr static char ptPythonExp[] = "Exponential function";
+constexpr static char enPythonExpm1[] = "Compute exp(x)-1";
+constexpr static char frPythonExpm1[] = "Calcul de exp(x)-1";
+constexpr static char esPythonExpm1[] = "Compute exp(x)-1";
+constexpr static char dePythonExpm1[] = "Compute exp(x)-1";
+constexpr static char ptPythonExpm1[] = "Compute exp(x)-1";
+constexpr static char enPythonFabs[] = "Absolute value";
+constexpr static char frPythonFabs[] = "Valeur absolue";
+constexpr static char esPythonFabs[] = "Absolute value";
+constexpr static char dePythonFabs[] = "Absolute value";
+constexpr static char ptPythonFabs[] = "Absolute value";
+constexpr static char enPythonFillRect[] = "Fill a rectangle at pixel (x,y)";
+constexpr static char frPythonFillRect[] = "Remplit un rectangle";
+constexpr static char esPythonFillRect[] = "Fill a rectangle at pixel (x,y)";
+constexpr static char dePythonFillRect[] = "Fill a rectangle at pixel (x,y)";
+constexpr static char ptPythonFillRect[] = "Fill a rectangle at pixel (x,y)";
+constexpr static char enPythonFloat[] = "Convert x to a float";
+constexpr static char frPythonFloat[] = "Conversion en flottant";
+constexpr static char esPythonFloat[] = "Convert x to a float";
+constexpr static char dePythonFloat[] = "Convert x to a float";
+constexpr static char ptPythonFloat[] = "Convert x to a float";
+constexpr static char enPythonFloor[] = "Floor";
+constexpr static char frPythonFloor[] = "Partie entière";
+constexpr static char esPythonFloor[] = "Floor";
+constexpr static char dePythonFloor[] = "Floor";
+constexpr static char ptPythonFloor[] = "Floor";
+constexpr static char enPythonFmod[] = "a modulo b";
+constexpr static char frPythonFmod[] = "a modulo b";
+constexpr static char esPythonFmod[] = "a modulo b";
+constexpr static char dePythonFmod[] = "a modulo b";
+constexpr static char ptPythonFmod[] = "a modulo b";
+constexpr static char enPythonFrExp[] = "Mantissa and exponent of x";
+constexpr static char frPythonFrExp[] = "Mantisse et exposant de x : (m,e)";
+constexpr static char esPythonFrExp[] = "Mantissa and exponent of x";
+constexpr static char dePythonFrExp[] = "Mantissa and exponent of x";
+constexpr static char ptPythonFrExp[] = "Mantissa and exponent of x";
+constexpr static char enPythonGamma[] = "Gamma function";
+constexpr static char frPythonGamma[] = "Fonction gamma";
+constexpr static char esPythonGamma[] = "Gamma function";
+constexpr static char dePythonGamma[] = "Gamma function";
+constexpr static char ptPythonGamma[] = "Gamma function";
+constexpr static char enPythonGetPixel[] = "Return pixel (x,y) color";
+constexpr static char frPythonGetPixel[] = "Renvoie la couleur du pixel (x,y)";
+constexpr static char esPythonGetPixel[] = "Return pixel (x,y) color";
+constexpr static char dePythonGetPixel[] = "Return pixel (x,y) color";
+constexpr static char ptPythonGetPixel[] = "Return pixel (x,y) color";
+constexpr static char enPythonGetrandbits[] = "Integer with k random bits";
+constexpr static char frPythonGetrandbits[] = "Nombre aléatoire sur k bits";
+constexpr static char esPythonGetrandbits[] = "Integer with k random bits";
+constexpr static char dePythonGetrandbits[] = "Integer with k random bits";
+constexpr static char ptPythonGetrandbits[] = "Integer with k random bits";
+constexpr static char enPythonHex[] = "Convert integer to hexadecimal";
+constexpr static char frPythonHex[] = "Conversion entier en hexadécimal";
+constexpr static char esPythonHex[] = "Convert integer to hexadecimal";
+constexpr static char dePythonHex[] = "Convert integer to hexadecimal";
+constexpr static char ptPythonHex[] = "Convert integer to hexadecimal";
+constexpr static char enPythonImag[] = "Imaginary part of z";
+constexpr static char frPythonImag[] = "Partie imaginaire de z";
+constexpr static char esPythonImag[] = "Imaginary part of z";
+constexpr static char dePythonImag[] = "Imaginärteil von z";
+constexpr static char ptPythonImag[] = "Imaginary part of z";
+constexpr static char enPythonImportCmath[] = "Import cmath module";
+constexpr static char frPythonImportCmath[] = "Importation du module cmath";
+constexpr static char esPythonImportCmath[] = "Import cmath module";
+constexpr static char dePythonImportCmath[] = "Import cmath module";
+constexpr static char ptPythonImportCmath[] = "Import cmath module";
+constexpr static char enPythonImportIon[] = "Import ion module";
+constexpr static char frPythonImportIon[] = "Importation du module ion";
+constexpr static char esPythonImportIon[] = "Import ion module";
+constexpr static char dePythonImportIon[] = "Import ion module";
+constexpr static char ptPythonImportIon[] = "Import ion module";
+constexpr static char enPythonImportKandinsky[] = "Import kandinsky module";
+constexpr static char frPythonImportKandinsky[] = "Importation du module kandinsky";
+constexpr static char esPythonImportKandinsky[] = "Import kandinsky module";
+constexpr static char dePythonImportKandinsky[] = "Import kandinsky module";
+constexpr static char ptPythonImportKandinsky[] = "Import kandinsky module";
+constexpr static char enPythonImportMath[] = "Import math module";
+constexpr static char frPythonImportMath[] = "Importation du module math";
+constexpr static char esPythonImportMath[] = "Import math module";
+constexpr static char dePythonImportMath[] = "Import math module";
+constexpr static char ptPythonImportMath[] = "Import math module";
+constexpr static char enPythonImportRandom[] = "Import random module";
+constexpr static char frPythonImportRandom[] = "Importation du module random";
+constexpr static char esPythonImportRandom[] = "Import random module";
+constexpr static char dePythonImportRandom[] = "Import random module";
+constexpr static char ptPythonImportRandom[] = "Import random module";
+constexpr static char enPythonImportTime[] = "Import time module";
+constexpr static char frPythonImportTime[] = "Importation du module time";
+constexpr static char esPythonImportTime[] = "Import time module";
+constexpr static char dePythonImportTime[] = "Import time module";
+constexpr static char ptPythonImportTime[] = "Import time module";
+constexpr static char enPythonImportTurtle[] = "Import turtle module";
+constexpr static char frPythonImportTurtle[] = "Importation du module turtle";
+constexpr static char esPythonImportTurtle[] = "Import turtle module";
+constexpr static char dePythonImportTurtle[] = "Import turtle module";
+constexpr static char ptPythonImportTurtle[] = "Import turtle module";
+constexpr static char enPythonIndex[] = "Index of the first x occurrence";
+constexpr static char frPythonIndex[] = "Indice première occurrence de x";
+constexpr static char esPythonIndex[] = "Index of the first x occurrence";
+constexpr static char dePythonIndex[] = "Index of the first x occurrence";
+constexpr static char ptPythonIndex[] = "Index of the first x occurrence";
+constexpr static char enPythonInput[] = "Prompt a value";
+constexpr static char frPythonInput[] = "Entrer une valeur";
+constexpr static char esPythonInput[] = "Prompt a value";
+constexpr static char dePythonInput[] = "Prompt a value";
+constexpr static char ptPythonInput[] = "Prompt a value";
+constexpr static char enPythonInsert[] = "Insert x at index i in the list";
+constexpr static char frPythonInsert[] = "Insère x en i-ème position";
+constexpr static char esPythonInsert[] = "Insert x at index i in the list";
+constexpr static char dePythonInsert[] = "Insert x at index i in the list";
+constexpr static char ptPythonInsert[] = "Insert x at index i in the list";
+constexpr static char enPythonInt[] = "Convert x to an integer";
+constexpr static char frPythonInt[] = "Conversion en entier";
+constexpr static char esPythonInt[] = "Convert x to an integer";
+constexpr static char dePythonInt[] = "Convert x to an integer";
+constexpr static char ptPythonInt[] = "Convert x to an integer";
+constexpr static char enPythonIonFunction[] = "ion module function prefix";
+constexpr static char frPythonIonFunction[] = "Préfixe fonction module ion";
+constexpr static char esPythonIonFunction[] = "ion module function prefix";
+constexpr static char dePythonIonFunction[] = "ion module function prefix";
+constexpr static char ptPythonIonFunction[] = "ion module function prefix";
+constexpr static char enPythonIsFinite[] = "Check if x is finite";
+constexpr static char frPythonIsFinite[] = "Teste si x est fini";
+constexpr static char esPythonIsFinite[] = "Check if x is finite";
+constexpr static char dePythonIsFinite[] = "Check if x is finite";
+constexpr static char ptPythonIsFinite[] = "Check if x is finite";
+constexpr static char enPythonIsInfinite[] = "Check if x is infinity";
+constexpr static char frPythonIsInfinite[] = "Teste si x est infini";
+constexpr static char esPythonIsInfinite[] = "Check if x is infinity";
+constexpr static char dePythonIsInfinite[] = "Check if x is infinity";
+constexpr static char ptPythonIsInfinite[] = "Check if x is infinity";
+constexpr static char enPythonIsKeyDown[] = "Return True if the k key is down";
+constexpr static char frPythonIsKeyDown[] = "Renvoie True si touche k enfoncée";
+constexpr static char esPythonIsKeyDown[] = "Return True if the k key is down";
+constexpr static char dePythonIsKeyDown[] = "Return True if the k key is down";
+constexpr static char ptPythonIsKeyDown[] = "Return True if the k key is down";
+constexpr static char enPythonIsNaN[] = "Check if x is a NaN";
+constexpr static char frPythonIsNaN[] = "Teste si x est NaN";
+constexpr static char esPythonIsNaN[] = "Check if x is a NaN";
+constexpr static char dePythonIsNaN[] = "Check if x is a NaN";
+constexpr static char ptPythonIsNaN[] = "Check if x is a NaN";
+constexpr static char enPythonKandinskyFunction[] = "kandinsky module function prefix";
+constexpr static char frPythonKandinskyFunction[] = "Préfixe fonction module kandinsky";
+constexpr static char esPythonKandinskyFunction[] = "kandinsky module function prefix";
+constexpr static char dePythonKandinskyFunction[] = "kandinsky module function prefix";
+constexpr static char ptPythonKandinskyFunction[] = "kandinsky module function prefix";
+constexpr static char enPythonKeyAlpha[] = "ALPHA key";
+constexpr static char frPythonKeyAlpha[] = "Touche ALPHA";
+constexpr static char esPythonKeyAlpha[] = "ALPHA key";
+constexpr static char dePythonKeyAlpha[] = "ALPHA key";
+constexpr static char ptPythonKeyAlpha[] = "ALPHA key";
+constexpr static char enPythonKeyAns[] = "ANS key";
+constexpr static char frPythonKeyAns[] = "Touche ANS";
+constexpr static char esPythonKeyAns[] = "ANS key";
+constexpr static char dePythonKeyAns[] = "ANS key";
+constexpr static char ptPythonKeyAns[] = "ANS key";
+constexpr static char enPythonKeyBack[] = "BACK key";
+constexpr static char frPythonKeyBack[] = "Touche RETOUR";
+constexpr static char esPythonKeyBack[] = "BACK key";
+constexpr static char dePythonKeyBack[] = "BACK key";
+constexpr static char ptPythonKeyBack[] = "BACK key";
+constexpr static char enPythonKeyBackspace[] = "BACKSPACE key";
+constexpr static char frPythonKeyBackspace[] = "Touche EFFACER";
+constexpr static char esPythonKeyBackspace[] = "BACKSPACE key";
+constexpr static char dePythonKeyBackspace[] = "BACKSPACE key";
+constexpr static char ptPythonKeyBackspace[] = "BACKSPACE key";
+constexpr static char enPythonKeyComma[] = "COMMA key";
+constexpr static char frPythonKeyComma[] = "Touche VIRGULE";
+constexpr static char esPythonKeyComma[] = "COMMA key";
+constexpr static char dePythonKeyComma[] = "COMMA key";
+constexpr static char ptPythonKeyComma[] = "COMMA key";
+constexpr static char enPythonKeyCosine[] = "COSINE key";
+constexpr static char frPythonKeyCosine[] = "Touche COSINUS";
+constexpr static char esPythonKeyCosine[] = "COSINE key";
+constexpr static char dePythonKeyCosine[] = "COSINE key";
+constexpr static char ptPythonKeyCosine[] = "COSINE key";
+constexpr static char enPythonKeyDivision[] = "DIVISION key";
+constexpr static char frPythonKeyDivision[] = "Touche DIVISION";
+constexpr static char esPythonKeyDivision[] = "DIVISION key";
+constexpr static char dePythonKeyDivision[] = "DIVISION key";
+constexpr static char ptPythonKeyDivision[] = "DIVISION key";
+constexpr static char enPythonKeyDot[] = "DOT key";
+constexpr static char frPythonKeyDot[] = "Touche POINT";
+constexpr static char esPythonKeyDot[] = "DOT key";
+constexpr static char dePythonKeyDot[] = "DOT key";
+constexpr static char ptPythonKeyDot[] = "DOT key";
+constexpr static char enPythonKeyDown[] = "DOWN ARROW key";
+constexpr static char frPythonKeyDown[] = "Touche FLECHE BAS";
+constexpr static char esPythonKeyDown[] = "DOWN ARROW key";
+constexpr static char dePythonKeyDown[] = "DOWN ARROW key";
+constexpr static char ptPythonKeyDown[] = "DOWN ARROW key";
+constexpr static char enPythonKeyEe[] = "10 POWER X key";
+constexpr static char frPythonKeyEe[] = "Touche 10 PUISSANCE X";
+constexpr static char esPythonKeyEe[] = "10 POWER X key";
+constexpr static char dePythonKeyEe[] = "10 POWER X key";
+constexpr static char ptPythonKeyEe[] = "10 POWER X key";
+constexpr static char enPythonKeyEight[] = "8 key";
+constexpr static char frPythonKeyEight[] = "Touche 8";
+constexpr static char esPythonKeyEight[] = "8 key";
+constexpr static char dePythonKeyEight[] = "8 key";
+constexpr static char ptPythonKeyEight[] = "8 key";
+constexpr static char enPythonKeyExe[] = "EXE key";
+constexpr static char frPythonKeyExe[] = "Touche EXE";
+constexpr static char esPythonKeyExe[] = "EXE key";
+constexpr static char dePythonKeyExe[] = "EXE key";
+constexpr static char ptPythonKeyExe[] = "EXE key";
+constexpr static char enPythonKeyExp[] = "EXPONENTIAL key";
+constexpr static char frPythonKeyExp[] = "Touche EXPONENTIELLE";
+constexpr static char esPythonKeyExp[] = "EXPONENTIAL key";
+constexpr static char dePythonKeyExp[] = "EXPONENTIAL key";
+constexpr static char ptPythonKeyExp[] = "EXPONENTIAL key";
+constexpr static char enPythonKeyFive[] = "5 key";
+constexpr static char frPythonKeyFive[] = "Touche 5";
+constexpr static char esPythonKeyFive[] = "5 key";
+constexpr static char dePythonKeyFive[] = "5 key";
+constexpr static char ptPythonKeyFive[] = "5 key";
+constexpr static char enPythonKeyFour[] = "4 key";
+constexpr static char frPythonKeyFour[] = "Touche 4";
+constexpr static char esPythonKeyFour[] = "4 key";
+constexpr static char dePythonKeyFour[] = "4 key";
+constexpr static char ptPythonKeyFour[] = "4 key";
+constexpr static char enPythonKeyHome[] = "HOME key";
+constexpr static char frPythonKeyHome[] = "Touche HOME";
+constexpr static char esPythonKeyHome[] = "HOME key";
+constexpr static char dePythonKeyHome[] = "HOME key";
+constexpr static char ptPythonKeyHome[] = "HOME key";
+constexpr static char enPythonKeyImaginary[] = "IMAGINARY I key";
+constexpr static char frPythonKeyImaginary[] = "Touche I IMAGINAIRE";
+constexpr static char esPythonKeyImaginary[] = "IMAGINARY I key";
+constexpr static char dePythonKeyImaginary[] = "IMAGINARY I key";
+constexpr static char ptPythonKeyImaginary[] = "IMAGINARY I key";
+constexpr static char enPythonKeyLeft[] = "LEFT ARROW key";
+constexpr static char frPythonKeyLeft[] = "Touche FLECHE GAUCHE";
+constexpr static char esPythonKeyLeft[] = "LEFT ARROW key";
+constexpr static char dePythonKeyLeft[] = "LEFT ARROW key";
+constexpr static char ptPythonKeyLeft[] = "LEFT ARROW key";
+constexpr static char enPythonKeyLeftParenthesis[] = "LEFT PARENTHESIS key";
+constexpr static char frPythonKeyLeftParenthesis[] = "Touche PARENTHESE GAUCHE";
+constexpr static char esPythonKeyLeftParenthesis[] = "LEFT PARENTHESIS key";
+constexpr static char dePythonKeyLeftParenthesis[] = "LEFT PARENTHESIS key";
+constexpr static char ptPythonKeyLeftParenthesis[] = "LEFT PARENTHESIS key";
+constexpr static char enPythonKeyLn[] = "NATURAL LOGARITHM key";
+constexpr static char frPythonKeyLn[] = "Touche LOGARITHME NEPERIEN";
+constexpr static char esPythonKeyLn[] = "NATURAL LOGARITHM key";
+constexpr static char dePythonKeyLn[] = "NATURAL LOGARITHM key";
+constexpr static char ptPythonKeyLn[] = "NATURAL LOGARITHM key";
+constexpr static char enPythonKeyLog[] = "DECIMAL LOGARITHM key";
+constexpr static char frPythonKeyLog[] = "Touche LOGARITHME DECIMAL";
+constexpr static char esPythonKeyLog[] = "DECIMAL LOGARITHM key";
+constexpr static char dePythonKeyLog[] = "DECIMAL LOGARITHM key";
+constexpr static char ptPythonKeyLog[] = "DECIMAL LOGARITHM key";
+constexpr static char enPythonKeyMinus[] = "MINUS key";
+constexpr static char frPythonKeyMinus[] = "Touche MOINS";
+constexpr static char esPythonKeyMinus[] = "MINUS key";
+constexpr static char dePythonKeyMinus[] = "MINUS key";
+constexpr static char ptPythonKeyMinus[] = "MINUS key";
+constexpr static char enPythonKeyMultiplication[] = "MULTIPLICATION key";
+constexpr static char frPythonKeyMultiplication[] = "Touche MULTIPLICATION";
+constexpr static char esPythonKeyMultiplication[] = "MULTIPLICATION key";
+constexpr static char dePythonKeyMultiplication[] = "MULTIPLICATION key";
+constexpr static char ptPythonKeyMultiplication[] = "MULTIPLICATION key";
+constexpr static char enPythonKeyNine[] = "9 key";
+constexpr static char frPythonKeyNine[] = "Touche 9";
+constexpr static char esPythonKeyNine[] = "9 key";
+constexpr static char dePythonKeyNine[] = "9 key";
+constexpr static char ptPythonKeyNine[] = "9 key";
+constexpr static char enPythonKeyOk[] = "OK key";
+constexpr static char frPythonKeyOk[] = "Touche OK";
+constexpr static char esPythonKeyOk[] = "OK key";
+constexpr static char dePythonKeyOk[] = "OK key";
+constexpr static char ptPythonKeyOk[] = "OK key";
+constexpr static char enPythonKeyOnOff[] = "ON/OFF key";
+constexpr static char frPythonKeyOnOff[] = "Touche ON/OFF";
+constexpr static char esPythonKeyOnOff[] = "ON/OFF key";
+constexpr static char dePythonKeyOnOff[] = "ON/OFF key";
+constexpr static char ptPythonKeyOnOff[] = "ON/OFF key";
+constexpr static char enPythonKeyOne[] = "1 key";
+constexpr static char frPythonKeyOne[] = "Touche 1";
+constexpr static char esPythonKeyOne[] = "1 key";
+constexpr static char dePythonKeyOne[] = "1 key";
+constexpr static char ptPythonKeyOne[] = "1 key";
+constexpr static char enPythonKeyPi[] = "PI key";
+constexpr static char frPythonKeyPi[] = "Touche PI";
+constexpr static char esPythonKeyPi[] = "PI key";
+constexpr static char dePythonKeyPi[] = "PI key";
+constexpr static char ptPythonKeyPi[] = "PI key";
+constexpr static char enPythonKeyPlus[] = "PLUS key";
+constexpr static char frPythonKeyPlus[] = "Touche PLUS";
+constexpr static char esPythonKeyPlus[] = "PLUS key";
+constexpr static char dePythonKeyPlus[] = "PLUS key";
+constexpr static char ptPythonKeyPlus[] = "PLUS key";
+constexpr static char enPythonKeyPower[] = "POWER key";
+constexpr static char frPythonKeyPower[] = "Touche PUISSANCE";
+constexpr static char esPythonKeyPower[] = "POWER key";
+constexpr static char dePythonKeyPower[] = "POWER key";
+constexpr static char ptPythonKeyPower[] = "POWER key";
+constexpr static char enPythonKeyRight[] = "RIGHT ARROW key";
+constexpr static char frPythonKeyRight[] = "Touche FLECHE DROITE";
+constexpr static char esPythonKeyRight[] = "RIGHT ARROW key";
+constexpr static char dePythonKeyRight[] = "RIGHT ARROW key";
+constexpr static char ptPythonKeyRight[] = "RIGHT ARROW key";
+constexpr static char enPythonKeyRightParenthesis[] = "RIGHT PARENTHESIS key";
+constexpr static char frPythonKeyRightParenthesis[] = "Touche PARENTHESE DROITE";
+constexpr static char esPythonKeyRightParenthesis[] = "RIGHT PARENTHESIS key";
+constexpr static char dePythonKeyRightParenthesis[] = "RIGHT PARENTHESIS key";
+constexpr static char ptPythonKeyRightParenthesis[] = "RIGHT PARENTHESIS key";
+constexpr static char enPythonKeySeven[] = "7 key";
+constexpr static char frPythonKeySeven[] = "Touche 7";
+constexpr static char esPythonKeySeven[] = "7 key";
+constexpr static char dePythonKeySeven[] = "7 key";
+constexpr static char ptPythonKeySeven[] = "7 key";
+constexpr static char enPythonKeyShift[] = "SHIFT key";
+constexpr static char frPythonKeyShift[] = "Touche SHIFT";
+constexpr static char esPythonKeyShift[] = "SHIFT key";
+constexpr static char dePythonKeyShift[] = "SHIFT key";
+constexpr static char ptPythonKeyShift[] = "SHIFT key";
+constexpr static char enPythonKeySine[] = "SINE key";
+constexpr static char frPythonKeySine[] = "Touche SINUS";
+constexpr static char esPythonKeySine[] = "SINE key";
+constexpr static char dePythonKeySine[] = "SINE key";
+constexpr static char ptPythonKeySine[] = "SINE key";
+constexpr static char enPythonKeySix[] = "6 key";
+constexpr static char frPythonKeySix[] = "Touche 6";
+constexpr static char esPythonKeySix[] = "6 key";
+constexpr static char dePythonKeySix[] = "6 key";
+constexpr static char ptPythonKeySix[] = "6 key";
+constexpr static char enPythonKeySqrt[] = "SQUARE ROOT key";
+constexpr static char frPythonKeySqrt[] = "Touche RACINE CARREE";
+constexpr static char esPythonKeySqrt[] = "SQUARE ROOT key";
+constexpr static char dePythonKeySqrt[] = "SQUARE ROOT key";
+constexpr static char ptPythonKeySqrt[] = "SQUARE ROOT key";
+constexpr static char enPythonKeySquare[] = "SQUARE key";
+constexpr static char frPythonKeySquare[] = "Touche CARRE";
+constexpr static char esPythonKeySquare[] = "SQUARE key";
+constexpr static char dePythonKeySquare[] = "SQUARE key";
+constexpr static char ptPythonKeySquare[] = "SQUARE key";
+constexpr static char enPythonKeyTangent[] = "TANGENT key";
+constexpr static char frPythonKeyTangent[] = "Touche TANGENTE";
+constexpr static char esPythonKeyTangent[] = "TANGENT key";
+constexpr static char dePythonKeyTangent[] = "TANGENT key";
+constexpr static char ptPythonKeyTangent[] = "TANGENT key";
+constexpr static char enPythonKeyThree[] = "3 key";
+constexpr static char frPythonKeyThree[] = "Touche 3";
+constexpr static char esPythonKeyThree[] = "3 key";
+constexpr static char dePythonKeyThree[] = "3 key";
+constexpr static char ptPythonKeyThree[] = "3 key";
+constexpr static char enPythonKeyToolbox[] = "TOOLBOX key";
+constexpr static char frPythonKeyToolbox[] = "Touche BOITE A OUTILS";
+constexpr static char esPythonKeyToolbox[] = "TOOLBOX key";
+constexpr static char dePythonKeyToolbox[] = "TOOLBOX key";
+constexpr static char ptPythonKeyToolbox[] = "TOOLBOX key";
+constexpr static char enPythonKeyTwo[] = "2 key";
+constexpr static char frPythonKeyTwo[] = "Touche 2";
+constexpr static char esPythonKeyTwo[] = "2 key";
+constexpr static char dePythonKeyTwo[] = "2 key";
+constexpr static char ptPythonKeyTwo[] = "2 key";
+constexpr static char enPythonKeyUp[] = "UP ARROW key";
+constexpr static char frPythonKeyUp[] = "Touche FLECHE HAUT";
+constexpr static char esPythonKeyUp[] = "UP ARROW key";
+constexpr static char dePythonKeyUp[] = "UP ARROW key";
+constexpr static char ptPythonKeyUp[] = "UP ARROW key";
+constexpr static char enPythonKeyVar[] = "VAR key";
+constexpr static char frPythonKeyVar[] = "Touche VAR";
+constexpr static char esPythonKeyVar[] = "VAR key";
+constexpr static char dePythonKeyVar[] = "VAR key";
+constexpr static char ptPythonKeyVar[] = "VAR key";
+constexpr static char enPythonKeyXnt[] = "X,N,T key";
+constexpr static char frPythonKeyXnt[] = "Touche X,N,T";
+constexpr static char esPythonKeyXnt[] = "X,N,T key";
+constexpr static char dePythonKeyXnt[] = "X,N,T key";
+constexpr static char ptPythonKeyXnt[] = "X,N,T key";
+constexpr static char enPythonKeyZero[] = "0 key";
+constexpr static char frPythonKeyZero[] = "Touche 0";
+constexpr static char esPythonKeyZero[] = "0 key";
+constexpr static char dePythonKeyZero[] = "0 key";
+constexpr static char ptPythonKeyZero[] = "0 key";
+constexpr static char enPythonLF[] = "Line feed";
+constexpr static char frPythonLF[] = "Saut à la ligne";
+constexpr static char esPythonLF[] = "Line feed";
+constexpr static char dePythonLF[] = "Zeilenvorschub";
+constexpr static char ptPythonLF[] = "Line feed";
+constexpr static char enPythonLdexp[] = "Return x*(2**i), inverse of frexp";
+constexpr static char frPythonLdexp[] = "Inverse de frexp : x*(2**i)";
+constexpr static char esPythonLdexp[] = "Return x*(2**i), inverse of frexp";
+constexpr static char dePythonLdexp[] = "Return x*(2**i), inverse of frexp";
+constexpr static char ptPythonLdexp[] = "Return x*(2**i), inverse of frexp";
+constexpr static char enPythonLength[] = "Length of an object";
+constexpr static char frPythonLength[] = "Longueur d'un objet";
+constexpr static char esPythonLength[] = "Length of an object";
+constexpr static char dePythonLength[] = "Length of an object";
+constexpr static char ptPythonLength[] = "Length of an object";
+constexpr static char enPythonLgamma[] = "Log-gamma function";
+constexpr static char frPythonLgamma[] = "Logarithme de la fonction gamma";
+constexpr static char esPythonLgamma[] = "Log-gamma function";
+constexpr static char dePythonLgamma[] = "Log-gamma function";
+constexpr static char ptPythonLgamma[] = "Log-gamma function";
+constexpr static char enPythonLog[] = "Logarithm to base a";
+constexpr static char frPythonLog[] = "Logarithme de base a";
+constexpr static char esPythonLog[] = "Logarithm to base a";
+constexpr static char dePythonLog[] = "Logarithm to base a";
+constexpr static char ptPythonLog[] = "Logarithm to base a";
+constexpr static char enPythonLog10[] = "Logarithm to base 10";
+constexpr static char frPythonLog10[] = "Logarithme décimal";
+constexpr static char esPythonLog10[] = "Logarithm to base 10";
+constexpr static char dePythonLog10[] = "Logarithm to base 10";
+constexpr static char ptPythonLog10[] = "Logarithm to base 10";
+constexpr static char enPythonLog2[] = "Logarithm to base 2";
+constexpr static char frPythonLog2[] = "Logarithme de base 2";
+constexpr static char esPythonLog2[] = "Logarithm to base 2";
+constexpr static char dePythonLog2[] = "Logarithm to base 2";
+constexpr static char ptPythonLog2[] = "Logarithm to base 2";
+constexpr static char enPythonMathFunction[] = "math module function prefix";
+constexpr static char frPythonMathFunction[] = "Préfixe fonction du module math";
+constexpr static char esPythonMathFunction[] = "math module function prefix";
+constexpr static char dePythonMathFunction[] = "math module function prefix";
+constexpr static char ptPythonMathFunction[] = "math module function prefix";
+constexpr static char enPythonMax[] = "Maximum";
+constexpr static char frPythonMax[] = "Maximum";
+constexpr static char esPythonMax[] = "Maximum";
+constexpr static char dePythonMax[] = "Maximum";
+constexpr static char ptPythonMax[] = "Maximum";
+constexpr static char enPythonMin[] = "Minimum";
+constexpr static char frPythonMin[] = "Minimum";
+constexpr static char esPythonMin[] = "Minimum";
+constexpr static char dePythonMin[] = "Minimum";
+constexpr static char ptPythonMin[] = "Minimum";
+constexpr static char enPythonModf[] = "Fractional and integer parts of x";
+constexpr static char frPythonModf[] = "Parties fractionnaire et entière";
+constexpr static char esPythonModf[] = "Fractional and integer parts of x";
+constexpr static char dePythonModf[] = "Fractional and integer parts of x";
+constexpr static char ptPythonModf[] = "Fractional and integer parts of x";
+constexpr static char enPythonMonotonic[] = "Value of a monotonic clock";
+constexpr static char frPythonMonotonic[] = "Renvoie la valeur de l'horloge";
+constexpr static char esPythonMonotonic[] = "Value of a monotonic clock";
+constexpr static char dePythonMonotonic[] = "Value of a monotonic clock";
+constexpr static char ptPythonMonotonic[] = "Value of a monotonic clock";
+constexpr static char enPythonOct[] = "Convert integer to octal";
+constexpr static char frPythonOct[] = "Conversion en octal";
+constexpr static char esPythonOct[] = "Convert integer to octal";
+constexpr static char dePythonOct[] = "Convert integer to octal";
+constexpr static char ptPythonOct[] = "Convert integer to octal";
+constexpr static char enPythonPercent[] = "Modulo";
+constexpr static char frPythonPercent[] = "Modulo";
+constexpr static char esPythonPercent[] = "Modulo";
+constexpr static char dePythonPercent[] = "Modulo";
+constexpr static char ptPythonPercent[] = "Modulo";
+constexpr static char enPythonPhase[] = "Phase of z";
+constexpr static char frPythonPhase[] = "Argument de z";
+constexpr static char esPythonPhase[] = "Phase of z";
+constexpr static char dePythonPhase[] = "Phase of z";
+constexpr static char ptPythonPhase[] = "Phase of z";
+constexpr static char enPythonPolar[] = "z in polar coordinates";
+constexpr static char frPythonPolar[] = "Conversion en polaire";
+constexpr static char esPythonPolar[] = "z in polar coordinates";
+constexpr static char dePythonPolar[] = "z in polar coordinates";
+constexpr static char ptPythonPolar[] = "z in polar coordinates";
+constexpr static char enPythonPop[] = "Remove and return the last item";
+constexpr static char frPythonPop[] = "Supprime le dernier élément";
+constexpr static char esPythonPop[] = "Remove and return the last item";
+constexpr static char dePythonPop[] = "Remove and return the last item";
+constexpr static char ptPythonPop[] = "Remove and return the last item";
+constexpr static char enPythonPound[] = "Comment";
+constexpr static char frPythonPound[] = "Commentaire";
+constexpr static char esPythonPound[] = "Comment";
+constexpr static char dePythonPound[] = "Kommentar";
+constexpr static char ptPythonPound[] = "Comment";
+constexpr static char enPythonPower[] = "x raised to the power y";
+constexpr static char frPythonPower[] = "x à la puissance y";
+constexpr static char esPythonPower[] = "x raised to the power y";
+constexpr static char dePythonPower[] = "x raised to the power y";
+constexpr static char ptPythonPower[] = "x raised to the power y";
+constexpr static char enPythonPrint[] = "Print object";
+constexpr static char frPythonPrint[] = "Affiche l'objet";
+constexpr static char esPythonPrint[] = "Print object";
+constexpr static char dePythonPrint[] = "Print object";
+constexpr static char ptPythonPrint[] = "Print object";
+constexpr static char enPythonRadians[] = "Convert x from degrees to radians";
+constexpr static char frPythonRadians[] = "Conversion de degrés en radians";
+constexpr static char esPythonRadians[] = "Convert x from degrees to radians";
+constexpr static char dePythonRadians[] = "Convert x from degrees to radians";
+constexpr static char ptPythonRadians[] = "Convert x from degrees to radians";
+constexpr static char enPythonRandint[] = "Random integer in [a,b]";
+constexpr static char frPythonRandint[] = "Entier aléatoire dans [a,b]";
+constexpr static char esPythonRandint[] = "Random integer in [a,b]";
+constexpr static char dePythonRandint[] = "Random integer in [a,b]";
+constexpr static char ptPythonRandint[] = "Random integer in [a,b]";
+constexpr static char enPythonRandom[] = "Floating point number in [0,1[";
+constexpr static char frPythonRandom[] = "Nombre décimal dans [0,1[";
+constexpr static char esPythonRandom[] = "Floating point number in [0,1[";
+constexpr static char dePythonRandom[] = "Floating point number in [0,1[";
+constexpr static char ptPythonRandom[] = "Floating point number in [0,1[";
+constexpr static char enPythonRandomFunction[] = "random module function prefix";
+constexpr static char frPythonRandomFunction[] = "Préfixe fonction du module random";
+constexpr static char esPythonRandomFunction[] = "random module function prefix";
+constexpr static char dePythonRandomFunction[] = "random module function prefix";
+constexpr static char ptPythonRandomFunction[] = "random module function prefix";
+constexpr static char enPythonRandrange[] = "Random number in range(start, stop)";
+constexpr static char frPythonRandrange[] = "Nombre dans range(start, stop)";
+constexpr static char esPythonRandrange[] = "Random number in range(start, stop)";
+constexpr static char dePythonRandrange[] = "Random number in range(start, stop)";
+constexpr static char ptPythonRandrange[] = "Random number in range(start, stop)";
+constexpr static char enPythonRangeStartStop[] = "List from start to stop-1";
+constexpr static char frPythonRangeStartStop[] = "Liste de start à stop-1";
+constexpr static char esPythonRangeStartStop[] = "List from start to stop-1";
+constexpr static char dePythonRangeStartStop[] = "List from start to stop-1";
+constexpr static char ptPythonRangeStartStop[] = "List from start to stop-1";
+constexpr static char enPythonRangeStop[] = "List from 0 to stop-1";
+constexpr static char frPythonRangeStop[] = "Liste de 0 à stop-1";
+constexpr static char esPythonRangeStop[] = "List from 0 to stop-1";
+constexpr static char dePythonRangeStop[] = "List from 0 to stop-1";
+constexpr static char ptPythonRangeStop[] = "List from 0 to stop-1";
+constexpr static char enPythonReal[] = "Real part of z";
+constexpr static char frPythonReal[] = "Partie réelle de z";
+constexpr static char esPythonReal[] = "Real part of z";
+constexpr static char dePythonReal[] = "Realteil von z";
+constexpr static char ptPythonReal[] = "Real part of z";
+constexpr static char enPythonRect[] = "z in cartesian coordinates";
+constexpr static char frPythonRect[] = "Conversion en algébrique";
+constexpr static char esPythonRect[] = "z in cartesian coordinates";
+constexpr static char dePythonRect[] = "z in cartesian coordinates";
+constexpr static char ptPythonRect[] = "z in cartesian coordinates";
+constexpr static char enPythonRemove[] = "Remove the first occurrence of x";
+constexpr static char frPythonRemove[] = "Supprime le premier x de la liste";
+constexpr static char esPythonRemove[] = "Remove the first occurrence of x";
+constexpr static char dePythonRemove[] = "Remove the first occurrence of x";
+constexpr static char ptPythonRemove[] = "Remove the first occurrence of x";
+constexpr static char enPythonReverse[] = "Reverse the elements of the list";
+constexpr static char frPythonReverse[] = "Inverse les éléments de la liste";
+constexpr static char esPythonReverse[] = "Reverse the elements of the list";
+constexpr static char dePythonReverse[] = "Reverse the elements of the list";
+constexpr static char ptPythonReverse[] = "Reverse the elements of the list";
+constexpr static char enPythonRound[] = "Round to n digits";
+constexpr static char frPythonRound[] = "Arrondi à n décimales";
+constexpr static char esPythonRound[] = "Round to n digits";
+constexpr static char dePythonRound[] = "Round to n digits";
+constexpr static char ptPythonRound[] = "Round to n digits";
+constexpr static char enPythonSeed[] = "Initialize random number generator";
+constexpr static char frPythonSeed[] = "Initialiser générateur aléatoire";
+constexpr static char esPythonSeed[] = "Initialize random number generator";
+constexpr static char dePythonSeed[] = "Initialize random number generator";
+constexpr static char ptPythonSeed[] = "Initialize random number generator";
+constexpr static char enPythonSetPixel[] = "Color pixel (x,y)";
+constexpr static char frPythonSetPixel[] = "Colore le pixel (x,y)";
+constexpr static char esPythonSetPixel[] = "Color pixel (x,y)";
+constexpr static char dePythonSetPixel[] = "Color pixel (x,y)";
+constexpr static char ptPythonSetPixel[] = "Color pixel (x,y)";
+constexpr static char enPythonSin[] = "Sine";
+constexpr static char frPythonSin[] = "Sinus";
+constexpr static char esPythonSin[] = "Sine";
+constexpr static char dePythonSin[] = "Sine";
+constexpr static char ptPythonSin[] = "Sine";
+constexpr static char enPythonSingleQuote[] = "Single quote";
+constexpr static char frPythonSingleQuote[] = "Apostrophe";
+constexpr static char esPythonSingleQuote[] = "Single quote";
+constexpr static char dePythonSingleQuote[] = "Einfaches Anführungszeichen";
+constexpr static char ptPythonSingleQuote[] = "Single quote";
+constexpr static char enPythonSinh[] = "Hyperbolic sine";
+constexpr static char frPythonSinh[] = "Sinus hyperbolique";
+constexpr static char esPythonSinh[] = "Hyperbolic sine";
+constexpr static char dePythonSinh[] = "Hyperbolic sine";
+constexpr static char ptPythonSinh[] = "Hyperbolic sine";
+constexpr static char enPythonSleep[] = "Suspend the execution for t seconds";
+constexpr static char frPythonSleep[] = "Suspend l'exécution t secondes";
+constexpr static char esPythonSleep[] = "Suspend the execution for t seconds";
+constexpr static char dePythonSleep[] = "Suspend the execution for t seconds";
+constexpr static char ptPythonSleep[] = "Suspend the execution for t seconds";
+constexpr static char enPythonSort[] = "Sort the list";
+constexpr static char frPythonSort[] = "Trie la liste";
+constexpr static char esPythonSort[] = "Sort the list";
+constexpr static char dePythonSort[] = "Sort the list";
+constexpr static char ptPythonSort[] = "Sort the list";
+constexpr static char enPythonSqrt[] = "Square root";
+constexpr static char frPythonSqrt[] = "Racine carrée";
+constexpr static char esPythonSqrt[] = "Square root";
+constexpr static char dePythonSqrt[] = "Square root";
+constexpr static char ptPythonSqrt[] = "Square root";
+constexpr static char enPythonSum[] = "Sum the items of a list";
+constexpr static char frPythonSum[] = "Somme des éléments de la liste";
+constexpr static char esPythonSum[] = "Sum the items of a list";
+constexpr static char dePythonSum[] = "Sum the items of a list";
+constexpr static char ptPythonSum[] = "Sum the items of a list";
+constexpr static char enPythonSymbolExp[] = "Bitwise exclusive or";
+constexpr static char frPythonSymbolExp[] = "Ou exclusif logique";
+constexpr static char esPythonSymbolExp[] = "Bitwise exclusive or";
+constexpr static char dePythonSymbolExp[] = "Bitweise exklusiv oder";
+constexpr static char ptPythonSymbolExp[] = "Bitwise exclusive or";
+constexpr static char enPythonTab[] = "Tabulation";
+constexpr static char frPythonTab[] = "Tabulation";
+constexpr static char esPythonTab[] = "Tabulation";
+constexpr static char dePythonTab[] = "Tabulator";
+constexpr static char ptPythonTab[] = "Tabulation";
+constexpr static char enPythonTan[] = "Tangent";
+constexpr static char frPythonTan[] = "Tangente";
+constexpr static char esPythonTan[] = "Tangent";
+constexpr static char dePythonTan[] = "Tangent";
+constexpr static char ptPythonTan[] = "Tangent";
+constexpr static char enPythonTanh[] = "Hyperbolic tangent";
+constexpr static char frPythonTanh[] = "Tangente hyperbolique";
+constexpr static char esPythonTanh[] = "Hyperbolic tangent";
+constexpr static char dePythonTanh[] = "Hyperbolic tangent";
+constexpr static char ptPythonTanh[] = "Hyperbolic tangent";
+constexpr static char enPythonTimeFunction[] = "time module function prefix";
+constexpr static char frPythonTimeFunction[] = "Préfixe fonction module time";
+constexpr static char esPythonTimeFunction[] = "time module function prefix";
+constexpr static char dePythonTimeFunction[] = "time module function prefix";
+constexpr static char ptPythonTimeFunction[] = "time module function prefix";
+constexpr static char enPythonTrunc[] = "x truncated to an integer";
+constexpr static char frPythonTrunc[] = "Troncature entière";
+constexpr static char esPythonTrunc[] = "x truncated to an integer";
+constexpr static char dePythonTrunc[] = "x truncated to an integer";
+constexpr static char ptPythonTrunc[] = "x truncated to an integer";
+constexpr static char enPythonTurtleBackward[] = "Move backward by x pixels";
+constexpr static char frPythonTurtleBackward[] = "Recule de x pixels";
+constexpr static char esPythonTurtleBackward[] = "Move backward by x pixels";
+constexpr static char dePythonTurtleBackward[] = "Move backward by x pixels";
+constexpr static char ptPythonTurtleBackward[] = "Move backward by x pixels";
+constexpr static char enPythonTurtleBlack[] = "Black color";
+constexpr static char frPythonTurtleBlack[] = "Couleur noire";
+constexpr static char esPythonTurtleBlack[] = "Black color";
+constexpr static char dePythonTurtleBlack[] = "Black color";
+constexpr static char ptPythonTurtleBlack[] = "Black color";
+constexpr static char enPythonTurtleBlue[] = "Blue color";
+constexpr static char frPythonTurtleBlue[] = "Couleur bleue";
+constexpr static char esPythonTurtleBlue[] = "Blue color";
+constexpr static char dePythonTurtleBlue[] = "Blue color";
+constexpr static char ptPythonTurtleBlue[] = "Blue color";
+constexpr static char enPythonTurtleBrown[] = "Brown color";
+constexpr static char frPythonTurtleBrown[] = "Couleur marron";
+constexpr static char esPythonTurtleBrown[] = "Brown color";
+constexpr static char dePythonTurtleBrown[] = "Brown color";
+constexpr static char ptPythonTurtleBrown[] = "Brown color";
+constexpr static char enPythonTurtleCircle[] = "Circle of radius r pixels";
+constexpr static char frPythonTurtleCircle[] = "Cercle de rayon r pixels";
+constexpr static char esPythonTurtleCircle[] = "Circle of radius r pixels";
+constexpr static char dePythonTurtleCircle[] = "Circle of radius r pixels";
+constexpr static char ptPythonTurtleCircle[] = "Circle of radius r pixels";
+constexpr static char enPythonTurtleColor[] = "Set the pen color";
+constexpr static char frPythonTurtleColor[] = "Modifie la couleur du tracé";
+constexpr static char esPythonTurtleColor[] = "Set the pen color";
+constexpr static char dePythonTurtleColor[] = "Set the pen color";
+constexpr static char ptPythonTurtleColor[] = "Set the pen color";
+constexpr static char enPythonTurtleForward[] = "Move forward by x pixels";
+constexpr static char frPythonTurtleForward[] = "Avance de x pixels";
+constexpr static char esPythonTurtleForward[] = "Move forward by x pixels";
+constexpr static char dePythonTurtleForward[] = "Move forward by x pixels";
+constexpr static char ptPythonTurtleForward[] = "Move forward by x pixels";
+constexpr static char enPythonTurtleFunction[] = "turtle module function prefix";
+constexpr static char frPythonTurtleFunction[] = "Préfixe fonction du module turtle";
+constexpr static char esPythonTurtleFunction[] = "turtle module function prefix";
+constexpr static char dePythonTurtleFunction[] = "turtle module function prefix";
+constexpr static char ptPythonTurtleFunction[] = "turtle module function prefix";
+constexpr static char enPythonTurtleGoto[] = "Move to (x,y) coordinates";
+constexpr static char frPythonTurtleGoto[] = "Va au point de coordonnées (x,y)";
+constexpr static char esPythonTurtleGoto[] = "Move to (x,y) coordinates";
+constexpr static char dePythonTurtleGoto[] = "Move to (x,y) coordinates";
+constexpr static char ptPythonTurtleGoto[] = "Move to (x,y) coordinates";
+constexpr static char enPythonTurtleGreen[] = "Green color";
+constexpr static char frPythonTurtleGreen[] = "Couleur verte";
+constexpr static char esPythonTurtleGreen[] = "Green color";
+constexpr static char dePythonTurtleGreen[] = "Green color";
+constexpr static char ptPythonTurtleGreen[] = "Green color";
+constexpr static char enPythonTurtleGrey[] = "Grey color";
+constexpr static char frPythonTurtleGrey[] = "Couleur grise";
+constexpr static char esPythonTurtleGrey[] = "Grey color";
+constexpr static char dePythonTurtleGrey[] = "Grey color";
+constexpr static char ptPythonTurtleGrey[] = "Grey color";
+constexpr static char enPythonTurtleHeading[] = "Return the current heading";
+constexpr static char frPythonTurtleHeading[] = "Renvoie l'orientation actuelle";
+constexpr static char esPythonTurtleHeading[] = "Return the current heading";
+constexpr static char dePythonTurtleHeading[] = "Return the current heading";
+constexpr static char ptPythonTurtleHeading[] = "Return the current heading";
+constexpr static char enPythonTurtleHideturtle[] = "Hide the turtle";
+constexpr static char frPythonTurtleHideturtle[] = "Masque la tortue";
+constexpr static char esPythonTurtleHideturtle[] = "Hide the turtle";
+constexpr static char dePythonTurtleHideturtle[] = "Hide the turtle";
+constexpr static char ptPythonTurtleHideturtle[] = "Hide the turtle";
+constexpr static char enPythonTurtleIsdown[] = "Return True if the pen is down";
+constexpr static char frPythonTurtleIsdown[] = "True si le crayon est abaissé";
+constexpr static char esPythonTurtleIsdown[] = "Return True if the pen is down";
+constexpr static char dePythonTurtleIsdown[] = "Return True if the pen is down";
+constexpr static char ptPythonTurtleIsdown[] = "Return True if the pen is down";
+constexpr static char enPythonTurtleLeft[] = "Turn left by a degrees";
+constexpr static char frPythonTurtleLeft[] = "Pivote de a degrés vers la gauche";
+constexpr static char esPythonTurtleLeft[] = "Turn left by a degrees";
+constexpr static char dePythonTurtleLeft[] = "Turn left by a degrees";
+constexpr static char ptPythonTurtleLeft[] = "Turn left by a degrees";
+constexpr static char enPythonTurtleOrange[] = "Orange color";
+constexpr static char frPythonTurtleOrange[] = "Couleur orange";
+constexpr static char esPythonTurtleOrange[] = "Orange color";
+constexpr static char dePythonTurtleOrange[] = "Orange color";
+constexpr static char ptPythonTurtleOrange[] = "Orange color";
+constexpr static char enPythonTurtlePendown[] = "Pull the pen down";
+constexpr static char frPythonTurtlePendown[] = "Abaisse le crayon";
+constexpr static char esPythonTurtlePendown[] = "Pull the pen down";
+constexpr static char dePythonTurtlePendown[] = "Pull the pen down";
+constexpr static char ptPythonTurtlePendown[] = "Pull the pen down";
+constexpr static char enPythonTurtlePensize[] = "Set the line thickness to x pixels";
+constexpr static char frPythonTurtlePensize[] = "Taille du tracé en pixels";
+constexpr static char esPythonTurtlePensize[] = "Set the line thickness to x pixels";
+constexpr static char dePythonTurtlePensize[] = "Set the line thickness to x pixels";
+constexpr static char ptPythonTurtlePensize[] = "Set the line thickness to x pixels";
+constexpr static char enPythonTurtlePenup[] = "Pull the pen up";
+constexpr static char frPythonTurtlePenup[] = "Relève le crayon";
+constexpr static char esPythonTurtlePenup[] = "Pull the pen up";
+constexpr static char dePythonTurtlePenup[] = "Pull the pen up";
+constexpr static char ptPythonTurtlePenup[] = "Pull the pen up";
+constexpr static char enPythonTurtlePink[] = "Pink color";
+constexpr static char frPythonTurtlePink[] = "Couleur rose";
+constexpr static char esPythonTurtlePink[] = "Pink color";
+constexpr static char dePythonTurtlePink[] = "Pink color";
+constexpr static char ptPythonTurtlePink[] = "Pink color";
+constexpr static char enPythonTurtlePosition[] = "Return the current (x,y) location";
+constexpr static char frPythonTurtlePosition[] = "Renvoie la position (x,y)";
+constexpr static char esPythonTurtlePosition[] = "Return the current (x,y) location";
+constexpr static char dePythonTurtlePosition[] = "Return the current (x,y) location";
+constexpr static char ptPythonTurtlePosition[] = "Return the current (x,y) location";
+constexpr static char enPythonTurtlePurple[] = "Purple color";
+constexpr static char frPythonTurtlePurple[] = "Couleur violette";
+constexpr static char esPythonTurtlePurple[] = "Purple color";
+constexpr static char dePythonTurtlePurple[] = "Purple color";
+constexpr static char ptPythonTurtlePurple[] = "Purple color";
+constexpr static char enPythonTurtleRed[] = "Red color";
+constexpr static char frPythonTurtleRed[] = "Couleur rouge";
+constexpr static char esPythonTurtleRed[] = "Red color";
+constexpr static char dePythonTurtleRed[] = "Red color";
+constexpr static char ptPythonTurtleRed[] = "Red color";
+constexpr static char enPythonTurtleReset[] = "Reset the drawing";
+constexpr static char frPythonTurtleReset[] = "Réinitialise le dessin";
+constexpr static char esPythonTurtleReset[] = "Reset the drawing";
+constexpr static char dePythonTurtleReset[] = "Reset the drawing";
+constexpr static char ptPythonTurtleReset[] = "Reset the drawing";
+constexpr static char enPythonTurtleRight[] = "Turn right by a degrees";
+constexpr static char frPythonTurtleRight[] = "Pivote de a degrés vers la droite";
+constexpr static char esPythonTurtleRight[] = "Turn right by a degrees";
+constexpr static char dePythonTurtleRight[] = "Turn right by a degrees";
+constexpr static char ptPythonTurtleRight[] = "Turn right by a degrees";
+constexpr static char enPythonTurtleSetheading[] = "Set the orientation to a degrees";
+constexpr static char frPythonTurtleSetheading[] = "Met un cap de a degrés";
+constexpr static char esPythonTurtleSetheading[] = "Set the orientation to a degrees";
+constexpr static char dePythonTurtleSetheading[] = "Set the orientation to a degrees";
+constexpr static char ptPythonTurtleSetheading[] = "Set the orientation to a degrees";
+constexpr static char enPythonTurtleSetposition[] = "Positionne la tortue";
+constexpr static char frPythonTurtleSetposition[] = "Positionne la tortue";
+constexpr static char esPythonTurtleSetposition[] = "Positionne la tortue";
+constexpr static char dePythonTurtleSetposition[] = "Positionne la tortue";
+constexpr static char ptPythonTurtleSetposition[] = "Positionne la tortue";
+constexpr static char enPythonTurtleShowturtle[] = "Show the turtle";
+constexpr static char frPythonTurtleShowturtle[] = "Affiche la tortue";
+constexpr static char esPythonTurtleShowturtle[] = "Show the turtle";
+constexpr static char dePythonTurtleShowturtle[] = "Show the turtle";
+constexpr static char ptPythonTurtleShowturtle[] = "Show the turtle";
+constexpr static char enPythonTurtleSpeed[] = "Drawing speed between 0 and 10";
+constexpr static char frPythonTurtleSpeed[] = "Vitesse du tracé entre 0 et 10";
+constexpr static char esPythonTurtleSpeed[] = "Drawing speed between 0 and 10";
+constexpr static char dePythonTurtleSpeed[] = "Drawing speed between 0 and 10";
+constexpr static char ptPythonTurtleSpeed[] = "Drawing speed between 0 and 10";
+constexpr static char enPythonTurtleWhite[] = "White color";
+constexpr static char frPythonTurtleWhite[] = "Couleur blanche";
+constexpr static char esPythonTurtleWhite[] = "White color";
+constexpr static char dePythonTurtleWhite[] = "White color";
+constexpr static char ptPythonTurtleWhite[] = "White color";
+constexpr static char enPythonTurtleYellow[] = "Yellow color";
+constexpr static char frPythonTurtleYellow[] = "Couleur jaune";
+constexpr static char esPythonTurtleYellow[] = "Yellow color";
+constexpr static char dePythonTurtleYellow[] = "Yellow color";
+constexpr static char ptPythonTurtleYellow[] = "Yellow color";
+constexpr static char enPythonUniform[] = "Floating point number in [a,b]";
+constexpr static char frPythonUniform[] = "Nombre décimal dans [a,b]";
+constexpr static char esPythonUniform[] = "Floating point number in [a,b]";
+constexpr static char dePythonUniform[] = "Floating point number in [a,b]";
+constexpr static char ptPythonUniform[] = "Floating point number in [a,b]";
+constexpr static char enPythonVerticalBar[] = "Bitwise or";
+constexpr static char frPythonVerticalBar[] = "Ou logique";
+constexpr static char esPythonVerticalBar[] = "Bitwise or";
+constexpr static char dePythonVerticalBar[] = "Bitweise oder";
+constexpr static char ptPythonVerticalBar[] = "Bitwise or";
+constexpr static char enQuadratic[] = "Quadratic";
+constexpr static char frQuadratic[] = "Quadratique";
+constexpr static char esQuadratic[] = "Cuadrática";
+constexpr static char deQuadratic[] = "Quadratische";
+constexpr static char ptQuadratic[] = "Quadrática";
+constexpr static char enQuartic[] = "Quartic";
+constexpr static char frQuartic[] = "Quartique";
+constexpr static char esQuartic[] = "Cuártica";
+constexpr static char deQuartic[] = "Biquadratische";
+constexpr static char ptQuartic[] = "Quarto grau";
+constexpr static char enQuotient[] = "Quotient division p by q";
+constexpr static char frQuotient[] = "Quotient de la division de p par q";
+constexpr static char esQuotient[] = "Cociente división p por q";
+constexpr static char deQuotient[] = "Ganzzahlquotient";
+constexpr static char ptQuotient[] = "Quociente";
+constexpr static char enRad[] = "rad";
+constexpr static char frRad[] = "rad";
+constexpr static char esRad[] = "rad";
+constexpr static char deRad[] = "rad";
+constexpr static char ptRad[] = "rad";
+constexpr static char enRadian[] = "Radians ";
+constexpr static char frRadian[] = "Radians ";
+constexpr static char esRadian[] = "Radianes ";
+constexpr static char deRadian[] = "Bogenmaß ";
+constexpr static char ptRadian[] = "Radianos ";
+constexpr static char enRandomAndApproximation[] = "Random and approximation";
+constexpr static char frRandomAndApproximation[] = "Aléatoire et approximation";
+constexpr static char esRandomAndApproximation[] = "Aleatorio y aproximación";
+constexpr static char deRandomAndApproximation[] = "Zufall und Näherung";
+constexpr static char ptRandomAndApproximation[] = "Aleatório e aproximação";
+constexpr static char enRandomFloat[] = "Floating point number in [0,1[";
+constexpr static char frRandomFloat[] = "Nombre décimal dans [0,1[";
+constexpr static char esRandomFloat[] = "Número decimal en [0,1[";
+constexpr static char deRandomFloat[] = "Dezimalzahl in [0,1]";
+constexpr static char ptRandomFloat[] = "Número decimal em [0,1[";
+constexpr static char enRandomInteger[] = "Random integer in [a,b]";
+constexpr static char frRandomInteger[] = "Entier aléatoire dans [a,b]";
+constexpr static char esRandomInteger[] = "Entero aleatorio en [a,b]";
+constexpr static char deRandomInteger[] = "Zufällige ganze Zahl in [a,b]";
+constexpr static char ptRandomInteger[] = "Inteiro aleatório em [a,b]";
+constexpr static char enRange[] = "Range";
+constexpr static char frRange[] = "Etendue";
+constexpr static char esRange[] = "Rango";
+constexpr static char deRange[] = "Spannweite";
+constexpr static char ptRange[] = "Amplitude";
+constexpr static char enReal[] = "Real ";
+constexpr static char frReal[] = "Réel ";
+constexpr static char esReal[] = "Real ";
+constexpr static char deReal[] = "Reel ";
+constexpr static char ptReal[] = "Real ";
+constexpr static char enRealPart[] = "Real part";
+constexpr static char frRealPart[] = "Partie réelle";
+constexpr static char esRealPart[] = "Parte real";
+constexpr static char deRealPart[] = "Realteil";
+constexpr static char ptRealPart[] = "Parte real";
+constexpr static char enRectangleWidth[] = "Bin width";
+constexpr static char frRectangleWidth[] = "Largeur des rectangles";
+constexpr static char esRectangleWidth[] = "Ancho del rectangulo";
+constexpr static char deRectangleWidth[] = "Breite der Rechtecke";
+constexpr static char ptRectangleWidth[] = "Largura dos retângulos";
+constexpr static char enReg[] = "reg";
+constexpr static char frReg[] = "reg";
+constexpr static char esReg[] = "reg";
+constexpr static char deReg[] = "reg";
+constexpr static char ptReg[] = "reg";
+constexpr static char enRegression[] = "Regression";
+constexpr static char frRegression[] = "Régression";
+constexpr static char esRegression[] = "Regresión";
+constexpr static char deRegression[] = "Regression";
+constexpr static char ptRegression[] = "Regressão";
+constexpr static char enRegressionApp[] = "Regression";
+constexpr static char frRegressionApp[] = "Régressions";
+constexpr static char esRegressionApp[] = "Regresión";
+constexpr static char deRegressionApp[] = "Regression";
+constexpr static char ptRegressionApp[] = "Regressão";
+constexpr static char enRegressionAppCapital[] = "REGRESSION";
+constexpr static char frRegressionAppCapital[] = "REGRESSIONS";
+constexpr static char esRegressionAppCapital[] = "REGRESION";
+constexpr static char deRegressionAppCapital[] = "REGRESSION";
+constexpr static char ptRegressionAppCapital[] = "REGRESSAO";
+constexpr static char enRegressionCurve[] = "Regression curve";
+constexpr static char frRegressionCurve[] = "Courbe de régression";
+constexpr static char esRegressionCurve[] = "Curva de regresión";
+constexpr static char deRegressionCurve[] = "Regressionskurve";
+constexpr static char ptRegressionCurve[] = "Curva de regressão";
+constexpr static char enRemainder[] = "Remainder division p by q";
+constexpr static char frRemainder[] = "Reste de la division de p par q";
+constexpr static char esRemainder[] = "Resto división p por q";
+constexpr static char deRemainder[] = "Rest";
+constexpr static char ptRemainder[] = "Resto da divisão inteira";
+constexpr static char enRename[] = "Rename";
+constexpr static char frRename[] = "Renommer";
+constexpr static char esRename[] = "Renombrar";
+constexpr static char deRename[] = "Umbenennen";
+constexpr static char ptRename[] = "Renomear";
+constexpr static char enRepetitionNumber[] = "n: Number of trials";
+constexpr static char frRepetitionNumber[] = "n : Nombre de répétitions";
+constexpr static char esRepetitionNumber[] = "n : Número de ensayos ";
+constexpr static char deRepetitionNumber[] = "n: Anzahl der Versuche";
+constexpr static char ptRepetitionNumber[] = "n : Número de ensaios";
+constexpr static char enRequireEquation[] = "The input must be an equation";
+constexpr static char frRequireEquation[] = "L'entrée doit être une équation";
+constexpr static char esRequireEquation[] = "La entrada debe ser una ecuación";
+constexpr static char deRequireEquation[] = "Die Eingabe muss eine Gleichung sein";
+constexpr static char ptRequireEquation[] = "A entrada deve ser uma equação";
+constexpr static char enReservedName[] = "Reserved name";
+constexpr static char frReservedName[] = "Nom réservé";
+constexpr static char esReservedName[] = "Nombre reservado";
+constexpr static char deReservedName[] = "Reserviertes Wort";
+constexpr static char ptReservedName[] = "Nome reservado";
+constexpr static char enResolveEquation[] = "Solve the equation";
+constexpr static char frResolveEquation[] = "Résoudre l'équation";
+constexpr static char esResolveEquation[] = "Resolver la ecuación";
+constexpr static char deResolveEquation[] = "Lösen der Gleichung";
+constexpr static char ptResolveEquation[] = "Resolver a equação";
+constexpr static char enResolveSystem[] = "Solve the system";
+constexpr static char frResolveSystem[] = "Résoudre le système";
+constexpr static char esResolveSystem[] = "Resolver el sistema";
+constexpr static char deResolveSystem[] = "Lösen des Gleichungssystems";
+constexpr static char ptResolveSystem[] = "Resolver o sistema";
+constexpr static char enRoundAbscissa[] = "Integer";
+constexpr static char frRoundAbscissa[] = "Abscisses entières";
+constexpr static char esRoundAbscissa[] = "Abscisas enteras";
+constexpr static char deRoundAbscissa[] = "Ganzzahl";
+constexpr static char ptRoundAbscissa[] = "Inteiro";
+constexpr static char enRounding[] = "Rounding to n digits";
+constexpr static char frRounding[] = "Arrondi à n décimales";
+constexpr static char esRounding[] = "Redondeo n digitos";
+constexpr static char deRounding[] = "Runden";
+constexpr static char ptRounding[] = "Arredondar";
+constexpr static char enSampleStandardDeviationS[] = "Sample std deviation s";
+constexpr static char frSampleStandardDeviationS[] = "Ecart type échantillon";
+constexpr static char esSampleStandardDeviationS[] = "Desviación típica s";
+constexpr static char deSampleStandardDeviationS[] = "Standardabweichung s";
+constexpr static char ptSampleStandardDeviationS[] = "Desvio padrão amostral s";
+constexpr static char enSci[] = "sci";
+constexpr static char frSci[] = "sci";
+constexpr static char esSci[] = "cie";
+constexpr static char deSci[] = "wiss";
+constexpr static char ptSci[] = "cie";
+constexpr static char enScientific[] = "Scientific ";
+constexpr static char frScientific[] = "Scientifique ";
+constexpr static char esScientific[] = "Científico ";
+constexpr static char deScientific[] = "Wissenschaftlich ";
+constexpr static char ptScientific[] = "Científico ";
+constexpr static char enScriptOptions[] = "Script options";
+constexpr static char frScriptOptions[] = "Options de script";
+constexpr static char esScriptOptions[] = "Opciones del archivo";
+constexpr static char deScriptOptions[] = "Skriptoptionen";
+constexpr static char ptScriptOptions[] = "Opções de script";
+constexpr static char enSearchInverval[] = "Search interval";
+constexpr static char frSearchInverval[] = "Intervalle de recherche";
+constexpr static char esSearchInverval[] = "Intervalo de búsqueda";
+constexpr static char deSearchInverval[] = "Lösungssuche Intervall";
+constexpr static char ptSearchInverval[] = "Intervalo de busca";
+constexpr static char enSelectFirstTerm[] = "Select First Term ";
+constexpr static char frSelectFirstTerm[] = "Sélectionner le premier terme ";
+constexpr static char esSelectFirstTerm[] = "Seleccionar el primer término ";
+constexpr static char deSelectFirstTerm[] = "Erster Term ";
+constexpr static char ptSelectFirstTerm[] = "Selecionar primeiro termo ";
+constexpr static char enSelectLastTerm[] = "Select last term ";
+constexpr static char frSelectLastTerm[] = "Sélectionner le dernier terme ";
+constexpr static char esSelectLastTerm[] = "Seleccionar el último término ";
+constexpr static char deSelectLastTerm[] = "Letzter Term ";
+constexpr static char ptSelectLastTerm[] = "Selecionar último termo ";
+constexpr static char enSelectLowerBound[] = "Select lower bound";
+constexpr static char frSelectLowerBound[] = "Sélectionner la borne inférieure";
+constexpr static char esSelectLowerBound[] = "Seleccionar el límite inferior";
+constexpr static char deSelectLowerBound[] = "Untere Integrationsgrenze";
+constexpr static char ptSelectLowerBound[] = "Selecionar limite superior";
+constexpr static char enSelectUpperBound[] = "Select upper bound";
+constexpr static char frSelectUpperBound[] = "Sélectionner la borne supérieure";
+constexpr static char esSelectUpperBound[] = "Seleccionar el límite superior";
+constexpr static char deSelectUpperBound[] = "Obere Integrationsgrenze";
+constexpr static char ptSelectUpperBound[] = "Selecionar limite inferior";
+constexpr static char enSequenceApp[] = "Sequences";
+constexpr static char frSequenceApp[] = "Suites";
+constexpr static char esSequenceApp[] = "Sucesión";
+constexpr static char deSequenceApp[] = "Folge";
+constexpr static char ptSequenceApp[] = "Sequência";
+constexpr static char enSequenceAppCapital[] = "SEQUENCES";
+constexpr static char frSequenceAppCapital[] = "SUITES";
+constexpr static char esSequenceAppCapital[] = "SUCESION";
+constexpr static char deSequenceAppCapital[] = "FOLGE";
+constexpr static char ptSequenceAppCapital[] = "SEQUENCIA";
+constexpr static char enSequenceColor[] = "Sequence color";
+constexpr static char frSequenceColor[] = "Couleur de la suite";
+constexpr static char esSequenceColor[] = "Color de la sucesión";
+constexpr static char deSequenceColor[] = "Farbe der Folge";
+constexpr static char ptSequenceColor[] = "Cor da sequência";
+constexpr static char enSequenceOptions[] = "Sequence options";
+constexpr static char frSequenceOptions[] = "Options de la suite";
+constexpr static char esSequenceOptions[] = "Opciones de la sucesión";
+constexpr static char deSequenceOptions[] = "Optionen der Folge";
+constexpr static char ptSequenceOptions[] = "Opções de sequência";
+constexpr static char enSequenceTab[] = "Sequences";
+constexpr static char frSequenceTab[] = "Suites";
+constexpr static char esSequenceTab[] = "Sucesiones";
+constexpr static char deSequenceTab[] = "Folgen";
+constexpr static char ptSequenceTab[] = "Sequências";
+constexpr static char enSequenceType[] = "Sequence type";
+constexpr static char frSequenceType[] = "Type de suite";
+constexpr static char esSequenceType[] = "Tipo de sucesión";
+constexpr static char deSequenceType[] = "Bildungsgesetz der Folge";
+constexpr static char ptSequenceType[] = "Tipo de sequência";
+constexpr static char enSerialNumber[] = "Serial number";
+constexpr static char frSerialNumber[] = "Numéro série";
+constexpr static char esSerialNumber[] = "Número serie";
+constexpr static char deSerialNumber[] = "Seriennummer";
+constexpr static char ptSerialNumber[] = "Número serie";
+constexpr static char enSettingsApp[] = "Settings";
+constexpr static char frSettingsApp[] = "Paramètres";
+constexpr static char esSettingsApp[] = "Configuración";
+constexpr static char deSettingsApp[] = "Einstellungen";
+constexpr static char ptSettingsApp[] = "Configuração";
+constexpr static char enSettingsAppCapital[] = "SETTINGS";
+constexpr static char frSettingsAppCapital[] = "PARAMETRES";
+constexpr static char esSettingsAppCapital[] = "CONFIGURACION";
+constexpr static char deSettingsAppCapital[] = "EINSTELLUNGEN";
+constexpr static char ptSettingsAppCapital[] = "CONFIGURACAO";
+constexpr static char enSignificantFigures[] = "Significant figures ";
+constexpr static char frSignificantFigures[] = "Chiffres significatifs ";
+constexpr static char esSignificantFigures[] = "Cifras significativas ";
+constexpr static char deSignificantFigures[] = "Signifikante Stellen ";
+constexpr static char ptSignificantFigures[] = "Algarismo significativo ";
+constexpr static char enSingleRecurrence[] = "Recursive first order";
+constexpr static char frSingleRecurrence[] = "Récurrente d'ordre 1";
+constexpr static char esSingleRecurrence[] = "Recurrencia de orden uno";
+constexpr static char deSingleRecurrence[] = "Rekursion 1. Ordnung";
+constexpr static char ptSingleRecurrence[] = "Recorrência de Primeira Ordem";
+constexpr static char enSize[] = " Size";
+constexpr static char frSize[] = " Effectif";
+constexpr static char esSize[] = " Frecuencia";
+constexpr static char deSize[] = " Häufigkeit";
+constexpr static char ptSize[] = " Frequência";
+constexpr static char enSizes1[] = "Sizes N1";
+constexpr static char frSizes1[] = "Effectifs N1";
+constexpr static char esSizes1[] = "Frecuencias N1";
+constexpr static char deSizes1[] = "Häufigkeiten N1";
+constexpr static char ptSizes1[] = "Frequências N1";
+constexpr static char enSizes2[] = "Sizes N2";
+constexpr static char frSizes2[] = "Effectifs N2";
+constexpr static char esSizes2[] = "Frecuencias N2";
+constexpr static char deSizes2[] = "Häufigkeiten N2";
+constexpr static char ptSizes2[] = "Frequências N2";
+constexpr static char enSizes3[] = "Sizes N3";
+constexpr static char frSizes3[] = "Effectifs N3";
+constexpr static char esSizes3[] = "Frecuencias N3";
+constexpr static char deSizes3[] = "Häufigkeiten N3";
+constexpr static char ptSizes3[] = "Frequências N3";
+constexpr static char enSkip[] = "Skip";
+constexpr static char frSkip[] = "Passer";
+constexpr static char esSkip[] = "Saltar";
+constexpr static char deSkip[] = "Uberspringen";
+constexpr static char ptSkip[] = "Pular";
+constexpr static char enSmallFont[] = "Small ";
+constexpr static char frSmallFont[] = "Petit ";
+constexpr static char esSmallFont[] = "Pequeño ";
+constexpr static char deSmallFont[] = "Kleine ";
+constexpr static char ptSmallFont[] = "Pequeno ";
+constexpr static char enSoftwareVersion[] = "Software version";
+constexpr static char frSoftwareVersion[] = "Version du logiciel";
+constexpr static char esSoftwareVersion[] = "Versión de software";
+constexpr static char deSoftwareVersion[] = "Softwareversion";
+constexpr static char ptSoftwareVersion[] = "Versão do software";
+constexpr static char enSolution[] = "Solution";
+constexpr static char frSolution[] = "Solution";
+constexpr static char esSolution[] = "Solución";
+constexpr static char deSolution[] = "Lösung";
+constexpr static char ptSolution[] = "Solução";
+constexpr static char enSolverApp[] = "Equations";
+constexpr static char frSolverApp[] = "Equations";
+constexpr static char esSolverApp[] = "Ecuaciones";
+constexpr static char deSolverApp[] = "Gleichungen";
+constexpr static char ptSolverApp[] = "Equações";
+constexpr static char enSolverAppCapital[] = "EQUATIONS";
+constexpr static char frSolverAppCapital[] = "EQUATIONS";
+constexpr static char esSolverAppCapital[] = "ECUACIONES";
+constexpr static char deSolverAppCapital[] = "GLEICHUNGEN";
+constexpr static char ptSolverAppCapital[] = "EQUACOES";
+constexpr static char enSort[] = "Sort ascending ";
+constexpr static char frSort[] = "Tri croissant";
+constexpr static char esSort[] = "Clasificación ascendente";
+constexpr static char deSort[] = "Sortieren aufsteigend";
+constexpr static char ptSort[] = "Ordem crescente";
+constexpr static char enSquareSum[] = "Sum of squares";
+constexpr static char frSquareSum[] = "Somme des carrés";
+constexpr static char esSquareSum[] = "Suma cuadrados";
+constexpr static char deSquareSum[] = "Quadratsumme";
+constexpr static char ptSquareSum[] = "Soma dos quadrados";
+constexpr static char enStandardDeviation[] = "Standard deviation";
+constexpr static char frStandardDeviation[] = "Ecart type";
+constexpr static char esStandardDeviation[] = "Desviación típica";
+constexpr static char deStandardDeviation[] = "Standardabweichung";
+constexpr static char ptStandardDeviation[] = "Desvio padrão";
+constexpr static char enStandardDeviationSigma[] = "Standard deviation σ";
+constexpr static char frStandardDeviationSigma[] = "Ecart type";
+constexpr static char esStandardDeviationSigma[] = "Desviación típica σ";
+constexpr static char deStandardDeviationSigma[] = "Standardabweichung σ";
+constexpr static char ptStandardDeviationSigma[] = "Desvio padrão σ";
+constexpr static char enStatTab[] = "Stats";
+constexpr static char frStatTab[] = "Stats";
+constexpr static char esStatTab[] = "Medidas";
+constexpr static char deStatTab[] = "Stats";
+constexpr static char ptStatTab[] = "Estat";
+constexpr static char enStatsApp[] = "Statistics";
+constexpr static char frStatsApp[] = "Statistiques";
+constexpr static char esStatsApp[] = "Estadística";
+constexpr static char deStatsApp[] = "Statistik";
+constexpr static char ptStatsApp[] = "Estatística";
+constexpr static char enStatsAppCapital[] = "STATISTICS";
+constexpr static char frStatsAppCapital[] = "STATISTIQUES";
+constexpr static char esStatsAppCapital[] = "ESTADISTICA";
+constexpr static char deStatsAppCapital[] = "STATISTIK";
+constexpr static char ptStatsAppCapital[] = "ESTATISTICA";
+constexpr static char enStep[] = "Step";
+constexpr static char frStep[] = "Pas";
+constexpr static char esStep[] = "Incremento";
+constexpr static char deStep[] = "Schrittwert";
+constexpr static char ptStep[] = "Passo";
+constexpr static char enStorageMemoryFull1[] = "The memory is full.";
+constexpr static char frStorageMemoryFull1[] = "La mémoire est pleine.";
+constexpr static char esStorageMemoryFull1[] = "La memoria está llena.";
+constexpr static char deStorageMemoryFull1[] = "Der Speicher ist voll. Löschen Sie";
+constexpr static char ptStorageMemoryFull1[] = "A memoria esta cheia.";
+constexpr static char enStorageMemoryFull2[] = "Erase data and try again.";
+constexpr static char frStorageMemoryFull2[] = "Effacez des données et réessayez.";
+constexpr static char esStorageMemoryFull2[] = "Borre datos e intente de nuevo.";
+constexpr static char deStorageMemoryFull2[] = "von Daten und versuchen Sie es erneut.";
+constexpr static char ptStorageMemoryFull2[] = "Apage dados e tente novamente.";
+constexpr static char enStoreExpressionNotAllowed[] = "'store' is not allowed";
+constexpr static char frStoreExpressionNotAllowed[] = "'store' n'est pas autorisé";
+constexpr static char esStoreExpressionNotAllowed[] = "'store' no está permitido";
+constexpr static char deStoreExpressionNotAllowed[] = "'store' ist verboten";
+constexpr static char ptStoreExpressionNotAllowed[] = "'store' não está permitido";
+constexpr static char enStudentDistribution[] = "Student's distribution";
+constexpr static char frStudentDistribution[] = "Loi de Student";
+constexpr static char esStudentDistribution[] = "Distribución de Student";
+constexpr static char deStudentDistribution[] = "Student-Verteilung";
+constexpr static char ptStudentDistribution[] = "Distribuição de Student";
+constexpr static char enSuccessProbability[] = "p: Success probability";
+constexpr static char frSuccessProbability[] = "p : Probabilité de succès";
+constexpr static char esSuccessProbability[] = "p : Probabilidad de éxito ";
+constexpr static char deSuccessProbability[] = "p: Erfolgswahrscheinlichkeit";
+constexpr static char ptSuccessProbability[] = "p : Probabilidade de sucesso";
+constexpr static char enSum[] = "Sum";
+constexpr static char frSum[] = "Somme";
+constexpr static char esSum[] = "Suma";
+constexpr static char deSum[] = "Summe";
+constexpr static char ptSum[] = "Somatório";
+constexpr static char enSyntaxError[] = "Syntax error";
+constexpr static char frSyntaxError[] = "Attention à la syntaxe";
+constexpr static char esSyntaxError[] = "Error sintáctico";
+constexpr static char deSyntaxError[] = "Syntaxfehler";
+constexpr static char ptSyntaxError[] = "Erro de sintaxe";
+constexpr static char enTEnd[] = "T end";
+constexpr static char frTEnd[] = "T fin";
+constexpr static char esTEnd[] = "T fin";
+constexpr static char deTEnd[] = "T Endwert";
+constexpr static char ptTEnd[] = "T fim";
+constexpr static char enTStart[] = "T start";
+constexpr static char frTStart[] = "T début";
+constexpr static char esTStart[] = "T inicio";
+constexpr static char deTStart[] = "T Startwert";
+constexpr static char ptTStart[] = "T inicio";
+constexpr static char enTangent[] = "Tangent";
+constexpr static char frTangent[] = "Tangente";
+constexpr static char esTangent[] = "Tangente";
+constexpr static char deTangent[] = "Tangente";
+constexpr static char ptTangent[] = "Tangente";
+constexpr static char enTermSum[] = "Sum of terms";
+constexpr static char frTermSum[] = "Somme des termes";
+constexpr static char esTermSum[] = "Suma de términos";
+constexpr static char deTermSum[] = "Summe der Terme";
+constexpr static char ptTermSum[] = "Soma dos termos";
+constexpr static char enThetaEnd[] = "θ end";
+constexpr static char frThetaEnd[] = "θ fin";
+constexpr static char esThetaEnd[] = "θ fin";
+constexpr static char deThetaEnd[] = "θ Endwert";
+constexpr static char ptThetaEnd[] = "θ fim";
+constexpr static char enThetaStart[] = "θ start";
+constexpr static char frThetaStart[] = "θ début";
+constexpr static char esThetaStart[] = "θ inicio";
+constexpr static char deThetaStart[] = "θ Startwert";
+constexpr static char ptThetaStart[] = "θ inicio";
+constexpr static char enThirdQuartile[] = "Third quartile";
+constexpr static char frThirdQuartile[] = "Troisième quartile";
+constexpr static char esThirdQuartile[] = "Tercer cuartil";
+constexpr static char deThirdQuartile[] = "Oberes Quartil";
+constexpr static char ptThirdQuartile[] = "Quartil superior";
+constexpr static char enToDeactivateExamMode1[] = "To deactivate the exam mode,";
+constexpr static char frToDeactivateExamMode1[] = "Pour désactiver le mode examen,";
+constexpr static char esToDeactivateExamMode1[] = "Para desactivar el modo examen,";
+constexpr static char deToDeactivateExamMode1[] = "Um den Testmodus auszuschalten,";
+constexpr static char ptToDeactivateExamMode1[] = "Para desactivar o modo de exame,";
+constexpr static char enToDeactivateExamMode2[] = "plug the calculator to a computer";
+constexpr static char frToDeactivateExamMode2[] = "brancher la calculatrice à un";
+constexpr static char esToDeactivateExamMode2[] = "conecte la calculadora a un ordenador";
+constexpr static char deToDeactivateExamMode2[] = "schließen Sie den Rechner an einen";
+constexpr static char ptToDeactivateExamMode2[] = "ligue a calculadora a um computador";
+constexpr static char enToDeactivateExamMode3[] = "or to a power socket.";
+constexpr static char frToDeactivateExamMode3[] = "ordinateur ou à une prise de courant.";
+constexpr static char esToDeactivateExamMode3[] = "o a un enchufe eléctrico.";
+constexpr static char deToDeactivateExamMode3[] = "Computer oder eine Steckdose an.";
+constexpr static char ptToDeactivateExamMode3[] = "ou a uma tomada eléctrica.";
+constexpr static char enToZoom[] = "Zoom: ";
+constexpr static char frToZoom[] = "Zoomer : ";
+constexpr static char esToZoom[] = "Zoom : ";
+constexpr static char deToZoom[] = "Zoom: ";
+constexpr static char ptToZoom[] = "Zoom : ";
+constexpr static char enTooManyVariables[] = "There are too many unknowns";
+constexpr static char frTooManyVariables[] = "Le nombre d'inconnues est trop grand";
+constexpr static char esTooManyVariables[] = "Hay demasiadas incógnitas";
+constexpr static char deTooManyVariables[] = "Es gibt zu viele Unbekannte";
+constexpr static char ptTooManyVariables[] = "Existem muitas incógnitas";
+constexpr static char enToolbox[] = "Toolbox";
+constexpr static char frToolbox[] = "Boîte à outils";
+constexpr static char esToolbox[] = "Caja de herramientas";
+constexpr static char deToolbox[] = "Werkzeugkasten";
+constexpr static char ptToolbox[] = "Caixa de ferramentas";
+constexpr static char enTotalSize[] = "Total size";
+constexpr static char frTotalSize[] = "Effectif total";
+constexpr static char esTotalSize[] = "Población";
+constexpr static char deTotalSize[] = "Anzahl der Elemente";
+constexpr static char ptTotalSize[] = "Número de itens";
+constexpr static char enTrace[] = "Trace";
+constexpr static char frTrace[] = "Trace";
+constexpr static char esTrace[] = "Traza";
+constexpr static char deTrace[] = "Spur";
+constexpr static char ptTrace[] = "Traço";
+constexpr static char enTranspose[] = "Transpose";
+constexpr static char frTranspose[] = "Transposée";
+constexpr static char esTranspose[] = "Transpuesta";
+constexpr static char deTranspose[] = "Transponierte";
+constexpr static char ptTranspose[] = "Matriz transposta";
+constexpr static char enTrigonometric[] = "Trigonometrical";
+constexpr static char frTrigonometric[] = "Trigonométrique";
+constexpr static char esTrigonometric[] = "Trigonométrico";
+constexpr static char deTrigonometric[] = "Trigonometrisch";
+constexpr static char ptTrigonometric[] = "Trigonométrico";
+constexpr static char enTrigonometrical[] = "Trigonometric";
+constexpr static char frTrigonometrical[] = "Trigonométrique";
+constexpr static char esTrigonometrical[] = "Trigonométrica";
+constexpr static char deTrigonometrical[] = "Trigonometrische";
+constexpr static char ptTrigonometrical[] = "Trigonométrica";
+constexpr static char enUSBConnected[] = "THE CALCULATOR IS CONNECTED";
+constexpr static char frUSBConnected[] = "LA CALCULATRICE EST CONNECTEE";
+constexpr static char esUSBConnected[] = "CALCULADORA CONECTADA";
+constexpr static char deUSBConnected[] = "DER RECHNER IST ANGESCHLOSSEN";
+constexpr static char ptUSBConnected[] = "A CALCULADORA ESTA CONECTADA";
+constexpr static char enUndefinedEquation[] = "Undefined equation";
+constexpr static char frUndefinedEquation[] = "Une équation est indéfinie";
+constexpr static char esUndefinedEquation[] = "Una ecuación es indefinida";
+constexpr static char deUndefinedEquation[] = "Nicht definierte Gleichung";
+constexpr static char ptUndefinedEquation[] = "Uma equação é indefinida";
+constexpr static char enUndefinedValue[] = "Undefined value";
+constexpr static char frUndefinedValue[] = "Valeur non définie";
+constexpr static char esUndefinedValue[] = "Valor indefinido";
+constexpr static char deUndefinedValue[] = "Nicht definierter Wert";
+constexpr static char ptUndefinedValue[] = "Valor indefinido";
+constexpr static char enUniformDistribution[] = "Uniform distribution";
+constexpr static char frUniformDistribution[] = "Loi uniforme";
+constexpr static char esUniformDistribution[] = "Distribución uniforme";
+constexpr static char deUniformDistribution[] = "Uniformverteilung";
+constexpr static char ptUniformDistribution[] = "Distribuição uniforme";
+constexpr static char enUniforme[] = "Uniform";
+constexpr static char frUniforme[] = "Uniforme";
+constexpr static char esUniforme[] = "Uniforme";
+constexpr static char deUniforme[] = "Uniform";
+constexpr static char ptUniforme[] = "Uniforme";
+constexpr static char enUnit[] = "Units";
+constexpr static char frUnit[] = "Unités";
+constexpr static char esUnit[] = "Units";
+constexpr static char deUnit[] = "Units";
+constexpr static char ptUnit[] = "Units";
+constexpr static char enUnitAmountMenu[] = "Amount of substance";
+constexpr static char frUnitAmountMenu[] = "Quantité de matière";
+constexpr static char esUnitAmountMenu[] = "Amount of substance";
+constexpr static char deUnitAmountMenu[] = "Amount of substance";
+constexpr static char ptUnitAmountMenu[] = "Amount of substance";
+constexpr static char enUnitAmountMole[] = "Mole";
+constexpr static char frUnitAmountMole[] = "Mole";
+constexpr static char esUnitAmountMole[] = "Mole";
+constexpr static char deUnitAmountMole[] = "Mole";
+constexpr static char ptUnitAmountMole[] = "Mole";
+constexpr static char enUnitAmountMoleMicro[] = "Micromole";
+constexpr static char frUnitAmountMoleMicro[] = "Micromole";
+constexpr static char esUnitAmountMoleMicro[] = "Micromole";
+constexpr static char deUnitAmountMoleMicro[] = "Micromole";
+constexpr static char ptUnitAmountMoleMicro[] = "Micromole";
+constexpr static char enUnitAmountMoleMilli[] = "Millimole";
+constexpr static char frUnitAmountMoleMilli[] = "Millimole";
+constexpr static char esUnitAmountMoleMilli[] = "Millimole";
+constexpr static char deUnitAmountMoleMilli[] = "Millimole";
+constexpr static char ptUnitAmountMoleMilli[] = "Millimole";
+constexpr static char enUnitCapacitanceFarad[] = "Farad";
+constexpr static char frUnitCapacitanceFarad[] = "Farad";
+constexpr static char esUnitCapacitanceFarad[] = "Farad";
+constexpr static char deUnitCapacitanceFarad[] = "Farad";
+constexpr static char ptUnitCapacitanceFarad[] = "Farad";
+constexpr static char enUnitCapacitanceFaradMicro[] = "Microfarad";
+constexpr static char frUnitCapacitanceFaradMicro[] = "Microfarad";
+constexpr static char esUnitCapacitanceFaradMicro[] = "Microfarad";
+constexpr static char deUnitCapacitanceFaradMicro[] = "Microfarad";
+constexpr static char ptUnitCapacitanceFaradMicro[] = "Microfarad";
+constexpr static char enUnitCapacitanceFaradMilli[] = "Millifarad";
+constexpr static char frUnitCapacitanceFaradMilli[] = "Millifarad";
+constexpr static char esUnitCapacitanceFaradMilli[] = "Millifarad";
+constexpr static char deUnitCapacitanceFaradMilli[] = "Millifarad";
+constexpr static char ptUnitCapacitanceFaradMilli[] = "Millifarad";
+constexpr static char enUnitCapacitanceMenu[] = "Electrical capacitance";
+constexpr static char frUnitCapacitanceMenu[] = "Capacité électrique";
+constexpr static char esUnitCapacitanceMenu[] = "Electrical capacitance";
+constexpr static char deUnitCapacitanceMenu[] = "Electrical capacitance";
+constexpr static char ptUnitCapacitanceMenu[] = "Electrical capacitance";
+constexpr static char enUnitChargeCoulomb[] = "Coulomb";
+constexpr static char frUnitChargeCoulomb[] = "Coulomb";
+constexpr static char esUnitChargeCoulomb[] = "Coulomb";
+constexpr static char deUnitChargeCoulomb[] = "Coulomb";
+constexpr static char ptUnitChargeCoulomb[] = "Coulomb";
+constexpr static char enUnitConductanceMenu[] = "Electrical conductance";
+constexpr static char frUnitConductanceMenu[] = "Conductance électrique";
+constexpr static char esUnitConductanceMenu[] = "Electrical conductance";
+constexpr static char deUnitConductanceMenu[] = "Electrical conductance";
+constexpr static char ptUnitConductanceMenu[] = "Electrical conductance";
+constexpr static char enUnitConductanceSiemens[] = "Siemens";
+constexpr static char frUnitConductanceSiemens[] = "Siemens";
+constexpr static char esUnitConductanceSiemens[] = "Siemens";
+constexpr static char deUnitConductanceSiemens[] = "Siemens";
+constexpr static char ptUnitConductanceSiemens[] = "Siemens";
+constexpr static char enUnitConductanceSiemensMilli[] = "Millisiemens";
+constexpr static char frUnitConductanceSiemensMilli[] = "Millisiemens";
+constexpr static char esUnitConductanceSiemensMilli[] = "Millisiemens";
+constexpr static char deUnitConductanceSiemensMilli[] = "Millisiemens";
+constexpr static char ptUnitConductanceSiemensMilli[] = "Millisiemens";
+constexpr static char enUnitCurrentAmpere[] = "Ampere";
+constexpr static char frUnitCurrentAmpere[] = "Ampère";
+constexpr static char esUnitCurrentAmpere[] = "Ampere";
+constexpr static char deUnitCurrentAmpere[] = "Ampere";
+constexpr static char ptUnitCurrentAmpere[] = "Ampere";
+constexpr static char enUnitCurrentAmpereMicro[] = "Microampere";
+constexpr static char frUnitCurrentAmpereMicro[] = "Microampère";
+constexpr static char esUnitCurrentAmpereMicro[] = "Microampere";
+constexpr static char deUnitCurrentAmpereMicro[] = "Microampere";
+constexpr static char ptUnitCurrentAmpereMicro[] = "Microampere";
+constexpr static char enUnitCurrentAmpereMilli[] = "Milliampere";
+constexpr static char frUnitCurrentAmpereMilli[] = "Milliampère";
+constexpr static char esUnitCurrentAmpereMilli[] = "Milliampere";
+constexpr static char deUnitCurrentAmpereMilli[] = "Milliampere";
+constexpr static char ptUnitCurrentAmpereMilli[] = "Milliampere";
+constexpr static char enUnitCurrentMenu[] = "Electric current";
+constexpr static char frUnitCurrentMenu[] = "Intensité du courant électrique";
+constexpr static char esUnitCurrentMenu[] = "Electric current";
+constexpr static char deUnitCurrentMenu[] = "Electric current";
+constexpr static char ptUnitCurrentMenu[] = "Electric current";
+constexpr static char enUnitDistanceAstronomicalUnit[] = "Astronomical unit";
+constexpr static char frUnitDistanceAstronomicalUnit[] = "Unité astronomique";
+constexpr static char esUnitDistanceAstronomicalUnit[] = "Astronomical unit";
+constexpr static char deUnitDistanceAstronomicalUnit[] = "Astronomical unit";
+constexpr static char ptUnitDistanceAstronomicalUnit[] = "Astronomical unit";
+constexpr static char enUnitDistanceLightYear[] = "Light year";
+constexpr static char frUnitDistanceLightYear[] = "Année lumière";
+constexpr static char esUnitDistanceLightYear[] = "Light year";
+constexpr static char deUnitDistanceLightYear[] = "Light year";
+constexpr static char ptUnitDistanceLightYear[] = "Light year";
+constexpr static char enUnitDistanceMenu[] = "Distance";
+constexpr static char frUnitDistanceMenu[] = "Distance";
+constexpr static char esUnitDistanceMenu[] = "Distance";
+constexpr static char deUnitDistanceMenu[] = "Distance";
+constexpr static char ptUnitDistanceMenu[] = "Distance";
+constexpr static char enUnitDistanceMeter[] = "Meter";
+constexpr static char frUnitDistanceMeter[] = "Mètre";
+constexpr static char esUnitDistanceMeter[] = "Meter";
+constexpr static char deUnitDistanceMeter[] = "Meter";
+constexpr static char ptUnitDistanceMeter[] = "Meter";
+constexpr static char enUnitDistanceMeterKilo[] = "Kilometer";
+constexpr static char frUnitDistanceMeterKilo[] = "Kilomètre";
+constexpr static char esUnitDistanceMeterKilo[] = "Kilometer";
+constexpr static char deUnitDistanceMeterKilo[] = "Kilometer";
+constexpr static char ptUnitDistanceMeterKilo[] = "Kilometer";
+constexpr static char enUnitDistanceMeterMenu[] = "Meter";
+constexpr static char frUnitDistanceMeterMenu[] = "Mètre";
+constexpr static char esUnitDistanceMeterMenu[] = "Meter";
+constexpr static char deUnitDistanceMeterMenu[] = "Meter";
+constexpr static char ptUnitDistanceMeterMenu[] = "Meter";
+constexpr static char enUnitDistanceMeterMicro[] = "Micrometer";
+constexpr static char frUnitDistanceMeterMicro[] = "Micromètre";
+constexpr static char esUnitDistanceMeterMicro[] = "Micrometer";
+constexpr static char deUnitDistanceMeterMicro[] = "Micrometer";
+constexpr static char ptUnitDistanceMeterMicro[] = "Micrometer";
+constexpr static char enUnitDistanceMeterMilli[] = "Millimeter";
+constexpr static char frUnitDistanceMeterMilli[] = "Millimètre";
+constexpr static char esUnitDistanceMeterMilli[] = "Millimeter";
+constexpr static char deUnitDistanceMeterMilli[] = "Millimeter";
+constexpr static char ptUnitDistanceMeterMilli[] = "Millimeter";
+constexpr static char enUnitDistanceMeterNano[] = "Nanometer";
+constexpr static char frUnitDistanceMeterNano[] = "Nanomètre";
+constexpr static char esUnitDistanceMeterNano[] = "Nanometer";
+constexpr static char deUnitDistanceMeterNano[] = "Nanometer";
+constexpr static char ptUnitDistanceMeterNano[] = "Nanometer";
+constexpr static char enUnitDistanceMeterPico[] = "Picometer";
+constexpr static char frUnitDistanceMeterPico[] = "Picomètre";
+constexpr static char esUnitDistanceMeterPico[] = "Picometer";
+constexpr static char deUnitDistanceMeterPico[] = "Picometer";
+constexpr static char ptUnitDistanceMeterPico[] = "Picometer";
+constexpr static char enUnitDistanceParsec[] = "Parsec";
+constexpr static char frUnitDistanceParsec[] = "Parsec";
+constexpr static char esUnitDistanceParsec[] = "Parsec";
+constexpr static char deUnitDistanceParsec[] = "Parsec";
+constexpr static char ptUnitDistanceParsec[] = "Parsec";
+constexpr static char enUnitElectricChargeMenu[] = "Electric charge";
+constexpr static char frUnitElectricChargeMenu[] = "Charge électrique";
+constexpr static char esUnitElectricChargeMenu[] = "Electric charge";
+constexpr static char deUnitElectricChargeMenu[] = "Electric charge";
+constexpr static char ptUnitElectricChargeMenu[] = "Electric charge";
+constexpr static char enUnitEnergyElectronVolt[] = "Electronvolt";
+constexpr static char frUnitEnergyElectronVolt[] = "Electronvolt";
+constexpr static char esUnitEnergyElectronVolt[] = "Electronvolt";
+constexpr static char deUnitEnergyElectronVolt[] = "Electronvolt";
+constexpr static char ptUnitEnergyElectronVolt[] = "Electronvolt";
+constexpr static char enUnitEnergyElectronVoltKilo[] = "Kiloelectronvolt";
+constexpr static char frUnitEnergyElectronVoltKilo[] = "Kiloelectronvolt";
+constexpr static char esUnitEnergyElectronVoltKilo[] = "Kiloelectronvolt";
+constexpr static char deUnitEnergyElectronVoltKilo[] = "Kiloelectronvolt";
+constexpr static char ptUnitEnergyElectronVoltKilo[] = "Kiloelectronvolt";
+constexpr static char enUnitEnergyElectronVoltMega[] = "Megaelectronvolt";
+constexpr static char frUnitEnergyElectronVoltMega[] = "Megaelectronvolt";
+constexpr static char esUnitEnergyElectronVoltMega[] = "Megaelectronvolt";
+constexpr static char deUnitEnergyElectronVoltMega[] = "Megaelectronvolt";
+constexpr static char ptUnitEnergyElectronVoltMega[] = "Megaelectronvolt";
+constexpr static char enUnitEnergyElectronVoltMilli[] = "Millielectronvolt";
+constexpr static char frUnitEnergyElectronVoltMilli[] = "Millielectronvolt";
+constexpr static char esUnitEnergyElectronVoltMilli[] = "Millielectronvolt";
+constexpr static char deUnitEnergyElectronVoltMilli[] = "Millielectronvolt";
+constexpr static char ptUnitEnergyElectronVoltMilli[] = "Millielectronvolt";
+constexpr static char enUnitEnergyEletronVoltMenu[] = "Electronvolt";
+constexpr static char frUnitEnergyEletronVoltMenu[] = "Electronvolt";
+constexpr static char esUnitEnergyEletronVoltMenu[] = "Electronvolt";
+constexpr static char deUnitEnergyEletronVoltMenu[] = "Electronvolt";
+constexpr static char ptUnitEnergyEletronVoltMenu[] = "Electronvolt";
+constexpr static char enUnitEnergyJoule[] = "Joule";
+constexpr static char frUnitEnergyJoule[] = "Joule";
+constexpr static char esUnitEnergyJoule[] = "Joule";
+constexpr static char deUnitEnergyJoule[] = "Joule";
+constexpr static char ptUnitEnergyJoule[] = "Joule";
+constexpr static char enUnitEnergyJouleKilo[] = "Kilojoule";
+constexpr static char frUnitEnergyJouleKilo[] = "Kilojoule";
+constexpr static char esUnitEnergyJouleKilo[] = "Kilojoule";
+constexpr static char deUnitEnergyJouleKilo[] = "Kilojoule";
+constexpr static char ptUnitEnergyJouleKilo[] = "Kilojoule";
+constexpr static char enUnitEnergyJouleMenu[] = "Joule";
+constexpr static char frUnitEnergyJouleMenu[] = "Joule";
+constexpr static char esUnitEnergyJouleMenu[] = "Joule";
+constexpr static char deUnitEnergyJouleMenu[] = "Joule";
+constexpr static char ptUnitEnergyJouleMenu[] = "Joule";
+constexpr static char enUnitEnergyJouleMilli[] = "Millijoule";
+constexpr static char frUnitEnergyJouleMilli[] = "Millijoule";
+constexpr static char esUnitEnergyJouleMilli[] = "Millijoule";
+constexpr static char deUnitEnergyJouleMilli[] = "Millijoule";
+constexpr static char ptUnitEnergyJouleMilli[] = "Millijoule";
+constexpr static char enUnitEnergyMenu[] = "Energy";
+constexpr static char frUnitEnergyMenu[] = "Energie";
+constexpr static char esUnitEnergyMenu[] = "Energy";
+constexpr static char deUnitEnergyMenu[] = "Energy";
+constexpr static char ptUnitEnergyMenu[] = "Energy";
+constexpr static char enUnitForceMenu[] = "Force";
+constexpr static char frUnitForceMenu[] = "Force";
+constexpr static char esUnitForceMenu[] = "Force";
+constexpr static char deUnitForceMenu[] = "Force";
+constexpr static char ptUnitForceMenu[] = "Force";
+constexpr static char enUnitForceNewton[] = "Newton";
+constexpr static char frUnitForceNewton[] = "Newton";
+constexpr static char esUnitForceNewton[] = "Newton";
+constexpr static char deUnitForceNewton[] = "Newton";
+constexpr static char ptUnitForceNewton[] = "Newton";
+constexpr static char enUnitForceNewtonKilo[] = "Kilonewton";
+constexpr static char frUnitForceNewtonKilo[] = "Kilonewton";
+constexpr static char esUnitForceNewtonKilo[] = "Kilonewton";
+constexpr static char deUnitForceNewtonKilo[] = "Kilonewton";
+constexpr static char ptUnitForceNewtonKilo[] = "Kilonewton";
+constexpr static char enUnitForceNewtonMilli[] = "Millinewton";
+constexpr static char frUnitForceNewtonMilli[] = "Millinewton";
+constexpr static char esUnitForceNewtonMilli[] = "Millinewton";
+constexpr static char deUnitForceNewtonMilli[] = "Millinewton";
+constexpr static char ptUnitForceNewtonMilli[] = "Millinewton";
+constexpr static char enUnitFrequencyHertz[] = "Hertz";
+constexpr static char frUnitFrequencyHertz[] = "Hertz";
+constexpr static char esUnitFrequencyHertz[] = "Hertz";
+constexpr static char deUnitFrequencyHertz[] = "Hertz";
+constexpr static char ptUnitFrequencyHertz[] = "Hertz";
+constexpr static char enUnitFrequencyHertzGiga[] = "Gigahertz";
+constexpr static char frUnitFrequencyHertzGiga[] = "Gigahertz";
+constexpr static char esUnitFrequencyHertzGiga[] = "Gigahertz";
+constexpr static char deUnitFrequencyHertzGiga[] = "Gigahertz";
+constexpr static char ptUnitFrequencyHertzGiga[] = "Gigahertz";
+constexpr static char enUnitFrequencyHertzKilo[] = "Kilohertz";
+constexpr static char frUnitFrequencyHertzKilo[] = "Kilohertz";
+constexpr static char esUnitFrequencyHertzKilo[] = "Kilohertz";
+constexpr static char deUnitFrequencyHertzKilo[] = "Kilohertz";
+constexpr static char ptUnitFrequencyHertzKilo[] = "Kilohertz";
+constexpr static char enUnitFrequencyHertzMega[] = "Megahertz";
+constexpr static char frUnitFrequencyHertzMega[] = "Megahertz";
+constexpr static char esUnitFrequencyHertzMega[] = "Megahertz";
+constexpr static char deUnitFrequencyHertzMega[] = "Megahertz";
+constexpr static char ptUnitFrequencyHertzMega[] = "Megahertz";
+constexpr static char enUnitFrequencyMenu[] = "Frequency";
+constexpr static char frUnitFrequencyMenu[] = "Fréquence";
+constexpr static char esUnitFrequencyMenu[] = "Frequency";
+constexpr static char deUnitFrequencyMenu[] = "Frequency";
+constexpr static char ptUnitFrequencyMenu[] = "Frequency";
+constexpr static char enUnitInductanceHenry[] = "Henry";
+constexpr static char frUnitInductanceHenry[] = "Henry";
+constexpr static char esUnitInductanceHenry[] = "Henry";
+constexpr static char deUnitInductanceHenry[] = "Henry";
+constexpr static char ptUnitInductanceHenry[] = "Henry";
+constexpr static char enUnitLuminousIntensityCandela[] = "Candela";
+constexpr static char frUnitLuminousIntensityCandela[] = "Candela";
+constexpr static char esUnitLuminousIntensityCandela[] = "Candela";
+constexpr static char deUnitLuminousIntensityCandela[] = "Candela";
+constexpr static char ptUnitLuminousIntensityCandela[] = "Candela";
+constexpr static char enUnitLuminousIntensityMenu[] = "Luminous intensity";
+constexpr static char frUnitLuminousIntensityMenu[] = "Intensité lumineuse";
+constexpr static char esUnitLuminousIntensityMenu[] = "Luminous intensity";
+constexpr static char deUnitLuminousIntensityMenu[] = "Luminous intensity";
+constexpr static char ptUnitLuminousIntensityMenu[] = "Luminous intensity";
+constexpr static char enUnitMagneticFieldMenu[] = "Magnetic field";
+constexpr static char frUnitMagneticFieldMenu[] = "Induction électromagnétique";
+constexpr static char esUnitMagneticFieldMenu[] = "Magnetic field";
+constexpr static char deUnitMagneticFieldMenu[] = "Magnetic field";
+constexpr static char ptUnitMagneticFieldMenu[] = "Magnetic field";
+constexpr static char enUnitMagneticFieldTesla[] = "Tesla";
+constexpr static char frUnitMagneticFieldTesla[] = "Tesla";
+constexpr static char esUnitMagneticFieldTesla[] = "Tesla";
+constexpr static char deUnitMagneticFieldTesla[] = "Tesla";
+constexpr static char ptUnitMagneticFieldTesla[] = "Tesla";
+constexpr static char enUnitMassGram[] = "Gram";
+constexpr static char frUnitMassGram[] = "Gramme";
+constexpr static char esUnitMassGram[] = "Gram";
+constexpr static char deUnitMassGram[] = "Gram";
+constexpr static char ptUnitMassGram[] = "Gram";
+constexpr static char enUnitMassGramKilo[] = "Kilogram";
+constexpr static char frUnitMassGramKilo[] = "Kilogramme";
+constexpr static char esUnitMassGramKilo[] = "Kilogram";
+constexpr static char deUnitMassGramKilo[] = "Kilogram";
+constexpr static char ptUnitMassGramKilo[] = "Kilogram";
+constexpr static char enUnitMassGramMicro[] = "Microgram";
+constexpr static char frUnitMassGramMicro[] = "Microgramme";
+constexpr static char esUnitMassGramMicro[] = "Microgram";
+constexpr static char deUnitMassGramMicro[] = "Microgram";
+constexpr static char ptUnitMassGramMicro[] = "Microgram";
+constexpr static char enUnitMassGramMilli[] = "Milligram";
+constexpr static char frUnitMassGramMilli[] = "Milligramme";
+constexpr static char esUnitMassGramMilli[] = "Milligram";
+constexpr static char deUnitMassGramMilli[] = "Milligram";
+constexpr static char ptUnitMassGramMilli[] = "Milligram";
+constexpr static char enUnitMassGramNano[] = "Nanogram";
+constexpr static char frUnitMassGramNano[] = "Nanogramme";
+constexpr static char esUnitMassGramNano[] = "Nanogram";
+constexpr static char deUnitMassGramNano[] = "Nanogram";
+constexpr static char ptUnitMassGramNano[] = "Nanogram";
+constexpr static char enUnitMassMenu[] = "Mass";
+constexpr static char frUnitMassMenu[] = "Masse";
+constexpr static char esUnitMassMenu[] = "Mass";
+constexpr static char deUnitMassMenu[] = "Mass";
+constexpr static char ptUnitMassMenu[] = "Mass";
+constexpr static char enUnitMassTonne[] = "Tonne";
+constexpr static char frUnitMassTonne[] = "Tonne";
+constexpr static char esUnitMassTonne[] = "Tonne";
+constexpr static char deUnitMassTonne[] = "Tonne";
+constexpr static char ptUnitMassTonne[] = "Tonne";
+constexpr static char enUnitPotentialMenu[] = "Electric potential";
+constexpr static char frUnitPotentialMenu[] = "Tension électrique";
+constexpr static char esUnitPotentialMenu[] = "Electric potential";
+constexpr static char deUnitPotentialMenu[] = "Electric potential";
+constexpr static char ptUnitPotentialMenu[] = "Electric potential";
+constexpr static char enUnitPotentialVolt[] = "Volt";
+constexpr static char frUnitPotentialVolt[] = "Volt";
+constexpr static char esUnitPotentialVolt[] = "Volt";
+constexpr static char deUnitPotentialVolt[] = "Volt";
+constexpr static char ptUnitPotentialVolt[] = "Volt";
+constexpr static char enUnitPotentialVoltKilo[] = "Kilovolt";
+constexpr static char frUnitPotentialVoltKilo[] = "Kilovolt";
+constexpr static char esUnitPotentialVoltKilo[] = "Kilovolt";
+constexpr static char deUnitPotentialVoltKilo[] = "Kilovolt";
+constexpr static char ptUnitPotentialVoltKilo[] = "Kilovolt";
+constexpr static char enUnitPotentialVoltMicro[] = "Microvolt";
+constexpr static char frUnitPotentialVoltMicro[] = "Microvolt";
+constexpr static char esUnitPotentialVoltMicro[] = "Microvolt";
+constexpr static char deUnitPotentialVoltMicro[] = "Microvolt";
+constexpr static char ptUnitPotentialVoltMicro[] = "Microvolt";
+constexpr static char enUnitPotentialVoltMilli[] = "Millivolt";
+constexpr static char frUnitPotentialVoltMilli[] = "Millivolt";
+constexpr static char esUnitPotentialVoltMilli[] = "Millivolt";
+constexpr static char deUnitPotentialVoltMilli[] = "Millivolt";
+constexpr static char ptUnitPotentialVoltMilli[] = "Millivolt";
+constexpr static char enUnitPowerMenu[] = "Power";
+constexpr static char frUnitPowerMenu[] = "Puissance";
+constexpr static char esUnitPowerMenu[] = "Power";
+constexpr static char deUnitPowerMenu[] = "Power";
+constexpr static char ptUnitPowerMenu[] = "Power";
+constexpr static char enUnitPowerWatt[] = "Watt";
+constexpr static char frUnitPowerWatt[] = "Watt";
+constexpr static char esUnitPowerWatt[] = "Watt";
+constexpr static char deUnitPowerWatt[] = "Watt";
+constexpr static char ptUnitPowerWatt[] = "Watt";
+constexpr static char enUnitPowerWattGiga[] = "Gigawatt";
+constexpr static char frUnitPowerWattGiga[] = "Gigawatt";
+constexpr static char esUnitPowerWattGiga[] = "Gigawatt";
+constexpr static char deUnitPowerWattGiga[] = "Gigawatt";
+constexpr static char ptUnitPowerWattGiga[] = "Gigawatt";
+constexpr static char enUnitPowerWattKilo[] = "Kilowatt";
+constexpr static char frUnitPowerWattKilo[] = "Kilowatt";
+constexpr static char esUnitPowerWattKilo[] = "Kilowatt";
+constexpr static char deUnitPowerWattKilo[] = "Kilowatt";
+constexpr static char ptUnitPowerWattKilo[] = "Kilowatt";
+constexpr static char enUnitPowerWattMega[] = "Megawatt";
+constexpr static char frUnitPowerWattMega[] = "Megawatt";
+constexpr static char esUnitPowerWattMega[] = "Megawatt";
+constexpr static char deUnitPowerWattMega[] = "Megawatt";
+constexpr static char ptUnitPowerWattMega[] = "Megawatt";
+constexpr static char enUnitPowerWattMicro[] = "Microwatt";
+constexpr static char frUnitPowerWattMicro[] = "Microwatt";
+constexpr static char esUnitPowerWattMicro[] = "Microwatt";
+constexpr static char deUnitPowerWattMicro[] = "Microwatt";
+constexpr static char ptUnitPowerWattMicro[] = "Microwatt";
+constexpr static char enUnitPowerWattMilli[] = "Milliwatt";
+constexpr static char frUnitPowerWattMilli[] = "Milliwatt";
+constexpr static char esUnitPowerWattMilli[] = "Milliwatt";
+constexpr static char deUnitPowerWattMilli[] = "Milliwatt";
+constexpr static char ptUnitPowerWattMilli[] = "Milliwatt";
+constexpr static char enUnitPressureAtm[] = "Atmosphere";
+constexpr static char frUnitPressureAtm[] = "Atmosphère";
+constexpr static char esUnitPressureAtm[] = "Atmosphere";
+constexpr static char deUnitPressureAtm[] = "Atmosphere";
+constexpr static char ptUnitPressureAtm[] = "Atmosphere";
+constexpr static char enUnitPressureBar[] = "Bar";
+constexpr static char frUnitPressureBar[] = "Bar";
+constexpr static char esUnitPressureBar[] = "Bar";
+constexpr static char deUnitPressureBar[] = "Bar";
+constexpr static char ptUnitPressureBar[] = "Bar";
+constexpr static char enUnitPressureMenu[] = "Pressure";
+constexpr static char frUnitPressureMenu[] = "Pression";
+constexpr static char esUnitPressureMenu[] = "Pressure";
+constexpr static char deUnitPressureMenu[] = "Pressure";
+constexpr static char ptUnitPressureMenu[] = "Pressure";
+constexpr static char enUnitPressurePascal[] = "Pascal";
+constexpr static char frUnitPressurePascal[] = "Pascal";
+constexpr static char esUnitPressurePascal[] = "Pascal";
+constexpr static char deUnitPressurePascal[] = "Pascal";
+constexpr static char ptUnitPressurePascal[] = "Pascal";
+constexpr static char enUnitPressurePascalHecto[] = "Hectopascal";
+constexpr static char frUnitPressurePascalHecto[] = "Hectopascal";
+constexpr static char esUnitPressurePascalHecto[] = "Hectopascal";
+constexpr static char deUnitPressurePascalHecto[] = "Hectopascal";
+constexpr static char ptUnitPressurePascalHecto[] = "Hectopascal";
+constexpr static char enUnitResistanceMenu[] = "Electrical resistance";
+constexpr static char frUnitResistanceMenu[] = "Résistance électrique";
+constexpr static char esUnitResistanceMenu[] = "Electrical resistance";
+constexpr static char deUnitResistanceMenu[] = "Electrical resistance";
+constexpr static char ptUnitResistanceMenu[] = "Electrical resistance";
+constexpr static char enUnitResistanceOhm[] = "Ohm";
+constexpr static char frUnitResistanceOhm[] = "Ohm";
+constexpr static char esUnitResistanceOhm[] = "Ohm";
+constexpr static char deUnitResistanceOhm[] = "Ohm";
+constexpr static char ptUnitResistanceOhm[] = "Ohm";
+constexpr static char enUnitResistanceOhmKilo[] = "Kiloohm";
+constexpr static char frUnitResistanceOhmKilo[] = "Kiloohm";
+constexpr static char esUnitResistanceOhmKilo[] = "Kiloohm";
+constexpr static char deUnitResistanceOhmKilo[] = "Kiloohm";
+constexpr static char ptUnitResistanceOhmKilo[] = "Kiloohm";
+constexpr static char enUnitSurfaceHectar[] = "Hectare";
+constexpr static char frUnitSurfaceHectar[] = "Hectare";
+constexpr static char esUnitSurfaceHectar[] = "Hectare";
+constexpr static char deUnitSurfaceHectar[] = "Hectare";
+constexpr static char ptUnitSurfaceHectar[] = "Hectare";
+constexpr static char enUnitSurfaceMenu[] = "Area";
+constexpr static char frUnitSurfaceMenu[] = "Superficie";
+constexpr static char esUnitSurfaceMenu[] = "Area";
+constexpr static char deUnitSurfaceMenu[] = "Area";
+constexpr static char ptUnitSurfaceMenu[] = "Area";
+constexpr static char enUnitTemperatureKelvin[] = "Kelvin";
+constexpr static char frUnitTemperatureKelvin[] = "Kelvin";
+constexpr static char esUnitTemperatureKelvin[] = "Kelvin";
+constexpr static char deUnitTemperatureKelvin[] = "Kelvin";
+constexpr static char ptUnitTemperatureKelvin[] = "Kelvin";
+constexpr static char enUnitTemperatureMenu[] = "Temperature";
+constexpr static char frUnitTemperatureMenu[] = "Température";
+constexpr static char esUnitTemperatureMenu[] = "Temperature";
+constexpr static char deUnitTemperatureMenu[] = "Temperature";
+constexpr static char ptUnitTemperatureMenu[] = "Temperature";
+constexpr static char enUnitTimeDay[] = "Day";
+constexpr static char frUnitTimeDay[] = "Jour";
+constexpr static char esUnitTimeDay[] = "Day";
+constexpr static char deUnitTimeDay[] = "Day";
+constexpr static char ptUnitTimeDay[] = "Day";
+constexpr static char enUnitTimeHour[] = "Hour";
+constexpr static char frUnitTimeHour[] = "Heure";
+constexpr static char esUnitTimeHour[] = "Hour";
+constexpr static char deUnitTimeHour[] = "Hour";
+constexpr static char ptUnitTimeHour[] = "Hour";
+constexpr static char enUnitTimeMenu[] = "Time";
+constexpr static char frUnitTimeMenu[] = "Temps";
+constexpr static char esUnitTimeMenu[] = "Time";
+constexpr static char deUnitTimeMenu[] = "Time";
+constexpr static char ptUnitTimeMenu[] = "Time";
+constexpr static char enUnitTimeMinute[] = "Minute";
+constexpr static char frUnitTimeMinute[] = "Minute";
+constexpr static char esUnitTimeMinute[] = "Minute";
+constexpr static char deUnitTimeMinute[] = "Minute";
+constexpr static char ptUnitTimeMinute[] = "Minute";
+constexpr static char enUnitTimeMonth[] = "Month";
+constexpr static char frUnitTimeMonth[] = "Mois";
+constexpr static char esUnitTimeMonth[] = "Month";
+constexpr static char deUnitTimeMonth[] = "Month";
+constexpr static char ptUnitTimeMonth[] = "Month";
+constexpr static char enUnitTimeSecond[] = "Second";
+constexpr static char frUnitTimeSecond[] = "Seconde";
+constexpr static char esUnitTimeSecond[] = "Second";
+constexpr static char deUnitTimeSecond[] = "Second";
+constexpr static char ptUnitTimeSecond[] = "Second";
+constexpr static char enUnitTimeSecondMenu[] = "Second";
+constexpr static char frUnitTimeSecondMenu[] = "Seconde";
+constexpr static char esUnitTimeSecondMenu[] = "Second";
+constexpr static char deUnitTimeSecondMenu[] = "Second";
+constexpr static char ptUnitTimeSecondMenu[] = "Second";
+constexpr static char enUnitTimeSecondMicro[] = "Microsecond";
+constexpr static char frUnitTimeSecondMicro[] = "Microseconde";
+constexpr static char esUnitTimeSecondMicro[] = "Microsecond";
+constexpr static char deUnitTimeSecondMicro[] = "Microsecond";
+constexpr static char ptUnitTimeSecondMicro[] = "Microsecond";
+constexpr static char enUnitTimeSecondMilli[] = "Millisecond";
+constexpr static char frUnitTimeSecondMilli[] = "Milliseconde";
+constexpr static char esUnitTimeSecondMilli[] = "Millisecond";
+constexpr static char deUnitTimeSecondMilli[] = "Millisecond";
+constexpr static char ptUnitTimeSecondMilli[] = "Millisecond";
+constexpr static char enUnitTimeSecondNano[] = "Nanosecond";
+constexpr static char frUnitTimeSecondNano[] = "Nanoseconde";
+constexpr static char esUnitTimeSecondNano[] = "Nanosecond";
+constexpr static char deUnitTimeSecondNano[] = "Nanosecond";
+constexpr static char ptUnitTimeSecondNano[] = "Nanosecond";
+constexpr static char enUnitTimeWeek[] = "Week";
+constexpr static char frUnitTimeWeek[] = "Semaine";
+constexpr static char esUnitTimeWeek[] = "Week";
+constexpr static char deUnitTimeWeek[] = "Week";
+constexpr static char ptUnitTimeWeek[] = "Week";
+constexpr static char enUnitTimeYear[] = "Year";
+constexpr static char frUnitTimeYear[] = "Année";
+constexpr static char esUnitTimeYear[] = "Year";
+constexpr static char deUnitTimeYear[] = "Year";
+constexpr static char ptUnitTimeYear[] = "Year";
+constexpr static char enUnitVolumeLiter[] = "Liter";
+constexpr static char frUnitVolumeLiter[] = "Litre";
+constexpr static char esUnitVolumeLiter[] = "Liter";
+constexpr static char deUnitVolumeLiter[] = "Liter";
+constexpr static char ptUnitVolumeLiter[] = "Liter";
+constexpr static char enUnitVolumeLiterCenti[] = "Centiliter";
+constexpr static char frUnitVolumeLiterCenti[] = "Centilitre";
+constexpr static char esUnitVolumeLiterCenti[] = "Centiliter";
+constexpr static char deUnitVolumeLiterCenti[] = "Centiliter";
+constexpr static char ptUnitVolumeLiterCenti[] = "Centiliter";
+constexpr static char enUnitVolumeLiterDeci[] = "Deciliter";
+constexpr static char frUnitVolumeLiterDeci[] = "Decilitre";
+constexpr static char esUnitVolumeLiterDeci[] = "Deciliter";
+constexpr static char deUnitVolumeLiterDeci[] = "Deciliter";
+constexpr static char ptUnitVolumeLiterDeci[] = "Deciliter";
+constexpr static char enUnitVolumeLiterMilli[] = "Milliliter";
+constexpr static char frUnitVolumeLiterMilli[] = "Millilitre";
+constexpr static char esUnitVolumeLiterMilli[] = "Milliliter";
+constexpr static char deUnitVolumeLiterMilli[] = "Milliliter";
+constexpr static char ptUnitVolumeLiterMilli[] = "Milliliter";
+constexpr static char enUnitVolumeMenu[] = "Volume";
+constexpr static char frUnitVolumeMenu[] = "Volume";
+constexpr static char esUnitVolumeMenu[] = "Volume";
+constexpr static char deUnitVolumeMenu[] = "Volume";
+constexpr static char ptUnitVolumeMenu[] = "Volume";
+constexpr static char enUnrealEquation[] = "Unreal equation";
+constexpr static char frUnrealEquation[] = "Une équation n'est pas réelle";
+constexpr static char esUnrealEquation[] = "Una ecuación no es real";
+constexpr static char deUnrealEquation[] = "Nicht reelle Gleichung";
+constexpr static char ptUnrealEquation[] = "Uma equação não é real";
+constexpr static char enUpdateAvailable[] = "UPDATE AVAILABLE";
+constexpr static char frUpdateAvailable[] = "MISE A JOUR DISPONIBLE";
+constexpr static char esUpdateAvailable[] = "ACTUALIZACION DISPONIBLE";
+constexpr static char deUpdateAvailable[] = "UPDATE VERFUGBAR";
+constexpr static char ptUpdateAvailable[] = "ATUALIZACAO DISPONIVEL";
+constexpr static char enUpdateMessage1[] = "There are important upgrades";
+constexpr static char frUpdateMessage1[] = "Des améliorations importantes existent";
+constexpr static char esUpdateMessage1[] = "Hay mejoras importantes";
+constexpr static char deUpdateMessage1[] = "Wichtige Verbesserungen für Ihren";
+constexpr static char ptUpdateMessage1[] = "Existem melhorias significativas";
+constexpr static char enUpdateMessage2[] = "for your calculator.";
+constexpr static char frUpdateMessage2[] = "pour votre calculatrice.";
+constexpr static char esUpdateMessage2[] = "para su calculadora.";
+constexpr static char deUpdateMessage2[] = "Rechner stehen zur Verfügung.";
+constexpr static char ptUpdateMessage2[] = "para a sua calculadora.";
+constexpr static char enUpdateMessage3[] = "Browse our page from your computer";
+constexpr static char frUpdateMessage3[] = "Connectez-vous depuis votre ordinateur";
+constexpr static char esUpdateMessage3[] = "Visite nuestra página desde su ordenador";
+constexpr static char deUpdateMessage3[] = "Verbinden Sie sich mit Ihrem Computer auf";
+constexpr static char ptUpdateMessage3[] = "Navegue na nossa página do seu computador";
+constexpr static char enUpdateMessage4[] = "www.numworks.com/update";
+constexpr static char frUpdateMessage4[] = "www.numworks.com/update";
+constexpr static char esUpdateMessage4[] = "www.numworks.com/update";
+constexpr static char deUpdateMessage4[] = "www.numworks.com/update.";
+constexpr static char ptUpdateMessage4[] = "www.numworks.com/update";
+constexpr static char enUpdatePopUp[] = "Update pop-up";
+constexpr static char frUpdatePopUp[] = "Rappel mise à jour";
+constexpr static char esUpdatePopUp[] = "Pop-up de actualización";
+constexpr static char deUpdatePopUp[] = "Erinnerung: Update";
+constexpr static char ptUpdatePopUp[] = "Alertas de atualização";
+constexpr static char enUseEquationModel[] = "Use an equation template";
+constexpr static char frUseEquationModel[] = "Utiliser un modèle d'équation";
+constexpr static char esUseEquationModel[] = "Usar un modelo de ecuación";
+constexpr static char deUseEquationModel[] = "Verwenden Sie ein Gleichungsmodell";
+constexpr static char ptUseEquationModel[] = "Usar um modelo de equação";
+constexpr static char enValueNotReachedByFunction[] = "Value not reached by function";
+constexpr static char frValueNotReachedByFunction[] = "Valeur non atteinte par la fonction";
+constexpr static char esValueNotReachedByFunction[] = "No se alcanza este valor";
+constexpr static char deValueNotReachedByFunction[] = "Der Wert wird von der Funktion nicht erreicht";
+constexpr static char ptValueNotReachedByFunction[] = "O valor não é alcançado pela função";
+constexpr static char enValueNotReachedByRegression[] = "Value not reached in this window";
+constexpr static char frValueNotReachedByRegression[] = "Valeur non atteinte dans cette fenêtre";
+constexpr static char esValueNotReachedByRegression[] = "Valor no alcanzado en esta ventana";
+constexpr static char deValueNotReachedByRegression[] = "Wert in diesem Fenster nicht erreicht";
+constexpr static char ptValueNotReachedByRegression[] = "Valor não alcançado nesta janela";
+constexpr static char enValueNotReachedBySequence[] = "Value not reached by sequence";
+constexpr static char frValueNotReachedBySequence[] = "Valeur non atteinte par la suite";
+constexpr static char esValueNotReachedBySequence[] = "No se alcanza este valor";
+constexpr static char deValueNotReachedBySequence[] = "Der Wert wird von der Folge nicht erreicht";
+constexpr static char ptValueNotReachedBySequence[] = "O valor não é alcançado pela sequência";
+constexpr static char enValues1[] = "Values V1";
+constexpr static char frValues1[] = "Valeurs V1";
+constexpr static char esValues1[] = "Valores V1";
+constexpr static char deValues1[] = "Werte V1";
+constexpr static char ptValues1[] = "Valores V1";
+constexpr static char enValues2[] = "Values V2";
+constexpr static char frValues2[] = "Valeurs V2";
+constexpr static char esValues2[] = "Valores V2";
+constexpr static char deValues2[] = "Werte V2";
+constexpr static char ptValues2[] = "Valores V2";
+constexpr static char enValues3[] = "Values V3";
+constexpr static char frValues3[] = "Valeurs V3";
+constexpr static char esValues3[] = "Valores V3";
+constexpr static char deValues3[] = "Werte V3";
+constexpr static char ptValues3[] = "Valores V3";
+constexpr static char enValuesTab[] = "Table";
+constexpr static char frValuesTab[] = "Tableau";
+constexpr static char esValuesTab[] = "Tabla";
+constexpr static char deValuesTab[] = "Tabelle";
+constexpr static char ptValuesTab[] = "Tabela";
+constexpr static char enVariables[] = "Variables";
+constexpr static char frVariables[] = "Variables";
+constexpr static char esVariables[] = "Variables";
+constexpr static char deVariables[] = "Variablen";
+constexpr static char ptVariables[] = "Variáveis";
+constexpr static char enWarning[] = "Warning";
+constexpr static char frWarning[] = "Attention";
+constexpr static char esWarning[] = "Cuidado";
+constexpr static char deWarning[] = "Achtung";
+constexpr static char ptWarning[] = "Atenção";
+constexpr static char enXEnd[] = "X end";
+constexpr static char frXEnd[] = "X fin";
+constexpr static char esXEnd[] = "X fin";
+constexpr static char deXEnd[] = "X Endwert";
+constexpr static char ptXEnd[] = "X fim";
+constexpr static char enXPrediction[] = "Prediction given X";
+constexpr static char frXPrediction[] = "Prédiction sachant X";
+constexpr static char esXPrediction[] = "Predicción dado X";
+constexpr static char deXPrediction[] = "Berechne Y";
+constexpr static char ptXPrediction[] = "Predição dado X";
+constexpr static char enXStart[] = "X start";
+constexpr static char frXStart[] = "X début";
+constexpr static char esXStart[] = "X inicio";
+constexpr static char deXStart[] = "X Startwert";
+constexpr static char ptXStart[] = "X inicio";
+constexpr static char enYPrediction[] = "Prediction given Y";
+constexpr static char frYPrediction[] = "Prédiction sachant Y";
+constexpr static char esYPrediction[] = "Predicción dado Y";
+constexpr static char deYPrediction[] = "Berechne X";
+constexpr static char ptYPrediction[] = "Predição dado Y";
+constexpr static char enZeros[] = "Zeros";
+constexpr static char frZeros[] = "Zéros";
+constexpr static char esZeros[] = "Raíces";
+constexpr static char deZeros[] = "Nullstellen";
+constexpr static char ptZeros[] = "Raízes";
+constexpr static char enZoom[] = "Zoom";
+constexpr static char frZoom[] = "Zoom";
+constexpr static char esZoom[] = "Zoom";
+constexpr static char deZoom[] = "Zoom";
+constexpr static char ptZoom[] = "Zoom";
+
+constexpr static const char * messages[679][5] = {
+  {enAbout, frAbout, esAbout, deAbout, ptAbout, },
+  {enAboutWarning1, frAboutWarning1, esAboutWarning1, deAboutWarning1, ptAboutWarning1, },
+  {enAboutWarning2, frAboutWarning2, esAboutWarning2, deAboutWarning2, ptAboutWarning2, },
+  {enAboutWarning3, frAboutWarning3, esAboutWarning3, deAboutWarning3, ptAboutWarning3, },
+  {enAboutWarning4, frAboutWarning4, esAboutWarning4, deAboutWarning4, ptAboutWarning4, },
+  {enAbsoluteValue, frAbsoluteValue, esAbsoluteValue, deAbsoluteValue, ptAbsoluteValue, },
+  {enActivateDeactivate, frActivateDeactivate, esActivateDeactivate, deActivateDeactivate, ptActivateDeactivate, },
+  {enActivateDutchExamMode, frActivateDutchExamMode, esActivateDutchExamMode, deActivateDutchExamMode, ptActivateDutchExamMode, },
+  {enActivateExamMode, frActivateExamMode, esActivateExamMode, deActivateExamMode, ptActivateExamMode, },
+  {enActiveDutchExamModeMessage1, frActiveDutchExamModeMessage1, esActiveDutchExamModeMessage1, deActiveDutchExamModeMessage1, ptActiveDutchExamModeMessage1, },
+  {enActiveDutchExamModeMessage2, frActiveDutchExamModeMessage2, esActiveDutchExamModeMessage2, deActiveDutchExamModeMessage2, ptActiveDutchExamModeMessage2, },
+  {enActiveDutchExamModeMessage3, frActiveDutchExamModeMessage3, esActiveDutchExamModeMessage3, deActiveDutchExamModeMessage3, ptActiveDutchExamModeMessage3, },
+  {enActiveExamModeMessage1, frActiveExamModeMessage1, esActiveExamModeMessage1, deActiveExamModeMessage1, ptActiveExamModeMessage1, },
+  {enActiveExamModeMessage2, frActiveExamModeMessage2, esActiveExamModeMessage2, deActiveExamModeMessage2, ptActiveExamModeMessage2, },
+  {enActiveExamModeMessage3, frActiveExamModeMessage3, esActiveExamModeMessage3, deActiveExamModeMessage3, ptActiveExamModeMessage3, },
+  {enAddEquation, frAddEquation, esAddEquation, deAddEquation, ptAddEquation, },
+  {enAddFunction, frAddFunction, esAddFunction, deAddFunction, ptAddFunction, },
+  {enAddScript, frAddScript, esAddScript, deAddScript, ptAddScript, },
+  {enAddSequence, frAddSequence, esAddSequence, deAddSequence, ptAddSequence, },
+  {enAdditionalResults, frAdditionalResults, esAdditionalResults, deAdditionalResults, ptAdditionalResults, },
+  {enAgument, frAgument, esAgument, deAgument, ptAgument, },
+  {enAllowedCharactersAZaz09, frAllowedCharactersAZaz09, esAllowedCharactersAZaz09, deAllowedCharactersAZaz09, ptAllowedCharactersAZaz09, },
+  {enAllowedCharactersaz09, frAllowedCharactersaz09, esAllowedCharactersaz09, deAllowedCharactersaz09, ptAllowedCharactersaz09, },
+  {enAngleUnit, frAngleUnit, esAngleUnit, deAngleUnit, ptAngleUnit, },
+  {enApproximateSolution, frApproximateSolution, esApproximateSolution, deApproximateSolution, ptApproximateSolution, },
+  {enApproximateSolutionIntervalInstruction0, frApproximateSolutionIntervalInstruction0, esApproximateSolutionIntervalInstruction0, deApproximateSolutionIntervalInstruction0, ptApproximateSolutionIntervalInstruction0, },
+  {enApproximateSolutionIntervalInstruction1, frApproximateSolutionIntervalInstruction1, esApproximateSolutionIntervalInstruction1, deApproximateSolutionIntervalInstruction1, ptApproximateSolutionIntervalInstruction1, },
+  {enApps, frApps, esApps, deApps, ptApps, },
+  {enAppsCapital, frAppsCapital, esAppsCapital, deAppsCapital, ptAppsCapital, },
+  {enArithmetic, frArithmetic, esArithmetic, deArithmetic, ptArithmetic, },
+  {enAutoImportScript, frAutoImportScript, esAutoImportScript, deAutoImportScript, ptAutoImportScript, },
+  {enAxis, frAxis, esAxis, deAxis, ptAxis, },
+  {enBarStart, frBarStart, esBarStart, deBarStart, ptBarStart, },
+  {enBasedLogarithm, frBasedLogarithm, esBasedLogarithm, deBasedLogarithm, ptBasedLogarithm, },
+  {enBetaPopUp, frBetaPopUp, esBetaPopUp, deBetaPopUp, ptBetaPopUp, },
+  {enBetaVersion, frBetaVersion, esBetaVersion, deBetaVersion, ptBetaVersion, },
+  {enBetaVersionMessage1, frBetaVersionMessage1, esBetaVersionMessage1, deBetaVersionMessage1, ptBetaVersionMessage1, },
+  {enBetaVersionMessage2, frBetaVersionMessage2, esBetaVersionMessage2, deBetaVersionMessage2, ptBetaVersionMessage2, },
+  {enBetaVersionMessage3, frBetaVersionMessage3, esBetaVersionMessage3, deBetaVersionMessage3, ptBetaVersionMessage3, },
+  {enBetaVersionMessage4, frBetaVersionMessage4, esBetaVersionMessage4, deBetaVersionMessage4, ptBetaVersionMessage4, },
+  {enBetaVersionMessage5, frBetaVersionMessage5, esBetaVersionMessage5, deBetaVersionMessage5, ptBetaVersionMessage5, },
+  {enBetaVersionMessage6, frBetaVersionMessage6, esBetaVersionMessage6, deBetaVersionMessage6, ptBetaVersionMessage6, },
+  {enBinaryBase, frBinaryBase, esBinaryBase, deBinaryBase, ptBinaryBase, },
+  {enBinomial, frBinomial, esBinomial, deBinomial, ptBinomial, },
+  {enBinomialCDF, frBinomialCDF, esBinomialCDF, deBinomialCDF, ptBinomialCDF, },
+  {enBinomialDistribution, frBinomialDistribution, esBinomialDistribution, deBinomialDistribution, ptBinomialDistribution, },
+  {enBinomialPDF, frBinomialPDF, esBinomialPDF, deBinomialPDF, ptBinomialPDF, },
+  {enBoxTab, frBoxTab, esBoxTab, deBoxTab, ptBoxTab, },
+  {enBrightness, frBrightness, esBrightness, deBrightness, ptBrightness, },
+  {enCalculApp, frCalculApp, esCalculApp, deCalculApp, ptCalculApp, },
+  {enCalculAppCapital, frCalculAppCapital, esCalculAppCapital, deCalculAppCapital, ptCalculAppCapital, },
+  {enCalculation, frCalculation, esCalculation, deCalculation, ptCalculation, },
+  {enCancel, frCancel, esCancel, deCancel, ptCancel, },
+  {enCartesian, frCartesian, esCartesian, deCartesian, ptCartesian, },
+  {enCartesianType, frCartesianType, esCartesianType, deCartesianType, ptCartesianType, },
+  {enCatalog, frCatalog, esCatalog, deCatalog, ptCatalog, },
+  {enCeiling, frCeiling, esCeiling, deCeiling, ptCeiling, },
+  {enChiSquared, frChiSquared, esChiSquared, deChiSquared, ptChiSquared, },
+  {enChiSquaredDistribution, frChiSquaredDistribution, esChiSquaredDistribution, deChiSquaredDistribution, ptChiSquaredDistribution, },
+  {enChooseDistribution, frChooseDistribution, esChooseDistribution, deChooseDistribution, ptChooseDistribution, },
+  {enChooseParameters, frChooseParameters, esChooseParameters, deChooseParameters, ptChooseParameters, },
+  {enChooseSequenceType, frChooseSequenceType, esChooseSequenceType, deChooseSequenceType, ptChooseSequenceType, },
+  {enClearColumn, frClearColumn, esClearColumn, deClearColumn, ptClearColumn, },
+  {enColumnOptions, frColumnOptions, esColumnOptions, deColumnOptions, ptColumnOptions, },
+  {enCombination, frCombination, esCombination, deCombination, ptCombination, },
+  {enCombinatorics, frCombinatorics, esCombinatorics, deCombinatorics, ptCombinatorics, },
+  {enComplexAbsoluteValue, frComplexAbsoluteValue, esComplexAbsoluteValue, deComplexAbsoluteValue, ptComplexAbsoluteValue, },
+  {enComplexFormat, frComplexFormat, esComplexFormat, deComplexFormat, ptComplexFormat, },
+  {enComplexNumber, frComplexNumber, esComplexNumber, deComplexNumber, ptComplexNumber, },
+  {enCompute, frCompute, esCompute, deCompute, ptCompute, },
+  {enComputeProbability, frComputeProbability, esComputeProbability, deComputeProbability, ptComputeProbability, },
+  {enConfidence, frConfidence, esConfidence, deConfidence, ptConfidence, },
+  {enConjugate, frConjugate, esConjugate, deConjugate, ptConjugate, },
+  {enConnectedMessage1, frConnectedMessage1, esConnectedMessage1, deConnectedMessage1, ptConnectedMessage1, },
+  {enConnectedMessage2, frConnectedMessage2, esConnectedMessage2, deConnectedMessage2, ptConnectedMessage2, },
+  {enConnectedMessage3, frConnectedMessage3, esConnectedMessage3, deConnectedMessage3, ptConnectedMessage3, },
+  {enConnectedMessage4, frConnectedMessage4, esConnectedMessage4, deConnectedMessage4, ptConnectedMessage4, },
+  {enConnectedMessage5, frConnectedMessage5, esConnectedMessage5, deConnectedMessage5, ptConnectedMessage5, },
+  {enConnectedMessage6, frConnectedMessage6, esConnectedMessage6, deConnectedMessage6, ptConnectedMessage6, },
+  {enConsole, frConsole, esConsole, deConsole, ptConsole, },
+  {enCopyColumnInList, frCopyColumnInList, esCopyColumnInList, deCopyColumnInList, ptCopyColumnInList, },
+  {enCovariance, frCovariance, esCovariance, deCovariance, ptCovariance, },
+  {enCubic, frCubic, esCubic, deCubic, ptCubic, },
+  {enCurveType, frCurveType, esCurveType, deCurveType, ptCurveType, },
+  {enD1FisherDefinition, frD1FisherDefinition, esD1FisherDefinition, deD1FisherDefinition, ptD1FisherDefinition, },
+  {enD2FisherDefinition, frD2FisherDefinition, esD2FisherDefinition, deD2FisherDefinition, ptD2FisherDefinition, },
+  {enDataNotSuitable, frDataNotSuitable, esDataNotSuitable, deDataNotSuitable, ptDataNotSuitable, },
+  {enDataNotSuitableForRegression, frDataNotSuitableForRegression, esDataNotSuitableForRegression, deDataNotSuitableForRegression, ptDataNotSuitableForRegression, },
+  {enDataTab, frDataTab, esDataTab, deDataTab, ptDataTab, },
+  {enDecimal, frDecimal, esDecimal, deDecimal, ptDecimal, },
+  {enDecimalBase, frDecimalBase, esDecimalBase, deDecimalBase, ptDecimalBase, },
+  {enDefaultSetting, frDefaultSetting, esDefaultSetting, deDefaultSetting, ptDefaultSetting, },
+  {enDeg, frDeg, esDeg, deDeg, ptDeg, },
+  {enDegrees, frDegrees, esDegrees, deDegrees, ptDegrees, },
+  {enDegreesOfFreedomDefinition, frDegreesOfFreedomDefinition, esDegreesOfFreedomDefinition, deDegreesOfFreedomDefinition, ptDegreesOfFreedomDefinition, },
+  {enDeleteFunction, frDeleteFunction, esDeleteFunction, deDeleteFunction, ptDeleteFunction, },
+  {enDeleteScript, frDeleteScript, esDeleteScript, deDeleteScript, ptDeleteScript, },
+  {enDeleteSequence, frDeleteSequence, esDeleteSequence, deDeleteSequence, ptDeleteSequence, },
+  {enDerivateNumber, frDerivateNumber, esDerivateNumber, deDerivateNumber, ptDerivateNumber, },
+  {enDerivativeFunctionColumn, frDerivativeFunctionColumn, esDerivativeFunctionColumn, deDerivativeFunctionColumn, ptDerivativeFunctionColumn, },
+  {enDeterminant, frDeterminant, esDeterminant, deDeterminant, ptDeterminant, },
+  {enDeviation, frDeviation, esDeviation, deDeviation, ptDeviation, },
+  {enDeviationDefinition, frDeviationDefinition, esDeviationDefinition, deDeviationDefinition, ptDeviationDefinition, },
+  {enDimension, frDimension, esDimension, deDimension, ptDimension, },
+  {enDisplayMode, frDisplayMode, esDisplayMode, deDisplayMode, ptDisplayMode, },
+  {enDisplayValues, frDisplayValues, esDisplayValues, deDisplayValues, ptDisplayValues, },
+  {enDoubleRecurrence, frDoubleRecurrence, esDoubleRecurrence, deDoubleRecurrence, ptDoubleRecurrence, },
+  {enEdition2D, frEdition2D, esEdition2D, deEdition2D, ptEdition2D, },
+  {enEditionLinear, frEditionLinear, esEditionLinear, deEditionLinear, ptEditionLinear, },
+  {enEditionMode, frEditionMode, esEditionMode, deEditionMode, ptEditionMode, },
+  {enEmpty, frEmpty, esEmpty, deEmpty, ptEmpty, },
+  {enEmptyExpressionBox0, frEmptyExpressionBox0, esEmptyExpressionBox0, deEmptyExpressionBox0, ptEmptyExpressionBox0, },
+  {enEmptyExpressionBox1, frEmptyExpressionBox1, esEmptyExpressionBox1, deEmptyExpressionBox1, ptEmptyExpressionBox1, },
+  {enEmptyExpressionBox2, frEmptyExpressionBox2, esEmptyExpressionBox2, deEmptyExpressionBox2, ptEmptyExpressionBox2, },
+  {enEmptyFunctionBox0, frEmptyFunctionBox0, esEmptyFunctionBox0, deEmptyFunctionBox0, ptEmptyFunctionBox0, },
+  {enEmptyFunctionBox1, frEmptyFunctionBox1, esEmptyFunctionBox1, deEmptyFunctionBox1, ptEmptyFunctionBox1, },
+  {enEmptyFunctionBox2, frEmptyFunctionBox2, esEmptyFunctionBox2, deEmptyFunctionBox2, ptEmptyFunctionBox2, },
+  {enEnableCharacters, frEnableCharacters, esEnableCharacters, deEnableCharacters, ptEnableCharacters, },
+  {enEng, frEng, esEng, deEng, ptEng, },
+  {enEngineering, frEngineering, esEngineering, deEngineering, ptEngineering, },
+  {enEnterEquation, frEnterEquation, esEnterEquation, deEnterEquation, ptEnterEquation, },
+  {enEuclideanDivision, frEuclideanDivision, esEuclideanDivision, deEuclideanDivision, ptEuclideanDivision, },
+  {enExamMode, frExamMode, esExamMode, deExamMode, ptExamMode, },
+  {enExamModeActive, frExamModeActive, esExamModeActive, deExamModeActive, ptExamModeActive, },
+  {enExamModeWarning1, frExamModeWarning1, esExamModeWarning1, deExamModeWarning1, ptExamModeWarning1, },
+  {enExamModeWarning2, frExamModeWarning2, esExamModeWarning2, deExamModeWarning2, ptExamModeWarning2, },
+  {enExamModeWarning3, frExamModeWarning3, esExamModeWarning3, deExamModeWarning3, ptExamModeWarning3, },
+  {enExecuteScript, frExecuteScript, esExecuteScript, deExecuteScript, ptExecuteScript, },
+  {enExitExamMode1, frExitExamMode1, esExitExamMode1, deExitExamMode1, ptExitExamMode1, },
+  {enExitExamMode2, frExitExamMode2, esExitExamMode2, deExitExamMode2, ptExitExamMode2, },
+  {enExplicit, frExplicit, esExplicit, deExplicit, ptExplicit, },
+  {enExponential, frExponential, esExponential, deExponential, ptExponential, },
+  {enExponentialDistribution, frExponentialDistribution, esExponentialDistribution, deExponentialDistribution, ptExponentialDistribution, },
+  {enExpressions, frExpressions, esExpressions, deExpressions, ptExpressions, },
+  {enFillWithFormula, frFillWithFormula, esFillWithFormula, deFillWithFormula, ptFillWithFormula, },
+  {enFirstQuartile, frFirstQuartile, esFirstQuartile, deFirstQuartile, ptFirstQuartile, },
+  {enFirstTermIndex, frFirstTermIndex, esFirstTermIndex, deFirstTermIndex, ptFirstTermIndex, },
+  {enFisherDistribution, frFisherDistribution, esFisherDistribution, deFisherDistribution, ptFisherDistribution, },
+  {enFloor, frFloor, esFloor, deFloor, ptFloor, },
+  {enFluctuation, frFluctuation, esFluctuation, deFluctuation, ptFluctuation, },
+  {enFontSizes, frFontSizes, esFontSizes, deFontSizes, ptFontSizes, },
+  {enForbiddenValue, frForbiddenValue, esForbiddenValue, deForbiddenValue, ptForbiddenValue, },
+  {enForbidenAppInExamMode1, frForbidenAppInExamMode1, esForbidenAppInExamMode1, deForbidenAppInExamMode1, ptForbidenAppInExamMode1, },
+  {enForbidenAppInExamMode2, frForbidenAppInExamMode2, esForbidenAppInExamMode2, deForbidenAppInExamMode2, ptForbidenAppInExamMode2, },
+  {enFracPart, frFracPart, esFracPart, deFracPart, ptFracPart, },
+  {enFrequency, frFrequency, esFrequency, deFrequency, ptFrequency, },
+  {enFunctionApp, frFunctionApp, esFunctionApp, deFunctionApp, ptFunctionApp, },
+  {enFunctionAppCapital, frFunctionAppCapital, esFunctionAppCapital, deFunctionAppCapital, ptFunctionAppCapital, },
+  {enFunctionColor, frFunctionColor, esFunctionColor, deFunctionColor, ptFunctionColor, },
+  {enFunctionColumn, frFunctionColumn, esFunctionColumn, deFunctionColumn, ptFunctionColumn, },
+  {enFunctionDomain, frFunctionDomain, esFunctionDomain, deFunctionDomain, ptFunctionDomain, },
+  {enFunctionOptions, frFunctionOptions, esFunctionOptions, deFunctionOptions, ptFunctionOptions, },
+  {enFunctionTab, frFunctionTab, esFunctionTab, deFunctionTab, ptFunctionTab, },
+  {enFunctions, frFunctions, esFunctions, deFunctions, ptFunctions, },
+  {enFunctionsAndVariables, frFunctionsAndVariables, esFunctionsAndVariables, deFunctionsAndVariables, ptFunctionsAndVariables, },
+  {enGeometric, frGeometric, esGeometric, deGeometric, ptGeometric, },
+  {enGeometricDistribution, frGeometricDistribution, esGeometricDistribution, deGeometricDistribution, ptGeometricDistribution, },
+  {enGoto, frGoto, esGoto, deGoto, ptGoto, },
+  {enGradians, frGradians, esGradians, deGradians, ptGradians, },
+  {enGraphTab, frGraphTab, esGraphTab, deGraphTab, ptGraphTab, },
+  {enGreatCommonDivisor, frGreatCommonDivisor, esGreatCommonDivisor, deGreatCommonDivisor, ptGreatCommonDivisor, },
+  {enHardwareTestLaunch1, frHardwareTestLaunch1, esHardwareTestLaunch1, deHardwareTestLaunch1, ptHardwareTestLaunch1, },
+  {enHardwareTestLaunch2, frHardwareTestLaunch2, esHardwareTestLaunch2, deHardwareTestLaunch2, ptHardwareTestLaunch2, },
+  {enHardwareTestLaunch3, frHardwareTestLaunch3, esHardwareTestLaunch3, deHardwareTestLaunch3, ptHardwareTestLaunch3, },
+  {enHardwareTestLaunch4, frHardwareTestLaunch4, esHardwareTestLaunch4, deHardwareTestLaunch4, ptHardwareTestLaunch4, },
+  {enHexadecimalBase, frHexadecimalBase, esHexadecimalBase, deHexadecimalBase, ptHexadecimalBase, },
+  {enHideDerivativeColumn, frHideDerivativeColumn, esHideDerivativeColumn, deHideDerivativeColumn, ptHideDerivativeColumn, },
+  {enHistogramSet, frHistogramSet, esHistogramSet, deHistogramSet, ptHistogramSet, },
+  {enHistogramTab, frHistogramTab, esHistogramTab, deHistogramTab, ptHistogramTab, },
+  {enHyperbolicCosine, frHyperbolicCosine, esHyperbolicCosine, deHyperbolicCosine, ptHyperbolicCosine, },
+  {enHyperbolicSine, frHyperbolicSine, esHyperbolicSine, deHyperbolicSine, ptHyperbolicSine, },
+  {enHyperbolicTangent, frHyperbolicTangent, esHyperbolicTangent, deHyperbolicTangent, ptHyperbolicTangent, },
+  {enHyperbolicTrigonometry, frHyperbolicTrigonometry, esHyperbolicTrigonometry, deHyperbolicTrigonometry, ptHyperbolicTrigonometry, },
+  {enIdentity, frIdentity, esIdentity, deIdentity, ptIdentity, },
+  {enImaginaryPart, frImaginaryPart, esImaginaryPart, deImaginaryPart, ptImaginaryPart, },
+  {enImportList, frImportList, esImportList, deImportList, ptImportList, },
+  {enInductanceMenu, frInductanceMenu, esInductanceMenu, deInductanceMenu, ptInductanceMenu, },
+  {enInfiniteNumberOfSolutions, frInfiniteNumberOfSolutions, esInfiniteNumberOfSolutions, deInfiniteNumberOfSolutions, ptInfiniteNumberOfSolutions, },
+  {enInitialization, frInitialization, esInitialization, deInitialization, ptInitialization, },
+  {enIntegral, frIntegral, esIntegral, deIntegral, ptIntegral, },
+  {enInterquartileRange, frInterquartileRange, esInterquartileRange, deInterquartileRange, ptInterquartileRange, },
+  {enIntersection, frIntersection, esIntersection, deIntersection, ptIntersection, },
+  {enInterval, frInterval, esInterval, deInterval, ptInterval, },
+  {enIntervalDefinition, frIntervalDefinition, esIntervalDefinition, deIntervalDefinition, ptIntervalDefinition, },
+  {enIntervalSet, frIntervalSet, esIntervalSet, deIntervalSet, ptIntervalSet, },
+  {enIntervalT, frIntervalT, esIntervalT, deIntervalT, ptIntervalT, },
+  {enIntervalTheta, frIntervalTheta, esIntervalTheta, deIntervalTheta, ptIntervalTheta, },
+  {enIntervalX, frIntervalX, esIntervalX, deIntervalX, ptIntervalX, },
+  {enInvBinomial, frInvBinomial, esInvBinomial, deInvBinomial, ptInvBinomial, },
+  {enInvNorm, frInvNorm, esInvNorm, deInvNorm, ptInvNorm, },
+  {enInvSort, frInvSort, esInvSort, deInvSort, ptInvSort, },
+  {enInverse, frInverse, esInverse, deInverse, ptInverse, },
+  {enInverseHyperbolicCosine, frInverseHyperbolicCosine, esInverseHyperbolicCosine, deInverseHyperbolicCosine, ptInverseHyperbolicCosine, },
+  {enInverseHyperbolicSine, frInverseHyperbolicSine, esInverseHyperbolicSine, deInverseHyperbolicSine, ptInverseHyperbolicSine, },
+  {enInverseHyperbolicTangent, frInverseHyperbolicTangent, esInverseHyperbolicTangent, deInverseHyperbolicTangent, ptInverseHyperbolicTangent, },
+  {enLambdaExponentialDefinition, frLambdaExponentialDefinition, esLambdaExponentialDefinition, deLambdaExponentialDefinition, ptLambdaExponentialDefinition, },
+  {enLambdaPoissonDefinition, frLambdaPoissonDefinition, esLambdaPoissonDefinition, deLambdaPoissonDefinition, ptLambdaPoissonDefinition, },
+  {enLanguage, frLanguage, esLanguage, deLanguage, ptLanguage, },
+  {enLargeFont, frLargeFont, esLargeFont, deLargeFont, ptLargeFont, },
+  {enLeastCommonMultiple, frLeastCommonMultiple, esLeastCommonMultiple, deLeastCommonMultiple, ptLeastCommonMultiple, },
+  {enLinear, frLinear, esLinear, deLinear, ptLinear, },
+  {enLists, frLists, esLists, deLists, ptLists, },
+  {enLogarithmic, frLogarithmic, esLogarithmic, deLogarithmic, ptLogarithmic, },
+  {enLogistic, frLogistic, esLogistic, deLogistic, ptLogistic, },
+  {enLoopsAndTests, frLoopsAndTests, esLoopsAndTests, deLoopsAndTests, ptLoopsAndTests, },
+  {enLowBattery, frLowBattery, esLowBattery, deLowBattery, ptLowBattery, },
+  {enMatrices, frMatrices, esMatrices, deMatrices, ptMatrices, },
+  {enMaximum, frMaximum, esMaximum, deMaximum, ptMaximum, },
+  {enMean, frMean, esMean, deMean, ptMean, },
+  {enMeanDefinition, frMeanDefinition, esMeanDefinition, deMeanDefinition, ptMeanDefinition, },
+  {enMeanDot, frMeanDot, esMeanDot, deMeanDot, ptMeanDot, },
+  {enMedian, frMedian, esMedian, deMedian, ptMedian, },
+  {enMinimum, frMinimum, esMinimum, deMinimum, ptMinimum, },
+  {enMixedFraction, frMixedFraction, esMixedFraction, deMixedFraction, ptMixedFraction, },
+  {enModules, frModules, esModules, deModules, ptModules, },
+  {enMove, frMove, esMove, deMove, ptMove, },
+  {enNColumn, frNColumn, esNColumn, deNColumn, ptNColumn, },
+  {enNEnd, frNEnd, esNEnd, deNEnd, ptNEnd, },
+  {enNStart, frNStart, esNStart, deNStart, ptNStart, },
+  {enNameCannotStartWithNumber, frNameCannotStartWithNumber, esNameCannotStartWithNumber, deNameCannotStartWithNumber, ptNameCannotStartWithNumber, },
+  {enNameTaken, frNameTaken, esNameTaken, deNameTaken, ptNameTaken, },
+  {enNameTooLong, frNameTooLong, esNameTooLong, deNameTooLong, ptNameTooLong, },
+  {enNewMatrix, frNewMatrix, esNewMatrix, deNewMatrix, ptNewMatrix, },
+  {enNext, frNext, esNext, deNext, ptNext, },
+  {enNoActivatedFunction, frNoActivatedFunction, esNoActivatedFunction, deNoActivatedFunction, ptNoActivatedFunction, },
+  {enNoActivatedSequence, frNoActivatedSequence, esNoActivatedSequence, deNoActivatedSequence, ptNoActivatedSequence, },
+  {enNoDataToPlot, frNoDataToPlot, esNoDataToPlot, deNoDataToPlot, ptNoDataToPlot, },
+  {enNoFunction, frNoFunction, esNoFunction, deNoFunction, ptNoFunction, },
+  {enNoFunctionToDelete, frNoFunctionToDelete, esNoFunctionToDelete, deNoFunctionToDelete, ptNoFunctionToDelete, },
+  {enNoIntersectionFound, frNoIntersectionFound, esNoIntersectionFound, deNoIntersectionFound, ptNoIntersectionFound, },
+  {enNoMaximumFound, frNoMaximumFound, esNoMaximumFound, deNoMaximumFound, ptNoMaximumFound, },
+  {enNoMinimumFound, frNoMinimumFound, esNoMinimumFound, deNoMinimumFound, ptNoMinimumFound, },
+  {enNoPreimageFound, frNoPreimageFound, esNoPreimageFound, deNoPreimageFound, ptNoPreimageFound, },
+  {enNoSequence, frNoSequence, esNoSequence, deNoSequence, ptNoSequence, },
+  {enNoSolutionEquation, frNoSolutionEquation, esNoSolutionEquation, deNoSolutionEquation, ptNoSolutionEquation, },
+  {enNoSolutionInterval, frNoSolutionInterval, esNoSolutionInterval, deNoSolutionInterval, ptNoSolutionInterval, },
+  {enNoSolutionSystem, frNoSolutionSystem, esNoSolutionSystem, deNoSolutionSystem, ptNoSolutionSystem, },
+  {enNoValueToCompute, frNoValueToCompute, esNoValueToCompute, deNoValueToCompute, ptNoValueToCompute, },
+  {enNoZeroFound, frNoZeroFound, esNoZeroFound, deNoZeroFound, ptNoZeroFound, },
+  {enNonLinearSystem, frNonLinearSystem, esNonLinearSystem, deNonLinearSystem, ptNonLinearSystem, },
+  {enNormCDF, frNormCDF, esNormCDF, deNormCDF, ptNormCDF, },
+  {enNormCDF2, frNormCDF2, esNormCDF2, deNormCDF2, ptNormCDF2, },
+  {enNormPDF, frNormPDF, esNormPDF, deNormPDF, ptNormPDF, },
+  {enNormal, frNormal, esNormal, deNormal, ptNormal, },
+  {enNormalDistribution, frNormalDistribution, esNormalDistribution, deNormalDistribution, ptNormalDistribution, },
+  {enNthRoot, frNthRoot, esNthRoot, deNthRoot, ptNthRoot, },
+  {enNumberOfDots, frNumberOfDots, esNumberOfDots, deNumberOfDots, ptNumberOfDots, },
+  {enOk, frOk, esOk, deOk, ptOk, },
+  {enOnlyFirstSolutionsDisplayed0, frOnlyFirstSolutionsDisplayed0, esOnlyFirstSolutionsDisplayed0, deOnlyFirstSolutionsDisplayed0, ptOnlyFirstSolutionsDisplayed0, },
+  {enOnlyFirstSolutionsDisplayed1, frOnlyFirstSolutionsDisplayed1, esOnlyFirstSolutionsDisplayed1, deOnlyFirstSolutionsDisplayed1, ptOnlyFirstSolutionsDisplayed1, },
+  {enOr, frOr, esOr, deOr, ptOr, },
+  {enOrthonormal, frOrthonormal, esOrthonormal, deOrthonormal, ptOrthonormal, },
+  {enParametricType, frParametricType, esParametricType, deParametricType, ptParametricType, },
+  {enPermutation, frPermutation, esPermutation, dePermutation, ptPermutation, },
+  {enPlot, frPlot, esPlot, dePlot, ptPlot, },
+  {enPlotOptions, frPlotOptions, esPlotOptions, dePlotOptions, ptPlotOptions, },
+  {enPoissonDistribution, frPoissonDistribution, esPoissonDistribution, dePoissonDistribution, ptPoissonDistribution, },
+  {enPolar, frPolar, esPolar, dePolar, ptPolar, },
+  {enPolarType, frPolarType, esPolarType, dePolarType, ptPolarType, },
+  {enPolynomeHasNoRealSolution0, frPolynomeHasNoRealSolution0, esPolynomeHasNoRealSolution0, dePolynomeHasNoRealSolution0, ptPolynomeHasNoRealSolution0, },
+  {enPolynomeHasNoRealSolution1, frPolynomeHasNoRealSolution1, esPolynomeHasNoRealSolution1, dePolynomeHasNoRealSolution1, ptPolynomeHasNoRealSolution1, },
+  {enPoolMemoryFull1, frPoolMemoryFull1, esPoolMemoryFull1, dePoolMemoryFull1, ptPoolMemoryFull1, },
+  {enPoolMemoryFull2, frPoolMemoryFull2, esPoolMemoryFull2, dePoolMemoryFull2, ptPoolMemoryFull2, },
+  {enPower, frPower, esPower, dePower, ptPower, },
+  {enPredefinedVariablesIgnoredLeft, frPredefinedVariablesIgnoredLeft, esPredefinedVariablesIgnoredLeft, dePredefinedVariablesIgnoredLeft, ptPredefinedVariablesIgnoredLeft, },
+  {enPredefinedVariablesIgnoredRight, frPredefinedVariablesIgnoredRight, esPredefinedVariablesIgnoredRight, dePredefinedVariablesIgnoredRight, ptPredefinedVariablesIgnoredRight, },
+  {enPredefinedVariablesUsedLeft, frPredefinedVariablesUsedLeft, esPredefinedVariablesUsedLeft, dePredefinedVariablesUsedLeft, ptPredefinedVariablesUsedLeft, },
+  {enPredefinedVariablesUsedRight, frPredefinedVariablesUsedRight, esPredefinedVariablesUsedRight, dePredefinedVariablesUsedRight, ptPredefinedVariablesUsedRight, },
+  {enPrediction, frPrediction, esPrediction, dePrediction, ptPrediction, },
+  {enPrediction95, frPrediction95, esPrediction95, dePrediction95, ptPrediction95, },
+  {enPreimage, frPreimage, esPreimage, dePreimage, ptPreimage, },
+  {enPrimeFactorDecomposition, frPrimeFactorDecomposition, esPrimeFactorDecomposition, dePrimeFactorDecomposition, ptPrimeFactorDecomposition, },
+  {enPrimeFactors, frPrimeFactors, esPrimeFactors, dePrimeFactors, ptPrimeFactors, },
+  {enProbaApp, frProbaApp, esProbaApp, deProbaApp, ptProbaApp, },
+  {enProbaAppCapital, frProbaAppCapital, esProbaAppCapital, deProbaAppCapital, ptProbaAppCapital, },
+  {enProbability, frProbability, esProbability, deProbability, ptProbability, },
+  {enProduct, frProduct, esProduct, deProduct, ptProduct, },
+  {enPython1J, frPython1J, esPython1J, dePython1J, ptPython1J, },
+  {enPythonAbs, frPythonAbs, esPythonAbs, dePythonAbs, ptPythonAbs, },
+  {enPythonAcos, frPythonAcos, esPythonAcos, dePythonAcos, ptPythonAcos, },
+  {enPythonAcosh, frPythonAcosh, esPythonAcosh, dePythonAcosh, ptPythonAcosh, },
+  {enPythonAmpersand, frPythonAmpersand, esPythonAmpersand, dePythonAmpersand, ptPythonAmpersand, },
+  {enPythonAppend, frPythonAppend, esPythonAppend, dePythonAppend, ptPythonAppend, },
+  {enPythonAsin, frPythonAsin, esPythonAsin, dePythonAsin, ptPythonAsin, },
+  {enPythonAsinh, frPythonAsinh, esPythonAsinh, dePythonAsinh, ptPythonAsinh, },
+  {enPythonAtan, frPythonAtan, esPythonAtan, dePythonAtan, ptPythonAtan, },
+  {enPythonAtan2, frPythonAtan2, esPythonAtan2, dePythonAtan2, ptPythonAtan2, },
+  {enPythonAtanh, frPythonAtanh, esPythonAtanh, dePythonAtanh, ptPythonAtanh, },
+  {enPythonBin, frPythonBin, esPythonBin, dePythonBin, ptPythonBin, },
+  {enPythonCeil, frPythonCeil, esPythonCeil, dePythonCeil, ptPythonCeil, },
+  {enPythonChoice, frPythonChoice, esPythonChoice, dePythonChoice, ptPythonChoice, },
+  {enPythonClear, frPythonClear, esPythonClear, dePythonClear, ptPythonClear, },
+  {enPythonCmathFunction, frPythonCmathFunction, esPythonCmathFunction, dePythonCmathFunction, ptPythonCmathFunction, },
+  {enPythonColor, frPythonColor, esPythonColor, dePythonColor, ptPythonColor, },
+  {enPythonComplex, frPythonComplex, esPythonComplex, dePythonComplex, ptPythonComplex, },
+  {enPythonCopySign, frPythonCopySign, esPythonCopySign, dePythonCopySign, ptPythonCopySign, },
+  {enPythonCos, frPythonCos, esPythonCos, dePythonCos, ptPythonCos, },
+  {enPythonCosh, frPythonCosh, esPythonCosh, dePythonCosh, ptPythonCosh, },
+  {enPythonCount, frPythonCount, esPythonCount, dePythonCount, ptPythonCount, },
+  {enPythonDegrees, frPythonDegrees, esPythonDegrees, dePythonDegrees, ptPythonDegrees, },
+  {enPythonDivMod, frPythonDivMod, esPythonDivMod, dePythonDivMod, ptPythonDivMod, },
+  {enPythonDrawString, frPythonDrawString, esPythonDrawString, dePythonDrawString, ptPythonDrawString, },
+  {enPythonErf, frPythonErf, esPythonErf, dePythonErf, ptPythonErf, },
+  {enPythonErfc, frPythonErfc, esPythonErfc, dePythonErfc, ptPythonErfc, },
+  {enPythonEval, frPythonEval, esPythonEval, dePythonEval, ptPythonEval, },
+  {enPythonExp, frPythonExp, esPythonExp, dePythonExp, ptPythonExp, },
+  {enPythonExpm1, frPythonExpm1, esPythonExpm1, dePythonExpm1, ptPythonExpm1, },
+  {enPythonFabs, frPythonFabs, esPythonFabs, dePythonFabs, ptPythonFabs, },
+  {enPythonFillRect, frPythonFillRect, esPythonFillRect, dePythonFillRect, ptPythonFillRect, },
+  {enPythonFloat, frPythonFloat, esPythonFloat, dePythonFloat, ptPythonFloat, },
+  {enPythonFloor, frPythonFloor, esPythonFloor, dePythonFloor, ptPythonFloor, },
+  {enPythonFmod, frPythonFmod, esPythonFmod, dePythonFmod, ptPythonFmod, },
+  {enPythonFrExp, frPythonFrExp, esPythonFrExp, dePythonFrExp, ptPythonFrExp, },
+  {enPythonGamma, frPythonGamma, esPythonGamma, dePythonGamma, ptPythonGamma, },
+  {enPythonGetPixel, frPythonGetPixel, esPythonGetPixel, dePythonGetPixel, ptPythonGetPixel, },
+  {enPythonGetrandbits, frPythonGetrandbits, esPythonGetrandbits, dePythonGetrandbits, ptPythonGetrandbits, },
+  {enPythonHex, frPythonHex, esPythonHex, dePythonHex, ptPythonHex, },
+  {enPythonImag, frPythonImag, esPythonImag, dePythonImag, ptPythonImag, },
+  {enPythonImportCmath, frPythonImportCmath, esPythonImportCmath, dePythonImportCmath, ptPythonImportCmath, },
+  {enPythonImportIon, frPythonImportIon, esPythonImportIon, dePythonImportIon, ptPythonImportIon, },
+  {enPythonImportKandinsky, frPythonImportKandinsky, esPythonImportKandinsky, dePythonImportKandinsky, ptPythonImportKandinsky, },
+  {enPythonImportMath, frPythonImportMath, esPythonImportMath, dePythonImportMath, ptPythonImportMath, },
+  {enPythonImportRandom, frPythonImportRandom, esPythonImportRandom, dePythonImportRandom, ptPythonImportRandom, },
+  {enPythonImportTime, frPythonImportTime, esPythonImportTime, dePythonImportTime, ptPythonImportTime, },
+  {enPythonImportTurtle, frPythonImportTurtle, esPythonImportTurtle, dePythonImportTurtle, ptPythonImportTurtle, },
+  {enPythonIndex, frPythonIndex, esPythonIndex, dePythonIndex, ptPythonIndex, },
+  {enPythonInput, frPythonInput, esPythonInput, dePythonInput, ptPythonInput, },
+  {enPythonInsert, frPythonInsert, esPythonInsert, dePythonInsert, ptPythonInsert, },
+  {enPythonInt, frPythonInt, esPythonInt, dePythonInt, ptPythonInt, },
+  {enPythonIonFunction, frPythonIonFunction, esPythonIonFunction, dePythonIonFunction, ptPythonIonFunction, },
+  {enPythonIsFinite, frPythonIsFinite, esPythonIsFinite, dePythonIsFinite, ptPythonIsFinite, },
+  {enPythonIsInfinite, frPythonIsInfinite, esPythonIsInfinite, dePythonIsInfinite, ptPythonIsInfinite, },
+  {enPythonIsKeyDown, frPythonIsKeyDown, esPythonIsKeyDown, dePythonIsKeyDown, ptPythonIsKeyDown, },
+  {enPythonIsNaN, frPythonIsNaN, esPythonIsNaN, dePythonIsNaN, ptPythonIsNaN, },
+  {enPythonKandinskyFunction, frPythonKandinskyFunction, esPythonKandinskyFunction, dePythonKandinskyFunction, ptPythonKandinskyFunction, },
+  {enPythonKeyAlpha, frPythonKeyAlpha, esPythonKeyAlpha, dePythonKeyAlpha, ptPythonKeyAlpha, },
+  {enPythonKeyAns, frPythonKeyAns, esPythonKeyAns, dePythonKeyAns, ptPythonKeyAns, },
+  {enPythonKeyBack, frPythonKeyBack, esPythonKeyBack, dePythonKeyBack, ptPythonKeyBack, },
+  {enPythonKeyBackspace, frPythonKeyBackspace, esPythonKeyBackspace, dePythonKeyBackspace, ptPythonKeyBackspace, },
+  {enPythonKeyComma, frPythonKeyComma, esPythonKeyComma, dePythonKeyComma, ptPythonKeyComma, },
+  {enPythonKeyCosine, frPythonKeyCosine, esPythonKeyCosine, dePythonKeyCosine, ptPythonKeyCosine, },
+  {enPythonKeyDivision, frPythonKeyDivision, esPythonKeyDivision, dePythonKeyDivision, ptPythonKeyDivision, },
+  {enPythonKeyDot, frPythonKeyDot, esPythonKeyDot, dePythonKeyDot, ptPythonKeyDot, },
+  {enPythonKeyDown, frPythonKeyDown, esPythonKeyDown, dePythonKeyDown, ptPythonKeyDown, },
+  {enPythonKeyEe, frPythonKeyEe, esPythonKeyEe, dePythonKeyEe, ptPythonKeyEe, },
+  {enPythonKeyEight, frPythonKeyEight, esPythonKeyEight, dePythonKeyEight, ptPythonKeyEight, },
+  {enPythonKeyExe, frPythonKeyExe, esPythonKeyExe, dePythonKeyExe, ptPythonKeyExe, },
+  {enPythonKeyExp, frPythonKeyExp, esPythonKeyExp, dePythonKeyExp, ptPythonKeyExp, },
+  {enPythonKeyFive, frPythonKeyFive, esPythonKeyFive, dePythonKeyFive, ptPythonKeyFive, },
+  {enPythonKeyFour, frPythonKeyFour, esPythonKeyFour, dePythonKeyFour, ptPythonKeyFour, },
+  {enPythonKeyHome, frPythonKeyHome, esPythonKeyHome, dePythonKeyHome, ptPythonKeyHome, },
+  {enPythonKeyImaginary, frPythonKeyImaginary, esPythonKeyImaginary, dePythonKeyImaginary, ptPythonKeyImaginary, },
+  {enPythonKeyLeft, frPythonKeyLeft, esPythonKeyLeft, dePythonKeyLeft, ptPythonKeyLeft, },
+  {enPythonKeyLeftParenthesis, frPythonKeyLeftParenthesis, esPythonKeyLeftParenthesis, dePythonKeyLeftParenthesis, ptPythonKeyLeftParenthesis, },
+  {enPythonKeyLn, frPythonKeyLn, esPythonKeyLn, dePythonKeyLn, ptPythonKeyLn, },
+  {enPythonKeyLog, frPythonKeyLog, esPythonKeyLog, dePythonKeyLog, ptPythonKeyLog, },
+  {enPythonKeyMinus, frPythonKeyMinus, esPythonKeyMinus, dePythonKeyMinus, ptPythonKeyMinus, },
+  {enPythonKeyMultiplication, frPythonKeyMultiplication, esPythonKeyMultiplication, dePythonKeyMultiplication, ptPythonKeyMultiplication, },
+  {enPythonKeyNine, frPythonKeyNine, esPythonKeyNine, dePythonKeyNine, ptPythonKeyNine, },
+  {enPythonKeyOk, frPythonKeyOk, esPythonKeyOk, dePythonKeyOk, ptPythonKeyOk, },
+  {enPythonKeyOnOff, frPythonKeyOnOff, esPythonKeyOnOff, dePythonKeyOnOff, ptPythonKeyOnOff, },
+  {enPythonKeyOne, frPythonKeyOne, esPythonKeyOne, dePythonKeyOne, ptPythonKeyOne, },
+  {enPythonKeyPi, frPythonKeyPi, esPythonKeyPi, dePythonKeyPi, ptPythonKeyPi, },
+  {enPythonKeyPlus, frPythonKeyPlus, esPythonKeyPlus, dePythonKeyPlus, ptPythonKeyPlus, },
+  {enPythonKeyPower, frPythonKeyPower, esPythonKeyPower, dePythonKeyPower, ptPythonKeyPower, },
+  {enPythonKeyRight, frPythonKeyRight, esPythonKeyRight, dePythonKeyRight, ptPythonKeyRight, },
+  {enPythonKeyRightParenthesis, frPythonKeyRightParenthesis, esPythonKeyRightParenthesis, dePythonKeyRightParenthesis, ptPythonKeyRightParenthesis, },
+  {enPythonKeySeven, frPythonKeySeven, esPythonKeySeven, dePythonKeySeven, ptPythonKeySeven, },
+  {enPythonKeyShift, frPythonKeyShift, esPythonKeyShift, dePythonKeyShift, ptPythonKeyShift, },
+  {enPythonKeySine, frPythonKeySine, esPythonKeySine, dePythonKeySine, ptPythonKeySine, },
+  {enPythonKeySix, frPythonKeySix, esPythonKeySix, dePythonKeySix, ptPythonKeySix, },
+  {enPythonKeySqrt, frPythonKeySqrt, esPythonKeySqrt, dePythonKeySqrt, ptPythonKeySqrt, },
+  {enPythonKeySquare, frPythonKeySquare, esPythonKeySquare, dePythonKeySquare, ptPythonKeySquare, },
+  {enPythonKeyTangent, frPythonKeyTangent, esPythonKeyTangent, dePythonKeyTangent, ptPythonKeyTangent, },
+  {enPythonKeyThree, frPythonKeyThree, esPythonKeyThree, dePythonKeyThree, ptPythonKeyThree, },
+  {enPythonKeyToolbox, frPythonKeyToolbox, esPythonKeyToolbox, dePythonKeyToolbox, ptPythonKeyToolbox, },
+  {enPythonKeyTwo, frPythonKeyTwo, esPythonKeyTwo, dePythonKeyTwo, ptPythonKeyTwo, },
+  {enPythonKeyUp, frPythonKeyUp, esPythonKeyUp, dePythonKeyUp, ptPythonKeyUp, },
+  {enPythonKeyVar, frPythonKeyVar, esPythonKeyVar, dePythonKeyVar, ptPythonKeyVar, },
+  {enPythonKeyXnt, frPythonKeyXnt, esPythonKeyXnt, dePythonKeyXnt, ptPythonKeyXnt, },
+  {enPythonKeyZero, frPythonKeyZero, esPythonKeyZero, dePythonKeyZero, ptPythonKeyZero, },
+  {enPythonLF, frPythonLF, esPythonLF, dePythonLF, ptPythonLF, },
+  {enPythonLdexp, frPythonLdexp, esPythonLdexp, dePythonLdexp, ptPythonLdexp, },
+  {enPythonLength, frPythonLength, esPythonLength, dePythonLength, ptPythonLength, },
+  {enPythonLgamma, frPythonLgamma, esPythonLgamma, dePythonLgamma, ptPythonLgamma, },
+  {enPythonLog, frPythonLog, esPythonLog, dePythonLog, ptPythonLog, },
+  {enPythonLog10, frPythonLog10, esPythonLog10, dePythonLog10, ptPythonLog10, },
+  {enPythonLog2, frPythonLog2, esPythonLog2, dePythonLog2, ptPythonLog2, },
+  {enPythonMathFunction, frPythonMathFunction, esPythonMathFunction, dePythonMathFunction, ptPythonMathFunction, },
+  {enPythonMax, frPythonMax, esPythonMax, dePythonMax, ptPythonMax, },
+  {enPythonMin, frPythonMin, esPythonMin, dePythonMin, ptPythonMin, },
+  {enPythonModf, frPythonModf, esPythonModf, dePythonModf, ptPythonModf, },
+  {enPythonMonotonic, frPythonMonotonic, esPythonMonotonic, dePythonMonotonic, ptPythonMonotonic, },
+  {enPythonOct, frPythonOct, esPythonOct, dePythonOct, ptPythonOct, },
+  {enPythonPercent, frPythonPercent, esPythonPercent, dePythonPercent, ptPythonPercent, },
+  {enPythonPhase, frPythonPhase, esPythonPhase, dePythonPhase, ptPythonPhase, },
+  {enPythonPolar, frPythonPolar, esPythonPolar, dePythonPolar, ptPythonPolar, },
+  {enPythonPop, frPythonPop, esPythonPop, dePythonPop, ptPythonPop, },
+  {enPythonPound, frPythonPound, esPythonPound, dePythonPound, ptPythonPound, },
+  {enPythonPower, frPythonPower, esPythonPower, dePythonPower, ptPythonPower, },
+  {enPythonPrint, frPythonPrint, esPythonPrint, dePythonPrint, ptPythonPrint, },
+  {enPythonRadians, frPythonRadians, esPythonRadians, dePythonRadians, ptPythonRadians, },
+  {enPythonRandint, frPythonRandint, esPythonRandint, dePythonRandint, ptPythonRandint, },
+  {enPythonRandom, frPythonRandom, esPythonRandom, dePythonRandom, ptPythonRandom, },
+  {enPythonRandomFunction, frPythonRandomFunction, esPythonRandomFunction, dePythonRandomFunction, ptPythonRandomFunction, },
+  {enPythonRandrange, frPythonRandrange, esPythonRandrange, dePythonRandrange, ptPythonRandrange, },
+  {enPythonRangeStartStop, frPythonRangeStartStop, esPythonRangeStartStop, dePythonRangeStartStop, ptPythonRangeStartStop, },
+  {enPythonRangeStop, frPythonRangeStop, esPythonRangeStop, dePythonRangeStop, ptPythonRangeStop, },
+  {enPythonReal, frPythonReal, esPythonReal, dePythonReal, ptPythonReal, },
+  {enPythonRect, frPythonRect, esPythonRect, dePythonRect, ptPythonRect, },
+  {enPythonRemove, frPythonRemove, esPythonRemove, dePythonRemove, ptPythonRemove, },
+  {enPythonReverse, frPythonReverse, esPythonReverse, dePythonReverse, ptPythonReverse, },
+  {enPythonRound, frPythonRound, esPythonRound, dePythonRound, ptPythonRound, },
+  {enPythonSeed, frPythonSeed, esPythonSeed, dePythonSeed, ptPythonSeed, },
+  {enPythonSetPixel, frPythonSetPixel, esPythonSetPixel, dePythonSetPixel, ptPythonSetPixel, },
+  {enPythonSin, frPythonSin, esPythonSin, dePythonSin, ptPythonSin, },
+  {enPythonSingleQuote, frPythonSingleQuote, esPythonSingleQuote, dePythonSingleQuote, ptPythonSingleQuote, },
+  {enPythonSinh, frPythonSinh, esPythonSinh, dePythonSinh, ptPythonSinh, },
+  {enPythonSleep, frPythonSleep, esPythonSleep, dePythonSleep, ptPythonSleep, },
+  {enPythonSort, frPythonSort, esPythonSort, dePythonSort, ptPythonSort, },
+  {enPythonSqrt, frPythonSqrt, esPythonSqrt, dePythonSqrt, ptPythonSqrt, },
+  {enPythonSum, frPythonSum, esPythonSum, dePythonSum, ptPythonSum, },
+  {enPythonSymbolExp, frPythonSymbolExp, esPythonSymbolExp, dePythonSymbolExp, ptPythonSymbolExp, },
+  {enPythonTab, frPythonTab, esPythonTab, dePythonTab, ptPythonTab, },
+  {enPythonTan, frPythonTan, esPythonTan, dePythonTan, ptPythonTan, },
+  {enPythonTanh, frPythonTanh, esPythonTanh, dePythonTanh, ptPythonTanh, },
+  {enPythonTimeFunction, frPythonTimeFunction, esPythonTimeFunction, dePythonTimeFunction, ptPythonTimeFunction, },
+  {enPythonTrunc, frPythonTrunc, esPythonTrunc, dePythonTrunc, ptPythonTrunc, },
+  {enPythonTurtleBackward, frPythonTurtleBackward, esPythonTurtleBackward, dePythonTurtleBackward, ptPythonTurtleBackward, },
+  {enPythonTurtleBlack, frPythonTurtleBlack, esPythonTurtleBlack, dePythonTurtleBlack, ptPythonTurtleBlack, },
+  {enPythonTurtleBlue, frPythonTurtleBlue, esPythonTurtleBlue, dePythonTurtleBlue, ptPythonTurtleBlue, },
+  {enPythonTurtleBrown, frPythonTurtleBrown, esPythonTurtleBrown, dePythonTurtleBrown, ptPythonTurtleBrown, },
+  {enPythonTurtleCircle, frPythonTurtleCircle, esPythonTurtleCircle, dePythonTurtleCircle, ptPythonTurtleCircle, },
+  {enPythonTurtleColor, frPythonTurtleColor, esPythonTurtleColor, dePythonTurtleColor, ptPythonTurtleColor, },
+  {enPythonTurtleForward, frPythonTurtleForward, esPythonTurtleForward, dePythonTurtleForward, ptPythonTurtleForward, },
+  {enPythonTurtleFunction, frPythonTurtleFunction, esPythonTurtleFunction, dePythonTurtleFunction, ptPythonTurtleFunction, },
+  {enPythonTurtleGoto, frPythonTurtleGoto, esPythonTurtleGoto, dePythonTurtleGoto, ptPythonTurtleGoto, },
+  {enPythonTurtleGreen, frPythonTurtleGreen, esPythonTurtleGreen, dePythonTurtleGreen, ptPythonTurtleGreen, },
+  {enPythonTurtleGrey, frPythonTurtleGrey, esPythonTurtleGrey, dePythonTurtleGrey, ptPythonTurtleGrey, },
+  {enPythonTurtleHeading, frPythonTurtleHeading, esPythonTurtleHeading, dePythonTurtleHeading, ptPythonTurtleHeading, },
+  {enPythonTurtleHideturtle, frPythonTurtleHideturtle, esPythonTurtleHideturtle, dePythonTurtleHideturtle, ptPythonTurtleHideturtle, },
+  {enPythonTurtleIsdown, frPythonTurtleIsdown, esPythonTurtleIsdown, dePythonTurtleIsdown, ptPythonTurtleIsdown, },
+  {enPythonTurtleLeft, frPythonTurtleLeft, esPythonTurtleLeft, dePythonTurtleLeft, ptPythonTurtleLeft, },
+  {enPythonTurtleOrange, frPythonTurtleOrange, esPythonTurtleOrange, dePythonTurtleOrange, ptPythonTurtleOrange, },
+  {enPythonTurtlePendown, frPythonTurtlePendown, esPythonTurtlePendown, dePythonTurtlePendown, ptPythonTurtlePendown, },
+  {enPythonTurtlePensize, frPythonTurtlePensize, esPythonTurtlePensize, dePythonTurtlePensize, ptPythonTurtlePensize, },
+  {enPythonTurtlePenup, frPythonTurtlePenup, esPythonTurtlePenup, dePythonTurtlePenup, ptPythonTurtlePenup, },
+  {enPythonTurtlePink, frPythonTurtlePink, esPythonTurtlePink, dePythonTurtlePink, ptPythonTurtlePink, },
+  {enPythonTurtlePosition, frPythonTurtlePosition, esPythonTurtlePosition, dePythonTurtlePosition, ptPythonTurtlePosition, },
+  {enPythonTurtlePurple, frPythonTurtlePurple, esPythonTurtlePurple, dePythonTurtlePurple, ptPythonTurtlePurple, },
+  {enPythonTurtleRed, frPythonTurtleRed, esPythonTurtleRed, dePythonTurtleRed, ptPythonTurtleRed, },
+  {enPythonTurtleReset, frPythonTurtleReset, esPythonTurtleReset, dePythonTurtleReset, ptPythonTurtleReset, },
+  {enPythonTurtleRight, frPythonTurtleRight, esPythonTurtleRight, dePythonTurtleRight, ptPythonTurtleRight, },
+  {enPythonTurtleSetheading, frPythonTurtleSetheading, esPythonTurtleSetheading, dePythonTurtleSetheading, ptPythonTurtleSetheading, },
+  {enPythonTurtleSetposition, frPythonTurtleSetposition, esPythonTurtleSetposition, dePythonTurtleSetposition, ptPythonTurtleSetposition, },
+  {enPythonTurtleShowturtle, frPythonTurtleShowturtle, esPythonTurtleShowturtle, dePythonTurtleShowturtle, ptPythonTurtleShowturtle, },
+  {enPythonTurtleSpeed, frPythonTurtleSpeed, esPythonTurtleSpeed, dePythonTurtleSpeed, ptPythonTurtleSpeed, },
+  {enPythonTurtleWhite, frPythonTurtleWhite, esPythonTurtleWhite, dePythonTurtleWhite, ptPythonTurtleWhite, },
+  {enPythonTurtleYellow, frPythonTurtleYellow, esPythonTurtleYellow, dePythonTurtleYellow, ptPythonTurtleYellow, },
+  {enPythonUniform, frPythonUniform, esPythonUniform, dePythonUniform, ptPythonUniform, },
+  {enPythonVerticalBar, frPythonVerticalBar, esPythonVerticalBar, dePythonVerticalBar, ptPythonVerticalBar, },
+  {enQuadratic, frQuadratic, esQuadratic, deQuadratic, ptQuadratic, },
+  {enQuartic, frQuartic, esQuartic, deQuartic, ptQuartic, },
+  {enQuotient, frQuotient, esQuotient, deQuotient, ptQuotient, },
+  {enRad, frRad, esRad, deRad, ptRad, },
+  {enRadian, frRadian, esRadian, deRadian, ptRadian, },
+  {enRandomAndApproximation, frRandomAndApproximation, esRandomAndApproximation, deRandomAndApproximation, ptRandomAndApproximation, },
+  {enRandomFloat, frRandomFloat, esRandomFloat, deRandomFloat, ptRandomFloat, },
+  {enRandomInteger, frRandomInteger, esRandomInteger, deRandomInteger, ptRandomInteger, },
+  {enRange, frRange, esRange, deRange, ptRange, },
+  {enReal, frReal, esReal, deReal, ptReal, },
+  {enRealPart, frRealPart, esRealPart, deRealPart, ptRealPart, },
+  {enRectangleWidth, frRectangleWidth, esRectangleWidth, deRectangleWidth, ptRectangleWidth, },
+  {enReg, frReg, esReg, deReg, ptReg, },
+  {enRegression, frRegression, esRegression, deRegression, ptRegression, },
+  {enRegressionApp, frRegressionApp, esRegressionApp, deRegressionApp, ptRegressionApp, },
+  {enRegressionAppCapital, frRegressionAppCapital, esRegressionAppCapital, deRegressionAppCapital, ptRegressionAppCapital, },
+  {enRegressionCurve, frRegressionCurve, esRegressionCurve, deRegressionCurve, ptRegressionCurve, },
+  {enRemainder, frRemainder, esRemainder, deRemainder, ptRemainder, },
+  {enRename, frRename, esRename, deRename, ptRename, },
+  {enRepetitionNumber, frRepetitionNumber, esRepetitionNumber, deRepetitionNumber, ptRepetitionNumber, },
+  {enRequireEquation, frRequireEquation, esRequireEquation, deRequireEquation, ptRequireEquation, },
+  {enReservedName, frReservedName, esReservedName, deReservedName, ptReservedName, },
+  {enResolveEquation, frResolveEquation, esResolveEquation, deResolveEquation, ptResolveEquation, },
+  {enResolveSystem, frResolveSystem, esResolveSystem, deResolveSystem, ptResolveSystem, },
+  {enRoundAbscissa, frRoundAbscissa, esRoundAbscissa, deRoundAbscissa, ptRoundAbscissa, },
+  {enRounding, frRounding, esRounding, deRounding, ptRounding, },
+  {enSampleStandardDeviationS, frSampleStandardDeviationS, esSampleStandardDeviationS, deSampleStandardDeviationS, ptSampleStandardDeviationS, },
+  {enSci, frSci, esSci, deSci, ptSci, },
+  {enScientific, frScientific, esScientific, deScientific, ptScientific, },
+  {enScriptOptions, frScriptOptions, esScriptOptions, deScriptOptions, ptScriptOptions, },
+  {enSearchInverval, frSearchInverval, esSearchInverval, deSearchInverval, ptSearchInverval, },
+  {enSelectFirstTerm, frSelectFirstTerm, esSelectFirstTerm, deSelectFirstTerm, ptSelectFirstTerm, },
+  {enSelectLastTerm, frSelectLastTerm, esSelectLastTerm, deSelectLastTerm, ptSelectLastTerm, },
+  {enSelectLowerBound, frSelectLowerBound, esSelectLowerBound, deSelectLowerBound, ptSelectLowerBound, },
+  {enSelectUpperBound, frSelectUpperBound, esSelectUpperBound, deSelectUpperBound, ptSelectUpperBound, },
+  {enSequenceApp, frSequenceApp, esSequenceApp, deSequenceApp, ptSequenceApp, },
+  {enSequenceAppCapital, frSequenceAppCapital, esSequenceAppCapital, deSequenceAppCapital, ptSequenceAppCapital, },
+  {enSequenceColor, frSequenceColor, esSequenceColor, deSequenceColor, ptSequenceColor, },
+  {enSequenceOptions, frSequenceOptions, esSequenceOptions, deSequenceOptions, ptSequenceOptions, },
+  {enSequenceTab, frSequenceTab, esSequenceTab, deSequenceTab, ptSequenceTab, },
+  {enSequenceType, frSequenceType, esSequenceType, deSequenceType, ptSequenceType, },
+  {enSerialNumber, frSerialNumber, esSerialNumber, deSerialNumber, ptSerialNumber, },
+  {enSettingsApp, frSettingsApp, esSettingsApp, deSettingsApp, ptSettingsApp, },
+  {enSettingsAppCapital, frSettingsAppCapital, esSettingsAppCapital, deSettingsAppCapital, ptSettingsAppCapital, },
+  {enSignificantFigures, frSignificantFigures, esSignificantFigures, deSignificantFigures, ptSignificantFigures, },
+  {enSingleRecurrence, frSingleRecurrence, esSingleRecurrence, deSingleRecurrence, ptSingleRecurrence, },
+  {enSize, frSize, esSize, deSize, ptSize, },
+  {enSizes1, frSizes1, esSizes1, deSizes1, ptSizes1, },
+  {enSizes2, frSizes2, esSizes2, deSizes2, ptSizes2, },
+  {enSizes3, frSizes3, esSizes3, deSizes3, ptSizes3, },
+  {enSkip, frSkip, esSkip, deSkip, ptSkip, },
+  {enSmallFont, frSmallFont, esSmallFont, deSmallFont, ptSmallFont, },
+  {enSoftwareVersion, frSoftwareVersion, esSoftwareVersion, deSoftwareVersion, ptSoftwareVersion, },
+  {enSolution, frSolution, esSolution, deSolution, ptSolution, },
+  {enSolverApp, frSolverApp, esSolverApp, deSolverApp, ptSolverApp, },
+  {enSolverAppCapital, frSolverAppCapital, esSolverAppCapital, deSolverAppCapital, ptSolverAppCapital, },
+  {enSort, frSort, esSort, deSort, ptSort, },
+  {enSquareSum, frSquareSum, esSquareSum, deSquareSum, ptSquareSum, },
+  {enStandardDeviation, frStandardDeviation, esStandardDeviation, deStandardDeviation, ptStandardDeviation, },
+  {enStandardDeviationSigma, frStandardDeviationSigma, esStandardDeviationSigma, deStandardDeviationSigma, ptStandardDeviationSigma, },
+  {enStatTab, frStatTab, esStatTab, deStatTab, ptStatTab, },
+  {enStatsApp, frStatsApp, esStatsApp, deStatsApp, ptStatsApp, },
+  {enStatsAppCapital, frStatsAppCapital, esStatsAppCapital, deStatsAppCapital, ptStatsAppCapital, },
+  {enStep, frStep, esStep, deStep, ptStep, },
+  {enStorageMemoryFull1, frStorageMemoryFull1, esStorageMemoryFull1, deStorageMemoryFull1, ptStorageMemoryFull1, },
+  {enStorageMemoryFull2, frStorageMemoryFull2, esStorageMemoryFull2, deStorageMemoryFull2, ptStorageMemoryFull2, },
+  {enStoreExpressionNotAllowed, frStoreExpressionNotAllowed, esStoreExpressionNotAllowed, deStoreExpressionNotAllowed, ptStoreExpressionNotAllowed, },
+  {enStudentDistribution, frStudentDistribution, esStudentDistribution, deStudentDistribution, ptStudentDistribution, },
+  {enSuccessProbability, frSuccessProbability, esSuccessProbability, deSuccessProbability, ptSuccessProbability, },
+  {enSum, frSum, esSum, deSum, ptSum, },
+  {enSyntaxError, frSyntaxError, esSyntaxError, deSyntaxError, ptSyntaxError, },
+  {enTEnd, frTEnd, esTEnd, deTEnd, ptTEnd, },
+  {enTStart, frTStart, esTStart, deTStart, ptTStart, },
+  {enTangent, frTangent, esTangent, deTangent, ptTangent, },
+  {enTermSum, frTermSum, esTermSum, deTermSum, ptTermSum, },
+  {enThetaEnd, frThetaEnd, esThetaEnd, deThetaEnd, ptThetaEnd, },
+  {enThetaStart, frThetaStart, esThetaStart, deThetaStart, ptThetaStart, },
+  {enThirdQuartile, frThirdQuartile, esThirdQuartile, deThirdQuartile, ptThirdQuartile, },
+  {enToDeactivateExamMode1, frToDeactivateExamMode1, esToDeactivateExamMode1, deToDeactivateExamMode1, ptToDeactivateExamMode1, },
+  {enToDeactivateExamMode2, frToDeactivateExamMode2, esToDeactivateExamMode2, deToDeactivateExamMode2, ptToDeactivateExamMode2, },
+  {enToDeactivateExamMode3, frToDeactivateExamMode3, esToDeactivateExamMode3, deToDeactivateExamMode3, ptToDeactivateExamMode3, },
+  {enToZoom, frToZoom, esToZoom, deToZoom, ptToZoom, },
+  {enTooManyVariables, frTooManyVariables, esTooManyVariables, deTooManyVariables, ptTooManyVariables, },
+  {enToolbox, frToolbox, esToolbox, deToolbox, ptToolbox, },
+  {enTotalSize, frTotalSize, esTotalSize, deTotalSize, ptTotalSize, },
+  {enTrace, frTrace, esTrace, deTrace, ptTrace, },
+  {enTranspose, frTranspose, esTranspose, deTranspose, ptTranspose, },
+  {enTrigonometric, frTrigonometric, esTrigonometric, deTrigonometric, ptTrigonometric, },
+  {enTrigonometrical, frTrigonometrical, esTrigonometrical, deTrigonometrical, ptTrigonometrical, },
+  {enUSBConnected, frUSBConnected, esUSBConnected, deUSBConnected, ptUSBConnected, },
+  {enUndefinedEquation, frUndefinedEquation, esUndefinedEquation, deUndefinedEquation, ptUndefinedEquation, },
+  {enUndefinedValue, frUndefinedValue, esUndefinedValue, deUndefinedValue, ptUndefinedValue, },
+  {enUniformDistribution, frUniformDistribution, esUniformDistribution, deUniformDistribution, ptUniformDistribution, },
+  {enUniforme, frUniforme, esUniforme, deUniforme, ptUniforme, },
+  {enUnit, frUnit, esUnit, deUnit, ptUnit, },
+  {enUnitAmountMenu, frUnitAmountMenu, esUnitAmountMenu, deUnitAmountMenu, ptUnitAmountMenu, },
+  {enUnitAmountMole, frUnitAmountMole, esUnitAmountMole, deUnitAmountMole, ptUnitAmountMole, },
+  {enUnitAmountMoleMicro, frUnitAmountMoleMicro, esUnitAmountMoleMicro, deUnitAmountMoleMicro, ptUnitAmountMoleMicro, },
+  {enUnitAmountMoleMilli, frUnitAmountMoleMilli, esUnitAmountMoleMilli, deUnitAmountMoleMilli, ptUnitAmountMoleMilli, },
+  {enUnitCapacitanceFarad, frUnitCapacitanceFarad, esUnitCapacitanceFarad, deUnitCapacitanceFarad, ptUnitCapacitanceFarad, },
+  {enUnitCapacitanceFaradMicro, frUnitCapacitanceFaradMicro, esUnitCapacitanceFaradMicro, deUnitCapacitanceFaradMicro, ptUnitCapacitanceFaradMicro, },
+  {enUnitCapacitanceFaradMilli, frUnitCapacitanceFaradMilli, esUnitCapacitanceFaradMilli, deUnitCapacitanceFaradMilli, ptUnitCapacitanceFaradMilli, },
+  {enUnitCapacitanceMenu, frUnitCapacitanceMenu, esUnitCapacitanceMenu, deUnitCapacitanceMenu, ptUnitCapacitanceMenu, },
+  {enUnitChargeCoulomb, frUnitChargeCoulomb, esUnitChargeCoulomb, deUnitChargeCoulomb, ptUnitChargeCoulomb, },
+  {enUnitConductanceMenu, frUnitConductanceMenu, esUnitConductanceMenu, deUnitConductanceMenu, ptUnitConductanceMenu, },
+  {enUnitConductanceSiemens, frUnitConductanceSiemens, esUnitConductanceSiemens, deUnitConductanceSiemens, ptUnitConductanceSiemens, },
+  {enUnitConductanceSiemensMilli, frUnitConductanceSiemensMilli, esUnitConductanceSiemensMilli, deUnitConductanceSiemensMilli, ptUnitConductanceSiemensMilli, },
+  {enUnitCurrentAmpere, frUnitCurrentAmpere, esUnitCurrentAmpere, deUnitCurrentAmpere, ptUnitCurrentAmpere, },
+  {enUnitCurrentAmpereMicro, frUnitCurrentAmpereMicro, esUnitCurrentAmpereMicro, deUnitCurrentAmpereMicro, ptUnitCurrentAmpereMicro, },
+  {enUnitCurrentAmpereMilli, frUnitCurrentAmpereMilli, esUnitCurrentAmpereMilli, deUnitCurrentAmpereMilli, ptUnitCurrentAmpereMilli, },
+  {enUnitCurrentMenu, frUnitCurrentMenu, esUnitCurrentMenu, deUnitCurrentMenu, ptUnitCurrentMenu, },
+  {enUnitDistanceAstronomicalUnit, frUnitDistanceAstronomicalUnit, esUnitDistanceAstronomicalUnit, deUnitDistanceAstronomicalUnit, ptUnitDistanceAstronomicalUnit, },
+  {enUnitDistanceLightYear, frUnitDistanceLightYear, esUnitDistanceLightYear, deUnitDistanceLightYear, ptUnitDistanceLightYear, },
+  {enUnitDistanceMenu, frUnitDistanceMenu, esUnitDistanceMenu, deUnitDistanceMenu, ptUnitDistanceMenu, },
+  {enUnitDistanceMeter, frUnitDistanceMeter, esUnitDistanceMeter, deUnitDistanceMeter, ptUnitDistanceMeter, },
+  {enUnitDistanceMeterKilo, frUnitDistanceMeterKilo, esUnitDistanceMeterKilo, deUnitDistanceMeterKilo, ptUnitDistanceMeterKilo, },
+  {enUnitDistanceMeterMenu, frUnitDistanceMeterMenu, esUnitDistanceMeterMenu, deUnitDistanceMeterMenu, ptUnitDistanceMeterMenu, },
+  {enUnitDistanceMeterMicro, frUnitDistanceMeterMicro, esUnitDistanceMeterMicro, deUnitDistanceMeterMicro, ptUnitDistanceMeterMicro, },
+  {enUnitDistanceMeterMilli, frUnitDistanceMeterMilli, esUnitDistanceMeterMilli, deUnitDistanceMeterMilli, ptUnitDistanceMeterMilli, },
+  {enUnitDistanceMeterNano, frUnitDistanceMeterNano, esUnitDistanceMeterNano, deUnitDistanceMeterNano, ptUnitDistanceMeterNano, },
+  {enUnitDistanceMeterPico, frUnitDistanceMeterPico, esUnitDistanceMeterPico, deUnitDistanceMeterPico, ptUnitDistanceMeterPico, },
+  {enUnitDistanceParsec, frUnitDistanceParsec, esUnitDistanceParsec, deUnitDistanceParsec, ptUnitDistanceParsec, },
+  {enUnitElectricChargeMenu, frUnitElectricChargeMenu, esUnitElectricChargeMenu, deUnitElectricChargeMenu, ptUnitElectricChargeMenu, },
+  {enUnitEnergyElectronVolt, frUnitEnergyElectronVolt, esUnitEnergyElectronVolt, deUnitEnergyElectronVolt, ptUnitEnergyElectronVolt, },
+  {enUnitEnergyElectronVoltKilo, frUnitEnergyElectronVoltKilo, esUnitEnergyElectronVoltKilo, deUnitEnergyElectronVoltKilo, ptUnitEnergyElectronVoltKilo, },
+  {enUnitEnergyElectronVoltMega, frUnitEnergyElectronVoltMega, esUnitEnergyElectronVoltMega, deUnitEnergyElectronVoltMega, ptUnitEnergyElectronVoltMega, },
+  {enUnitEnergyElectronVoltMilli, frUnitEnergyElectronVoltMilli, esUnitEnergyElectronVoltMilli, deUnitEnergyElectronVoltMilli, ptUnitEnergyElectronVoltMilli, },
+  {enUnitEnergyEletronVoltMenu, frUnitEnergyEletronVoltMenu, esUnitEnergyEletronVoltMenu, deUnitEnergyEletronVoltMenu, ptUnitEnergyEletronVoltMenu, },
+  {enUnitEnergyJoule, frUnitEnergyJoule, esUnitEnergyJoule, deUnitEnergyJoule, ptUnitEnergyJoule, },
+  {enUnitEnergyJouleKilo, frUnitEnergyJouleKilo, esUnitEnergyJouleKilo, deUnitEnergyJouleKilo, ptUnitEnergyJouleKilo, },
+  {enUnitEnergyJouleMenu, frUnitEnergyJouleMenu, esUnitEnergyJouleMenu, deUnitEnergyJouleMenu, ptUnitEnergyJouleMenu, },
+  {enUnitEnergyJouleMilli, frUnitEnergyJouleMilli, esUnitEnergyJouleMilli, deUnitEnergyJouleMilli, ptUnitEnergyJouleMilli, },
+  {enUnitEnergyMenu, frUnitEnergyMenu, esUnitEnergyMenu, deUnitEnergyMenu, ptUnitEnergyMenu, },
+  {enUnitForceMenu, frUnitForceMenu, esUnitForceMenu, deUnitForceMenu, ptUnitForceMenu, },
+  {enUnitForceNewton, frUnitForceNewton, esUnitForceNewton, deUnitForceNewton, ptUnitForceNewton, },
+  {enUnitForceNewtonKilo, frUnitForceNewtonKilo, esUnitForceNewtonKilo, deUnitForceNewtonKilo, ptUnitForceNewtonKilo, },
+  {enUnitForceNewtonMilli, frUnitForceNewtonMilli, esUnitForceNewtonMilli, deUnitForceNewtonMilli, ptUnitForceNewtonMilli, },
+  {enUnitFrequencyHertz, frUnitFrequencyHertz, esUnitFrequencyHertz, deUnitFrequencyHertz, ptUnitFrequencyHertz, },
+  {enUnitFrequencyHertzGiga, frUnitFrequencyHertzGiga, esUnitFrequencyHertzGiga, deUnitFrequencyHertzGiga, ptUnitFrequencyHertzGiga, },
+  {enUnitFrequencyHertzKilo, frUnitFrequencyHertzKilo, esUnitFrequencyHertzKilo, deUnitFrequencyHertzKilo, ptUnitFrequencyHertzKilo, },
+  {enUnitFrequencyHertzMega, frUnitFrequencyHertzMega, esUnitFrequencyHertzMega, deUnitFrequencyHertzMega, ptUnitFrequencyHertzMega, },
+  {enUnitFrequencyMenu, frUnitFrequencyMenu, esUnitFrequencyMenu, deUnitFrequencyMenu, ptUnitFrequencyMenu, },
+  {enUnitInductanceHenry, frUnitInductanceHenry, esUnitInductanceHenry, deUnitInductanceHenry, ptUnitInductanceHenry, },
+  {enUnitLuminousIntensityCandela, frUnitLuminousIntensityCandela, esUnitLuminousIntensityCandela, deUnitLuminousIntensityCandela, ptUnitLuminousIntensityCandela, },
+  {enUnitLuminousIntensityMenu, frUnitLuminousIntensityMenu, esUnitLuminousIntensityMenu, deUnitLuminousIntensityMenu, ptUnitLuminousIntensityMenu, },
+  {enUnitMagneticFieldMenu, frUnitMagneticFieldMenu, esUnitMagneticFieldMenu, deUnitMagneticFieldMenu, ptUnitMagneticFieldMenu, },
+  {enUnitMagneticFieldTesla, frUnitMagneticFieldTesla, esUnitMagneticFieldTesla, deUnitMagneticFieldTesla, ptUnitMagneticFieldTesla, },
+  {enUnitMassGram, frUnitMassGram, esUnitMassGram, deUnitMassGram, ptUnitMassGram, },
+  {enUnitMassGramKilo, frUnitMassGramKilo, esUnitMassGramKilo, deUnitMassGramKilo, ptUnitMassGramKilo, },
+  {enUnitMassGramMicro, frUnitMassGramMicro, esUnitMassGramMicro, deUnitMassGramMicro, ptUnitMassGramMicro, },
+  {enUnitMassGramMilli, frUnitMassGramMilli, esUnitMassGramMilli, deUnitMassGramMilli, ptUnitMassGramMilli, },
+  {enUnitMassGramNano, frUnitMassGramNano, esUnitMassGramNano, deUnitMassGramNano, ptUnitMassGramNano, },
+  {enUnitMassMenu, frUnitMassMenu, esUnitMassMenu, deUnitMassMenu, ptUnitMassMenu, },
+  {enUnitMassTonne, frUnitMassTonne, esUnitMassTonne, deUnitMassTonne, ptUnitMassTonne, },
+  {enUnitPotentialMenu, frUnitPotentialMenu, esUnitPotentialMenu, deUnitPotentialMenu, ptUnitPotentialMenu, },
+  {enUnitPotentialVolt, frUnitPotentialVolt, esUnitPotentialVolt, deUnitPotentialVolt, ptUnitPotentialVolt, },
+  {enUnitPotentialVoltKilo, frUnitPotentialVoltKilo, esUnitPotentialVoltKilo, deUnitPotentialVoltKilo, ptUnitPotentialVoltKilo, },
+  {enUnitPotentialVoltMicro, frUnitPotentialVoltMicro, esUnitPotentialVoltMicro, deUnitPotentialVoltMicro, ptUnitPotentialVoltMicro, },
+  {enUnitPotentialVoltMilli, frUnitPotentialVoltMilli, esUnitPotentialVoltMilli, deUnitPotentialVoltMilli, ptUnitPotentialVoltMilli, },
+  {enUnitPowerMenu, frUnitPowerMenu, esUnitPowerMenu, deUnitPowerMenu, ptUnitPowerMenu, },
+  {enUnitPowerWatt, frUnitPowerWatt, esUnitPowerWatt, deUnitPowerWatt, ptUnitPowerWatt, },
+  {enUnitPowerWattGiga, frUnitPowerWattGiga, esUnitPowerWattGiga, deUnitPowerWattGiga, ptUnitPowerWattGiga, },
+  {enUnitPowerWattKilo, frUnitPowerWattKilo, esUnitPowerWattKilo, deUnitPowerWattKilo, ptUnitPowerWattKilo, },
+  {enUnitPowerWattMega, frUnitPowerWattMega, esUnitPowerWattMega, deUnitPowerWattMega, ptUnitPowerWattMega, },
+  {enUnitPowerWattMicro, frUnitPowerWattMicro, esUnitPowerWattMicro, deUnitPowerWattMicro, ptUnitPowerWattMicro, },
+  {enUnitPowerWattMilli, frUnitPowerWattMilli, esUnitPowerWattMilli, deUnitPowerWattMilli, ptUnitPowerWattMilli, },
+  {enUnitPressureAtm, frUnitPressureAtm, esUnitPressureAtm, deUnitPressureAtm, ptUnitPressureAtm, },
+  {enUnitPressureBar, frUnitPressureBar, esUnitPressureBar, deUnitPressureBar, ptUnitPressureBar, },
+  {enUnitPressureMenu, frUnitPressureMenu, esUnitPressureMenu, deUnitPressureMenu, ptUnitPressureMenu, },
+  {enUnitPressurePascal, frUnitPressurePascal, esUnitPressurePascal, deUnitPressurePascal, ptUnitPressurePascal, },
+  {enUnitPressurePascalHecto, frUnitPressurePascalHecto, esUnitPressurePascalHecto, deUnitPressurePascalHecto, ptUnitPressurePascalHecto, },
+  {enUnitResistanceMenu, frUnitResistanceMenu, esUnitResistanceMenu, deUnitResistanceMenu, ptUnitResistanceMenu, },
+  {enUnitResistanceOhm, frUnitResistanceOhm, esUnitResistanceOhm, deUnitResistanceOhm, ptUnitResistanceOhm, },
+  {enUnitResistanceOhmKilo, frUnitResistanceOhmKilo, esUnitResistanceOhmKilo, deUnitResistanceOhmKilo, ptUnitResistanceOhmKilo, },
+  {enUnitSurfaceHectar, frUnitSurfaceHectar, esUnitSurfaceHectar, deUnitSurfaceHectar, ptUnitSurfaceHectar, },
+  {enUnitSurfaceMenu, frUnitSurfaceMenu, esUnitSurfaceMenu, deUnitSurfaceMenu, ptUnitSurfaceMenu, },
+  {enUnitTemperatureKelvin, frUnitTemperatureKelvin, esUnitTemperatureKelvin, deUnitTemperatureKelvin, ptUnitTemperatureKelvin, },
+  {enUnitTemperatureMenu, frUnitTemperatureMenu, esUnitTemperatureMenu, deUnitTemperatureMenu, ptUnitTemperatureMenu, },
+  {enUnitTimeDay, frUnitTimeDay, esUnitTimeDay, deUnitTimeDay, ptUnitTimeDay, },
+  {enUnitTimeHour, frUnitTimeHour, esUnitTimeHour, deUnitTimeHour, ptUnitTimeHour, },
+  {enUnitTimeMenu, frUnitTimeMenu, esUnitTimeMenu, deUnitTimeMenu, ptUnitTimeMenu, },
+  {enUnitTimeMinute, frUnitTimeMinute, esUnitTimeMinute, deUnitTimeMinute, ptUnitTimeMinute, },
+  {enUnitTimeMonth, frUnitTimeMonth, esUnitTimeMonth, deUnitTimeMonth, ptUnitTimeMonth, },
+  {enUnitTimeSecond, frUnitTimeSecond, esUnitTimeSecond, deUnitTimeSecond, ptUnitTimeSecond, },
+  {enUnitTimeSecondMenu, frUnitTimeSecondMenu, esUnitTimeSecondMenu, deUnitTimeSecondMenu, ptUnitTimeSecondMenu, },
+  {enUnitTimeSecondMicro, frUnitTimeSecondMicro, esUnitTimeSecondMicro, deUnitTimeSecondMicro, ptUnitTimeSecondMicro, },
+  {enUnitTimeSecondMilli, frUnitTimeSecondMilli, esUnitTimeSecondMilli, deUnitTimeSecondMilli, ptUnitTimeSecondMilli, },
+  {enUnitTimeSecondNano, frUnitTimeSecondNano, esUnitTimeSecondNano, deUnitTimeSecondNano, ptUnitTimeSecondNano, },
+  {enUnitTimeWeek, frUnitTimeWeek, esUnitTimeWeek, deUnitTimeWeek, ptUnitTimeWeek, },
+  {enUnitTimeYear, frUnitTimeYear, esUnitTimeYear, deUnitTimeYear, ptUnitTimeYear, },
+  {enUnitVolumeLiter, frUnitVolumeLiter, esUnitVolumeLiter, deUnitVolumeLiter, ptUnitVolumeLiter, },
+  {enUnitVolumeLiterCenti, frUnitVolumeLiterCenti, esUnitVolumeLiterCenti, deUnitVolumeLiterCenti, ptUnitVolumeLiterCenti, },
+  {enUnitVolumeLiterDeci, frUnitVolumeLiterDeci, esUnitVolumeLiterDeci, deUnitVolumeLiterDeci, ptUnitVolumeLiterDeci, },
+  {enUnitVolumeLiterMilli, frUnitVolumeLiterMilli, esUnitVolumeLiterMilli, deUnitVolumeLiterMilli, ptUnitVolumeLiterMilli, },
+  {enUnitVolumeMenu, frUnitVolumeMenu, esUnitVolumeMenu, deUnitVolumeMenu, ptUnitVolumeMenu, },
+  {enUnrealEquation, frUnrealEquation, esUnrealEquation, deUnrealEquation, ptUnrealEquation, },
+  {enUpdateAvailable, frUpdateAvailable, esUpdateAvailable, deUpdateAvailable, ptUpdateAvailable, },
+  {enUpdateMessage1, frUpdateMessage1, esUpdateMessage1, deUpdateMessage1, ptUpdateMessage1, },
+  {enUpdateMessage2, frUpdateMessage2, esUpdateMessage2, deUpdateMessage2, ptUpdateMessage2, },
+  {enUpdateMessage3, frUpdateMessage3, esUpdateMessage3, deUpdateMessage3, ptUpdateMessage3, },
+  {enUpdateMessage4, frUpdateMessage4, esUpdateMessage4, deUpdateMessage4, ptUpdateMessage4, },
+  {enUpdatePopUp, frUpdatePopUp, esUpdatePopUp, deUpdatePopUp, ptUpdatePopUp, },
+  {enUseEquationModel, frUseEquationModel, esUseEquationModel, deUseEquationModel, ptUseEquationModel, },
+  {enValueNotReachedByFunction, frValueNotReachedByFunction, esValueNotReachedByFunction, deValueNotReachedByFunction, ptValueNotReachedByFunction, },
+  {enValueNotReachedByRegression, frValueNotReachedByRegression, esValueNotReachedByRegression, deValueNotReachedByRegression, ptValueNotReachedByRegression, },
+  {enValueNotReachedBySequence, frValueNotReachedBySequence, esValueNotReachedBySequence, deValueNotReachedBySequence, ptValueNotReachedBySequence, },
+  {enValues1, frValues1, esValues1, deValues1, ptValues1, },
+  {enValues2, frValues2, esValues2, deValues2, ptValues2, },
+  {enValues3, frValues3, esValues3, deValues3, ptValues3, },
+  {enValuesTab, frValuesTab, esValuesTab, deValuesTab, ptValuesTab, },
+  {enVariables, frVariables, esVariables, deVariables, ptVariables, },
+  {enWarning, frWarning, esWarning, deWarning, ptWarning, },
+  {enXEnd, frXEnd, esXEnd, deXEnd, ptXEnd, },
+  {enXPrediction, frXPrediction, esXPrediction, deXPrediction, ptXPrediction, },
+  {enXStart, frXStart, esXStart, deXStart, ptXStart, },
+  {enYPrediction, frYPrediction, esYPrediction, deYPrediction, ptYPrediction, },
+  {enZeros, frZeros, esZeros, deZeros, ptZeros, },
+  {enZoom, frZoom, esZoom, deZoom, ptZoom, },
+};
+
+const char * translate(Message m, Language l) {
+  assert(m != Message::LocalizedMessageMarker);
+  int localizedMessageOffset = (int)Message::LocalizedMessageMarker+1;
+  if ((int)m < localizedMessageOffset) {
+    assert(universalMessages[(int)m] != nullptr);
+    return universalMessages[(int)m];
+  }
+  int languageIndex = (int)l;
+  if (l == Language::Default) {
+    languageIndex = (int) GlobalPreferences::sharedGlobalPreferences()->language();
+  }
+  assert(languageIndex > 0);
+  int messageIndex = (int)m - localizedMessageOffset;
+  assert((messageIndex*NumberOfLanguages+languageIndex-1)*sizeof(char *) < sizeof(messages));
+  return messages[messageIndex][languageIndex-1];
+}
+
+}
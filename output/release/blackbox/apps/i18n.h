@@ -0,0 +1,1185 @@
+#ifndef APPS_I18N_H
+#define APPS_I18N_H
+
+// This file is auto-generated by i18n.py
+
+#include <escher.h>
+
+namespace I18n {
+
+constexpr static int NumberOfLanguages = 5;
+
+enum class Message : uint16_t {
+  Default = 0,
+  A,
+  AbsCommandWithArg,
+  AcoshCommandWithArg,
+  AlmostEqual,
+  Alpha,
+  ArgCommandWithArg,
+  AsinhCommandWithArg,
+  AtanhCommandWithArg,
+  B,
+  BinomialCDFCommandWithArg,
+  BinomialCommandWithArg,
+  BinomialPDFCommandWithArg,
+  BlankMessage,
+  C,
+  CapitalAlpha,
+  CeilCommandWithArg,
+  CmathModule,
+  CodeApp,
+  CodeAppCapital,
+  ConditionAnd,
+  ConditionNot,
+  ConditionOr,
+  ConditionsMenu,
+  ConfidenceCommandWithArg,
+  ConjCommandWithArg,
+  ConsolePrompt,
+  CoshCommandWithArg,
+  CubicRegressionFormula,
+  D,
+  D1,
+  D2,
+  Dash,
+  DeterminantCommandWithArg,
+  DiffCommand,
+  DiffCommandWithArg,
+  DimensionCommandWithArg,
+  DiscreteLegend,
+  DiscriminantFormulaDegree2,
+  E,
+  Equal,
+  EqualityCondition,
+  EqualityConditionWithArg,
+  ExponentialRegressionFormula,
+  FactorCommandWithArg,
+  FccId,
+  FiniteIntegralFirstLegend,
+  FiniteIntegralLegend,
+  Fisher,
+  FloorCommandWithArg,
+  ForInListLoop,
+  ForInListLoopWithArg,
+  ForInRange1ArgLoop,
+  ForInRange1ArgLoopWithArg,
+  ForInRange2ArgsLoop,
+  ForInRange2ArgsLoopWithArg,
+  ForInRange3ArgsLoop,
+  ForInRange3ArgsLoopWithArg,
+  ForLoopMenu,
+  FracCommandWithArg,
+  GcdCommandWithArg,
+  Gon,
+  IfAndIfElseStatement,
+  IfAndIfElseStatementWithArg,
+  IfElifElseStatement,
+  IfElifElseStatementWithArg,
+  IfElseStatement,
+  IfElseStatementWithArg,
+  IfOrIfElseStatement,
+  IfOrIfElseStatementWithArg,
+  IfStatementMenu,
+  IfThenStatement,
+  IfThenStatementWithArg,
+  ImCommandWithArg,
+  IndentityCommandWithArg,
+  InferiorCondition,
+  InferiorConditionWithArg,
+  InferiorStrictCondition,
+  InferiorStrictConditionWithArg,
+  IntCommand,
+  IntCommandWithArg,
+  InvBinomialCommandWithArg,
+  InvNormCommandWithArg,
+  InvSortCommandWithArg,
+  InverseCommandWithArg,
+  IonModule,
+  K,
+  KandinskyModule,
+  Lambda,
+  LanguageDE,
+  LanguageEN,
+  LanguageES,
+  LanguageFR,
+  LanguagePT,
+  LcmCommandWithArg,
+  LeftIntegralFirstLegend,
+  LeftIntegralSecondLegend,
+  LinearRegressionFormula,
+  LogCommandWithArg,
+  LogarithmicRegressionFormula,
+  LogisticRegressionFormula,
+  MathModule,
+  MatrixCommand,
+  MatrixCommandWithArg,
+  MaxCommandWithArg,
+  MinCommandWithArg,
+  Mu,
+  N,
+  NonEqualityCondition,
+  NonEqualityConditionWithArg,
+  NormCDF2CommandWithArg,
+  NormCDFCommandWithArg,
+  NormPDFCommandWithArg,
+  P,
+  PermuteCommandWithArg,
+  Poisson,
+  PowerRegressionFormula,
+  Prediction95CommandWithArg,
+  PredictionCommandWithArg,
+  ProductCommand,
+  ProductCommandWithArg,
+  PythonCommand1J,
+  PythonCommandAbs,
+  PythonCommandAcos,
+  PythonCommandAcosh,
+  PythonCommandAmpersand,
+  PythonCommandAppend,
+  PythonCommandAppendWithoutArg,
+  PythonCommandAsin,
+  PythonCommandAsinh,
+  PythonCommandAtan,
+  PythonCommandAtan2,
+  PythonCommandAtanh,
+  PythonCommandBin,
+  PythonCommandCeil,
+  PythonCommandChoice,
+  PythonCommandClear,
+  PythonCommandClearWithoutArg,
+  PythonCommandCmathFunction,
+  PythonCommandCmathFunctionWithoutArg,
+  PythonCommandColor,
+  PythonCommandComplex,
+  PythonCommandConstantE,
+  PythonCommandConstantPi,
+  PythonCommandCopySign,
+  PythonCommandCos,
+  PythonCommandCosComplex,
+  PythonCommandCosh,
+  PythonCommandCount,
+  PythonCommandCountWithoutArg,
+  PythonCommandDef,
+  PythonCommandDefWithArg,
+  PythonCommandDegrees,
+  PythonCommandDivMod,
+  PythonCommandDrawString,
+  PythonCommandErf,
+  PythonCommandErfc,
+  PythonCommandEval,
+  PythonCommandExp,
+  PythonCommandExpComplex,
+  PythonCommandExpm1,
+  PythonCommandFabs,
+  PythonCommandFillRect,
+  PythonCommandFloat,
+  PythonCommandFloor,
+  PythonCommandFmod,
+  PythonCommandFrExp,
+  PythonCommandGamma,
+  PythonCommandGetPixel,
+  PythonCommandGetrandbits,
+  PythonCommandHex,
+  PythonCommandImag,
+  PythonCommandImagWithoutArg,
+  PythonCommandImportCmath,
+  PythonCommandImportFromCmath,
+  PythonCommandImportFromIon,
+  PythonCommandImportFromKandinsky,
+  PythonCommandImportFromMath,
+  PythonCommandImportFromRandom,
+  PythonCommandImportFromTime,
+  PythonCommandImportFromTurtle,
+  PythonCommandImportIon,
+  PythonCommandImportKandinsky,
+  PythonCommandImportMath,
+  PythonCommandImportRandom,
+  PythonCommandImportTime,
+  PythonCommandImportTurtle,
+  PythonCommandIndex,
+  PythonCommandIndexWithoutArg,
+  PythonCommandInput,
+  PythonCommandInsert,
+  PythonCommandInsertWithoutArg,
+  PythonCommandInt,
+  PythonCommandIonFunction,
+  PythonCommandIonFunctionWithoutArg,
+  PythonCommandIsFinite,
+  PythonCommandIsInfinite,
+  PythonCommandIsKeyDown,
+  PythonCommandIsNaN,
+  PythonCommandKandinskyFunction,
+  PythonCommandKandinskyFunctionWithoutArg,
+  PythonCommandKeyAlpha,
+  PythonCommandKeyAns,
+  PythonCommandKeyBack,
+  PythonCommandKeyBackspace,
+  PythonCommandKeyComma,
+  PythonCommandKeyCosine,
+  PythonCommandKeyDivision,
+  PythonCommandKeyDot,
+  PythonCommandKeyDown,
+  PythonCommandKeyEe,
+  PythonCommandKeyEight,
+  PythonCommandKeyExe,
+  PythonCommandKeyExp,
+  PythonCommandKeyFive,
+  PythonCommandKeyFour,
+  PythonCommandKeyHome,
+  PythonCommandKeyImaginary,
+  PythonCommandKeyLeft,
+  PythonCommandKeyLeftParenthesis,
+  PythonCommandKeyLn,
+  PythonCommandKeyLog,
+  PythonCommandKeyMinus,
+  PythonCommandKeyMultiplication,
+  PythonCommandKeyNine,
+  PythonCommandKeyOk,
+  PythonCommandKeyOnOff,
+  PythonCommandKeyOne,
+  PythonCommandKeyPi,
+  PythonCommandKeyPlus,
+  PythonCommandKeyPower,
+  PythonCommandKeyRight,
+  PythonCommandKeyRightParenthesis,
+  PythonCommandKeySeven,
+  PythonCommandKeyShift,
+  PythonCommandKeySine,
+  PythonCommandKeySix,
+  PythonCommandKeySqrt,
+  PythonCommandKeySquare,
+  PythonCommandKeyTangent,
+  PythonCommandKeyThree,
+  PythonCommandKeyToolbox,
+  PythonCommandKeyTwo,
+  PythonCommandKeyUp,
+  PythonCommandKeyVar,
+  PythonCommandKeyXnt,
+  PythonCommandKeyZero,
+  PythonCommandLF,
+  PythonCommandLdexp,
+  PythonCommandLength,
+  PythonCommandLgamma,
+  PythonCommandLog,
+  PythonCommandLog10,
+  PythonCommandLog2,
+  PythonCommandLogComplex,
+  PythonCommandMathFunction,
+  PythonCommandMathFunctionWithoutArg,
+  PythonCommandMax,
+  PythonCommandMin,
+  PythonCommandModf,
+  PythonCommandMonotonic,
+  PythonCommandOct,
+  PythonCommandPercent,
+  PythonCommandPhase,
+  PythonCommandPolar,
+  PythonCommandPop,
+  PythonCommandPopWithoutArg,
+  PythonCommandPound,
+  PythonCommandPower,
+  PythonCommandPrint,
+  PythonCommandRadians,
+  PythonCommandRandint,
+  PythonCommandRandom,
+  PythonCommandRandomFunction,
+  PythonCommandRandomFunctionWithoutArg,
+  PythonCommandRandrange,
+  PythonCommandRangeStartStop,
+  PythonCommandRangeStop,
+  PythonCommandReal,
+  PythonCommandRealWithoutArg,
+  PythonCommandRect,
+  PythonCommandRemove,
+  PythonCommandRemoveWithoutArg,
+  PythonCommandReturn,
+  PythonCommandReverse,
+  PythonCommandReverseWithoutArg,
+  PythonCommandRound,
+  PythonCommandSeed,
+  PythonCommandSetPixel,
+  PythonCommandSin,
+  PythonCommandSinComplex,
+  PythonCommandSingleQuote,
+  PythonCommandSinh,
+  PythonCommandSleep,
+  PythonCommandSort,
+  PythonCommandSortWithoutArg,
+  PythonCommandSorted,
+  PythonCommandSqrt,
+  PythonCommandSqrtComplex,
+  PythonCommandSum,
+  PythonCommandSymbolExp,
+  PythonCommandTab,
+  PythonCommandTan,
+  PythonCommandTanh,
+  PythonCommandTimeFunction,
+  PythonCommandTimeFunctionWithoutArg,
+  PythonCommandTrunc,
+  PythonCommandTurtleFunction,
+  PythonCommandTurtleFunctionWithoutArg,
+  PythonCommandUniform,
+  PythonCommandVerticalBar,
+  PythonConstantE,
+  PythonConstantPi,
+  PythonTurtleCommandBackward,
+  PythonTurtleCommandBlack,
+  PythonTurtleCommandBlue,
+  PythonTurtleCommandBrown,
+  PythonTurtleCommandCircle,
+  PythonTurtleCommandColor,
+  PythonTurtleCommandColorWithoutArg,
+  PythonTurtleCommandForward,
+  PythonTurtleCommandGoto,
+  PythonTurtleCommandGreen,
+  PythonTurtleCommandGrey,
+  PythonTurtleCommandHeading,
+  PythonTurtleCommandHideturtle,
+  PythonTurtleCommandIsdown,
+  PythonTurtleCommandLeft,
+  PythonTurtleCommandOrange,
+  PythonTurtleCommandPendown,
+  PythonTurtleCommandPensize,
+  PythonTurtleCommandPenup,
+  PythonTurtleCommandPink,
+  PythonTurtleCommandPosition,
+  PythonTurtleCommandPurple,
+  PythonTurtleCommandRed,
+  PythonTurtleCommandReset,
+  PythonTurtleCommandRight,
+  PythonTurtleCommandSetheading,
+  PythonTurtleCommandSetposition,
+  PythonTurtleCommandShowturtle,
+  PythonTurtleCommandSpeed,
+  PythonTurtleCommandWhite,
+  PythonTurtleCommandYellow,
+  QuadraticRegressionFormula,
+  QuarticRegressionFormula,
+  QuoCommandWithArg,
+  R,
+  RandintCommandWithArg,
+  RandomCommandWithArg,
+  RandomModule,
+  ReCommandWithArg,
+  RemCommandWithArg,
+  RightIntegralFirstLegend,
+  RightIntegralSecondLegend,
+  RootCommandWithArg,
+  RoundCommandWithArg,
+  ScriptParameters,
+  Shift,
+  Sigma,
+  SinhCommandWithArg,
+  SortCommandWithArg,
+  Student,
+  SumCommand,
+  SumCommandWithArg,
+  SuperiorCondition,
+  SuperiorConditionWithArg,
+  SuperiorStrictCondition,
+  SuperiorStrictConditionWithArg,
+  Sxy,
+  T,
+  TMax,
+  TMin,
+  TanhCommandWithArg,
+  Theta,
+  ThetaMax,
+  ThetaMin,
+  TimeModule,
+  TraceCommandWithArg,
+  TransposeCommandWithArg,
+  TrigonometricRegressionFormula,
+  TurtleModule,
+  USBAppCapital,
+  UnitAmountMoleMicroSymbol,
+  UnitAmountMoleMilliSymbol,
+  UnitAmountMoleSymbol,
+  UnitCapacitanceFaradMicroSymbol,
+  UnitCapacitanceFaradMilliSymbol,
+  UnitCapacitanceFaradSymbol,
+  UnitChargeCoulombSymbol,
+  UnitConductanceSiemensMilliSymbol,
+  UnitConductanceSiemensSymbol,
+  UnitCurrentAmpereMicroSymbol,
+  UnitCurrentAmpereMilliSymbol,
+  UnitCurrentAmpereSymbol,
+  UnitDistanceAstronomicalUnitSymbol,
+  UnitDistanceLightYearSymbol,
+  UnitDistanceMeterKiloSymbol,
+  UnitDistanceMeterMicroSymbol,
+  UnitDistanceMeterMilliSymbol,
+  UnitDistanceMeterNanoSymbol,
+  UnitDistanceMeterPicoSymbol,
+  UnitDistanceMeterSymbol,
+  UnitDistanceParsecSymbol,
+  UnitEnergyElectronVoltKiloSymbol,
+  UnitEnergyElectronVoltMegaSymbol,
+  UnitEnergyElectronVoltMilliSymbol,
+  UnitEnergyElectronVoltSymbol,
+  UnitEnergyJouleKiloSymbol,
+  UnitEnergyJouleMilliSymbol,
+  UnitEnergyJouleSymbol,
+  UnitForceNewtonKiloSymbol,
+  UnitForceNewtonMilliSymbol,
+  UnitForceNewtonSymbol,
+  UnitFrequencyHertzGigaSymbol,
+  UnitFrequencyHertzKiloSymbol,
+  UnitFrequencyHertzMegaSymbol,
+  UnitFrequencyHertzSymbol,
+  UnitInductanceHenrySymbol,
+  UnitLuminousIntensityCandelaSymbol,
+  UnitMagneticFieldTeslaSymbol,
+  UnitMassGramKiloSymbol,
+  UnitMassGramMicroSymbol,
+  UnitMassGramMilliSymbol,
+  UnitMassGramNanoSymbol,
+  UnitMassGramSymbol,
+  UnitMassTonneSymbol,
+  UnitPotentialVoltKiloSymbol,
+  UnitPotentialVoltMicroSymbol,
+  UnitPotentialVoltMilliSymbol,
+  UnitPotentialVoltSymbol,
+  UnitPowerWattGigaSymbol,
+  UnitPowerWattKiloSymbol,
+  UnitPowerWattMegaSymbol,
+  UnitPowerWattMicroSymbol,
+  UnitPowerWattMilliSymbol,
+  UnitPowerWattSymbol,
+  UnitPressureAtmSymbol,
+  UnitPressureBarSymbol,
+  UnitPressurePascalHectoSymbol,
+  UnitPressurePascalSymbol,
+  UnitResistanceOhmKiloSymbol,
+  UnitResistanceOhmSymbol,
+  UnitSurfaceHectarSymbol,
+  UnitTemperatureKelvinSymbol,
+  UnitTimeDaySymbol,
+  UnitTimeHourSymbol,
+  UnitTimeMinuteSymbol,
+  UnitTimeMonthSymbol,
+  UnitTimeSecondMicroSymbol,
+  UnitTimeSecondMilliSymbol,
+  UnitTimeSecondNanoSymbol,
+  UnitTimeSecondSymbol,
+  UnitTimeWeekSymbol,
+  UnitTimeYearSymbol,
+  UnitVolumeLiterCentiSymbol,
+  UnitVolumeLiterDeciSymbol,
+  UnitVolumeLiterMilliSymbol,
+  UnitVolumeLiterSymbol,
+  WhileLoop,
+  WhileLoopMenu,
+  WhileLoopWithArg,
+  X,
+  XMax,
+  XMin,
+  Y,
+  YAuto,
+  YMax,
+  YMin,
+
+  LocalizedMessageMarker,
+
+  About,
+  AboutWarning1,
+  AboutWarning2,
+  AboutWarning3,
+  AboutWarning4,
+  AbsoluteValue,
+  ActivateDeactivate,
+  ActivateDutchExamMode,
+  ActivateExamMode,
+  ActiveDutchExamModeMessage1,
+  ActiveDutchExamModeMessage2,
+  ActiveDutchExamModeMessage3,
+  ActiveExamModeMessage1,
+  ActiveExamModeMessage2,
+  ActiveExamModeMessage3,
+  AddEquation,
+  AddFunction,
+  AddScript,
+  AddSequence,
+  AdditionalResults,
+  Agument,
+  AllowedCharactersAZaz09,
+  AllowedCharactersaz09,
+  AngleUnit,
+  ApproximateSolution,
+  ApproximateSolutionIntervalInstruction0,
+  ApproximateSolutionIntervalInstruction1,
+  Apps,
+  AppsCapital,
+  Arithmetic,
+  AutoImportScript,
+  Axis,
+  BarStart,
+  BasedLogarithm,
+  BetaPopUp,
+  BetaVersion,
+  BetaVersionMessage1,
+  BetaVersionMessage2,
+  BetaVersionMessage3,
+  BetaVersionMessage4,
+  BetaVersionMessage5,
+  BetaVersionMessage6,
+  BinaryBase,
+  Binomial,
+  BinomialCDF,
+  BinomialDistribution,
+  BinomialPDF,
+  BoxTab,
+  Brightness,
+  CalculApp,
+  CalculAppCapital,
+  Calculation,
+  Cancel,
+  Cartesian,
+  CartesianType,
+  Catalog,
+  Ceiling,
+  ChiSquared,
+  ChiSquaredDistribution,
+  ChooseDistribution,
+  ChooseParameters,
+  ChooseSequenceType,
+  ClearColumn,
+  ColumnOptions,
+  Combination,
+  Combinatorics,
+  ComplexAbsoluteValue,
+  ComplexFormat,
+  ComplexNumber,
+  Compute,
+  ComputeProbability,
+  Confidence,
+  Conjugate,
+  ConnectedMessage1,
+  ConnectedMessage2,
+  ConnectedMessage3,
+  ConnectedMessage4,
+  ConnectedMessage5,
+  ConnectedMessage6,
+  Console,
+  CopyColumnInList,
+  Covariance,
+  Cubic,
+  CurveType,
+  D1FisherDefinition,
+  D2FisherDefinition,
+  DataNotSuitable,
+  DataNotSuitableForRegression,
+  DataTab,
+  Decimal,
+  DecimalBase,
+  DefaultSetting,
+  Deg,
+  Degrees,
+  DegreesOfFreedomDefinition,
+  DeleteFunction,
+  DeleteScript,
+  DeleteSequence,
+  DerivateNumber,
+  DerivativeFunctionColumn,
+  Determinant,
+  Deviation,
+  DeviationDefinition,
+  Dimension,
+  DisplayMode,
+  DisplayValues,
+  DoubleRecurrence,
+  Edition2D,
+  EditionLinear,
+  EditionMode,
+  Empty,
+  EmptyExpressionBox0,
+  EmptyExpressionBox1,
+  EmptyExpressionBox2,
+  EmptyFunctionBox0,
+  EmptyFunctionBox1,
+  EmptyFunctionBox2,
+  EnableCharacters,
+  Eng,
+  Engineering,
+  EnterEquation,
+  EuclideanDivision,
+  ExamMode,
+  ExamModeActive,
+  ExamModeWarning1,
+  ExamModeWarning2,
+  ExamModeWarning3,
+  ExecuteScript,
+  ExitExamMode1,
+  ExitExamMode2,
+  Explicit,
+  Exponential,
+  ExponentialDistribution,
+  Expressions,
+  FillWithFormula,
+  FirstQuartile,
+  FirstTermIndex,
+  FisherDistribution,
+  Floor,
+  Fluctuation,
+  FontSizes,
+  ForbiddenValue,
+  ForbidenAppInExamMode1,
+  ForbidenAppInExamMode2,
+  FracPart,
+  Frequency,
+  FunctionApp,
+  FunctionAppCapital,
+  FunctionColor,
+  FunctionColumn,
+  FunctionDomain,
+  FunctionOptions,
+  FunctionTab,
+  Functions,
+  FunctionsAndVariables,
+  Geometric,
+  GeometricDistribution,
+  Goto,
+  Gradians,
+  GraphTab,
+  GreatCommonDivisor,
+  HardwareTestLaunch1,
+  HardwareTestLaunch2,
+  HardwareTestLaunch3,
+  HardwareTestLaunch4,
+  HexadecimalBase,
+  HideDerivativeColumn,
+  HistogramSet,
+  HistogramTab,
+  HyperbolicCosine,
+  HyperbolicSine,
+  HyperbolicTangent,
+  HyperbolicTrigonometry,
+  Identity,
+  ImaginaryPart,
+  ImportList,
+  InductanceMenu,
+  InfiniteNumberOfSolutions,
+  Initialization,
+  Integral,
+  InterquartileRange,
+  Intersection,
+  Interval,
+  IntervalDefinition,
+  IntervalSet,
+  IntervalT,
+  IntervalTheta,
+  IntervalX,
+  InvBinomial,
+  InvNorm,
+  InvSort,
+  Inverse,
+  InverseHyperbolicCosine,
+  InverseHyperbolicSine,
+  InverseHyperbolicTangent,
+  LambdaExponentialDefinition,
+  LambdaPoissonDefinition,
+  Language,
+  LargeFont,
+  LeastCommonMultiple,
+  Linear,
+  Lists,
+  Logarithmic,
+  Logistic,
+  LoopsAndTests,
+  LowBattery,
+  Matrices,
+  Maximum,
+  Mean,
+  MeanDefinition,
+  MeanDot,
+  Median,
+  Minimum,
+  MixedFraction,
+  Modules,
+  Move,
+  NColumn,
+  NEnd,
+  NStart,
+  NameCannotStartWithNumber,
+  NameTaken,
+  NameTooLong,
+  NewMatrix,
+  Next,
+  NoActivatedFunction,
+  NoActivatedSequence,
+  NoDataToPlot,
+  NoFunction,
+  NoFunctionToDelete,
+  NoIntersectionFound,
+  NoMaximumFound,
+  NoMinimumFound,
+  NoPreimageFound,
+  NoSequence,
+  NoSolutionEquation,
+  NoSolutionInterval,
+  NoSolutionSystem,
+  NoValueToCompute,
+  NoZeroFound,
+  NonLinearSystem,
+  NormCDF,
+  NormCDF2,
+  NormPDF,
+  Normal,
+  NormalDistribution,
+  NthRoot,
+  NumberOfDots,
+  Ok,
+  OnlyFirstSolutionsDisplayed0,
+  OnlyFirstSolutionsDisplayed1,
+  Or,
+  Orthonormal,
+  ParametricType,
+  Permutation,
+  Plot,
+  PlotOptions,
+  PoissonDistribution,
+  Polar,
+  PolarType,
+  PolynomeHasNoRealSolution0,
+  PolynomeHasNoRealSolution1,
+  PoolMemoryFull1,
+  PoolMemoryFull2,
+  Power,
+  PredefinedVariablesIgnoredLeft,
+  PredefinedVariablesIgnoredRight,
+  PredefinedVariablesUsedLeft,
+  PredefinedVariablesUsedRight,
+  Prediction,
+  Prediction95,
+  Preimage,
+  PrimeFactorDecomposition,
+  PrimeFactors,
+  ProbaApp,
+  ProbaAppCapital,
+  Probability,
+  Product,
+  Python1J,
+  PythonAbs,
+  PythonAcos,
+  PythonAcosh,
+  PythonAmpersand,
+  PythonAppend,
+  PythonAsin,
+  PythonAsinh,
+  PythonAtan,
+  PythonAtan2,
+  PythonAtanh,
+  PythonBin,
+  PythonCeil,
+  PythonChoice,
+  PythonClear,
+  PythonCmathFunction,
+  PythonColor,
+  PythonComplex,
+  PythonCopySign,
+  PythonCos,
+  PythonCosh,
+  PythonCount,
+  PythonDegrees,
+  PythonDivMod,
+  PythonDrawString,
+  PythonErf,
+  PythonErfc,
+  PythonEval,
+  PythonExp,
+  PythonExpm1,
+  PythonFabs,
+  PythonFillRect,
+  PythonFloat,
+  PythonFloor,
+  PythonFmod,
+  PythonFrExp,
+  PythonGamma,
+  PythonGetPixel,
+  PythonGetrandbits,
+  PythonHex,
+  PythonImag,
+  PythonImportCmath,
+  PythonImportIon,
+  PythonImportKandinsky,
+  PythonImportMath,
+  PythonImportRandom,
+  PythonImportTime,
+  PythonImportTurtle,
+  PythonIndex,
+  PythonInput,
+  PythonInsert,
+  PythonInt,
+  PythonIonFunction,
+  PythonIsFinite,
+  PythonIsInfinite,
+  PythonIsKeyDown,
+  PythonIsNaN,
+  PythonKandinskyFunction,
+  PythonKeyAlpha,
+  PythonKeyAns,
+  PythonKeyBack,
+  PythonKeyBackspace,
+  PythonKeyComma,
+  PythonKeyCosine,
+  PythonKeyDivision,
+  PythonKeyDot,
+  PythonKeyDown,
+  PythonKeyEe,
+  PythonKeyEight,
+  PythonKeyExe,
+  PythonKeyExp,
+  PythonKeyFive,
+  PythonKeyFour,
+  PythonKeyHome,
+  PythonKeyImaginary,
+  PythonKeyLeft,
+  PythonKeyLeftParenthesis,
+  PythonKeyLn,
+  PythonKeyLog,
+  PythonKeyMinus,
+  PythonKeyMultiplication,
+  PythonKeyNine,
+  PythonKeyOk,
+  PythonKeyOnOff,
+  PythonKeyOne,
+  PythonKeyPi,
+  PythonKeyPlus,
+  PythonKeyPower,
+  PythonKeyRight,
+  PythonKeyRightParenthesis,
+  PythonKeySeven,
+  PythonKeyShift,
+  PythonKeySine,
+  PythonKeySix,
+  PythonKeySqrt,
+  PythonKeySquare,
+  PythonKeyTangent,
+  PythonKeyThree,
+  PythonKeyToolbox,
+  PythonKeyTwo,
+  PythonKeyUp,
+  PythonKeyVar,
+  PythonKeyXnt,
+  PythonKeyZero,
+  PythonLF,
+  PythonLdexp,
+  PythonLength,
+  PythonLgamma,
+  PythonLog,
+  PythonLog10,
+  PythonLog2,
+  PythonMathFunction,
+  PythonMax,
+  PythonMin,
+  PythonModf,
+  PythonMonotonic,
+  PythonOct,
+  PythonPercent,
+  PythonPhase,
+  PythonPolar,
+  PythonPop,
+  PythonPound,
+  PythonPower,
+  PythonPrint,
+  PythonRadians,
+  PythonRandint,
+  PythonRandom,
+  PythonRandomFunction,
+  PythonRandrange,
+  PythonRangeStartStop,
+  PythonRangeStop,
+  PythonReal,
+  PythonRect,
+  PythonRemove,
+  PythonReverse,
+  PythonRound,
+  PythonSeed,
+  PythonSetPixel,
+  PythonSin,
+  PythonSingleQuote,
+  PythonSinh,
+  PythonSleep,
+  PythonSort,
+  PythonSqrt,
+  PythonSum,
+  PythonSymbolExp,
+  PythonTab,
+  PythonTan,
+  PythonTanh,
+  PythonTimeFunction,
+  PythonTrunc,
+  PythonTurtleBackward,
+  PythonTurtleBlack,
+  PythonTurtleBlue,
+  PythonTurtleBrown,
+  PythonTurtleCircle,
+  PythonTurtleColor,
+  PythonTurtleForward,
+  PythonTurtleFunction,
+  PythonTurtleGoto,
+  PythonTurtleGreen,
+  PythonTurtleGrey,
+  PythonTurtleHeading,
+  PythonTurtleHideturtle,
+  PythonTurtleIsdown,
+  PythonTurtleLeft,
+  PythonTurtleOrange,
+  PythonTurtlePendown,
+  PythonTurtlePensize,
+  PythonTurtlePenup,
+  PythonTurtlePink,
+  PythonTurtlePosition,
+  PythonTurtlePurple,
+  PythonTurtleRed,
+  PythonTurtleReset,
+  PythonTurtleRight,
+  PythonTurtleSetheading,
+  PythonTurtleSetposition,
+  PythonTurtleShowturtle,
+  PythonTurtleSpeed,
+  PythonTurtleWhite,
+  PythonTurtleYellow,
+  PythonUniform,
+  PythonVerticalBar,
+  Quadratic,
+  Quartic,
+  Quotient,
+  Rad,
+  Radian,
+  RandomAndApproximation,
+  RandomFloat,
+  RandomInteger,
+  Range,
+  Real,
+  RealPart,
+  RectangleWidth,
+  Reg,
+  Regression,
+  RegressionApp,
+  RegressionAppCapital,
+  RegressionCurve,
+  Remainder,
+  Rename,
+  RepetitionNumber,
+  RequireEquation,
+  ReservedName,
+  ResolveEquation,
+  ResolveSystem,
+  RoundAbscissa,
+  Rounding,
+  SampleStandardDeviationS,
+  Sci,
+  Scientific,
+  ScriptOptions,
+  SearchInverval,
+  SelectFirstTerm,
+  SelectLastTerm,
+  SelectLowerBound,
+  SelectUpperBound,
+  SequenceApp,
+  SequenceAppCapital,
+  SequenceColor,
+  SequenceOptions,
+  SequenceTab,
+  SequenceType,
+  SerialNumber,
+  SettingsApp,
+  SettingsAppCapital,
+  SignificantFigures,
+  SingleRecurrence,
+  Size,
+  Sizes1,
+  Sizes2,
+  Sizes3,
+  Skip,
+  SmallFont,
+  SoftwareVersion,
+  Solution,
+  SolverApp,
+  SolverAppCapital,
+  Sort,
+  SquareSum,
+  StandardDeviation,
+  StandardDeviationSigma,
+  StatTab,
+  StatsApp,
+  StatsAppCapital,
+  Step,
+  StorageMemoryFull1,
+  StorageMemoryFull2,
+  StoreExpressionNotAllowed,
+  StudentDistribution,
+  SuccessProbability,
+  Sum,
+  SyntaxError,
+  TEnd,
+  TStart,
+  Tangent,
+  TermSum,
+  ThetaEnd,
+  ThetaStart,
+  ThirdQuartile,
+  ToDeactivateExamMode1,
+  ToDeactivateExamMode2,
+  ToDeactivateExamMode3,
+  ToZoom,
+  TooManyVariables,
+  Toolbox,
+  TotalSize,
+  Trace,
+  Transpose,
+  Trigonometric,
+  Trigonometrical,
+  USBConnected,
+  UndefinedEquation,
+  UndefinedValue,
+  UniformDistribution,
+  Uniforme,
+  Unit,
+  UnitAmountMenu,
+  UnitAmountMole,
+  UnitAmountMoleMicro,
+  UnitAmountMoleMilli,
+  UnitCapacitanceFarad,
+  UnitCapacitanceFaradMicro,
+  UnitCapacitanceFaradMilli,
+  UnitCapacitanceMenu,
+  UnitChargeCoulomb,
+  UnitConductanceMenu,
+  UnitConductanceSiemens,
+  UnitConductanceSiemensMilli,
+  UnitCurrentAmpere,
+  UnitCurrentAmpereMicro,
+  UnitCurrentAmpereMilli,
+  UnitCurrentMenu,
+  UnitDistanceAstronomicalUnit,
+  UnitDistanceLightYear,
+  UnitDistanceMenu,
+  UnitDistanceMeter,
+  UnitDistanceMeterKilo,
+  UnitDistanceMeterMenu,
+  UnitDistanceMeterMicro,
+  UnitDistanceMeterMilli,
+  UnitDistanceMeterNano,
+  UnitDistanceMeterPico,
+  UnitDistanceParsec,
+  UnitElectricChargeMenu,
+  UnitEnergyElectronVolt,
+  UnitEnergyElectronVoltKilo,
+  UnitEnergyElectronVoltMega,
+  UnitEnergyElectronVoltMilli,
+  UnitEnergyEletronVoltMenu,
+  UnitEnergyJoule,
+  UnitEnergyJouleKilo,
+  UnitEnergyJouleMenu,
+  UnitEnergyJouleMilli,
+  UnitEnergyMenu,
+  UnitForceMenu,
+  UnitForceNewton,
+  UnitForceNewtonKilo,
+  UnitForceNewtonMilli,
+  UnitFrequencyHertz,
+  UnitFrequencyHertzGiga,
+  UnitFrequencyHertzKilo,
+  UnitFrequencyHertzMega,
+  UnitFrequencyMenu,
+  UnitInductanceHenry,
+  UnitLuminousIntensityCandela,
+  UnitLuminousIntensityMenu,
+  UnitMagneticFieldMenu,
+  UnitMagneticFieldTesla,
+  UnitMassGram,
+  UnitMassGramKilo,
+  UnitMassGramMicro,
+  UnitMassGramMilli,
+  UnitMassGramNano,
+  UnitMassMenu,
+  UnitMassTonne,
+  UnitPotentialMenu,
+  UnitPotentialVolt,
+  UnitPotentialVoltKilo,
+  UnitPotentialVoltMicro,
+  UnitPotentialVoltMilli,
+  UnitPowerMenu,
+  UnitPowerWatt,
+  UnitPowerWattGiga,
+  UnitPowerWattKilo,
+  UnitPowerWattMega,
+  UnitPowerWattMicro,
+  UnitPowerWattMilli,
+  UnitPressureAtm,
+  UnitPressureBar,
+  UnitPressureMenu,
+  UnitPressurePascal,
+  UnitPressurePascalHecto,
+  UnitResistanceMenu,
+  UnitResistanceOhm,
+  UnitResistanceOhmKilo,
+  UnitSurfaceHectar,
+  UnitSurfaceMenu,
+  UnitTemperatureKelvin,
+  UnitTemperatureMenu,
+  UnitTimeDay,
+  UnitTimeHour,
+  UnitTimeMenu,
+  UnitTimeMinute,
+  UnitTimeMonth,
+  UnitTimeSecond,
+  UnitTimeSecondMenu,
+  UnitTimeSecondMicro,
+  UnitTimeSecondMilli,
+  UnitTimeSecondNano,
+  UnitTimeWeek,
+  UnitTimeYear,
+  UnitVolumeLiter,
+  UnitVolumeLiterCenti,
+  UnitVolumeLiterDeci,
+  UnitVolumeLiterMilli,
+  UnitVolumeMenu,
+  UnrealEquation,
+  UpdateAvailable,
+  UpdateMessage1,
+  UpdateMessage2,
+  UpdateMessage3,
+  UpdateMessage4,
+  UpdatePopUp,
+  UseEquationModel,
+  ValueNotReachedByFunction,
+  ValueNotReachedByRegression,
+  ValueNotReachedBySequence,
+  Values1,
+  Values2,
+  Values3,
+  ValuesTab,
+  Variables,
+  Warning,
+  XEnd,
+  XPrediction,
+  XStart,
+  YPrediction,
+  Zeros,
+  Zoom,
+};
+
+enum class Language : uint16_t {
+  Default = 0,
+  EN,
+  FR,
+  ES,
+  DE,
+  PT,
+};
+
+constexpr const Message LanguageNames[NumberOfLanguages] = {
+  Message::LanguageEN,
+  Message::LanguageFR,
+  Message::LanguageES,
+  Message::LanguageDE,
+  Message::LanguagePT,
+};
+
+}
+
+#endif
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "chi_squared_icon.h"
+
+// Compressed 665 pixels into 164 bytes (12.33% compression ratio)/
+const uint8_t compressedPixelData[164] = {0x001f, 0x00ff, 0x0001, 0x0000, 0x00ff, 0x00db, 0x00df, 0x00fe, 0x00ff, 0x008d, 0x00fe, 0x00a1, 0x00fd, 0x0081, 0x00fd, 0x00c4, 0x00fd, 0x006c, 0x00fe, 0x0057, 0x0046, 0x0000, 0x0026, 0x0046, 0x0049, 0x00fe, 0x0080, 0x00fd, 0x0002, 0x0000, 0x003f, 0x0028, 0x00fe, 0x009a, 0x0044, 0x0000, 0x0020, 0x004c, 0x0035, 0x00ff, 0x0080, 0x00fd, 0x0002, 0x0000, 0x003f, 0x008d, 0x00fe, 0x00de, 0x0046, 0x0000, 0x001c, 0x0019, 0x0006, 0x008a, 0x0000, 0x0004, 0x0002, 0x0000, 0x003f, 0x00c3, 0x00fd, 0x0035, 0x0044, 0x0000, 0x0018, 0x001e, 0x00bb, 0x008a, 0x0000, 0x0007, 0x00dc, 0x0000, 0x001f, 0x0099, 0x0046, 0x0000, 0x0014, 0x001e, 0x00f2, 0x008a, 0x0000, 0x0009, 0x0002, 0x0000, 0x001f, 0x004a, 0x0026, 0x0001, 0x0012, 0x001f, 0x006c, 0x0046, 0x0000, 0x000c, 0x0002, 0x004a, 0x0000, 0x001f, 0x0078, 0x0016, 0x0001, 0x0022, 0x000e, 0x0002, 0x0000, 0x004f, 0x00e6, 0x00fd, 0x0013, 0x00ff, 0x0072, 0x0001, 0x0007, 0x003f, 0x00a2, 0x00fd, 0x0080, 0x0002, 0x0000, 0x0016, 0x001f, 0x00a1, 0x0050, 0x0002, 0x0006, 0x002f, 0x0080, 0x00fd, 0x0002, 0x0000, 0x001d, 0x005f, 0x00a2, 0x00fd, 0x008d, 0x00fe, 0x0057, 0x0046, 0x0000, 0x002e, 0x0004, 0x0098, 0x0000, 0x0053, 0x004a, 0x00fe, 0x0013, 0x00ff, 0x00bc, 0x0046, 0x0000, 0x002f, 0x00c4, 0x00fd, 0x0002, 0x0000, 0x002b, 0x0060, 0x0029, 0x00fe, 0x00d1, 0x00fe, 0x0079, 0x00ff, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 164);
+
+const Image * ImageStore::ChiSquaredIcon = &image;
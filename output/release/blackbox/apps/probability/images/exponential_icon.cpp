@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "exponential_icon.h"
+
+// Compressed 665 pixels into 167 bytes (12.56% compression ratio)/
+const uint8_t compressedPixelData[167] = {0x003f, 0x00c3, 0x00fd, 0x00ff, 0x0001, 0x0000, 0x0030, 0x000f, 0x0046, 0x0000, 0x007b, 0x001f, 0x0057, 0x0046, 0x0000, 0x0032, 0x002f, 0x0049, 0x00fe, 0x0046, 0x0000, 0x0031, 0x003f, 0x00c3, 0x00fd, 0x0035, 0x0046, 0x0000, 0x0032, 0x003f, 0x00e5, 0x00fd, 0x00dd, 0x0046, 0x0000, 0x0030, 0x004f, 0x00c3, 0x00fd, 0x004a, 0x00fe, 0x0046, 0x0000, 0x0031, 0x004f, 0x00c3, 0x00fd, 0x008d, 0x00fe, 0x0046, 0x0000, 0x0031, 0x005f, 0x00c3, 0x00fd, 0x006c, 0x00fe, 0x00fe, 0x0046, 0x0000, 0x0030, 0x005f, 0x00c3, 0x00fd, 0x0028, 0x00fe, 0x00bb, 0x0046, 0x0000, 0x0030, 0x005f, 0x00c3, 0x00fd, 0x00e4, 0x00fd, 0x0035, 0x0046, 0x0000, 0x0030, 0x0020, 0x00c3, 0x00fd, 0x0040, 0x0002, 0x001f, 0x009a, 0x0046, 0x0000, 0x0030, 0x0002, 0x0024, 0x0001, 0x001f, 0x0099, 0x0046, 0x0000, 0x0030, 0x0002, 0x00fe, 0x0001, 0x003f, 0x0035, 0x00ff, 0x00fe, 0x0046, 0x0000, 0x002e, 0x0000, 0x0002, 0x0000, 0x007f, 0x00c4, 0x00fd, 0x008d, 0x00fe, 0x0035, 0x00ff, 0x00dd, 0x0046, 0x0000, 0x002c, 0x0006, 0x00be, 0x0001, 0x005f, 0x00af, 0x00fe, 0x0035, 0x00ff, 0x00bb, 0x0046, 0x0000, 0x002c, 0x0006, 0x009c, 0x0000, 0x00fe, 0x0002, 0x0029, 0x00fe, 0x008d, 0x00fe, 0x00d1, 0x00fe, 0x0014, 0x00ff, 0x0057, 0x00ff, 0x0079, 0x00ff, 0x00bb, 0x00ff, 0x00dd, 0x00ff, 0x00fe, 0x0046, 0x0000, 0x000f, 0x0002, 0x0000, 0x0021, 0x0050, 0x00fd, 0x00c3, 0x00fd, 0x00c3, 0x00fd, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 167);
+
+const Image * ImageStore::ExponentialIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_calcul4_icon.h"
+
+// Compressed 897 pixels into 344 bytes (19.18% compression ratio)/
+const uint8_t compressedPixelData[344] = {0x002f, 0x00bc, 0x00d6, 0x0002, 0x0000, 0x00ab, 0x009f, 0x0052, 0x00e6, 0x00e6, 0x00fd, 0x00c5, 0x00fd, 0x004f, 0x00ee, 0x00bb, 0x004c, 0x0000, 0x0030, 0x00cf, 0x0051, 0x00e6, 0x00e7, 0x00fd, 0x0097, 0x00de, 0x0098, 0x00de, 0x000a, 0x00f6, 0x000c, 0x00f6, 0x0050, 0x0000, 0x002d, 0x0060, 0x0097, 0x00de, 0x00c5, 0x00fd, 0x0099, 0x00de, 0x000a, 0x0000, 0x006f, 0x00bb, 0x00d6, 0x00e8, 0x00f5, 0x0050, 0x00e6, 0x004e, 0x0000, 0x002b, 0x0035, 0x00e9, 0x00f5, 0x0052, 0x0042, 0x0000, 0x006f, 0x0098, 0x00de, 0x00c4, 0x00fd, 0x0098, 0x00de, 0x004c, 0x0000, 0x0027, 0x0048, 0x0074, 0x00e6, 0x00e6, 0x00fd, 0x00de, 0x0000, 0x004f, 0x00a6, 0x00fd, 0x000b, 0x00f6, 0x004e, 0x0000, 0x0027, 0x0026, 0x0009, 0x00f6, 0x009a, 0x0000, 0x0002, 0x004e, 0x0000, 0x004f, 0x00c5, 0x00fd, 0x0097, 0x00de, 0x0034, 0x0001, 0x0025, 0x000a, 0x009a, 0x0000, 0x0001, 0x004e, 0x0000, 0x001f, 0x00f5, 0x009e, 0x0000, 0x0025, 0x002c, 0x002c, 0x00ee, 0x0026, 0x0001, 0x005f, 0x00a6, 0x00fd, 0x00ba, 0x00d6, 0x00c5, 0x003c, 0x0001, 0x0022, 0x006c, 0x00ba, 0x00d6, 0x00c4, 0x00fd, 0x00ba, 0x00d6, 0x004e, 0x0000, 0x006f, 0x00bc, 0x00d6, 0x002f, 0x00ee, 0x002d, 0x00ee, 0x004e, 0x0000, 0x001f, 0x003d, 0x0050, 0x00e6, 0x000c, 0x0036, 0x0000, 0x0000, 0x004e, 0x0000, 0x005f, 0x0099, 0x00de, 0x00c5, 0x00fd, 0x00ba, 0x004c, 0x0000, 0x001c, 0x003e, 0x00bb, 0x00d6, 0x00e6, 0x0070, 0x0001, 0x0001, 0x004e, 0x0000, 0x005f, 0x00bc, 0x00d6, 0x000b, 0x00f6, 0x0051, 0x0078, 0x0002, 0x001c, 0x003e, 0x0075, 0x00e6, 0x0009, 0x006e, 0x0001, 0x0003, 0x004e, 0x0000, 0x004f, 0x0076, 0x00de, 0x00e7, 0x00fd, 0x0016, 0x0003, 0x001b, 0x004f, 0x000a, 0x00f6, 0x0074, 0x00e6, 0x004e, 0x0000, 0x0005, 0x006f, 0x00bc, 0x00d6, 0x00e7, 0x00f5, 0x0075, 0x00e6, 0x001c, 0x0002, 0x0029, 0x000a, 0x004e, 0x0000, 0x004f, 0x0052, 0x00e6, 0x000a, 0x00f6, 0x00b6, 0x0002, 0x0027, 0x000c, 0x004e, 0x0000, 0x002f, 0x00bb, 0x00d6, 0x00c6, 0x0002, 0x0017, 0x004e, 0x0050, 0x00ee, 0x00e8, 0x00f5, 0x0018, 0x0001, 0x0008, 0x004e, 0x0000, 0x000f, 0x009e, 0x0000, 0x0015, 0x007e, 0x0096, 0x00de, 0x0009, 0x00f6, 0x00e7, 0x00fd, 0x00b9, 0x0078, 0x0000, 0x000b, 0x004e, 0x0000, 0x006f, 0x00bb, 0x00d6, 0x00e7, 0x00f5, 0x0050, 0x00ee, 0x004a, 0x0000, 0x000b, 0x006e, 0x000a, 0x00f6, 0x00c5, 0x00fd, 0x0051, 0x00e6, 0x00b0, 0x0001, 0x000e, 0x004e, 0x0000, 0x008e, 0x00bc, 0x00d6, 0x00b9, 0x00de, 0x00e7, 0x00fd, 0x000b, 0x00f6, 0x0018, 0x0003, 0x0000, 0x006a, 0x0000, 0x005e, 0x004f, 0x00ee, 0x00e7, 0x00f5, 0x00e7, 0x004a, 0x0000, 0x000e, 0x004e, 0x0000, 0x0009, 0x0036, 0x0000, 0x005d, 0x0050, 0x00ee, 0x00e6, 0x00fd, 0x000a, 0x0064, 0x0001, 0x0000, 0x001a, 0x0000, 0x002f, 0x00ba, 0x00d6, 0x005a, 0x0005, 0x0021, 0x0011, 0x00bb, 0x0002, 0x0000, 0x000f, 0x003e, 0x0006, 0x003e, 0x0050, 0x00d6, 0x00bc, 0x00d6, 0x00bc, 0x00d6, 
+};
+
+constexpr Image image = Image(39, 23, compressedPixelData, 344);
+
+const Image * ImageStore::FocusedCalcul4Icon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_exponential_icon.h"
+
+// Compressed 665 pixels into 182 bytes (13.68% compression ratio)/
+const uint8_t compressedPixelData[182] = {0x004f, 0x00c3, 0x00fd, 0x00bc, 0x00d6, 0x0002, 0x0000, 0x002f, 0x000f, 0x0046, 0x0000, 0x0035, 0x001f, 0x00bb, 0x0046, 0x0000, 0x0032, 0x002f, 0x0074, 0x00e6, 0x0046, 0x0000, 0x0031, 0x002f, 0x00e8, 0x00f5, 0x0046, 0x0000, 0x0031, 0x004f, 0x00c3, 0x00fd, 0x0073, 0x00e6, 0x0046, 0x0000, 0x0031, 0x004f, 0x00c5, 0x00fd, 0x00b9, 0x00de, 0x0046, 0x0000, 0x002f, 0x005f, 0x00c3, 0x00fd, 0x0009, 0x00f6, 0x00bb, 0x0046, 0x0000, 0x0030, 0x005f, 0x00c3, 0x00fd, 0x000b, 0x00f6, 0x00bb, 0x0046, 0x0000, 0x0030, 0x000f, 0x0048, 0x0000, 0x002b, 0x0026, 0x00c3, 0x00fd, 0x0002, 0x0000, 0x004f, 0x00e7, 0x00f5, 0x0098, 0x00de, 0x0046, 0x0000, 0x002f, 0x007f, 0x00c3, 0x00fd, 0x00c4, 0x00fd, 0x0073, 0x00e6, 0x00bb, 0x0046, 0x0000, 0x002e, 0x0020, 0x00c3, 0x00fd, 0x0040, 0x0002, 0x002f, 0x0097, 0x00de, 0x0046, 0x0000, 0x002f, 0x0002, 0x0024, 0x0001, 0x002f, 0x0096, 0x00de, 0x0046, 0x0000, 0x002f, 0x0002, 0x00fe, 0x0001, 0x003f, 0x0052, 0x00e6, 0x00ba, 0x0046, 0x0000, 0x002e, 0x0002, 0x0028, 0x0001, 0x006f, 0x000b, 0x00f6, 0x0073, 0x00e6, 0x00ba, 0x00de, 0x0046, 0x0000, 0x002b, 0x0006, 0x002c, 0x0001, 0x007f, 0x002d, 0x00ee, 0x0073, 0x00e6, 0x0098, 0x00de, 0x00bb, 0x0046, 0x0000, 0x002a, 0x0006, 0x009c, 0x0000, 0x00fe, 0x0002, 0x00e8, 0x00f5, 0x000b, 0x00f6, 0x002f, 0x00ee, 0x0052, 0x00e6, 0x0074, 0x00e6, 0x0096, 0x00de, 0x0098, 0x00de, 0x00ba, 0x00d6, 0x00ba, 0x0046, 0x0000, 0x000f, 0x0002, 0x0000, 0x0021, 0x0050, 0x00fd, 0x00c3, 0x00fd, 0x00c3, 0x00fd, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 182);
+
+const Image * ImageStore::FocusedExponentialIcon = &image;
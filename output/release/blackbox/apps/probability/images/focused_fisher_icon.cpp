@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_fisher_icon.h"
+
+// Compressed 665 pixels into 218 bytes (16.39% compression ratio)/
+const uint8_t compressedPixelData[218] = {0x002f, 0x00bc, 0x00d6, 0x0002, 0x0000, 0x00c3, 0x004f, 0x002e, 0x00ee, 0x000e, 0x00f6, 0x0044, 0x0000, 0x002d, 0x008f, 0x0098, 0x00de, 0x00a6, 0x00fd, 0x00a6, 0x00fd, 0x0076, 0x00de, 0x0046, 0x0000, 0x002b, 0x0020, 0x0030, 0x00ee, 0x0046, 0x0000, 0x002f, 0x00ec, 0x00f5, 0x0046, 0x0000, 0x002b, 0x0040, 0x00ea, 0x00f5, 0x00a6, 0x00fd, 0x0002, 0x0000, 0x001f, 0x0097, 0x008e, 0x0000, 0x0028, 0x0042, 0x00ba, 0x00d6, 0x00a6, 0x00fd, 0x0002, 0x0000, 0x001f, 0x000c, 0x001c, 0x0001, 0x0028, 0x0024, 0x0075, 0x00e6, 0x0046, 0x0000, 0x000f, 0x001c, 0x0001, 0x0029, 0x0026, 0x0031, 0x00ee, 0x0046, 0x0000, 0x003f, 0x00ea, 0x00f5, 0x00bb, 0x0046, 0x0000, 0x0024, 0x0046, 0x000c, 0x00f6, 0x00a6, 0x00fd, 0x0002, 0x0000, 0x002f, 0x0051, 0x00ee, 0x0046, 0x0000, 0x0023, 0x0028, 0x00c9, 0x00fd, 0x0046, 0x0000, 0x001f, 0x00c6, 0x00d6, 0x0000, 0x0022, 0x0006, 0x005c, 0x0001, 0x0004, 0x0002, 0x0000, 0x001f, 0x00c7, 0x00ac, 0x0001, 0x0020, 0x0011, 0x0097, 0x0072, 0x0002, 0x000c, 0x0048, 0x0000, 0x002f, 0x0074, 0x00e6, 0x0046, 0x0000, 0x001b, 0x002e, 0x0054, 0x00e6, 0x0046, 0x0000, 0x0002, 0x00f6, 0x0001, 0x002f, 0x0097, 0x00de, 0x00b8, 0x0002, 0x001d, 0x000f, 0x0002, 0x0000, 0x0003, 0x005f, 0x00eb, 0x00f5, 0x0053, 0x00e6, 0x00ba, 0x0046, 0x0000, 0x0012, 0x002e, 0x000d, 0x00f6, 0x0046, 0x0000, 0x000a, 0x00de, 0x0000, 0x006f, 0x000c, 0x00f6, 0x0052, 0x00e6, 0x0098, 0x00de, 0x00fe, 0x0002, 0x0013, 0x000f, 0x0002, 0x0000, 0x000d, 0x008f, 0x00c8, 0x00fd, 0x000d, 0x00f6, 0x0052, 0x00ee, 0x0076, 0x00de, 0x009c, 0x0000, 0x0003, 0x001f, 0x00c7, 0x0044, 0x0000, 0x0012, 0x000a, 0x0050, 0x0000, 0x00f0, 0x0003, 0x000c, 0x00f6, 0x0030, 0x00ee, 0x0074, 0x00e6, 0x0097, 0x00de, 0x00ba, 0x00d6, 0x00bc, 0x00d6, 0x00bc, 0x00d6, 0x00bc, 0x00d6, 0x00bc, 0x00d6, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 218);
+
+const Image * ImageStore::FocusedFisherIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_normal_icon.h"
+
+// Compressed 665 pixels into 242 bytes (18.20% compression ratio)/
+const uint8_t compressedPixelData[242] = {0x002f, 0x00bc, 0x00d6, 0x0002, 0x0000, 0x0007, 0x00cf, 0x00bb, 0x00d6, 0x002e, 0x00ee, 0x0082, 0x00fd, 0x00a2, 0x00fd, 0x0030, 0x00e6, 0x00bc, 0x00d6, 0x0002, 0x0000, 0x0025, 0x0062, 0x00bb, 0x00d6, 0x00ea, 0x00ed, 0x0080, 0x00fd, 0x0002, 0x0000, 0x001f, 0x002f, 0x0048, 0x0000, 0x0026, 0x0046, 0x002f, 0x00e6, 0x0080, 0x00fd, 0x0002, 0x0000, 0x002f, 0x0097, 0x00de, 0x0044, 0x0000, 0x0021, 0x0048, 0x0098, 0x00de, 0x0080, 0x00fd, 0x0002, 0x0000, 0x002f, 0x00c7, 0x00f5, 0x0046, 0x0000, 0x0021, 0x004a, 0x00e9, 0x00f5, 0x0080, 0x00fd, 0x0002, 0x0000, 0x001f, 0x0074, 0x00d6, 0x0000, 0x001e, 0x001b, 0x0097, 0x008a, 0x0000, 0x0000, 0x0002, 0x0000, 0x002f, 0x00c6, 0x00f5, 0x008a, 0x0000, 0x002f, 0x0000, 0x0002, 0x0000, 0x002f, 0x0076, 0x00de, 0x0014, 0x0001, 0x0029, 0x0004, 0x0002, 0x0000, 0x002f, 0x00ea, 0x00ed, 0x0046, 0x0000, 0x0019, 0x002f, 0x000c, 0x00ee, 0x0046, 0x0000, 0x0003, 0x003f, 0x0081, 0x00fd, 0x00b9, 0x0044, 0x0000, 0x0016, 0x003e, 0x00ba, 0x00d6, 0x0081, 0x0044, 0x0000, 0x000f, 0x0038, 0x0002, 0x001e, 0x0019, 0x0030, 0x0028, 0x0002, 0x000a, 0x0002, 0x0000, 0x003f, 0x00a4, 0x00fd, 0x00bb, 0x00b2, 0x0002, 0x0014, 0x001e, 0x00a4, 0x0044, 0x0000, 0x000f, 0x00f0, 0x0001, 0x001e, 0x001e, 0x0074, 0x008a, 0x0000, 0x000f, 0x007e, 0x0002, 0x0020, 0x001e, 0x00c7, 0x00e4, 0x0001, 0x000b, 0x0002, 0x0000, 0x001f, 0x0096, 0x00f0, 0x0001, 0x000e, 0x001e, 0x0096, 0x00e4, 0x0001, 0x000f, 0x008e, 0x0000, 0x0020, 0x000f, 0x008a, 0x0000, 0x000f, 0x0000, 0x0002, 0x0000, 0x002f, 0x002e, 0x00ee, 0x0044, 0x0000, 0x0009, 0x001e, 0x000d, 0x0028, 0x0002, 0x000f, 0x0090, 0x0000, 0x0006, 0x004e, 0x0074, 0x00de, 0x00bb, 0x00d6, 0x009a, 0x0001, 0x003f, 0x0053, 0x00e6, 0x00c6, 0x0088, 0x0000, 0x0012, 0x0008, 0x00f6, 0x0001, 0x0033, 0x002e, 0x00ee, 0x0096, 0x004c, 0x0000, 0x006e, 0x0073, 0x00e6, 0x000d, 0x00ee, 0x00c7, 0x00f5, 0x0068, 0x0002, 0x000f, 0x0002, 0x0000, 0x0015, 0x0060, 0x00a2, 0x00fd, 0x00c8, 0x00f5, 0x000d, 0x00ee, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 242);
+
+const Image * ImageStore::FocusedNormalIcon = &image;
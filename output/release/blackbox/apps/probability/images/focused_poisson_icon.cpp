@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_poisson_icon.h"
+
+// Compressed 665 pixels into 92 bytes (6.92% compression ratio)/
+const uint8_t compressedPixelData[92] = {0x002f, 0x00bc, 0x00d6, 0x0002, 0x0000, 0x000b, 0x0022, 0x00c3, 0x00fd, 0x0004, 0x0000, 0x000f, 0x0002, 0x0000, 0x002b, 0x000f, 0x0046, 0x0000, 0x0075, 0x002a, 0x00c3, 0x00fd, 0x0004, 0x0000, 0x000f, 0x0046, 0x0000, 0x0065, 0x000c, 0x0042, 0x0000, 0x000e, 0x004a, 0x0000, 0x000f, 0x0046, 0x0000, 0x0099, 0x000e, 0x0042, 0x0000, 0x000e, 0x004a, 0x0000, 0x000f, 0x0046, 0x0000, 0x0097, 0x002f, 0x00c3, 0x00fd, 0x0004, 0x0000, 0x0013, 0x000f, 0x0046, 0x0000, 0x0093, 0x002f, 0x00c3, 0x00fd, 0x0004, 0x0000, 0x001b, 0x000f, 0x0046, 0x0000, 0x0045, 0x002f, 0x00c3, 0x00fd, 0x0004, 0x0000, 0x0023, 0x000f, 0x0042, 0x0000, 0x002f, 0x0006, 0x004a, 0x0000, 0x000f, 0x0042, 0x0000, 0x002d, 0x0060, 0x00c3, 0x00fd, 0x00bc, 0x00d6, 0x00c3, 0x00fd, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 92);
+
+const Image * ImageStore::FocusedPoissonIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "normal_icon.h"
+
+// Compressed 665 pixels into 233 bytes (17.52% compression ratio)/
+const uint8_t compressedPixelData[233] = {0x001f, 0x00ff, 0x0001, 0x0000, 0x000a, 0x009f, 0x00d0, 0x00fe, 0x00a2, 0x00fd, 0x00a2, 0x00fd, 0x00f2, 0x00fe, 0x00ff, 0x0001, 0x0000, 0x0028, 0x0042, 0x006b, 0x00fe, 0x0080, 0x00fd, 0x0002, 0x0000, 0x001f, 0x00f1, 0x0048, 0x0000, 0x0026, 0x0015, 0x00f1, 0x0044, 0x0000, 0x0000, 0x0002, 0x0000, 0x001f, 0x009a, 0x0044, 0x0000, 0x0022, 0x0048, 0x00bb, 0x00ff, 0x0081, 0x00fd, 0x0046, 0x0000, 0x001f, 0x0028, 0x008e, 0x0000, 0x0022, 0x0019, 0x004a, 0x008a, 0x0000, 0x0000, 0x0002, 0x0000, 0x001f, 0x0056, 0x0044, 0x0000, 0x001e, 0x004c, 0x009a, 0x00ff, 0x0080, 0x00fd, 0x0002, 0x0000, 0x002f, 0x0007, 0x00fe, 0x008a, 0x0000, 0x002f, 0x0000, 0x0002, 0x0000, 0x001f, 0x0079, 0x0014, 0x0001, 0x001c, 0x000e, 0x0044, 0x0000, 0x0000, 0x0002, 0x0000, 0x001f, 0x006b, 0x008e, 0x0000, 0x001a, 0x002f, 0x008d, 0x00fe, 0x0046, 0x0000, 0x0003, 0x003f, 0x0081, 0x00fd, 0x00dd, 0x0044, 0x0000, 0x0016, 0x003e, 0x00de, 0x00ff, 0x00a1, 0x0044, 0x0000, 0x000f, 0x0038, 0x0002, 0x001e, 0x001e, 0x00f2, 0x008a, 0x0000, 0x0005, 0x0002, 0x0000, 0x002f, 0x00c4, 0x00fd, 0x0046, 0x0000, 0x0015, 0x001e, 0x00e5, 0x0044, 0x0000, 0x0007, 0x0002, 0x0000, 0x001f, 0x0057, 0x0044, 0x0000, 0x0012, 0x001e, 0x0057, 0x005a, 0x0001, 0x000f, 0x007e, 0x0002, 0x0020, 0x001f, 0x0028, 0x00d0, 0x0000, 0x0008, 0x000e, 0x000c, 0x0003, 0x000f, 0x006e, 0x0002, 0x0017, 0x000e, 0x008e, 0x0000, 0x000f, 0x008a, 0x0000, 0x002f, 0x0000, 0x0002, 0x0000, 0x001f, 0x00d0, 0x0048, 0x0000, 0x000a, 0x001f, 0x00af, 0x0044, 0x0000, 0x0012, 0x0002, 0x0090, 0x0000, 0x000f, 0x0066, 0x0001, 0x0001, 0x005f, 0x00fe, 0x00ff, 0x0036, 0x00ff, 0x0007, 0x0044, 0x0000, 0x0016, 0x0002, 0x0002, 0x0000, 0x0053, 0x00e5, 0x00fd, 0x00d0, 0x00fe, 0x0099, 0x0040, 0x0000, 0x006e, 0x0056, 0x00ff, 0x00af, 0x00fe, 0x0028, 0x00fe, 0x0068, 0x0002, 0x000f, 0x0002, 0x0000, 0x0015, 0x0060, 0x00a2, 0x00fd, 0x0029, 0x00fe, 0x00af, 0x00fe, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 233);
+
+const Image * ImageStore::NormalIcon = &image;
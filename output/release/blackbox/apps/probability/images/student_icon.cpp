@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "student_icon.h"
+
+// Compressed 665 pixels into 235 bytes (17.67% compression ratio)/
+const uint8_t compressedPixelData[235] = {0x001f, 0x00ff, 0x0001, 0x0000, 0x000a, 0x008f, 0x00bc, 0x00ff, 0x00c3, 0x00fd, 0x00c3, 0x00fd, 0x00bb, 0x00ff, 0x0001, 0x0000, 0x002b, 0x008f, 0x006c, 0x00fe, 0x0080, 0x00fd, 0x0080, 0x00fd, 0x0028, 0x00fe, 0x0044, 0x0000, 0x0029, 0x0051, 0x00de, 0x00ff, 0x0081, 0x00fd, 0x0080, 0x0002, 0x0000, 0x001f, 0x0099, 0x0046, 0x0000, 0x0028, 0x0033, 0x0035, 0x00ff, 0x0080, 0x0046, 0x0000, 0x001f, 0x008d, 0x008e, 0x0000, 0x0028, 0x0024, 0x008c, 0x00fe, 0x0046, 0x0000, 0x002f, 0x00a3, 0x00fd, 0x0046, 0x0000, 0x0027, 0x0035, 0x00e4, 0x00fd, 0x0080, 0x0002, 0x0000, 0x001f, 0x0078, 0x0044, 0x0000, 0x0024, 0x0037, 0x00dd, 0x00ff, 0x0080, 0x0046, 0x0000, 0x001f, 0x00af, 0x00d4, 0x0000, 0x0024, 0x0019, 0x0056, 0x0046, 0x0000, 0x001f, 0x00e5, 0x00d4, 0x0000, 0x0024, 0x0015, 0x00af, 0x0016, 0x0001, 0x0002, 0x0002, 0x0000, 0x001f, 0x00bc, 0x0046, 0x0000, 0x0022, 0x001b, 0x0028, 0x0046, 0x0000, 0x001f, 0x00f2, 0x00d4, 0x0000, 0x0022, 0x0019, 0x0081, 0x0044, 0x0000, 0x000f, 0x007c, 0x0002, 0x0023, 0x0019, 0x0078, 0x0016, 0x0001, 0x0002, 0x0002, 0x0000, 0x001f, 0x00dd, 0x0016, 0x0001, 0x002e, 0x0000, 0x0002, 0x0000, 0x001f, 0x0013, 0x0046, 0x0000, 0x001e, 0x002e, 0x00e5, 0x00fd, 0x0046, 0x0000, 0x002f, 0x0006, 0x00fe, 0x00d0, 0x0000, 0x002f, 0x0000, 0x0002, 0x0000, 0x001f, 0x0057, 0x0070, 0x0002, 0x001a, 0x000e, 0x008a, 0x0000, 0x0002, 0x0002, 0x0000, 0x001f, 0x00c4, 0x001c, 0x0001, 0x0016, 0x001e, 0x009a, 0x0044, 0x0000, 0x0007, 0x0002, 0x0000, 0x001f, 0x00e6, 0x0038, 0x0002, 0x0010, 0x003e, 0x0099, 0x00ff, 0x006b, 0x0056, 0x0001, 0x000b, 0x0002, 0x0000, 0x006e, 0x00a1, 0x00fd, 0x00f1, 0x00fe, 0x00de, 0x00ff, 0x00c0, 0x0000, 0x009f, 0x00bb, 0x00ff, 0x0078, 0x00ff, 0x00f3, 0x00fe, 0x006c, 0x00fe, 0x00c4, 0x0040, 0x0000, 0x000c, 0x0008, 0x004a, 0x0000, 0x00e0, 0x006b, 0x00fe, 0x0014, 0x00ff, 0x0099, 0x00ff, 0x00de, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 235);
+
+const Image * ImageStore::StudentIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "settings_icon.h"
+
+// Compressed 3080 pixels into 577 bytes (9.37% compression ratio)/
+const uint8_t compressedPixelData[577] = {0x0017, 0x00ff, 0x0001, 0x0000, 0x00af, 0x00dc, 0x00de, 0x00b8, 0x00b5, 0x0016, 0x009d, 0x00b4, 0x0094, 0x0094, 0x008c, 0x0002, 0x0000, 0x0031, 0x0088, 0x00b4, 0x008c, 0x00f5, 0x009c, 0x00d8, 0x00b5, 0x00dc, 0x00de, 0x0062, 0x0000, 0x0006, 0x006a, 0x0000, 0x004f, 0x0016, 0x009d, 0x0094, 0x008c, 0x0002, 0x0000, 0x0041, 0x003b, 0x0016, 0x009d, 0x00fc, 0x0072, 0x0000, 0x004f, 0x0019, 0x00c6, 0x0094, 0x008c, 0x0002, 0x0000, 0x0049, 0x0026, 0x0039, 0x00c6, 0x006c, 0x0000, 0x002f, 0x00f9, 0x00bd, 0x006c, 0x0000, 0x004b, 0x0008, 0x0070, 0x0000, 0x004f, 0x00dc, 0x00d6, 0x0094, 0x008c, 0x0002, 0x0000, 0x0051, 0x0002, 0x0050, 0x0001, 0x002f, 0x00f5, 0x0094, 0x006e, 0x0000, 0x0053, 0x005f, 0x00f5, 0x009c, 0x00ff, 0x00ff, 0x00bb, 0x00da, 0x0000, 0x0054, 0x0000, 0x0002, 0x0000, 0x004f, 0x00db, 0x00d6, 0x00b8, 0x00b5, 0x006e, 0x0000, 0x0057, 0x004f, 0x00b8, 0x00b5, 0x00f5, 0x009c, 0x006e, 0x0000, 0x0057, 0x001f, 0x0015, 0x0064, 0x0003, 0x000e, 0x0040, 0x0074, 0x008c, 0x0073, 0x0084, 0x0002, 0x0000, 0x001f, 0x0074, 0x00f0, 0x0003, 0x0032, 0x000f, 0x006a, 0x0000, 0x000b, 0x0000, 0x00ba, 0x0002, 0x0082, 0x007e, 0x00ef, 0x00ff, 0x00ff, 0x007e, 0x00ef, 0x0039, 0x00c6, 0x0010, 0x0000, 0x000f, 0x0002, 0x0000, 0x0045, 0x0000, 0x005c, 0x0000, 0x0026, 0x001c, 0x00e7, 0x0096, 0x0003, 0x002f, 0x001c, 0x00e7, 0x0070, 0x0000, 0x0049, 0x004b, 0x0073, 0x0084, 0x0019, 0x00c6, 0x0072, 0x0004, 0x003f, 0x00be, 0x0073, 0x0084, 0x00da, 0x0000, 0x0045, 0x004a, 0x0053, 0x0084, 0x007e, 0x00ef, 0x006e, 0x0000, 0x004f, 0x007e, 0x00ef, 0x0053, 0x0084, 0x00de, 0x0000, 0x003b, 0x0040, 0x00fb, 0x00de, 0x003c, 0x00e7, 0x0002, 0x0000, 0x004e, 0x001c, 0x00e7, 0x009a, 0x00d6, 0x00bc, 0x0005, 0x005f, 0x009a, 0x00d6, 0x001c, 0x00e7, 0x003c, 0x0002, 0x0000, 0x0018, 0x002f, 0x00fb, 0x00de, 0x006e, 0x0000, 0x000b, 0x0031, 0x002f, 0x005b, 0x000e, 0x0002, 0x0000, 0x006a, 0x00ed, 0x0052, 0x00cd, 0x0052, 0x003d, 0x00e7, 0x006c, 0x0000, 0x008f, 0x005d, 0x00e7, 0x00cd, 0x0052, 0x00ed, 0x0052, 0x000e, 0x005b, 0x0002, 0x0000, 0x0017, 0x002f, 0x002f, 0x005b, 0x00b6, 0x0001, 0x0015, 0x004a, 0x0032, 0x007c, 0x00f8, 0x00bd, 0x006e, 0x0000, 0x006f, 0x00f8, 0x00bd, 0x0032, 0x007c, 0x0073, 0x0084, 0x00b8, 0x0001, 0x0045, 0x0028, 0x0012, 0x007c, 0x009a, 0x0006, 0x004f, 0x00fc, 0x00de, 0x0012, 0x007c, 0x00b8, 0x0001, 0x003d, 0x000a, 0x00de, 0x0000, 0x00ef, 0x0012, 0x007c, 0x00d8, 0x00b5, 0x005d, 0x00ef, 0x00ff, 0x00ff, 0x005d, 0x00ef, 0x00d8, 0x00b5, 0x0012, 0x007c, 0x00da, 0x0000, 0x0045, 0x0004, 0x00de, 0x0000, 0x00df, 0x0032, 0x007c, 0x00f2, 0x0073, 0x00d1, 0x0073, 0x00b1, 0x0073, 0x00d1, 0x0073, 0x00f2, 0x0073, 0x0032, 0x00da, 0x0000, 0x0048, 0x0004, 0x00b6, 0x0004, 0x0000, 0x0072, 0x0000, 0x0000, 0x0002, 0x0000, 0x001f, 0x0053, 0x00be, 0x0004, 0x0034, 0x000f, 0x0028, 0x0005, 0x0057, 0x000f, 0x0002, 0x0000, 0x00ab, 0x000f, 0x000a, 0x0001, 0x0057, 0x000f, 0x0032, 0x0006, 0x00ff, 0x006c, 0x0004, 0x0004, 0x0006, 0x000f, 0x0002, 0x0000, 0x001b, 0x000f, 0x0032, 0x0006, 0x0005, 0x002f, 0x00bb, 0x00d6, 0x0004, 0x0006, 0x0013, 0x000f, 0x0002, 0x0000, 0x001b, 0x000f, 0x0032, 0x0006, 0x0005, 0x002f, 0x000e, 0x005b, 0x0054, 0x0005, 0x0045, 0x000f, 0x0032, 0x0006, 0x00ff, 0x00ff, 0x00fe, 0x000f, 0x0052, 0x0006, 0x00ff, 0x00fe, 0x000f, 0x0076, 0x000c, 0x0032, 0x000f, 0x0052, 0x0006, 0x0013, 0x001f, 0x001c, 0x0076, 0x000c, 0x0034, 0x000e, 0x0052, 0x0006, 0x000f, 0x0084, 0x000c, 0x0021, 0x002f, 0x002f, 0x005b, 0x0052, 0x0006, 0x0067, 0x0000, 0x0090, 0x0001, 0x000f, 0x0052, 0x0006, 0x0057, 0x004f, 0x0053, 0x0084, 0x0033, 0x0084, 0x0052, 0x0006, 0x0057, 0x002f, 0x0053, 0x0084, 0x0052, 0x0006, 0x0059, 0x002e, 0x00b4, 0x008c, 0x0036, 0x0003, 0x000f, 0x0052, 0x0006, 0x0045, 0x008f, 0x0053, 0x0084, 0x0039, 0x00c6, 0x00df, 0x00ff, 0x00d1, 0x0073, 0x0028, 0x0005, 0x0053, 0x00af, 0x00d1, 0x0073, 0x00df, 0x00ff, 0x00ff, 0x00ff, 0x0059, 0x00c6, 0x00f1, 0x0073, 0x00d0, 0x0005, 0x004f, 0x0033, 0x00d1, 0x0073, 0x005a, 0x008c, 0x0004, 0x004f, 0x0036, 0x00a5, 0x00f1, 0x0073, 0x006c, 0x0000, 0x004d, 0x0026, 0x0056, 0x00a5, 0x00d0, 0x0002, 0x005f, 0x0015, 0x009d, 0x0090, 0x006b, 0x0053, 0x00f6, 0x0004, 0x0044, 0x006a, 0x0053, 0x0084, 0x0090, 0x006b, 0x0015, 0x009d, 0x00ac, 0x0003, 0x008f, 0x0059, 0x00c6, 0x00b0, 0x006b, 0x0090, 0x006b, 0x0012, 0x007c, 0x0074, 0x0000, 0x0039, 0x0000, 0x00a4, 0x0003, 0x006e, 0x0090, 0x006b, 0x00b0, 0x006b, 0x0059, 0x00c6, 0x00f6, 0x0004, 0x00bf, 0x00df, 0x00ff, 0x0019, 0x00c6, 0x0093, 0x008c, 0x00b0, 0x006b, 0x002e, 0x005b, 0x000e, 0x0002, 0x0000, 0x0034, 0x0060, 0x0090, 0x006b, 0x00b4, 0x0094, 0x0059, 0x00c6, 0x001c, 0x0002, 0x0080, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(55, 56, compressedPixelData, 577);
+
+const Image * ImageStore::SettingsIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "calcul4_icon.h"
+
+// Compressed 897 pixels into 313 bytes (17.45% compression ratio)/
+const uint8_t compressedPixelData[313] = {0x001f, 0x00ff, 0x0001, 0x0000, 0x00ac, 0x008f, 0x0014, 0x00ff, 0x0006, 0x00fe, 0x00e5, 0x00fd, 0x00f1, 0x00fe, 0x004c, 0x0000, 0x0033, 0x009f, 0x0028, 0x00fe, 0x009b, 0x00ff, 0x00bc, 0x00ff, 0x006b, 0x00fe, 0x008d, 0x0050, 0x0000, 0x002e, 0x0053, 0x009a, 0x00ff, 0x00e5, 0x00fd, 0x00bc, 0x000c, 0x0000, 0x003f, 0x0029, 0x00fe, 0x00f2, 0x0050, 0x0000, 0x002c, 0x0035, 0x004a, 0x00fe, 0x0014, 0x000c, 0x0000, 0x0017, 0x00bc, 0x005a, 0x0000, 0x000f, 0x0001, 0x0000, 0x0021, 0x0039, 0x0057, 0x00ff, 0x0007, 0x008e, 0x0000, 0x004f, 0x00a6, 0x00fd, 0x008c, 0x00fe, 0x009a, 0x0000, 0x0029, 0x002a, 0x0035, 0x00ff, 0x004e, 0x0000, 0x003f, 0x00e6, 0x00fd, 0x009a, 0x0034, 0x0001, 0x0026, 0x003b, 0x0006, 0x00fe, 0x00ff, 0x004e, 0x0000, 0x003f, 0x00c5, 0x00f5, 0x006c, 0x009e, 0x0000, 0x0024, 0x004c, 0x008e, 0x00fe, 0x00bc, 0x00ff, 0x004e, 0x0000, 0x005f, 0x00fe, 0x00ff, 0x00e5, 0x00fd, 0x00bb, 0x004c, 0x0000, 0x0020, 0x005d, 0x00dd, 0x00ff, 0x00e5, 0x00fd, 0x00de, 0x004e, 0x0000, 0x005f, 0x00ff, 0x00ff, 0x00d1, 0x00fe, 0x00af, 0x009e, 0x0000, 0x0020, 0x001e, 0x00f3, 0x0060, 0x0002, 0x0001, 0x004e, 0x0000, 0x0000, 0x00da, 0x0001, 0x000f, 0x004f, 0x0000, 0x001f, 0x004e, 0x0007, 0x00fe, 0x009a, 0x00ff, 0x004e, 0x0000, 0x0000, 0x0006, 0x0000, 0x003f, 0x008c, 0x00fe, 0x0013, 0x001c, 0x0002, 0x001e, 0x001e, 0x004a, 0x0081, 0x0000, 0x0003, 0x004e, 0x0000, 0x003f, 0x0078, 0x00ff, 0x0007, 0x009d, 0x0000, 0x001c, 0x004f, 0x006b, 0x00fe, 0x0057, 0x00ff, 0x004e, 0x0000, 0x0005, 0x005f, 0x00ff, 0x00ff, 0x0028, 0x00fe, 0x0057, 0x001c, 0x0002, 0x001a, 0x000e, 0x007e, 0x0000, 0x0008, 0x004e, 0x0000, 0x004f, 0x0034, 0x00ff, 0x006b, 0x00fe, 0x0050, 0x0003, 0x0023, 0x000f, 0x004e, 0x0000, 0x0001, 0x004f, 0x00fe, 0x00ff, 0x0006, 0x00fe, 0x00c6, 0x0002, 0x0015, 0x003e, 0x00f2, 0x00fe, 0x0029, 0x007a, 0x0000, 0x0009, 0x004e, 0x0000, 0x0000, 0x005a, 0x0004, 0x000f, 0x009e, 0x0000, 0x0011, 0x005d, 0x0099, 0x00ff, 0x004a, 0x00fe, 0x0028, 0x00b6, 0x0002, 0x000e, 0x004e, 0x0000, 0x0000, 0x003c, 0x0001, 0x000f, 0x0052, 0x0004, 0x000b, 0x006e, 0x0079, 0x00ff, 0x006c, 0x00fe, 0x00e5, 0x00fd, 0x00fe, 0x0001, 0x000e, 0x004e, 0x0000, 0x0002, 0x0052, 0x0004, 0x004f, 0x0028, 0x00fe, 0x006c, 0x00fe, 0x0018, 0x0003, 0x0003, 0x008e, 0x00f1, 0x00fe, 0x0028, 0x00fe, 0x0007, 0x00fe, 0x0013, 0x00ff, 0x00bf, 0x0000, 0x000e, 0x004e, 0x0000, 0x0008, 0x0014, 0x0001, 0x003d, 0x0007, 0x00fe, 0x006b, 0x0064, 0x0001, 0x0000, 0x0058, 0x0001, 0x001f, 0x00de, 0x003d, 0x0006, 0x0079, 0x0050, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(39, 23, compressedPixelData, 313);
+
+const Image * ImageStore::Calcul4Icon = &image;
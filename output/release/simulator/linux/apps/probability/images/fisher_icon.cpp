@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "fisher_icon.h"
+
+// Compressed 665 pixels into 206 bytes (15.49% compression ratio)/
+const uint8_t compressedPixelData[206] = {0x001f, 0x00ff, 0x0001, 0x0000, 0x00c4, 0x004f, 0x0090, 0x00fe, 0x008f, 0x00fe, 0x0044, 0x0000, 0x002d, 0x007f, 0x009b, 0x00ff, 0x00a6, 0x00fd, 0x00a6, 0x00fd, 0x0079, 0x0046, 0x0000, 0x002c, 0x0020, 0x00d2, 0x00fe, 0x0046, 0x0000, 0x001f, 0x004d, 0x008e, 0x0000, 0x002c, 0x0011, 0x002b, 0x0046, 0x0000, 0x003f, 0x00a6, 0x00fd, 0x007a, 0x0044, 0x0000, 0x0028, 0x0031, 0x00de, 0x00ff, 0x00c6, 0x0044, 0x0000, 0x000f, 0x008e, 0x0000, 0x002b, 0x0022, 0x0058, 0x00ff, 0x0044, 0x0000, 0x000f, 0x001c, 0x0001, 0x002b, 0x0026, 0x00d3, 0x00fe, 0x0046, 0x0000, 0x001f, 0x002b, 0x008e, 0x0000, 0x0026, 0x0017, 0x006d, 0x0046, 0x0000, 0x003f, 0x00a6, 0x00fd, 0x00f3, 0x0048, 0x0000, 0x0024, 0x0028, 0x00e9, 0x00fd, 0x0046, 0x0000, 0x001f, 0x00c7, 0x00d6, 0x0000, 0x0022, 0x0017, 0x00de, 0x0016, 0x0001, 0x0002, 0x0002, 0x0000, 0x003f, 0x00c8, 0x00fd, 0x009a, 0x0046, 0x0000, 0x001e, 0x001d, 0x009a, 0x0046, 0x0000, 0x0000, 0x0090, 0x0000, 0x001f, 0x0036, 0x0046, 0x0000, 0x001c, 0x001e, 0x0036, 0x0046, 0x0000, 0x0003, 0x00f6, 0x0001, 0x001f, 0x009a, 0x00b8, 0x0002, 0x001e, 0x000f, 0x0002, 0x0000, 0x0003, 0x005f, 0x004c, 0x00fe, 0x0036, 0x00ff, 0x00de, 0x0046, 0x0000, 0x0012, 0x001e, 0x006e, 0x0046, 0x0000, 0x000b, 0x00de, 0x0000, 0x005f, 0x004d, 0x00fe, 0x00f4, 0x00fe, 0x009b, 0x00fe, 0x0002, 0x0014, 0x000f, 0x0002, 0x0000, 0x000d, 0x007f, 0x00e8, 0x00fd, 0x006e, 0x00fe, 0x00f4, 0x00fe, 0x0079, 0x009c, 0x0000, 0x0004, 0x003f, 0x00e8, 0x00fd, 0x00a6, 0x0002, 0x0000, 0x001c, 0x00f0, 0x0005, 0x00e9, 0x00fd, 0x006d, 0x00fe, 0x00d2, 0x00fe, 0x0036, 0x00ff, 0x009a, 0x00ff, 0x00de, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 206);
+
+const Image * ImageStore::FisherIcon = &image;
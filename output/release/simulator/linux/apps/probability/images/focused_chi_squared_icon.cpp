@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_chi_squared_icon.h"
+
+// Compressed 665 pixels into 183 bytes (13.76% compression ratio)/
+const uint8_t compressedPixelData[183] = {0x002f, 0x00bc, 0x00d6, 0x0002, 0x0000, 0x00ff, 0x00da, 0x00ef, 0x00bb, 0x00d6, 0x000c, 0x00ee, 0x0081, 0x00f5, 0x0080, 0x00f5, 0x00a3, 0x00f5, 0x00ea, 0x00ed, 0x0075, 0x00de, 0x0044, 0x0000, 0x0025, 0x0046, 0x00e8, 0x00ed, 0x0080, 0x00fd, 0x0002, 0x0000, 0x003f, 0x00c7, 0x00ed, 0x0097, 0x004a, 0x0000, 0x0020, 0x004b, 0x0052, 0x00e6, 0x0080, 0x00fd, 0x0002, 0x0000, 0x004f, 0x00f5, 0x000c, 0x00ee, 0x00ba, 0x0046, 0x0000, 0x001c, 0x004e, 0x00c5, 0x00f5, 0x0080, 0x00fd, 0x0002, 0x0000, 0x004f, 0x00a3, 0x00f5, 0x0052, 0x00e6, 0x0044, 0x0000, 0x0017, 0x002e, 0x0098, 0x00de, 0x0044, 0x0000, 0x0006, 0x00dc, 0x0000, 0x001f, 0x0096, 0x00dc, 0x0000, 0x0014, 0x001e, 0x0030, 0x00d0, 0x0000, 0x0009, 0x0002, 0x0000, 0x001f, 0x00e9, 0x0026, 0x0001, 0x0012, 0x002e, 0x00ea, 0x00ed, 0x0046, 0x0000, 0x000c, 0x0002, 0x0000, 0x001f, 0x00e8, 0x00ba, 0x0001, 0x000e, 0x001f, 0x00c6, 0x0016, 0x0001, 0x0002, 0x000e, 0x0002, 0x0000, 0x004f, 0x00c5, 0x00f5, 0x0051, 0x00e6, 0x0072, 0x0001, 0x0007, 0x001f, 0x0082, 0x0046, 0x0000, 0x0014, 0x0000, 0x0002, 0x0000, 0x008e, 0x0081, 0x00f5, 0x00ea, 0x00ed, 0x0074, 0x00de, 0x00bb, 0x00d6, 0x0046, 0x0000, 0x002f, 0x0080, 0x00fd, 0x0002, 0x0000, 0x001d, 0x004c, 0x0082, 0x00f5, 0x000b, 0x00ee, 0x004c, 0x0000, 0x000f, 0x0046, 0x0000, 0x001f, 0x0004, 0x0098, 0x0000, 0x0053, 0x00e9, 0x00ed, 0x0051, 0x00e6, 0x0099, 0x0030, 0x0001, 0x002f, 0x00a3, 0x00f5, 0x0002, 0x0000, 0x002b, 0x0060, 0x00c8, 0x00ed, 0x002f, 0x00e6, 0x0076, 0x00de, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 183);
+
+const Image * ImageStore::FocusedChiSquaredIcon = &image;
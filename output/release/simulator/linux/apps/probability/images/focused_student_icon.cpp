@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_student_icon.h"
+
+// Compressed 665 pixels into 251 bytes (18.87% compression ratio)/
+const uint8_t compressedPixelData[251] = {0x002f, 0x00bc, 0x00d6, 0x0002, 0x0000, 0x0009, 0x00af, 0x0098, 0x00de, 0x00a3, 0x00f5, 0x00a3, 0x00f5, 0x0098, 0x00de, 0x00bc, 0x00d6, 0x0002, 0x0000, 0x0029, 0x008f, 0x00ea, 0x00ed, 0x0080, 0x00fd, 0x0080, 0x00fd, 0x00c7, 0x00ed, 0x0044, 0x0000, 0x0029, 0x0060, 0x00ba, 0x00d6, 0x0081, 0x00f5, 0x0080, 0x00fd, 0x0002, 0x0000, 0x001f, 0x0096, 0x008e, 0x0000, 0x0028, 0x0042, 0x0052, 0x00e6, 0x0080, 0x00fd, 0x0002, 0x0000, 0x002f, 0x000b, 0x00ee, 0x0046, 0x0000, 0x0027, 0x0024, 0x000b, 0x00ee, 0x0046, 0x0000, 0x003f, 0x00a2, 0x00f5, 0x00bb, 0x0046, 0x0000, 0x0026, 0x0013, 0x00a4, 0x00d0, 0x0000, 0x0000, 0x0002, 0x0000, 0x002f, 0x0075, 0x00de, 0x0016, 0x0001, 0x0025, 0x0026, 0x0080, 0x00fd, 0x0002, 0x0000, 0x002f, 0x000d, 0x00e6, 0x0046, 0x0000, 0x0023, 0x0028, 0x0074, 0x00de, 0x0046, 0x0000, 0x002f, 0x00a5, 0x00f5, 0x0046, 0x0000, 0x0023, 0x0015, 0x000d, 0x005c, 0x0001, 0x0002, 0x0002, 0x0000, 0x000f, 0x0036, 0x0002, 0x0023, 0x002a, 0x00c7, 0x00ed, 0x0046, 0x0000, 0x001f, 0x0030, 0x00d4, 0x0000, 0x0020, 0x0037, 0x00bb, 0x00d6, 0x0081, 0x005c, 0x0001, 0x000f, 0x007c, 0x0002, 0x0025, 0x0019, 0x0075, 0x0016, 0x0001, 0x0001, 0x0002, 0x0000, 0x002f, 0x00f5, 0x00ba, 0x0016, 0x0001, 0x002e, 0x0000, 0x0002, 0x0000, 0x002f, 0x0050, 0x00e6, 0x002c, 0x0002, 0x0029, 0x0004, 0x0002, 0x0000, 0x002f, 0x00c5, 0x00f5, 0x00d0, 0x0000, 0x002e, 0x0001, 0x0002, 0x0000, 0x002f, 0x0074, 0x00de, 0x0070, 0x0002, 0x0019, 0x000e, 0x008a, 0x0000, 0x0002, 0x0002, 0x0000, 0x001f, 0x00a4, 0x001c, 0x0001, 0x0016, 0x003e, 0x0097, 0x00de, 0x00a5, 0x0044, 0x0000, 0x0007, 0x00d6, 0x0000, 0x000f, 0x0038, 0x0002, 0x000f, 0x003b, 0x0076, 0x00de, 0x00ea, 0x0026, 0x0002, 0x000e, 0x0002, 0x0000, 0x005d, 0x0081, 0x00f5, 0x002f, 0x00e6, 0x00ba, 0x0018, 0x0002, 0x00bf, 0x00ba, 0x00d6, 0x0098, 0x00de, 0x0075, 0x00de, 0x0030, 0x00e6, 0x00eb, 0x00ed, 0x00a3, 0x0084, 0x0000, 0x0008, 0x000c, 0x004a, 0x0000, 0x00e0, 0x00ea, 0x00ed, 0x0051, 0x00e6, 0x0096, 0x00de, 0x00ba, 0x00d6, 0x00bc, 0x00d6, 0x00bc, 0x00d6, 0x00bc, 0x00d6, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 251);
+
+const Image * ImageStore::FocusedStudentIcon = &image;
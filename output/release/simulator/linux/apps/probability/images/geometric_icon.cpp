@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "geometric_icon.h"
+
+// Compressed 665 pixels into 79 bytes (5.94% compression ratio)/
+const uint8_t compressedPixelData[79] = {0x001f, 0x00ff, 0x0001, 0x0000, 0x0032, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x00c1, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x00c1, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x007b, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x007b, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x007b, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x0035, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x0035, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x0035, 0x0004, 0x0004, 0x0000, 0x005f, 0x006e, 0x00fe, 0x00ff, 0x00ff, 0x0015, 0x0046, 0x0000, 0x002e, 0x000f, 0x0004, 0x0000, 0x000b, 0x000f, 0x0042, 0x0000, 0x002e, 0x0050, 0x00fd, 0x00ff, 0x00ff, 0x0080, 0x00fd, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 79);
+
+const Image * ImageStore::GeometricIcon = &image;
@@ -0,0 +1,438 @@
+/* This file is auto-generated by the rasterizer */
+
+#include <kandinsky/font.h>
+
+static constexpr KDFont::CodePointIndexPair table[] = {
+  KDFont::CodePointIndexPair(0x20, 0),
+  KDFont::CodePointIndexPair(0xb0, 95),
+  KDFont::CodePointIndexPair(0xb7, 96),
+  KDFont::CodePointIndexPair(0xc6, 97),
+  KDFont::CodePointIndexPair(0xd0, 98),
+  KDFont::CodePointIndexPair(0xd7, 99),
+  KDFont::CodePointIndexPair(0xde, 101),
+  KDFont::CodePointIndexPair(0xe6, 103),
+  KDFont::CodePointIndexPair(0xf0, 104),
+  KDFont::CodePointIndexPair(0xf7, 105),
+  KDFont::CodePointIndexPair(0xfe, 107),
+  KDFont::CodePointIndexPair(0x300, 108),
+  KDFont::CodePointIndexPair(0x305, 112),
+  KDFont::CodePointIndexPair(0x308, 113),
+  KDFont::CodePointIndexPair(0x30a, 114),
+  KDFont::CodePointIndexPair(0x327, 115),
+  KDFont::CodePointIndexPair(0x393, 116),
+  KDFont::CodePointIndexPair(0x3a9, 118),
+  KDFont::CodePointIndexPair(0x3b8, 119),
+  KDFont::CodePointIndexPair(0x3bb, 120),
+  KDFont::CodePointIndexPair(0x3c0, 122),
+  KDFont::CodePointIndexPair(0x3c3, 123),
+  KDFont::CodePointIndexPair(0x1d07, 124),
+  KDFont::CodePointIndexPair(0x212f, 125),
+  KDFont::CodePointIndexPair(0x2192, 126),
+  KDFont::CodePointIndexPair(0x2211, 127),
+  KDFont::CodePointIndexPair(0x221a, 128),
+  KDFont::CodePointIndexPair(0x222b, 129),
+  KDFont::CodePointIndexPair(0x2248, 130),
+  KDFont::CodePointIndexPair(0x2264, 131),
+  KDFont::CodePointIndexPair(0xfffd, 133),
+  KDFont::CodePointIndexPair(0x1d422, 134),
+};
+
+static constexpr size_t tableLength = 32;
+
+static constexpr KDCoordinate glyphWidth = 7;
+
+static constexpr KDCoordinate glyphHeight = 14;
+
+static constexpr uint16_t glyphDataOffset[136] = {
+  0x0000, 0x000b, 0x0025, 0x003b, 0x005f, 0x008f, 0x00ba, 0x00e5, 0x00fb,
+  0x012c, 0x015f, 0x0181, 0x019c, 0x01b3, 0x01c5, 0x01d4, 0x0206, 0x0231,
+  0x024d, 0x0278, 0x02a3, 0x02cc, 0x02f6, 0x0321, 0x034b, 0x0376, 0x03a1,
+  0x03b4, 0x03cf, 0x03f9, 0x040c, 0x0438, 0x0461, 0x0490, 0x04ba, 0x04e4,
+  0x050e, 0x0539, 0x055b, 0x057d, 0x05a8, 0x05c9, 0x05e7, 0x0609, 0x0633,
+  0x064d, 0x0678, 0x06a3, 0x06ce, 0x06f7, 0x0727, 0x0752, 0x077d, 0x0798,
+  0x07b7, 0x07e1, 0x080c, 0x0837, 0x0860, 0x088b, 0x08a6, 0x08d6, 0x08f1,
+  0x0911, 0x0922, 0x093a, 0x095d, 0x0987, 0x09a9, 0x09d4, 0x09f7, 0x0a19,
+  0x0a42, 0x0a67, 0x0a84, 0x0aa3, 0x0acc, 0x0aea, 0x0b08, 0x0b26, 0x0b49,
+  0x0b72, 0x0b9b, 0x0bbb, 0x0bde, 0x0c01, 0x0c1f, 0x0c41, 0x0c64, 0x0c87,
+  0x0cb0, 0x0cd3, 0x0cf8, 0x0d0a, 0x0d2c, 0x0d41, 0x0d59, 0x0d69, 0x0d93,
+  0x0dbe, 0x0de4, 0x0e10, 0x0e38, 0x0e66, 0x0e89, 0x0eb7, 0x0ecd, 0x0ef0,
+  0x0f1b, 0x0f33, 0x0f4b, 0x0f63, 0x0f78, 0x0f8a, 0x0f9b, 0x0fb2, 0x0fc5,
+  0x0fde, 0x1008, 0x1032, 0x105f, 0x108d, 0x10b1, 0x10cd, 0x10f0, 0x110e,
+  0x1131, 0x1158, 0x1188, 0x11bb, 0x11de, 0x11fb, 0x1220, 0x1247, 0x1279,
+  0x129c
+};
+
+/* Rasterized  = 13230 bytes (135 glyphs x 98 pixels)
+ * Downsampled =  6615 bytes (1/2 of rasterized)
+ * Compressed  =  4764 bytes (36.01% of rasterized) */
+static constexpr uint8_t glyphData[4764] = {
+  0x1f, 0x00, 0x01, 0x00, 0x18, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0x5c, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x00, 0x16, 0x00, 0x07,
+  0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0x51, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0x07, 0x00, 0x0f, 0x01, 0x00,
+  0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xd0, 0xf0,
+  0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0x00, 0xf0, 0x0e,
+  0x00, 0x33, 0xff, 0xff, 0xff, 0x15, 0x00, 0x14, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xf1, 0x11, 0xf0, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x5e, 0xfe, 0x70, 0x0e, 0x30, 0x4b, 0x00, 0xd7, 0x00, 0x00,
+  0x01, 0xae, 0x91, 0x00, 0x00, 0x17, 0xd0, 0x0e, 0x50, 0x3e, 0x00, 0x3d, 0xfe,
+  0x60, 0x00, 0x0f, 0x25, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x7f, 0x90, 0x05, 0x9e, 0x4e, 0x02, 0xc0,
+  0x7e, 0x70, 0xc2, 0x00, 0x00, 0x95, 0x00, 0x00, 0x59, 0x00, 0x00, 0x2c, 0x08,
+  0xf8, 0x0c, 0x20, 0xf4, 0xf9, 0x50, 0x08, 0xf8, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x05, 0xee, 0x50,
+  0x00, 0xe2, 0x3e, 0x00, 0x0e, 0x14, 0xd0, 0x00, 0x9d, 0xe3, 0x00, 0x5f, 0xf7,
+  0x05, 0xbe, 0x27, 0xf5, 0xe3, 0xe3, 0x07, 0xfa, 0x02, 0xcf, 0xf9, 0xcf, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0x52,
+  0x0f, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x00, 0x0f, 0x01, 0x00, 0x06, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0xf0, 0x1c, 0x90, 0x00, 0x00,
+  0xbb, 0x10, 0x00, 0x5d, 0x00, 0x00, 0x0a, 0x50, 0x00, 0x00, 0xe1, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x0b, 0x40, 0x00, 0x00, 0x6a, 0x00,
+  0x00, 0x00, 0xd8, 0x00, 0x00, 0x02, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x0b, 0xa0, 0x00,
+  0x00, 0x0d, 0x40, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x01, 0xd0, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x0a, 0x70, 0x00, 0x08,
+  0xd0, 0x00, 0x01, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x01, 0x00, 0xf8, 0x05, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf8,
+  0xf7, 0xf0, 0x02, 0xaf, 0xa2, 0x00, 0x6f, 0x8e, 0x60, 0x0f, 0x70, 0x6f, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x90,
+  0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0x07, 0x00, 0x2a, 0x00,
+  0x0f, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x0d, 0xf0, 0x01, 0xfc, 0x00, 0x00, 0x02, 0xe0, 0x00, 0x01, 0xb5, 0x00, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x01, 0x3f, 0x0f,
+  0xff, 0xff, 0x17, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x0d, 0x16, 0xf0, 0x0b, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x01, 0x00, 0xf0, 0x1d, 0x02, 0xf1, 0x00, 0x00, 0x8b, 0x00, 0x00,
+  0x0e, 0x60, 0x00, 0x04, 0xf0, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x0f, 0x40, 0x00,
+  0x05, 0xe0, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x07, 0xd0, 0x00,
+  0x00, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xf4, 0x0e, 0x03, 0xdf, 0xd3, 0x00, 0xb9, 0x05, 0xc0, 0x0e, 0x10,
+  0x0e, 0x00, 0xf0, 0xc0, 0xf0, 0x0f, 0x0c, 0x0f, 0x00, 0xe1, 0x01, 0xe0, 0x0b,
+  0x70, 0x8c, 0x00, 0x2d, 0xfd, 0x30, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0x8c, 0xff, 0x00, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0x0f, 0x07, 0x00, 0x44, 0xff, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x04, 0xdf, 0xc3,
+  0x00, 0xa4, 0x06, 0xd0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x06, 0xb0, 0x00, 0x04,
+  0xe2, 0x00, 0x05, 0xe2, 0x00, 0x07, 0xe2, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4,
+  0x0e, 0x05, 0xdf, 0xe8, 0x01, 0xe5, 0x04, 0xf0, 0x00, 0x00, 0x3f, 0x00, 0x0f,
+  0xff, 0x80, 0x00, 0x02, 0x9e, 0x00, 0x00, 0x00, 0xf0, 0x1d, 0x40, 0x5e, 0x00,
+  0x6d, 0xfd, 0x40, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x00, 0x01, 0x00, 0xf5, 0x0c, 0x04, 0xf0, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x8a,
+  0xf0, 0x00, 0x2e, 0x1f, 0x00, 0x0b, 0x50, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xf0, 0x04, 0x0f, 0xff, 0xff, 0x00, 0xf0, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x60, 0x00, 0x00, 0x5e, 0x00, 0x00,
+  0x10, 0x00, 0x64, 0x5f, 0x00, 0xff, 0xfe, 0x70, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x01, 0xbf, 0xff,
+  0x00, 0xab, 0x10, 0x00, 0x0d, 0x30, 0x00, 0x00, 0xff, 0xfe, 0x50, 0x0f, 0x00,
+  0x4e, 0x00, 0xf0, 0x00, 0xf0, 0x0d, 0x50, 0x2e, 0x00, 0x6e, 0xfe, 0x60, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf5,
+  0x0d, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x06, 0x90, 0x00, 0x01, 0xd0, 0x00, 0x00,
+  0x77, 0x00, 0x00, 0x0c, 0x20, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x00, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xf4, 0x0e, 0x07, 0xef, 0xe8, 0x00, 0xf2, 0x02, 0xf0, 0x0f, 0x00,
+  0x1f, 0x00, 0x9f, 0xff, 0xa0, 0x0e, 0x30, 0x3e, 0x00, 0xf0, 0x00, 0xf0, 0x0f,
+  0x10, 0x1f, 0x00, 0x8e, 0xfe, 0x80, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x07, 0xef, 0xe6, 0x00, 0xe3,
+  0x05, 0xe0, 0x0f, 0x00, 0x0f, 0x00, 0xe4, 0x00, 0xf0, 0x05, 0xef, 0xff, 0x00,
+  0x00, 0x03, 0xd0, 0x00, 0x01, 0xba, 0x00, 0xff, 0xfb, 0x10, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x2c, 0x0f, 0x00,
+  0x01, 0x00, 0x16, 0xf0, 0x0b, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0x00, 0x01, 0x00, 0x2c, 0x0f, 0x00, 0x01, 0x00, 0xf0, 0x01, 0xfc, 0x00, 0x00,
+  0x02, 0xe0, 0x00, 0x01, 0xb5, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x01, 0x00, 0xf0, 0x00, 0x01, 0x00, 0x00, 0x04, 0xe0, 0x00, 0x1a,
+  0xe5, 0x00, 0x5e, 0xa1, 0x00, 0x0f, 0xa0, 0x00, 0x07, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x15, 0x00, 0x00, 0x1c, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x37, 0xff, 0xff, 0xf0, 0x07, 0x00,
+  0x08, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf0, 0x06, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x05, 0xea, 0x10, 0x00,
+  0x01, 0xbe, 0x50, 0x00, 0x00, 0xaf, 0x00, 0x01, 0xae, 0x50, 0x0e, 0x00, 0x12,
+  0xe4, 0x1c, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf1, 0x09, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xfd, 0x30, 0x0c, 0x50, 0x6c,
+  0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x1d, 0x20, 0x00, 0x0a,
+  0x60, 0x0d, 0x00, 0x12, 0x00, 0x14, 0x00, 0x04, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf0, 0x1a, 0x9e, 0xf9, 0x00, 0xca,
+  0x21, 0xc8, 0x7b, 0x00, 0x03, 0xec, 0x30, 0x3c, 0xef, 0xf0, 0x0e, 0x61, 0xff,
+  0x00, 0xf2, 0x7f, 0xc4, 0x09, 0xf8, 0xf7, 0xb0, 0x00, 0x00, 0x0c, 0xa2, 0x17,
+  0xb0, 0x09, 0xef, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0xf4, 0x0d, 0x3f, 0x30, 0x00, 0x09, 0xc9, 0x00, 0x00, 0xe1, 0xe0,
+  0x00, 0x5a, 0x09, 0x60, 0x0b, 0xff, 0xfc, 0x01, 0xe0, 0x00, 0xd3, 0x78, 0x00,
+  0x08, 0x9d, 0x20, 0x00, 0x2f, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xf0, 0x06, 0x0f, 0xff, 0xd4, 0x00, 0xf0, 0x04,
+  0xe0, 0x0f, 0x00, 0x3f, 0x00, 0xff, 0xff, 0x80, 0x0f, 0x00, 0x4d, 0x00, 0xf0,
+  0x00, 0xf0, 0x07, 0x00, 0x44, 0xff, 0xfd, 0x40, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x6d, 0xfd, 0x60,
+  0x5c, 0x20, 0x45, 0x0c, 0x30, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x10, 0x00,
+  0x00, 0xc4, 0x00, 0x00, 0x05, 0xd3, 0x17, 0xa0, 0x06, 0xef, 0xc3, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e,
+  0x0f, 0xff, 0xd6, 0x00, 0xf0, 0x14, 0xe5, 0x0f, 0x00, 0x04, 0xc0, 0xf0, 0x00,
+  0x1f, 0x0f, 0x00, 0x01, 0xf0, 0xf0, 0x00, 0x5c, 0x0f, 0x00, 0x4e, 0x60, 0xff,
+  0xfc, 0x60, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xd1, 0x0f, 0xff, 0xff, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0x07, 0x00, 0x05, 0x0e, 0x00, 0x24, 0xf0, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xd1, 0x0f, 0xff,
+  0xff, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00,
+  0x24, 0xf0, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x04, 0xce, 0xff, 0x05, 0xd4, 0x00,
+  0x00, 0xc4, 0x00, 0x00, 0x0f, 0x10, 0x00, 0x00, 0xf0, 0x00, 0xff, 0x0c, 0x50,
+  0x00, 0xf0, 0x4e, 0x40, 0x0f, 0x00, 0x4c, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x70, 0x0f, 0x00, 0x0f,
+  0x00, 0xf0, 0x00, 0xf0, 0x07, 0x00, 0x36, 0xff, 0xff, 0xf0, 0x0e, 0x00, 0x00,
+  0x07, 0x00, 0x14, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xab, 0x0f, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f,
+  0x00, 0x07, 0x00, 0x44, 0xff, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xa7, 0x0f, 0xff, 0xff, 0x00, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x0f, 0x07, 0x00, 0x84, 0x09, 0x50, 0x7c, 0x00, 0x4d,
+  0xfc, 0x20, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xf0, 0x03, 0x0f, 0x00, 0x0c, 0x70, 0xf0, 0x0c, 0x70, 0x0f, 0x0c,
+  0x70, 0x00, 0xfc, 0xf3, 0x00, 0x0f, 0x76, 0xd0, 0x00, 0x0e, 0x00, 0x74, 0x00,
+  0x2e, 0x10, 0xf0, 0x00, 0x8b, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x00,
+  0x01, 0x44, 0xff, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0xfc, 0x00, 0x0d, 0xff, 0xc2, 0x03,
+  0xcf, 0xf6, 0x90, 0x96, 0xff, 0x0e, 0x1e, 0x0f, 0xf0, 0x9c, 0x90, 0xff, 0x03,
+  0xf3, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f, 0x30,
+  0x0f, 0x00, 0xfa, 0x00, 0xf0, 0x0f, 0xa2, 0x0f, 0x00, 0xf3, 0xa0, 0xf0, 0x0f,
+  0x0c, 0x2f, 0x00, 0xf0, 0x59, 0xf0, 0x0f, 0x00, 0xdf, 0x00, 0xf0, 0x07, 0xf0,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf4, 0x0e, 0x03, 0xcf, 0xd5, 0x03, 0xe4, 0x04, 0xe4, 0xb5, 0x00, 0x05, 0xbf,
+  0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x4b, 0x3e, 0x40, 0x3d,
+  0x30, 0x3c, 0xfd, 0x40, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x01, 0x00, 0xf6, 0x0c, 0x0f, 0xff, 0xfb, 0x30, 0xf0, 0x00, 0x7d,
+  0x0f, 0x00, 0x00, 0xf0, 0xf0, 0x01, 0x6c, 0x0f, 0xff, 0xeb, 0x20, 0xf0, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf0, 0x1b, 0x05, 0xdf, 0xd5, 0x04, 0xe4,
+  0x03, 0xd4, 0xc5, 0x00, 0x04, 0xcf, 0x10, 0x00, 0x0f, 0xf0, 0x00, 0x01, 0xfb,
+  0x50, 0x00, 0x4b, 0x4e, 0x51, 0x3d, 0x40, 0x5d, 0xfe, 0x50, 0x00, 0x0b, 0x50,
+  0x00, 0x00, 0x1b, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xf4, 0x0e, 0x0f, 0xff, 0xfb, 0x20, 0xf0, 0x01, 0x7b, 0x0f, 0x00,
+  0x00, 0xf0, 0xf0, 0x00, 0x6d, 0x0f, 0xff, 0xfc, 0x30, 0xf0, 0x3e, 0x00, 0x0f,
+  0x00, 0xa8, 0x00, 0xf0, 0x01, 0xe2, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x03, 0xcf, 0xd4, 0x00, 0xe5,
+  0x04, 0xc0, 0x0d, 0x50, 0x00, 0x00, 0x2c, 0xc3, 0x00, 0x00, 0x04, 0xd6, 0x00,
+  0x00, 0x02, 0xe0, 0x0c, 0x50, 0x4e, 0x00, 0x3c, 0xfd, 0x30, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xbe, 0xff, 0xff,
+  0xff, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x04, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x7a, 0x0f,
+  0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x07, 0x00, 0x84, 0x0c, 0x60, 0x6c, 0x00,
+  0x3d, 0xfd, 0x30, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xf5, 0x0d, 0x0e, 0x10, 0x1e, 0x00, 0xa4, 0x05, 0xa0, 0x07,
+  0x80, 0x86, 0x00, 0x3b, 0x0c, 0x30, 0x00, 0xe0, 0xe0, 0x00, 0x0c, 0x5c, 0x00,
+  0x00, 0x8c, 0x80, 0x00, 0x05, 0xf5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0xf0, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0x0f, 0xf0, 0x2f, 0x20, 0xff, 0x08, 0xf8, 0x0f, 0xf0, 0xe9, 0xe0, 0xff,
+  0x3e, 0x0e, 0x3f, 0xcf, 0x90, 0x9f, 0xc4, 0xf3, 0x03, 0xf5, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0xfa,
+  0x00, 0x0a, 0xf0, 0xd5, 0x05, 0xd0, 0x03, 0xe3, 0xe3, 0x00, 0x07, 0xf7, 0x00,
+  0x00, 0x7f, 0x70, 0x00, 0x3e, 0x2e, 0x30, 0x0d, 0x50, 0x4d, 0x0f, 0xa0, 0x00,
+  0xaf, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+  0x00, 0xf1, 0x09, 0x1f, 0x20, 0x3f, 0x10, 0x98, 0x09, 0x90, 0x02, 0xe0, 0xe2,
+  0x00, 0x0b, 0xab, 0x00, 0x00, 0x3f, 0x30, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f,
+  0x00, 0x07, 0x00, 0x04, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x05, 0xa0, 0x00,
+  0x01, 0xd1, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x1d, 0x10, 0x00,
+  0x0a, 0x50, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x9f, 0xff, 0xf0, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0xf0, 0x00, 0x07, 0x00, 0x07, 0x90, 0xff, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf0, 0x1b, 0x1f, 0x30, 0x00,
+  0x00, 0xb9, 0x00, 0x00, 0x04, 0xf0, 0x00, 0x00, 0x0e, 0x60, 0x00, 0x00, 0x8c,
+  0x00, 0x00, 0x01, 0xf3, 0x00, 0x00, 0x0b, 0x90, 0x00, 0x00, 0x5f, 0x00, 0x00,
+  0x00, 0xe6, 0x00, 0x00, 0x08, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x08, 0xa0, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x13, 0x00, 0x01, 0x00, 0xfe, 0x03, 0x4f, 0x70, 0x00, 0x0a, 0x6c, 0x00,
+  0x01, 0xb0, 0xb2, 0x00, 0x66, 0x07, 0x70, 0x0c, 0x10, 0x2d, 0x00, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x12, 0xb0,
+  0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x00,
+  0x20, 0x00, 0x00, 0x1e, 0x40, 0x00, 0x00, 0x3e, 0x20, 0x00, 0x00, 0x10, 0x00,
+  0x01, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00,
+  0xf5, 0x06, 0x07, 0xdf, 0xe4, 0x00, 0x42, 0x02, 0xd0, 0x04, 0xbe, 0xef, 0x00,
+  0xe6, 0x20, 0xf0, 0x0f, 0x10, 0x0f, 0x00, 0x9f, 0xff, 0xf0, 0x1e, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0x0f, 0x07, 0x00, 0xf4, 0x06, 0x6d, 0xfb, 0x10, 0xfd, 0x20, 0x8a, 0x0f, 0x10,
+  0x00, 0xe0, 0xf0, 0x00, 0x1e, 0x0f, 0xd3, 0x2b, 0x80, 0xf6, 0xee, 0x80, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf5,
+  0x05, 0x9e, 0xf9, 0x10, 0x9c, 0x21, 0x72, 0x0e, 0x10, 0x00, 0x00, 0xf1, 0x00,
+  0x00, 0x0a, 0xa1, 0x05, 0x10, 0x09, 0xef, 0xb2, 0x1d, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0x40, 0xf0, 0x00, 0x00, 0x0f, 0x07,
+  0x00, 0xf4, 0x07, 0x03, 0xcf, 0xff, 0x00, 0xc7, 0x00, 0xf0, 0x0f, 0x10, 0x0f,
+  0x00, 0xf0, 0x00, 0xf0, 0x0d, 0x60, 0x0f, 0x00, 0x4d, 0xff, 0xf0, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06,
+  0x01, 0xbf, 0xd4, 0x00, 0xb5, 0x04, 0xe0, 0x0f, 0xff, 0xff, 0x00, 0xe1, 0x00,
+  0x00, 0x0a, 0x90, 0x3e, 0x00, 0x1b, 0xfd, 0x40, 0x1e, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xc0, 0x4d, 0xff, 0x00, 0x0d, 0x50,
+  0x00, 0x00, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0x07, 0x00, 0x38, 0x00, 0x0f, 0x00,
+  0x07, 0x00, 0x04, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf0, 0x14, 0x05, 0xdf, 0xff, 0xf0, 0xe4, 0x03, 0xf0, 0x0e, 0x20,
+  0x2f, 0x00, 0x9f, 0xff, 0x90, 0x0e, 0x20, 0x00, 0x00, 0xaf, 0xff, 0xe4, 0x0e,
+  0x10, 0x02, 0xe0, 0xe3, 0x00, 0x5d, 0x05, 0xdf, 0xeb, 0x20, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x07, 0x00, 0xd3, 0xcf,
+  0xe6, 0x00, 0xf5, 0x04, 0xe0, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x07,
+  0x00, 0x14, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x01, 0x00, 0x10, 0xf0, 0x05, 0x00, 0x62, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0x0f,
+  0x0e, 0x00, 0x07, 0x07, 0x00, 0x03, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x14, 0x00, 0x01, 0x00, 0x10, 0xa0, 0x05, 0x00, 0x9c, 0x0f, 0xff, 0xf0,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0xa0, 0x30, 0x8c, 0x00, 0x0b,
+  0xfc, 0x20, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0x0f, 0x07, 0x00, 0xf4, 0x05, 0x7f, 0x00, 0xf0, 0x6e, 0x20, 0x0f, 0x5f,
+  0x70, 0x00, 0xfe, 0x6e, 0x30, 0x0f, 0x30, 0x5e, 0x10, 0xf0, 0x00, 0x7f, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x64, 0x31, 0x10,
+  0x00, 0x7f, 0xe5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0x00, 0x01, 0x00, 0xe3, 0xfb, 0xe7, 0xbe, 0x6f, 0x62, 0xf6, 0x2f, 0xf0, 0x0f,
+  0x00, 0xff, 0x00, 0xf0, 0x0f, 0x07, 0x00, 0x05, 0x1e, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xe3, 0x0f, 0x7f, 0xe5, 0x00, 0xfa,
+  0x04, 0xe0, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x07, 0x00, 0x05, 0x1e,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06,
+  0x02, 0xcf, 0xc2, 0x00, 0xb7, 0x07, 0xb0, 0x0e, 0x00, 0x1e, 0x00, 0xf1, 0x01,
+  0xf0, 0x0b, 0x90, 0x8b, 0x00, 0x1b, 0xfc, 0x20, 0x1e, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf0, 0x14, 0x0f, 0xff, 0xd4, 0x00,
+  0xf0, 0x05, 0xd0, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x01, 0xf0, 0x0f, 0x00, 0x7c,
+  0x00, 0xff, 0xfc, 0x20, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf0, 0x14, 0x04, 0xdf,
+  0xff, 0x00, 0xd5, 0x00, 0xf0, 0x0f, 0x00, 0x0f, 0x00, 0xf1, 0x00, 0xf0, 0x0c,
+  0x80, 0x0f, 0x00, 0x2c, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf2, 0x00,
+  0xf7, 0xef, 0x70, 0x0f, 0xc1, 0x11, 0x00, 0xf1, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x00, 0xf0, 0x07, 0x00, 0x04, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x05, 0xdf, 0xd5, 0x00, 0xf3, 0x03, 0x70,
+  0x09, 0xb7, 0x30, 0x00, 0x02, 0x6b, 0xa0, 0x07, 0x40, 0x2f, 0x00, 0x4b, 0xfe,
+  0x70, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00,
+  0xb5, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0f, 0x0e,
+  0x00, 0x84, 0x00, 0xe4, 0x02, 0x00, 0x04, 0xdf, 0xd2, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0x73, 0x0f, 0x00, 0x0f,
+  0x00, 0xf0, 0x00, 0xf0, 0x07, 0x00, 0x75, 0x0e, 0x40, 0xaf, 0x00, 0x5e, 0xf7,
+  0xf0, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00,
+  0xf6, 0x05, 0x1f, 0x20, 0x2f, 0x10, 0xb7, 0x08, 0xb0, 0x05, 0xc0, 0xd5, 0x00,
+  0x0e, 0x5e, 0x00, 0x00, 0x9e, 0x90, 0x00, 0x03, 0xf3, 0x1e, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0xf0, 0x2f, 0x10,
+  0xff, 0x06, 0xf6, 0x1f, 0xf0, 0xab, 0xa3, 0xff, 0x2e, 0x4d, 0x4f, 0xf6, 0xf0,
+  0xc7, 0xf8, 0xfb, 0x08, 0xf7, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x0d, 0x50, 0x4d, 0x00, 0x3d, 0x1d, 0x30,
+  0x00, 0x7e, 0x70, 0x00, 0x07, 0xe7, 0x00, 0x03, 0xd1, 0xd2, 0x00, 0xd4, 0x05,
+  0xc0, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00,
+  0xf0, 0x14, 0xf5, 0x00, 0x06, 0xf5, 0xd0, 0x00, 0xd7, 0x0c, 0x50, 0x4e, 0x00,
+  0x4d, 0x0b, 0x80, 0x00, 0xb8, 0xf1, 0x00, 0x02, 0xf8, 0x00, 0x00, 0x1f, 0x10,
+  0x03, 0x1a, 0x80, 0x00, 0x8f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf5, 0x06, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0c, 0x70, 0x00, 0x0b,
+  0x90, 0x00, 0x0a, 0xb0, 0x00, 0x08, 0xc0, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x1e,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xc1, 0x9e,
+  0xf0, 0x00, 0x0f, 0x20, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x07, 0x00,
+  0x28, 0xfd, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x90, 0x9f, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x4f, 0xf0, 0x00, 0x00,
+  0x0f, 0x07, 0x00, 0x10, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0xd6, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0xf9, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x07, 0x00,
+  0x18, 0xcf, 0x0e, 0x00, 0xd0, 0x02, 0xf0, 0x00, 0x0f, 0xf9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x8e, 0x4e, 0x91, 0x60,
+  0x06, 0x17, 0xe8, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xef, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x80, 0x00, 0x0f, 0x3f, 0x00, 0x00, 0x9f,
+  0xa0, 0x00, 0x01, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x01, 0x00, 0x2f, 0xf0, 0x00, 0x01, 0x00, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x0d, 0xff, 0xf0, 0x03, 0xcf, 0x00,
+  0x00, 0xa5, 0xf0, 0x00, 0x1e, 0x0f, 0xf0, 0x08, 0x70, 0xf0, 0x00, 0xef, 0xff,
+  0x00, 0x5b, 0x00, 0xf0, 0x0c, 0x30, 0x0f, 0xff, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f, 0xff, 0xc5,
+  0x00, 0xf0, 0x04, 0xe4, 0x0f, 0x00, 0x05, 0xcf, 0xff, 0xd0, 0x1e, 0x0f, 0x00,
+  0x01, 0xe0, 0xf0, 0x00, 0x5b, 0x0f, 0x00, 0x4e, 0x30, 0xff, 0xfc, 0x40, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf5,
+  0x09, 0x10, 0x00, 0x20, 0x2e, 0x30, 0x5f, 0x10, 0x5e, 0x8f, 0x30, 0x00, 0x8f,
+  0x70, 0x00, 0x5e, 0x8f, 0x30, 0x2f, 0x30, 0x5e, 0x10, 0x10, 0x00, 0x20, 0x21,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0xf4, 0x0f,
+  0x01, 0x04, 0xcf, 0xa5, 0xd3, 0xe4, 0x04, 0xf4, 0xb5, 0x00, 0xd8, 0xbf, 0x00,
+  0x98, 0x0f, 0xf1, 0x5c, 0x01, 0xfd, 0x7d, 0x10, 0x7b, 0x8f, 0x60, 0x6f, 0x3f,
+  0x7b, 0xfd, 0x40, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xf0, 0x06, 0x0f, 0x00, 0x00, 0x00, 0xff, 0xfd, 0x40, 0x0f,
+  0x00, 0x6d, 0x00, 0xf0, 0x00, 0xf0, 0x0f, 0x00, 0x7c, 0x00, 0xff, 0xfc, 0x30,
+  0x15, 0x00, 0x26, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xf7, 0x00, 0x0d, 0x33, 0xf0, 0x00,
+  0xf0, 0x2d, 0x00, 0x0f, 0x09, 0x50, 0x00, 0xf0, 0xe3, 0x00, 0x0f, 0x06, 0xd3,
+  0x00, 0xf0, 0x02, 0xb6, 0x0f, 0x03, 0x02, 0xf0, 0xf1, 0xbf, 0xf8, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06,
+  0x7e, 0xe2, 0x9e, 0x62, 0x14, 0xd7, 0x2e, 0x07, 0xdf, 0x10, 0xf9, 0x71, 0xff,
+  0xff, 0xf1, 0x0f, 0x30, 0x18, 0xfd, 0x4a, 0xfb, 0x1e, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf4, 0x15, 0x00, 0x02, 0x00, 0x00, 0x00, 0x36, 0x60, 0x00,
+  0x05, 0x56, 0x00, 0x00, 0x00, 0x92, 0x01, 0xaf, 0xc6, 0x90, 0xaa, 0x11, 0x7e,
+  0x0f, 0x10, 0x00, 0xf0, 0xe1, 0x00, 0x2e, 0x08, 0xb1, 0x1b, 0x80, 0x09, 0xef,
+  0x90, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01,
+  0x00, 0x12, 0x0f, 0x06, 0x00, 0x27, 0xff, 0xff, 0x0e, 0x00, 0x05, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x01,
+  0xbf, 0xc2, 0x90, 0xba, 0x20, 0x51, 0x0f, 0x10, 0x11, 0xc0, 0xc1, 0x10, 0x1f,
+  0x01, 0x50, 0x2a, 0xb0, 0x92, 0xbf, 0xb1, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x07, 0x00,
+  0xf3, 0x05, 0x3e, 0xd3, 0x00, 0xf5, 0x07, 0xc0, 0x0f, 0x00, 0x0f, 0x00, 0xf0,
+  0x01, 0xf0, 0x0f, 0x40, 0xaa, 0x00, 0xf4, 0xec, 0x10, 0x1c, 0x00, 0x70, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x00, 0x20, 0x00, 0x00, 0x3e, 0x20,
+  0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x0b, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x10, 0x00, 0x00, 0x4e, 0x00, 0x00,
+  0x2e, 0x30, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf6, 0x00, 0x03, 0xe3, 0xe2,
+  0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x62, 0xf0, 0x0f, 0x19, 0xfa, 0x00, 0x01,
+  0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x4f,
+  0x0f, 0xff, 0xff, 0x00, 0x01, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x01, 0x00, 0x3f, 0xf0, 0xf0, 0x00, 0x01, 0x00, 0x0e, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xa0, 0x00, 0x00,
+  0xb1, 0x10, 0x07, 0x00, 0x0f, 0x01, 0x00, 0x0a, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x10, 0xd0, 0x0f, 0x00, 0x00, 0x00, 0x6e, 0x00,
+  0x00, 0xfd, 0x60, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0x9e, 0xff,
+  0xff, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x06,
+  0x00, 0x00, 0x01, 0xf1, 0x00, 0x00, 0x7e, 0x70, 0x00, 0x0d, 0x5d, 0x00, 0x03,
+  0xc0, 0xc3, 0x00, 0x97, 0x07, 0x90, 0x0e, 0x10, 0x1e, 0x05, 0xff, 0xff, 0xf5,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00,
+  0xf4, 0x0d, 0xaf, 0x80, 0x00, 0x79, 0x09, 0x50, 0x0c, 0x20, 0x3b, 0x00, 0xe0,
+  0x02, 0xe0, 0x0e, 0x00, 0x2e, 0x00, 0xa3, 0x05, 0xa0, 0x03, 0xa0, 0xb1, 0x00,
+  0xff, 0x1f, 0xd0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfb, 0x00, 0x09, 0x92, 0xb7, 0x00, 0xe1,
+  0x04, 0xc0, 0x0f, 0x00, 0x3e, 0x01, 0xfe, 0xee, 0xf0, 0x1f, 0x11, 0x4e, 0x00,
+  0xf1, 0x04, 0xc0, 0x0a, 0x93, 0xb8, 0x00, 0x1c, 0xfb, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x00, 0x00, 0x00, 0x08, 0xfa, 0x00,
+  0x00, 0x12, 0xc5, 0x00, 0x00, 0x03, 0xd0, 0x00, 0x00, 0x2f, 0x50, 0x00, 0x09,
+  0xad, 0x00, 0x00, 0xe1, 0xc4, 0x00, 0x5c, 0x04, 0xc0, 0x0b, 0x70, 0x0d, 0x41,
+  0xf2, 0x00, 0x6c, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0x00, 0x01, 0x00, 0x74, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x07, 0x00,
+  0xf0, 0x05, 0x20, 0x0f, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00,
+  0xb5, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0xf0, 0x0f, 0x00, 0x0f, 0x00, 0x07,
+  0x00, 0x15, 0xcf, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf5, 0x06, 0x03, 0xdf, 0xff, 0xf0, 0xc6, 0x06, 0xc0, 0x0f, 0x00,
+  0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x0d, 0x40, 0x5c, 0x00, 0x3c, 0xfc, 0x30, 0x1e,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x40, 0xff,
+  0xff, 0x00, 0x0f, 0x07, 0x00, 0x11, 0xf0, 0x07, 0x00, 0x65, 0xf0, 0x00, 0x00,
+  0x0f, 0xff, 0xf0, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf5, 0x06, 0x07, 0xcc, 0x81, 0x08, 0xa1, 0x17, 0xd0, 0xe2, 0x38,
+  0xc9, 0x0e, 0xea, 0x40, 0x00, 0x5e, 0x31, 0x6e, 0x30, 0x5d, 0xfc, 0x30, 0x1e,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0x81, 0x02,
+  0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x07, 0x04, 0x00, 0x70, 0xff, 0xff, 0xff,
+  0xf0, 0x00, 0x07, 0xf8, 0x03, 0x00, 0x53, 0x02, 0xf8, 0x00, 0x00, 0x03, 0x24,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf0, 0x1b,
+  0x0f, 0xff, 0xff, 0x00, 0x96, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x02, 0xc0,
+  0x00, 0x00, 0x05, 0xa0, 0x00, 0x00, 0x79, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x0c,
+  0x20, 0x00, 0x0a, 0x50, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x0d, 0xf0, 0x00, 0x01, 0xd0, 0x00,
+  0x00, 0x4a, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0xa3, 0x01, 0x40, 0x0d, 0x00,
+  0xaf, 0x00, 0xb0, 0x00, 0xc4, 0x38, 0x00, 0x06, 0x97, 0x50, 0x00, 0x1e, 0xb1,
+  0x00, 0x00, 0xce, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xcb, 0xbf, 0xf0, 0x00, 0x0f, 0x0f, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x51, 0xf1, 0xf0, 0x00, 0x0f,
+  0xfc, 0x25, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0x70, 0x07, 0xe9, 0x1f, 0x00, 0xe1, 0x7f, 0xa0, 0x0b, 0x00, 0x69,
+  0x7f, 0x92, 0xf0, 0x0e, 0x17, 0xea, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x14, 0x00, 0x01, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x5d, 0xd0, 0x04, 0xcd,
+  0x50, 0x00, 0xfa, 0x00, 0x00, 0x07, 0x00, 0x30, 0x00, 0x5d, 0xd0, 0x15, 0x00,
+  0x35, 0xff, 0xff, 0xf0, 0x23, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xe0, 0x06, 0x00, 0x00, 0x00, 0xdd, 0x50, 0x00, 0x00, 0x5d,
+  0xc4, 0x00, 0x00, 0x0a, 0xf0, 0x07, 0x00, 0x21, 0xdd, 0x50, 0x15, 0x00, 0x44,
+  0xff, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
+  0x13, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x02, 0xff, 0xfb, 0x70, 0x8b, 0xff, 0x2c,
+  0x0d, 0x2f, 0xf0, 0x95, 0x90, 0xff, 0x02, 0xf2, 0x0f, 0xf0, 0x8a, 0x80, 0xff,
+  0x2e, 0x0e, 0x2f, 0xfb, 0x90, 0x9b, 0xff, 0xf3, 0x03, 0x22, 0x00, 0xb0, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01,
+  0x00, 0x11, 0x0f, 0x06, 0x00, 0x62, 0x01, 0xdf, 0x00, 0x01, 0xd7, 0xf0, 0x0e,
+  0x00, 0x00, 0x07, 0x00, 0x64, 0x8e, 0x20, 0x00, 0xfd, 0x10, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const KDFont KDFont::privateSmallFont(tableLength, table, glyphWidth, glyphHeight, glyphDataOffset, glyphData);
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "exam_icon.h"
+
+// Compressed 162 pixels into 175 bytes (54.01% compression ratio)/
+const uint8_t compressedPixelData[175] = {0x0028, 0x00a6, 0x00fd, 0x0002, 0x0000, 0x00dd, 0x00e8, 0x00fd, 0x00b1, 0x00fe, 0x009a, 0x00ff, 0x009b, 0x00ff, 0x00b1, 0x00fe, 0x00e8, 0x00fd, 0x00a6, 0x0002, 0x0000, 0x0068, 0x00c7, 0x00fd, 0x006e, 0x00fe, 0x0058, 0x00ff, 0x0001, 0x0000, 0x0055, 0x0058, 0x00ff, 0x006e, 0x00fe, 0x00c7, 0x0020, 0x0000, 0x006f, 0x002b, 0x00fe, 0x00f4, 0x00fe, 0x00dd, 0x00ff, 0x0001, 0x0000, 0x0001, 0x0060, 0x00dd, 0x00ff, 0x00f4, 0x00fe, 0x002b, 0x00fe, 0x0042, 0x0000, 0x000f, 0x0024, 0x0000, 0x000f, 0x006f, 0x00b1, 0x00fe, 0x00bc, 0x00ff, 0x006d, 0x00fe, 0x006c, 0x0000, 0x0009, 0x0031, 0x00c6, 0x00fd, 0x00bc, 0x0010, 0x0000, 0x0060, 0x00a6, 0x00fd, 0x0079, 0x00ff, 0x002c, 0x00fe, 0x00b4, 0x0000, 0x0013, 0x009b, 0x00b4, 0x0000, 0x0042, 0x00c6, 0x00fd, 0x00d3, 0x00fe, 0x008c, 0x0000, 0x0020, 0x006e, 0x00fe, 0x0034, 0x0000, 0x00f2, 0x0009, 0x000a, 0x00fe, 0x00a6, 0x00fd, 0x0015, 0x00ff, 0x00ff, 0x00ff, 0x007a, 0x00ff, 0x0090, 0x00fe, 0x0009, 0x00fe, 0x00c6, 0x00fd, 0x000a, 0x00fe, 0x00b2, 0x00fe, 0x00bc, 0x00ff, 0x0015, 0x00ff, 0x0024, 0x0000, 0x0053, 0x00e9, 0x00fd, 0x00e9, 0x00fd, 0x00f3, 0x0030, 0x0000, 0x0028, 0x00f4, 0x00fe, 0x006c, 0x0000, 0x002a, 0x0015, 0x00ff, 0x00f8, 0x0000, 0x0004, 0x000a, 0x0000, 0x00f0, 0x0007, 0x004c, 0x00fe, 0x0058, 0x00ff, 0x00de, 0x00ff, 0x00de, 0x00ff, 0x0079, 0x00ff, 0x004d, 0x00fe, 0x00a6, 0x00fd, 0x00a6, 0x00fd, 0x00a6, 0x00fd, 0x00a6, 0x00fd, 0x00a6, 0x00fd, 
+};
+
+constexpr Image image = Image(18, 9, compressedPixelData, 175);
+
+const Image * ImageStore::ExamIcon = &image;
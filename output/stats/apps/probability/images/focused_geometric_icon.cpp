@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_geometric_icon.h"
+
+// Compressed 665 pixels into 81 bytes (6.09% compression ratio)/
+const uint8_t compressedPixelData[81] = {0x002f, 0x00bc, 0x00d6, 0x0002, 0x0000, 0x0031, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x00c1, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x00c1, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x007b, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x007b, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x007b, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x0035, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x0035, 0x002f, 0x0080, 0x00fd, 0x0046, 0x0000, 0x0035, 0x0004, 0x0004, 0x0000, 0x006f, 0x0095, 0x00ee, 0x00bc, 0x00d6, 0x00db, 0x00de, 0x0046, 0x0000, 0x002d, 0x000f, 0x0004, 0x0000, 0x000b, 0x000f, 0x0042, 0x0000, 0x002e, 0x0050, 0x00fd, 0x00bc, 0x00d6, 0x0080, 0x00fd, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 81);
+
+const Image * ImageStore::FocusedGeometricIcon = &image;
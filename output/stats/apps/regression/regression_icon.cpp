@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "regression_icon.h"
+
+// Compressed 3080 pixels into 790 bytes (12.82% compression ratio)/
+const uint8_t compressedPixelData[790] = {0x0019, 0x00ff, 0x0001, 0x0000, 0x004f, 0x00df, 0x00ff, 0x00be, 0x00f7, 0x0002, 0x0000, 0x0039, 0x002f, 0x00df, 0x00ff, 0x0001, 0x0000, 0x0005, 0x002f, 0x00be, 0x00f7, 0x0002, 0x0000, 0x0045, 0x002f, 0x00ff, 0x00ff, 0x00d4, 0x0000, 0x004b, 0x000e, 0x00e4, 0x0000, 0x000f, 0x006c, 0x0000, 0x0057, 0x000a, 0x0070, 0x0000, 0x000f, 0x005e, 0x0000, 0x0041, 0x001e, 0x009e, 0x0050, 0x0001, 0x000f, 0x006c, 0x0000, 0x0046, 0x004e, 0x007a, 0x00ce, 0x0016, 0x009d, 0x00c0, 0x0001, 0x000f, 0x0046, 0x0001, 0x0043, 0x006f, 0x00fc, 0x00de, 0x00b4, 0x008c, 0x00db, 0x00d6, 0x006e, 0x0000, 0x0011, 0x002f, 0x00ab, 0x0052, 0x006c, 0x0000, 0x002d, 0x006f, 0x007d, 0x00ef, 0x00f5, 0x0094, 0x0019, 0x00be, 0x00bc, 0x0001, 0x0003, 0x000c, 0x0012, 0x0000, 0x002f, 0x0008, 0x0042, 0x006e, 0x0000, 0x002d, 0x004f, 0x0057, 0x00a5, 0x0077, 0x00ad, 0x002c, 0x0000, 0x0015, 0x000f, 0x006e, 0x0000, 0x002d, 0x006f, 0x0019, 0x00be, 0x00f5, 0x009c, 0x007d, 0x00ef, 0x006e, 0x0000, 0x0053, 0x008f, 0x00bb, 0x00d6, 0x00b4, 0x008c, 0x001c, 0x00e7, 0x00be, 0x00f7, 0x006e, 0x0000, 0x0051, 0x008f, 0x003d, 0x00e7, 0x00b5, 0x0094, 0x007a, 0x00ce, 0x00be, 0x00f7, 0x006e, 0x0000, 0x0051, 0x008f, 0x009e, 0x00f7, 0x0016, 0x009d, 0x00b8, 0x00b5, 0x00be, 0x00f7, 0x006e, 0x0000, 0x0053, 0x006f, 0x00b8, 0x00b5, 0x0036, 0x00a5, 0x009e, 0x00f7, 0x006e, 0x0000, 0x0053, 0x0057, 0x005a, 0x00c6, 0x00d5, 0x0094, 0x005d, 0x001e, 0x0002, 0x00af, 0x0016, 0x00ff, 0x000a, 0x00fe, 0x00c7, 0x00fd, 0x000a, 0x00fe, 0x0016, 0x00ff, 0x006e, 0x0000, 0x003f, 0x000c, 0x00d0, 0x0003, 0x0044, 0x0016, 0x00ff, 0x00a6, 0x00fd, 0x0002, 0x0000, 0x002f, 0x0016, 0x00ff, 0x006e, 0x0000, 0x003b, 0x0000, 0x00d0, 0x0003, 0x0028, 0x0039, 0x00c6, 0x0012, 0x0000, 0x0026, 0x000a, 0x00fe, 0x006e, 0x0000, 0x002f, 0x000a, 0x00fe, 0x006e, 0x0000, 0x003b, 0x001d, 0x0056, 0x00d0, 0x0003, 0x0026, 0x00c7, 0x00fd, 0x006e, 0x0000, 0x0028, 0x00c7, 0x00fd, 0x0098, 0x0000, 0x000a, 0x0002, 0x0000, 0x004f, 0x0008, 0x0042, 0x007d, 0x00ef, 0x0002, 0x0000, 0x001b, 0x006a, 0x00d8, 0x00b5, 0x00f5, 0x009c, 0x003c, 0x00e7, 0x0014, 0x0000, 0x000a, 0x00dc, 0x0000, 0x000e, 0x003c, 0x0000, 0x000f, 0x006e, 0x0000, 0x0025, 0x006c, 0x007a, 0x00ce, 0x00b4, 0x008c, 0x00db, 0x00de, 0x0016, 0x0000, 0x0017, 0x0037, 0x00b8, 0x0001, 0x002f, 0x0037, 0x00ff, 0x006e, 0x0000, 0x0035, 0x006e, 0x00fc, 0x00de, 0x00b4, 0x0094, 0x005a, 0x00c6, 0x0018, 0x0000, 0x0033, 0x009e, 0x00f7, 0x0037, 0x0094, 0x0002, 0x004f, 0x0037, 0x00ff, 0x009e, 0x00f7, 0x006e, 0x0000, 0x0033, 0x006f, 0x003d, 0x00e7, 0x0015, 0x009d, 0x00b8, 0x00b5, 0x001c, 0x0000, 0x0003, 0x0013, 0x009e, 0x003e, 0x0007, 0x000f, 0x006c, 0x0000, 0x0009, 0x000a, 0x006e, 0x0000, 0x0022, 0x00d5, 0x00f6, 0x00a0, 0x0000, 0x002f, 0x00d5, 0x00f6, 0x002c, 0x0000, 0x0003, 0x005f, 0x0077, 0x00ad, 0x0036, 0x00a5, 0x005d, 0x00e6, 0x0001, 0x001c, 0x000e, 0x006e, 0x0000, 0x0004, 0x006c, 0x0000, 0x0006, 0x007c, 0x0001, 0x000f, 0x0070, 0x0000, 0x0001, 0x007f, 0x0039, 0x00c6, 0x00d5, 0x0094, 0x001c, 0x00e7, 0x007d, 0x006e, 0x0000, 0x0034, 0x000f, 0x0058, 0x0002, 0x000b, 0x008f, 0x00bb, 0x00d6, 0x0094, 0x008c, 0x00bb, 0x00d6, 0x007d, 0x00ef, 0x006e, 0x0000, 0x0035, 0x000a, 0x0034, 0x0003, 0x000a, 0x0026, 0x0000, 0x006e, 0x001c, 0x00e7, 0x00d5, 0x0094, 0x0019, 0x00be, 0x006c, 0x0000, 0x000f, 0x00dc, 0x0000, 0x0041, 0x008f, 0x005d, 0x00ef, 0x0036, 0x00a5, 0x0077, 0x00ad, 0x007d, 0x00ef, 0x006e, 0x0000, 0x0039, 0x000e, 0x0034, 0x0003, 0x0008, 0x00d0, 0x0003, 0x002f, 0x003d, 0x00e7, 0x006e, 0x0000, 0x003b, 0x000e, 0x0034, 0x0003, 0x0006, 0x00d0, 0x0003, 0x001d, 0x00fb, 0x00d0, 0x0003, 0x000f, 0x006e, 0x0000, 0x002d, 0x000f, 0x0034, 0x0003, 0x0003, 0x0000, 0x00ee, 0x0005, 0x002f, 0x007a, 0x00ce, 0x006c, 0x0000, 0x0033, 0x000e, 0x00de, 0x0003, 0x000c, 0x00d0, 0x0003, 0x003e, 0x00f5, 0x009c, 0x00d8, 0x00d0, 0x0003, 0x000f, 0x006e, 0x0000, 0x0044, 0x000e, 0x00d0, 0x0003, 0x000f, 0x006e, 0x0000, 0x0047, 0x002e, 0x0019, 0x00be, 0x00d0, 0x0003, 0x000f, 0x006e, 0x0000, 0x0045, 0x000e, 0x00d0, 0x0003, 0x000e, 0x00e2, 0x0004, 0x000f, 0x006e, 0x0000, 0x0035, 0x0001, 0x00d0, 0x0003, 0x000e, 0x00ee, 0x0005, 0x000e, 0x00e2, 0x0004, 0x000f, 0x006e, 0x0000, 0x0030, 0x000e, 0x00d0, 0x0003, 0x000f, 0x003a, 0x0007, 0x001f, 0x0000, 0x0002, 0x0000, 0x002a, 0x00db, 0x00de, 0x0002, 0x0000, 0x004e, 0x0008, 0x0042, 0x00db, 0x00de, 0x0002, 0x0000, 0x006e, 0x0077, 0x00ad, 0x00f5, 0x0094, 0x00ba, 0x00d6, 0x001a, 0x0000, 0x0000, 0x0002, 0x0000, 0x000a, 0x00e2, 0x0004, 0x002f, 0x00db, 0x00de, 0x0002, 0x0000, 0x0019, 0x000f, 0x006e, 0x0000, 0x0001, 0x0020, 0x00f8, 0x00bd, 0x0064, 0x0003, 0x000f, 0x0032, 0x0000, 0x0005, 0x000a, 0x00dc, 0x0000, 0x000f, 0x006e, 0x0000, 0x002d, 0x006f, 0x0079, 0x00ce, 0x00b4, 0x008c, 0x0018, 0x00be, 0x0032, 0x0000, 0x0007, 0x000a, 0x00ce, 0x0009, 0x000f, 0x006e, 0x0000, 0x002b, 0x006f, 0x00ba, 0x00d6, 0x00d5, 0x0094, 0x0097, 0x00ad, 0x0032, 0x0000, 0x0009, 0x0026, 0x003c, 0x00e7, 0x00e2, 0x0004, 0x002f, 0x003c, 0x00e7, 0x006e, 0x0000, 0x002b, 0x004e, 0x0036, 0x00a5, 0x0016, 0x009d, 0x0034, 0x0000, 0x000c, 0x0070, 0x0000, 0x0011, 0x00df, 0x002c, 0x0010, 0x000f, 0x006c, 0x0000, 0x001d, 0x000c, 0x006e, 0x0000, 0x0000, 0x00a0, 0x0007, 0x002f, 0x009a, 0x00d6, 0x0044, 0x0000, 0x001d, 0x000f, 0x004a, 0x0001, 0x0029, 0x000f, 0x006c, 0x0000, 0x0047, 0x000f, 0x0002, 0x0003, 0x0005, 0x000f, 0x006e, 0x0000, 0x00ff, 0x0022, 0x003f, 0x0009, 0x0042, 0x0008, 0x0002, 0x0000, 0x0038, 0x004f, 0x008b, 0x0052, 0x00db, 0x00de, 0x0002, 0x0000, 0x0067, 0x002f, 0x00ba, 0x00d6, 0x006c, 0x0000, 0x0057, 0x002f, 0x009a, 0x00d6, 0x00dc, 0x0000, 0x005b, 0x004f, 0x00ff, 0x00ff, 0x0059, 0x00ce, 0x006a, 0x0000, 0x0053, 0x0020, 0x0038, 0x00c6, 0x0052, 0x0009, 0x001f, 0x00fb, 0x004e, 0x0001, 0x0052, 0x0042, 0x009a, 0x00d6, 0x00fb, 0x00de, 0x00c2, 0x0009, 0x004f, 0x0059, 0x00ce, 0x00ba, 0x00d6, 0x006c, 0x0000, 0x004d, 0x0026, 0x0059, 0x00ce, 0x007e, 0x0015, 0x004f, 0x0038, 0x00c6, 0x0038, 0x00c6, 0x006c, 0x0000, 0x0047, 0x004a, 0x0018, 0x00c6, 0x0038, 0x00c6, 0x005a, 0x0016, 0x006f, 0x00fb, 0x00de, 0x0055, 0x00ad, 0x0038, 0x00c6, 0x00ae, 0x0001, 0x0041, 0x0024, 0x0055, 0x00ad, 0x0044, 0x0001, 0x000a, 0x0001, 0x0000, 0x009f, 0x00db, 0x00de, 0x00d7, 0x00bd, 0x0034, 0x00a5, 0x00f3, 0x009c, 0x00d3, 0x0002, 0x0000, 0x0032, 0x0074, 0x00f3, 0x009c, 0x0034, 0x00a5, 0x00d7, 0x00bd, 0x00db, 0x006a, 0x0000, 0x0050, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(55, 56, compressedPixelData, 790);
+
+const Image * ImageStore::RegressionIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "sequence_icon.h"
+
+// Compressed 3080 pixels into 325 bytes (5.28% compression ratio)/
+const uint8_t compressedPixelData[325] = {0x0019, 0x00ff, 0x0001, 0x0000, 0x004f, 0x00df, 0x00ff, 0x00be, 0x00f7, 0x0002, 0x0000, 0x0039, 0x002f, 0x00df, 0x00ff, 0x0001, 0x0000, 0x0005, 0x002f, 0x00be, 0x00f7, 0x0002, 0x0000, 0x0045, 0x002f, 0x00ff, 0x00ff, 0x00d4, 0x0000, 0x004b, 0x000e, 0x00e4, 0x0000, 0x000f, 0x006c, 0x0000, 0x0057, 0x000a, 0x0070, 0x0000, 0x002f, 0x00be, 0x00f7, 0x0002, 0x0000, 0x0051, 0x000f, 0x006c, 0x0000, 0x0059, 0x0002, 0x0070, 0x0000, 0x001f, 0x00df, 0x006e, 0x0000, 0x006a, 0x002f, 0x00ab, 0x0052, 0x00bc, 0x0001, 0x0049, 0x000c, 0x0012, 0x0000, 0x002f, 0x0008, 0x0042, 0x00ec, 0x0000, 0x0057, 0x000f, 0x006e, 0x0000, 0x00ff, 0x00ff, 0x0053, 0x002a, 0x006f, 0x00fe, 0x0002, 0x0000, 0x000f, 0x006e, 0x0000, 0x00b9, 0x002a, 0x00a6, 0x00fd, 0x0002, 0x0000, 0x000f, 0x006e, 0x0000, 0x006d, 0x002a, 0x007d, 0x00ef, 0x0002, 0x0000, 0x004f, 0x0008, 0x0042, 0x007d, 0x00ef, 0x0002, 0x0000, 0x0025, 0x000c, 0x006e, 0x0000, 0x000e, 0x0032, 0x0000, 0x000f, 0x006e, 0x0000, 0x002b, 0x000a, 0x00a8, 0x0001, 0x000f, 0x006e, 0x0000, 0x00bb, 0x000c, 0x0060, 0x0000, 0x000f, 0x006e, 0x0000, 0x00ff, 0x0088, 0x000e, 0x0018, 0x0002, 0x000f, 0x006e, 0x0000, 0x00b7, 0x000e, 0x0060, 0x0000, 0x000f, 0x006e, 0x0000, 0x00ff, 0x0086, 0x000e, 0x0018, 0x0002, 0x000f, 0x006e, 0x0000, 0x00b7, 0x000f, 0x0060, 0x0000, 0x0019, 0x000f, 0x006e, 0x0000, 0x00e9, 0x002a, 0x00db, 0x00de, 0x0002, 0x0000, 0x002c, 0x0008, 0x0042, 0x00cc, 0x0008, 0x000f, 0x006e, 0x0000, 0x0027, 0x002e, 0x00db, 0x00de, 0x0002, 0x0000, 0x000f, 0x006e, 0x0000, 0x006b, 0x000e, 0x005e, 0x0000, 0x000f, 0x006e, 0x0000, 0x00ff, 0x00ff, 0x00ff, 0x004c, 0x003f, 0x0009, 0x0042, 0x0008, 0x0002, 0x0000, 0x0038, 0x004f, 0x008b, 0x0052, 0x00db, 0x00de, 0x0002, 0x0000, 0x0067, 0x002f, 0x00ba, 0x00d6, 0x006c, 0x0000, 0x0057, 0x002f, 0x009a, 0x00d6, 0x00dc, 0x0000, 0x005b, 0x004f, 0x00ff, 0x00ff, 0x0059, 0x00ce, 0x006a, 0x0000, 0x0053, 0x0020, 0x0038, 0x00c6, 0x00c4, 0x0013, 0x001f, 0x00fb, 0x004e, 0x0001, 0x0052, 0x0042, 0x009a, 0x00d6, 0x00fb, 0x00de, 0x0034, 0x0014, 0x004f, 0x0059, 0x00ce, 0x00ba, 0x00d6, 0x006c, 0x0000, 0x004d, 0x0026, 0x0059, 0x00ce, 0x007e, 0x0015, 0x004f, 0x0038, 0x00c6, 0x0038, 0x00c6, 0x006c, 0x0000, 0x0047, 0x004a, 0x0018, 0x00c6, 0x0038, 0x00c6, 0x005a, 0x0016, 0x006f, 0x00fb, 0x00de, 0x0055, 0x00ad, 0x0038, 0x00c6, 0x00ae, 0x0001, 0x0041, 0x0024, 0x0055, 0x00ad, 0x0044, 0x0001, 0x000a, 0x0001, 0x0000, 0x009f, 0x00db, 0x00de, 0x00d7, 0x00bd, 0x0034, 0x00a5, 0x00f3, 0x009c, 0x00d3, 0x0002, 0x0000, 0x0032, 0x0074, 0x00f3, 0x009c, 0x0034, 0x00a5, 0x00d7, 0x00bd, 0x00db, 0x006a, 0x0000, 0x0050, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(55, 56, compressedPixelData, 325);
+
+const Image * ImageStore::SequenceIcon = &image;